@@ -7,7 +7,6 @@
 
 #include <iostream>
 #include <memory>
-#include <chrono>
 
 void ResizeCallback(int w, int h) {
     VE::GEngine()->GetDevice()->SetViewport(0, 0, w, h);
@@ -28,7 +27,7 @@ int main() {
 
     // Set up the camera's projection matrix  
     cam.SetPerspective(45.0f, (float)width / (float)height, 0.001f, 100.0f);
-    cam.MovementSpeed = 0.01f;
+    cam.MovementSpeed = 2.0f; // units per second
 
     RenderPath->SetCamera(&cam);
 
@@ -256,56 +255,24 @@ int main() {
     material.SetFloat("uRoughness", 0.5f); // Reduced from 1.0 - let texture control roughness
     material.SetFloat("uAO", 1.0f);
     
-    // Lighting setup - 4 point lights
-    VE::Math::VVector3 lightPositions[4] = {
-        VE::Math::VVector3(2.0f, 2.0f, 2.0f),
-    };
+    // Lighting setup - pushed into the frame packet every frame, the forward pass uploads uLightPositions/uLightColors
+    VE::Internal::Graphics::VPointLightData pointLight{};
+    pointLight.position = VE::Math::VVector3(2.0f, 2.0f, 2.0f);
+    pointLight.diffuse  = VE::Math::VVector3(5.0f, 5.0f, 5.0f);    // Much lower intensity
     
-    VE::Math::VVector3 lightColors[4] = {
-        VE::Math::VVector3(5.0f, 5.0f, 5.0f),    // Much lower intensity
-    };
-    
-    // Set light uniforms
-    for (int i = 0; i < 4; i++) {
-        material.SetVector("uLightPositions[" + std::to_string(i) + "]", lightPositions[i]);
-        material.SetVector("uLightColors[" + std::to_string(i) + "]", lightColors[i]);
-    }
-    material.SetInt("uNumLights", 4);
-    
-    auto tStart = std::chrono::high_resolution_clock::now();
-    auto lastFrameTime = tStart;
-    
-    // FPS calculation variables
-    float frameTime = 0.0f;
-    float fps = 0.0f;
-    int frameCount = 0;
-    float fpsUpdateTimer = 0.0f;
-    const float fpsUpdateInterval = 0.5f; // Update FPS display every 0.5 seconds
-
     bool GameMode = true;
 
     inputDevice->SetMouseCursorState(!GameMode);
 
-    while (!window->shouldWindowClose()) {
-        VE::GEngine()->Update();
+    // Simulation state of the last two ticks, rendering interpolates between them
+    float yawDeg = 0.0f;
+    float previousYawDeg = 0.0f;
 
+    VE::VFrameLoop* frameLoop = VE::GEngine()->GetFrameLoop();
+
+    // VEngine::Update() already ran as the first PreUpdate hook
+    frameLoop->AddHook(VE::EFramePhase::PreUpdate, [&](const VE::VFrameTime&) {
         window->pollEvents();
-        auto tNow = std::chrono::high_resolution_clock::now();
-        float time = std::chrono::duration<float>(tNow - tStart).count();
-        
-        // Calculate frame time and FPS
-        frameTime = std::chrono::duration<float>(tNow - lastFrameTime).count();
-        lastFrameTime = tNow;
-        
-        frameCount++;
-        fpsUpdateTimer += frameTime;
-        
-        // Update FPS every fpsUpdateInterval seconds
-        if (fpsUpdateTimer >= fpsUpdateInterval) {
-            fps = frameCount / fpsUpdateTimer;
-            frameCount = 0;
-            fpsUpdateTimer = 0.0f;
-        }
 
         if (VE::GEngine()->GetInputMngr()->WasPressed(
             static_cast<int>(VE::Input::EInputKey::KEY_TAB),
@@ -316,51 +283,58 @@ int main() {
             inputDevice->SetMouseCursorState(!GameMode);
         }
 
+        if (GameMode) {
+            auto delta = inputDevice->GetMouseDelta();
+
+            cam.InputMouse(delta.x, -delta.y);
+
+        }
+    });
+
+    frameLoop->AddHook(VE::EFramePhase::Update, [&](const VE::VFrameTime& frameTime) {
+        const float dt = static_cast<float>(frameTime.fixedDeltaSeconds);
+
         if (VE::GEngine()->GetInputMngr()->IsPressed(
             static_cast<int>(VE::Input::EInputKey::KEY_W),
             VE::Input::EInputDeviceType::Keyboard) && GameMode)
         {
-            cam.InputKey(time, VE::Graphics::ECameraMovement::CAMERA_FORWARD);
+            cam.InputKey(dt, VE::Graphics::ECameraMovement::CAMERA_FORWARD);
         }
         else if (VE::GEngine()->GetInputMngr()->IsPressed(
                 static_cast<int>(VE::Input::EInputKey::KEY_S),
                 VE::Input::EInputDeviceType::Keyboard) && GameMode)
         {
-            cam.InputKey(time, VE::Graphics::ECameraMovement::CAMERA_BACK);
+            cam.InputKey(dt, VE::Graphics::ECameraMovement::CAMERA_BACK);
         }
         else if (VE::GEngine()->GetInputMngr()->IsPressed(
                 static_cast<int>(VE::Input::EInputKey::KEY_A),
                 VE::Input::EInputDeviceType::Keyboard) && GameMode)
         {
-            cam.InputKey(time, VE::Graphics::ECameraMovement::CAMERA_LEFT);
+            cam.InputKey(dt, VE::Graphics::ECameraMovement::CAMERA_LEFT);
         }
         else if (VE::GEngine()->GetInputMngr()->IsPressed(
                 static_cast<int>(VE::Input::EInputKey::KEY_D),
                 VE::Input::EInputDeviceType::Keyboard) && GameMode)
         {
-            cam.InputKey(time, VE::Graphics::ECameraMovement::CAMERA_RIGHT);
+            cam.InputKey(dt, VE::Graphics::ECameraMovement::CAMERA_RIGHT);
         }
 
-        if (GameMode) {
-            auto delta = inputDevice->GetMouseDelta();
-
-            cam.InputMouse(delta.x, -delta.y);
-
-        }
-
-        cam.Update(time);
+        cam.Update(dt);
 
         // rotation around Y only so the cube always faces camera initially
-        float yawDeg = time * 45.0f;
-        
-        VE::Math::VMat4 model = VE::Math::VMat4::RotationYaw(yawDeg);
-        
-        // Update camera position for PBR shader
-        material.SetVector("uCameraPos", cam.Position);
+        previousYawDeg = yawDeg;
+        yawDeg += dt * 45.0f;
+    });
 
+    frameLoop->AddHook(VE::EFramePhase::Render, [&](const VE::VFrameTime& frameTime) {
+        const float alpha = static_cast<float>(frameTime.alpha);
+        VE::Math::VMat4 model = VE::Math::VMat4::RotationYaw(previousYawDeg + (yawDeg - previousYawDeg) * alpha);
+        
+        // uCameraPos comes from the camera snapshot of the frame packet, the material stays untouched per frame
         VE::GEngine()->GetDevice()->Clear(0.1f, 0.1f, 0.12f, 1.0f);
       
         RenderPath->PushRender(modelasset->GetModel().get(), &material, model);
+        RenderPath->PushPointLight(pointLight);
 
         RenderPath->Render();
 
@@ -369,10 +343,18 @@ int main() {
             VE::Internal::Integration::Imgui::NewFrame();
 
             ImGui::Begin("Performance Monitor");
-            ImGui::Text("FPS: %.1f", fps);
-            ImGui::Text("Frame Time: %.3f ms", frameTime * 1000.0f);
-            ImGui::Text("Total Time: %.2f s", time);
-            
+            ImGui::Text("FPS: %.1f", 1.0 / frameTime.smoothedDeltaSeconds);
+            ImGui::Text("Frame Time: %.3f ms", frameTime.deltaSeconds * 1000.0);
+            ImGui::Text("Simulation Time: %.2f s (%u ticks this frame)", frameTime.simulationSeconds, frameTime.ticksThisFrame);
+
+            ImGui::Separator();
+            const auto frameStats = VE::Internal::Core::Profiler::VProfiler::GetFrameStats();
+            ImGui::Text("Frame: avg %.3f ms, max %.3f ms, p99 %.3f ms", frameStats.avgMs, frameStats.maxMs, frameStats.p99Ms);
+            for (const auto &zone : VE::Internal::Core::Profiler::VProfiler::GetZoneStats())
+            {
+                ImGui::Text("%*s%s: avg %.3f ms, max %.3f ms, p99 %.3f ms", zone.depth * 2, "", zone.name, zone.avgMs, zone.maxMs, zone.p99Ms);
+            }
+
             ImGui::Separator();
             ImGui::Text("Controls:");
             ImGui::Text("TAB - Toggle Game Mode");
@@ -384,7 +366,9 @@ int main() {
         }
 
         window->swapBuffers();
-    }
+    });
+
+    frameLoop->Run([&] { return !window->shouldWindowClose(); });
 
     VE::Internal::Integration::Imgui::Destroy();
 
@@ -0,0 +1,236 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorAllocatorBenchmark - VConcurrentBlockAllocator against VBlockAllocator + std::mutex
+//
+//   VantorAllocatorBenchmark [--scenario local|handoff] [--max-threads N] [--ops N] [--batch N] [--rounds N]
+//
+// Runs 1, 4 and 16 threads (up to --max-threads), every thread does --ops allocate()/free() pairs of a
+// 64 byte object in batches of --batch live objects.
+//
+// local    every thread frees the batch it allocated, like per-thread scratch objects.
+// handoff  every thread frees the batch the previous thread allocated, like jobs that are created on one
+//          thread and finished on another. The threads meet at a barrier once per batch, in both allocators.
+//
+// ns/op is wall time * threads / operations, so flat numbers mean perfect scaling. Every configuration
+// runs --rounds times and the fastest round is printed.
+
+#include <Core/Memory/VCO_Allocator.hpp>
+#include <Core/Memory/VCO_ConcurrentAllocator.hpp>
+#include <Core/VCO_Timer.hpp>
+
+#include <algorithm>
+#include <barrier>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using VE::Internal::Core::Memory::VBlockAllocator;
+using VE::Internal::Core::Memory::VConcurrentBlockAllocator;
+
+namespace
+{
+    struct VOptions
+    {
+            bool     handoff    = false;
+            uint32_t maxThreads = 16;
+            uint32_t ops        = 1000000; // allocate()/free() pairs per thread
+            uint32_t batch      = 64;
+            uint32_t rounds     = 3;
+    };
+
+    // Size of a job: a callable, a counter pointer and a few links
+    struct VObject
+    {
+            uint64_t payload[8];
+
+            explicit VObject(uint64_t value) { payload[0] = value; }
+    };
+
+    struct VLockedBlockAllocator
+    {
+            std::mutex               lock;
+            VBlockAllocator<VObject> allocator;
+
+            VObject *allocate(uint64_t value)
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                return allocator.allocate(value);
+            }
+
+            void free(VObject *object)
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                allocator.free(object);
+            }
+    };
+
+    template <typename Allocator> double RunLocal(const VOptions &options, uint32_t threads, uint64_t &checksum)
+    {
+        Allocator                allocator;
+        std::vector<uint64_t>    sums(threads, 0);
+        std::vector<std::thread> workers;
+
+        VE::Internal::Core::VTimer timer;
+        for (uint32_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back(
+                [&, t]
+                {
+                    std::vector<VObject *> live(options.batch);
+                    uint64_t               sum = 0;
+                    for (uint32_t done = 0; done < options.ops; done += options.batch)
+                    {
+                        for (uint32_t i = 0; i < options.batch; ++i)
+                        {
+                            live[i] = allocator.allocate(done + i);
+                        }
+                        for (VObject *object : live)
+                        {
+                            sum += object->payload[0];
+                            allocator.free(object);
+                        }
+                    }
+                    sums[t] = sum;
+                });
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+        const double ms = timer.elapsed_milliseconds();
+
+        for (uint64_t sum : sums)
+        {
+            checksum += sum;
+        }
+        return ms;
+    }
+
+    template <typename Allocator> double RunHandoff(const VOptions &options, uint32_t threads, uint64_t &checksum)
+    {
+        Allocator allocator;
+
+        // Two sets of mailboxes, a thread fills its own in one set while the next thread drains it from the other
+        std::vector<std::vector<VObject *>> mailboxes(threads * 2, std::vector<VObject *>(options.batch));
+        std::vector<uint64_t>               sums(threads, 0);
+        std::barrier                        sync(static_cast<std::ptrdiff_t>(threads));
+        std::vector<std::thread>            workers;
+        const uint32_t                      batches = (options.ops + options.batch - 1) / options.batch;
+
+        VE::Internal::Core::VTimer timer;
+        for (uint32_t t = 0; t < threads; ++t)
+        {
+            workers.emplace_back(
+                [&, t]
+                {
+                    const uint32_t previous = (t + threads - 1) % threads;
+                    uint64_t       sum      = 0;
+                    for (uint32_t b = 0; b <= batches; ++b)
+                    {
+                        if (b < batches)
+                        {
+                            std::vector<VObject *> &outgoing = mailboxes[(b % 2) * threads + t];
+                            for (uint32_t i = 0; i < options.batch; ++i)
+                            {
+                                outgoing[i] = allocator.allocate(uint64_t(b) * options.batch + i);
+                            }
+                        }
+                        if (b > 0)
+                        {
+                            for (VObject *object : mailboxes[((b - 1) % 2) * threads + previous])
+                            {
+                                sum += object->payload[0];
+                                allocator.free(object);
+                            }
+                        }
+                        sync.arrive_and_wait();
+                    }
+                    sums[t] = sum;
+                });
+        }
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+        const double ms = timer.elapsed_milliseconds();
+
+        for (uint64_t sum : sums)
+        {
+            checksum += sum;
+        }
+        return ms;
+    }
+
+    template <typename Allocator> void Run(const VOptions &options, const char *name, uint32_t threads)
+    {
+        double   bestMs   = 0.0;
+        uint64_t checksum = 0;
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            const double ms = options.handoff ? RunHandoff<Allocator>(options, threads, checksum) : RunLocal<Allocator>(options, threads, checksum);
+            bestMs          = round == 0 ? ms : std::min(bestMs, ms);
+        }
+
+        const double operations = double(options.ops) * threads;
+        std::printf("%-10u %-14s %12.3f %10.2f %12.1f %20llu\n", threads, name, bestMs, bestMs * 1.0e6 * threads / operations, operations / (bestMs * 1.0e3),
+                    static_cast<unsigned long long>(checksum));
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--scenario")
+            {
+                const std::string_view scenario = argv[i + 1];
+                if (scenario != "local" && scenario != "handoff") return false;
+                options.handoff = scenario == "handoff";
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--max-threads") options.maxThreads = value;
+            else if (arg == "--ops") options.ops = value;
+            else if (arg == "--batch") options.batch = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorAllocatorBenchmark [--scenario local|handoff] [--max-threads N] [--ops N] [--batch N] [--rounds N]\n");
+        return 1;
+    }
+
+    std::printf("%s, %u ops per thread, batch %u, best of %u rounds, %u hardware threads\n\n", options.handoff ? "handoff" : "local", options.ops, options.batch,
+                options.rounds, std::thread::hardware_concurrency());
+    std::printf("%-10s %-14s %12s %10s %12s %20s\n", "threads", "allocator", "ms", "ns/op", "Mops/s", "checksum");
+
+    for (const uint32_t threads : {1u, 4u, 16u})
+    {
+        if (threads > options.maxThreads) break;
+        Run<VLockedBlockAllocator>(options, "block+mutex", threads);
+        Run<VConcurrentBlockAllocator<VObject>>(options, "concurrent", threads);
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorFrameLoopBenchmark - VFrameLoop without a window or a render device
+//
+//   VantorFrameLoopBenchmark [--bodies N] [--ticks N] [--rate N] [--seconds N]
+//
+// The simulation integrates bodies under gravity that bounce off the ground, one Update hook per
+// fixed tick. It runs twice:
+//
+//   throughput  lockstep, as many ticks as possible, reports ticks per second
+//   paced       --rate frames per second for --seconds, reports how close the frame periods and
+//               the tick count come to the target
+//
+// Both print the same kind of checksum, equal tick counts give equal checksums.
+
+#include <EngineCore/Public/VECO_FrameLoop.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct VOptions
+    {
+            uint32_t bodies  = 100000;
+            uint32_t ticks   = 2000;
+            uint32_t rate    = 60;
+            uint32_t seconds = 2;
+    };
+
+    struct VBodies
+    {
+            std::vector<float> positionY, velocityY, positionX, velocityX;
+
+            explicit VBodies(uint32_t count)
+            {
+                positionX.resize(count);
+                positionY.resize(count);
+                velocityX.resize(count);
+                velocityY.resize(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    positionX[i] = static_cast<float>(i % 1000);
+                    positionY[i] = 1.0f + static_cast<float>(i % 50);
+                    velocityX[i] = static_cast<float>(i % 7) - 3.0f;
+                    velocityY[i] = 0.0f;
+                }
+            }
+
+            void Tick(float dt)
+            {
+                const size_t count = positionY.size();
+                for (size_t i = 0; i < count; ++i)
+                {
+                    velocityY[i] -= 9.81f * dt;
+                    positionX[i] += velocityX[i] * dt;
+                    positionY[i] += velocityY[i] * dt;
+                    if (positionY[i] < 0.0f)
+                    {
+                        positionY[i] = -positionY[i];
+                        velocityY[i] = -velocityY[i] * 0.8f;
+                    }
+                }
+            }
+
+            double Checksum() const
+            {
+                double sum = 0.0;
+                for (size_t i = 0; i < positionY.size(); ++i)
+                {
+                    sum += positionX[i] + positionY[i];
+                }
+                return sum;
+            }
+    };
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg   = argv[i];
+            const uint32_t         value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--bodies") options.bodies = value;
+            else if (arg == "--ticks") options.ticks = value;
+            else if (arg == "--rate") options.rate = value;
+            else if (arg == "--seconds") options.seconds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+
+    void RunThroughput(const VOptions &options)
+    {
+        VE::VFrameLoopDesc desc;
+        desc.lockstep = true;
+        VE::VFrameLoop loop(desc);
+
+        VBodies bodies(options.bodies);
+        loop.AddHook(VE::EFramePhase::Update, [&](const VE::VFrameTime &time) { bodies.Tick(static_cast<float>(time.fixedDeltaSeconds)); });
+
+        const auto start = std::chrono::steady_clock::now();
+        loop.Run([&] { return loop.GetTime().tickIndex < options.ticks; });
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("throughput  %u ticks in %.3f s: %.0f ticks/s, %.3f ms/tick, %.1f M body updates/s, checksum %.6g\n", options.ticks, seconds,
+                    options.ticks / seconds, 1000.0 * seconds / options.ticks, options.bodies * (options.ticks / seconds) * 1.0e-6, bodies.Checksum());
+    }
+
+    void RunPaced(const VOptions &options)
+    {
+        VE::VFrameLoopDesc desc;
+        desc.targetFrameRate = options.rate;
+        VE::VFrameLoop loop(desc);
+
+        VBodies bodies(options.bodies);
+        loop.AddHook(VE::EFramePhase::Update, [&](const VE::VFrameTime &time) { bodies.Tick(static_cast<float>(time.fixedDeltaSeconds)); });
+
+        // Period between consecutive Render hooks, which is what a display would see
+        std::vector<double>                   periods;
+        std::chrono::steady_clock::time_point lastRender{};
+        loop.AddHook(VE::EFramePhase::Render, [&](const VE::VFrameTime &time) {
+            const auto now = std::chrono::steady_clock::now();
+            if (time.frameIndex > 0) periods.push_back(std::chrono::duration<double, std::milli>(now - lastRender).count());
+            lastRender = now;
+        });
+
+        const auto start = std::chrono::steady_clock::now();
+        loop.Run([&] { return std::chrono::steady_clock::now() - start < std::chrono::seconds(options.seconds); });
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        double mean = 0.0, worst = 0.0;
+        for (double period : periods)
+        {
+            mean += period;
+            worst = std::max(worst, period);
+        }
+        mean /= std::max<size_t>(periods.size(), 1);
+        double variance = 0.0;
+        for (double period : periods)
+        {
+            variance += (period - mean) * (period - mean);
+        }
+        const double deviation = std::sqrt(variance / std::max<size_t>(periods.size(), 1));
+
+        const VE::VFrameTime &time = loop.GetTime();
+        std::printf("paced       %llu frames in %.3f s at target %u fps: period mean %.3f ms (target %.3f), stddev %.3f ms, max %.3f ms\n",
+                    static_cast<unsigned long long>(time.frameIndex), seconds, options.rate, mean, 1000.0 / options.rate, deviation, worst);
+        std::printf("            %llu ticks for %.3f s of simulation (wall %.3f s), %.3f s dropped, checksum %.6g\n", static_cast<unsigned long long>(time.tickIndex),
+                    time.simulationSeconds, seconds, loop.GetDroppedSeconds(), bodies.Checksum());
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorFrameLoopBenchmark [--bodies N] [--ticks N] [--rate N] [--seconds N]\n");
+        return 1;
+    }
+
+    std::printf("%u bodies, fixed step %.4f s\n\n", options.bodies, VE::VFrameLoopDesc().fixedTimestep);
+    RunThroughput(options);
+    RunPaced(options);
+    return 0;
+}
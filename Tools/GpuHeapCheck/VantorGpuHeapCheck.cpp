@@ -0,0 +1,364 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorGpuHeapCheck - the RHI VGpuHeap suballocator on top of a VCpuBuffer
+//
+//   VantorGpuHeapCheck [--seed N] [--rounds N]
+//
+// The heap only uses the IRHIBuffer interface, so a VCpuBuffer stands in for the GPU buffer and
+// every upload can be read back through GetData(). Checks:
+//   capacity   the buffer size is rounded down to whole pages
+//   alignment  offsets are multiples of the requested alignment, also for strides that don't divide the page size
+//   contents   Allocate(data) and Write() land at the allocation offset and nowhere else
+//   bounds     writes past the allocation are rejected and leave the buffer untouched
+//   full       an allocation that doesn't fit is invalid, the heap stays usable
+//   deferred   freed ranges are only reused after UpdateDeferredRelease() passed the buffered frames
+//   random     --rounds rounds of random allocate/free with a byte pattern per live range, no range may
+//              overlap another or leave the heap, and every pattern has to survive until it is freed
+// Every failed check is printed and makes the exit code 1.
+
+#include <RHI/Common/VRHI_CpuBuffer.hpp>
+#include <RHI/Common/VRHI_GpuHeap.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <vector>
+
+using VE::Internal::RHI::VCpuBuffer;
+using VE::Internal::RHI::VGpuAllocation;
+using VE::Internal::RHI::VGpuHeap;
+
+namespace
+{
+    struct VOptions
+    {
+            uint32_t seed   = 1;
+            uint32_t rounds = 20000;
+    };
+
+    int g_Failures = 0;
+
+    void Expect(bool condition, const char *what)
+    {
+        if (!condition)
+        {
+            std::printf("  FAILED: %s\n", what);
+            g_Failures++;
+        }
+    }
+
+    std::vector<uint8_t> Pattern(uint64_t size, uint8_t seed)
+    {
+        std::vector<uint8_t> bytes(size);
+        for (uint64_t i = 0; i < size; ++i)
+        {
+            bytes[i] = static_cast<uint8_t>(seed + i * 31);
+        }
+        return bytes;
+    }
+
+    bool Matches(const VCpuBuffer &buffer, uint64_t offset, const std::vector<uint8_t> &bytes)
+    {
+        return std::memcmp(buffer.GetData() + offset, bytes.data(), bytes.size()) == 0;
+    }
+
+    void CheckCapacity()
+    {
+        std::printf("capacity\n");
+
+        auto     buffer = std::make_shared<VCpuBuffer>(10 * 256 + 100);
+        VGpuHeap heap(buffer, 256, false);
+
+        Expect(heap.GetStats().capacity == 10 * 256, "capacity is the buffer size rounded down to pages");
+        Expect(heap.GetStats().freeBytes == 10 * 256, "a new heap is completely free");
+
+        // All ten pages fit, the 100 byte tail is never handed out
+        VGpuAllocation all = heap.Allocate(10 * 256);
+        Expect(all.IsValid() && all.offset == 0, "the whole capacity can be allocated at once");
+        Expect(!heap.Allocate(1).IsValid(), "nothing is left past the last whole page");
+    }
+
+    void CheckAlignment()
+    {
+        std::printf("alignment\n");
+
+        auto     buffer = std::make_shared<VCpuBuffer>(64 * 1024);
+        VGpuHeap heap(buffer, 256, false);
+
+        std::vector<VGpuAllocation> live;
+        for (uint32_t stride : {1u, 4u, 12u, 32u, 48u, 56u, 100u, 256u, 384u})
+        {
+            VGpuAllocation allocation = heap.Allocate(stride * 7, stride);
+            Expect(allocation.IsValid(), "aligned allocation fits");
+            Expect(allocation.offset % stride == 0, "offset is a multiple of the alignment");
+            Expect(allocation.GetElementOffset(stride) * uint64_t(stride) == allocation.offset, "element offset maps back to the byte offset");
+            Expect(allocation.offset + allocation.size <= allocation.allocation.byte_offset + heap.GetPageSize() * ((stride * 7 + stride - 1) / heap.GetPageSize() + 1),
+                   "aligned range stays inside the reserved pages");
+            live.push_back(allocation);
+        }
+
+        Expect(!heap.Allocate(16, 0).IsValid(), "alignment 0 is rejected");
+        Expect(!heap.Allocate(0).IsValid(), "size 0 is rejected");
+    }
+
+    void CheckContents()
+    {
+        std::printf("contents\n");
+
+        auto     buffer = std::make_shared<VCpuBuffer>(16 * 256);
+        VGpuHeap heap(buffer, 256, false);
+
+        const std::vector<uint8_t> before = Pattern(300, 1);
+        const std::vector<uint8_t> data   = Pattern(500, 7);
+        const std::vector<uint8_t> after  = Pattern(300, 13);
+
+        VGpuAllocation a = heap.Allocate(before.size(), 1, before.data());
+        VGpuAllocation b = heap.Allocate(data.size(), 12, data.data());
+        VGpuAllocation c = heap.Allocate(after.size(), 1, after.data());
+
+        Expect(a.IsValid() && b.IsValid() && c.IsValid(), "three allocations fit");
+        Expect(a.buffer == buffer.get() && b.buffer == buffer.get(), "allocations point at the heap buffer");
+        Expect(Matches(*buffer, b.offset, data), "Allocate(data) uploads at the allocation offset");
+
+        const std::vector<uint8_t> patch = Pattern(40, 99);
+        heap.Write(b, patch.data(), patch.size(), 100);
+
+        std::vector<uint8_t> expected = data;
+        std::memcpy(expected.data() + 100, patch.data(), patch.size());
+        Expect(Matches(*buffer, b.offset, expected), "Write() lands at allocation offset + offset");
+        Expect(Matches(*buffer, a.offset, before) && Matches(*buffer, c.offset, after), "neighbouring allocations are untouched");
+    }
+
+    void CheckBounds()
+    {
+        std::printf("bounds\n");
+
+        auto     buffer = std::make_shared<VCpuBuffer>(8 * 256);
+        VGpuHeap heap(buffer, 256, false);
+        VGpuHeap other(std::make_shared<VCpuBuffer>(8 * 256), 256, false);
+
+        const std::vector<uint8_t> data = Pattern(200, 3);
+        VGpuAllocation             a    = heap.Allocate(data.size(), 1, data.data());
+        VGpuAllocation             o    = other.Allocate(data.size());
+
+        const std::vector<uint8_t> patch = Pattern(64, 200);
+        heap.Write(a, patch.data(), patch.size(), 150); // 150 + 64 > 200
+        Expect(Matches(*buffer, a.offset, data), "a write past the allocation is rejected");
+
+        heap.Write(o, patch.data(), patch.size());
+        Expect(Matches(*buffer, a.offset, data), "an allocation of another heap is rejected");
+
+        heap.Write(VGpuAllocation(), patch.data(), patch.size());
+        Expect(Matches(*buffer, a.offset, data), "an invalid allocation is rejected");
+    }
+
+    void CheckFull()
+    {
+        std::printf("full\n");
+
+        auto     buffer = std::make_shared<VCpuBuffer>(4 * 256);
+        VGpuHeap heap(buffer, 256, false);
+
+        VGpuAllocation a = heap.Allocate(3 * 256);
+        Expect(a.IsValid(), "three pages fit");
+        Expect(!heap.Allocate(2 * 256).IsValid(), "two more pages don't fit");
+
+        // Alignment padding needs room as well, 255 bytes with alignment 3 take two pages
+        Expect(!heap.Allocate(255, 3).IsValid(), "padding for the alignment is reserved");
+
+        VGpuAllocation b = heap.Allocate(256);
+        Expect(b.IsValid(), "the last page is still usable");
+        Expect(heap.GetStats().freeBytes == 0, "no free bytes are reported");
+
+        a.Reset();
+        Expect(heap.GetStats().freeBytes == 3 * 256, "without deferred release a reset range is free at once");
+    }
+
+    void CheckDeferred()
+    {
+        std::printf("deferred\n");
+
+        constexpr uint32_t bufferCount = 2;
+
+        auto     buffer = std::make_shared<VCpuBuffer>(4 * 256);
+        VGpuHeap heap(buffer, 256, true);
+
+        uint64_t frame = 10;
+        heap.UpdateDeferredRelease(frame, bufferCount);
+
+        VGpuAllocation a = heap.Allocate(4 * 256);
+        Expect(a.IsValid(), "the whole heap is allocated");
+
+        a.Reset(); // released in frame 10
+        Expect(heap.GetStats().freeBytes == 0, "a released range stays allocated until the GPU is done with it");
+
+        // Reclaimed once the release frame + bufferCount is behind the current frame
+        for (frame = 11; frame <= 10 + bufferCount; ++frame)
+        {
+            heap.UpdateDeferredRelease(frame, bufferCount);
+            Expect(!heap.Allocate(256).IsValid(), "range is not reused while frames may still read it");
+        }
+
+        heap.UpdateDeferredRelease(frame, bufferCount);
+        Expect(heap.GetStats().freeBytes == 4 * 256, "range is free after the buffered frames");
+
+        // Copies share the range, only the last one releases it
+        VGpuAllocation b = heap.Allocate(256);
+        VGpuAllocation c = b;
+        b.Reset();
+        heap.UpdateDeferredRelease(frame + 10, bufferCount);
+        Expect(c.IsValid() && heap.GetStats().freeBytes == 3 * 256, "a copy keeps the range alive");
+        c.Reset();
+        heap.UpdateDeferredRelease(frame + 20, bufferCount);
+        Expect(heap.GetStats().freeBytes == 4 * 256, "the last copy releases it");
+    }
+
+    struct VLiveRange
+    {
+            VGpuAllocation       allocation;
+            std::vector<uint8_t> bytes;
+    };
+
+    void CheckRandom(const VOptions &options)
+    {
+        std::printf("random (%u rounds, seed %u)\n", options.rounds, options.seed);
+
+        constexpr uint32_t bufferCount = 2;
+
+        auto     buffer = std::make_shared<VCpuBuffer>(1024 * 1024);
+        VGpuHeap heap(buffer, 256, true);
+
+        std::mt19937            rng(options.seed);
+        std::vector<VLiveRange> live;
+        uint64_t                frame       = 0;
+        uint32_t                allocations = 0;
+        uint32_t                failed      = 0;
+        bool                    overlap     = false;
+        bool                    outside     = false;
+        bool                    corrupted   = false;
+
+        const uint32_t strides[] = {1, 4, 12, 16, 32, 48, 56, 64};
+
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            if (rng() % 8 == 0)
+            {
+                heap.UpdateDeferredRelease(++frame, bufferCount);
+            }
+
+            if (!live.empty() && (rng() % 2 == 0 || live.size() > 200))
+            {
+                const size_t index = rng() % live.size();
+                if (!Matches(*buffer, live[index].allocation.offset, live[index].bytes))
+                {
+                    corrupted = true;
+                }
+                live[index] = std::move(live.back());
+                live.pop_back();
+                continue;
+            }
+
+            const uint32_t stride = strides[rng() % std::size(strides)];
+            const uint64_t size   = uint64_t(1 + rng() % 512) * stride;
+            VLiveRange     range;
+            range.bytes      = Pattern(size, static_cast<uint8_t>(round));
+            range.allocation = heap.Allocate(size, stride, range.bytes.data());
+            if (!range.allocation.IsValid())
+            {
+                failed++;
+                continue;
+            }
+            allocations++;
+
+            const VGpuAllocation &a = range.allocation;
+            if (a.offset % stride != 0 || a.offset + a.size > heap.GetStats().capacity)
+            {
+                outside = true;
+            }
+            for (const VLiveRange &other : live)
+            {
+                const VGpuAllocation &b = other.allocation;
+                if (a.offset < b.offset + b.size && b.offset < a.offset + a.size)
+                {
+                    overlap = true;
+                }
+            }
+            live.push_back(std::move(range));
+        }
+
+        for (const VLiveRange &range : live)
+        {
+            if (!Matches(*buffer, range.allocation.offset, range.bytes))
+            {
+                corrupted = true;
+            }
+        }
+
+        std::printf("  %u allocations, %u did not fit, %zu live at the end\n", allocations, failed, live.size());
+        Expect(!overlap, "live ranges never overlap");
+        Expect(!outside, "ranges are aligned and inside the heap");
+        Expect(!corrupted, "every range keeps its contents until it is freed");
+
+        live.clear();
+        heap.UpdateDeferredRelease(frame + bufferCount + 1, bufferCount);
+        Expect(heap.GetStats().freeBytes == heap.GetStats().capacity, "everything is free after the last release");
+        Expect(heap.GetStats().largestFreeBlock == heap.GetStats().capacity, "free ranges merge back into one block");
+    }
+
+    bool ParseOptions(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+                return false;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            if (arg == "--seed")
+                options.seed = value;
+            else if (arg == "--rounds")
+                options.rounds = value;
+            else
+            {
+                std::fprintf(stderr, "Unknown option %s\n", argv[i - 1]);
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorGpuHeapCheck [--seed N] [--rounds N]\n");
+        return 1;
+    }
+
+    CheckCapacity();
+    CheckAlignment();
+    CheckContents();
+    CheckBounds();
+    CheckFull();
+    CheckDeferred();
+    CheckRandom(options);
+
+    std::printf("%s\n", g_Failures == 0 ? "all checks passed" : "checks FAILED");
+    return g_Failures == 0 ? 0 : 1;
+}
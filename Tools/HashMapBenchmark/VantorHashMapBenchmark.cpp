@@ -0,0 +1,336 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorHashMapBenchmark - TFlatHashMap against the std containers the engine used before
+//
+//   VantorHashMapBenchmark [--actors N] [--assets N] [--rounds N]
+//
+// Every shape is one of the engine's maps, timed against the container it replaced:
+//
+//   components  AActor::components, 8 std::type_index keys          std::unordered_map
+//   actors      actor ids, --actors uint64_t keys                    std::unordered_map
+//   assets      VAssetManager::m_LoadedAssets, --assets path keys    std::unordered_map<std::string>
+//   uniforms    VMaterial::m_Uniforms, 24 uniform names              std::map<std::string> (now VName keys)
+//
+// Operations: insert (build the map from empty), find of present keys, find of missing keys, iterate
+// every element, and churn (erase and reinsert a key). The asset shape also looks up by std::string_view,
+// which the std map can only do by building a std::string first, and by a hash computed up front.
+// ns per operation, best of --rounds rounds.
+
+#include <Core/Container/VCO_FlatHashMap.hpp>
+#include <Core/Types/VCO_Name.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using VE::Internal::Core::Container::TFlatHashMap;
+using VE::Internal::Core::Types::VName;
+
+namespace
+{
+    struct VOptions
+    {
+            uint32_t actors = 10000;
+            uint32_t assets = 4096;
+            uint32_t rounds = 10;
+    };
+
+    constexpr size_t LOOKUPS = 1 << 20; // per find pass, the key list is repeated to reach it
+
+    // Keeps results alive without the cost of storing them
+    volatile size_t g_Sink = 0;
+
+    template <typename F> double BestNsPerItem(const VOptions &options, size_t items, F &&run)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best            = std::min(best, ns / static_cast<double>(items));
+        }
+        return best;
+    }
+
+    struct VTimes
+    {
+            double insert  = 0.0;
+            double hit     = 0.0;
+            double miss    = 0.0;
+            double iterate = 0.0;
+            double churn   = 0.0;
+    };
+
+    // keys go into the map, misses are never inserted
+    template <typename Map, typename Key> VTimes RunOperations(const VOptions &options, const std::vector<Key> &keys, const std::vector<Key> &misses)
+    {
+        VTimes times;
+        times.insert = BestNsPerItem(options, keys.size(),
+                                     [&]
+                                     {
+                                         Map map;
+                                         for (size_t i = 0; i < keys.size(); ++i)
+                                         {
+                                             map.try_emplace(keys[i], static_cast<int>(i));
+                                         }
+                                         g_Sink = g_Sink + map.size();
+                                     });
+
+        Map map;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            map.try_emplace(keys[i], static_cast<int>(i));
+        }
+
+        const size_t passes = std::max<size_t>(1, LOOKUPS / keys.size());
+        times.hit           = BestNsPerItem(options, passes * keys.size(),
+                                            [&]
+                                            {
+                                                size_t sum = 0;
+                                                for (size_t pass = 0; pass < passes; ++pass)
+                                                {
+                                                    for (const Key &key : keys)
+                                                    {
+                                                        sum += static_cast<size_t>(map.find(key)->second);
+                                                    }
+                                                }
+                                                g_Sink = g_Sink + sum;
+                                            });
+
+        times.miss = BestNsPerItem(options, passes * misses.size(),
+                                   [&]
+                                   {
+                                       size_t found = 0;
+                                       for (size_t pass = 0; pass < passes; ++pass)
+                                       {
+                                           for (const Key &key : misses)
+                                           {
+                                               found += map.find(key) != map.end();
+                                           }
+                                       }
+                                       g_Sink = g_Sink + found;
+                                   });
+
+        times.iterate = BestNsPerItem(options, passes * keys.size(),
+                                      [&]
+                                      {
+                                          size_t sum = 0;
+                                          for (size_t pass = 0; pass < passes; ++pass)
+                                          {
+                                              for (const auto &[key, value] : map)
+                                              {
+                                                  sum += static_cast<size_t>(value);
+                                              }
+                                          }
+                                          g_Sink = g_Sink + sum;
+                                      });
+
+        // Actors and assets come and go while the map stays about the same size
+        times.churn = BestNsPerItem(options, passes * keys.size(),
+                                    [&]
+                                    {
+                                        for (size_t pass = 0; pass < passes; ++pass)
+                                        {
+                                            for (size_t i = 0; i < keys.size(); ++i)
+                                            {
+                                                map.erase(keys[i]);
+                                                map.try_emplace(keys[i], static_cast<int>(i));
+                                            }
+                                        }
+                                        g_Sink = g_Sink + map.size();
+                                    });
+        return times;
+    }
+
+    void PrintRow(const char *shape, const char *operation, double stdNs, double flatNs)
+    {
+        std::printf("%-12s %-16s %12.2f %12.2f %9.2fx\n", shape, operation, stdNs, flatNs, stdNs / flatNs);
+    }
+
+    void PrintTimes(const char *shape, const VTimes &reference, const VTimes &flat)
+    {
+        PrintRow(shape, "insert", reference.insert, flat.insert);
+        PrintRow(shape, "find hit", reference.hit, flat.hit);
+        PrintRow(shape, "find miss", reference.miss, flat.miss);
+        PrintRow(shape, "iterate", reference.iterate, flat.iterate);
+        PrintRow(shape, "erase+insert", reference.churn, flat.churn);
+    }
+
+    template <size_t I> struct TComponent
+    {
+    };
+
+    template <size_t... I> std::vector<std::type_index> ComponentTypes(std::index_sequence<I...>) { return {std::type_index(typeid(TComponent<I>))...}; }
+
+    void RunComponents(const VOptions &options)
+    {
+        // A typical actor: transform, mesh, material, a light or camera and some scripts
+        std::vector<std::type_index> all    = ComponentTypes(std::make_index_sequence<12>());
+        std::vector<std::type_index> keys   = std::vector<std::type_index>(all.begin(), all.begin() + 8);
+        std::vector<std::type_index> misses = std::vector<std::type_index>(all.begin() + 8, all.end());
+
+        PrintTimes("components", RunOperations<std::unordered_map<std::type_index, int>>(options, keys, misses),
+                   RunOperations<TFlatHashMap<std::type_index, int>>(options, keys, misses));
+    }
+
+    void RunActors(const VOptions &options)
+    {
+        // Ids are handed out sequentially and stay sparse once actors are destroyed
+        std::mt19937          rng(1);
+        std::vector<uint64_t> keys;
+        std::vector<uint64_t> misses;
+        for (uint64_t id = 1; keys.size() < options.actors; ++id)
+        {
+            if (rng() % 4 == 0) misses.push_back(id);
+            else keys.push_back(id);
+        }
+        std::shuffle(keys.begin(), keys.end(), rng);
+
+        PrintTimes("actors", RunOperations<std::unordered_map<uint64_t, int>>(options, keys, misses),
+                   RunOperations<TFlatHashMap<uint64_t, int>>(options, keys, misses));
+    }
+
+    void RunAssets(const VOptions &options)
+    {
+        std::vector<std::string> keys;
+        std::vector<std::string> misses;
+        const char              *kinds[] = {"Textures", "Models", "Shaders", "Materials"};
+        for (uint32_t i = 0; i < options.assets; ++i)
+        {
+            const std::string directory = std::string("Assets/") + kinds[i % 4] + "/Set" + std::to_string(i / 64) + "/";
+            keys.push_back(directory + "Asset_" + std::to_string(i) + ".bin");
+            misses.push_back(directory + "Missing_" + std::to_string(i) + ".bin");
+        }
+
+        PrintTimes("assets", RunOperations<std::unordered_map<std::string, int>>(options, keys, misses),
+                   RunOperations<TFlatHashMap<std::string, int>>(options, keys, misses));
+
+        // Callers usually hold a path as std::string_view (or a literal)
+        std::unordered_map<std::string, int> reference;
+        TFlatHashMap<std::string, int>       flat;
+        std::vector<std::string_view>        views;
+        std::vector<size_t>                  hashes;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            reference.try_emplace(keys[i], static_cast<int>(i));
+            flat.try_emplace(keys[i], static_cast<int>(i));
+            views.push_back(keys[i]);
+            hashes.push_back(flat.hash_function()(keys[i]));
+        }
+
+        const size_t passes = std::max<size_t>(1, LOOKUPS / keys.size());
+        const double stdNs  = BestNsPerItem(options, passes * views.size(),
+                                            [&]
+                                            {
+                                                size_t sum = 0;
+                                                for (size_t pass = 0; pass < passes; ++pass)
+                                                {
+                                                    for (std::string_view view : views)
+                                                    {
+                                                        sum += static_cast<size_t>(reference.find(std::string(view))->second);
+                                                    }
+                                                }
+                                                g_Sink = g_Sink + sum;
+                                            });
+        const double viewNs = BestNsPerItem(options, passes * views.size(),
+                                            [&]
+                                            {
+                                                size_t sum = 0;
+                                                for (size_t pass = 0; pass < passes; ++pass)
+                                                {
+                                                    for (std::string_view view : views)
+                                                    {
+                                                        sum += static_cast<size_t>(flat.find(view)->second);
+                                                    }
+                                                }
+                                                g_Sink = g_Sink + sum;
+                                            });
+        const double hashedNs = BestNsPerItem(options, passes * views.size(),
+                                              [&]
+                                              {
+                                                  size_t sum = 0;
+                                                  for (size_t pass = 0; pass < passes; ++pass)
+                                                  {
+                                                      for (size_t i = 0; i < views.size(); ++i)
+                                                      {
+                                                          sum += static_cast<size_t>(flat.find(views[i], hashes[i])->second);
+                                                      }
+                                                  }
+                                                  g_Sink = g_Sink + sum;
+                                              });
+        PrintRow("assets", "find string_view", stdNs, viewNs);
+        PrintRow("assets", "find prehashed", stdNs, hashedNs);
+    }
+
+    void RunUniforms(const VOptions &options)
+    {
+        const char *names[]   = {"uModel",          "uView",           "uProjection",     "uCameraPos",      "uNumLights",         "uNumDirLights",
+                                 "uAlbedo",         "uMetallic",       "uRoughness",      "uAO",             "uEmissive",          "uTime",
+                                 "uExposure",       "uGamma",          "uLightColors[0]", "uLightColors[1]", "uLightColors[2]",    "uLightColors[3]",
+                                 "uLightPositions[0]", "uLightPositions[1]", "uLightPositions[2]", "uLightPositions[3]", "uDirLightColors[0]", "uDirLightDirections[0]"};
+        const char *missing[] = {"uShadowMap", "uFogColor", "uFogDensity", "uWind"};
+
+        std::vector<std::string> stringKeys(std::begin(names), std::end(names));
+        std::vector<std::string> stringMisses(std::begin(missing), std::end(missing));
+        std::vector<VName>       nameKeys(std::begin(names), std::end(names));
+        std::vector<VName>       nameMisses(std::begin(missing), std::end(missing));
+
+        PrintTimes("uniforms", RunOperations<std::map<std::string, int>>(options, stringKeys, stringMisses),
+                   RunOperations<TFlatHashMap<VName, int>>(options, nameKeys, nameMisses));
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--actors") options.actors = value;
+            else if (arg == "--assets") options.assets = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorHashMapBenchmark [--actors N] [--assets N] [--rounds N]\n");
+        return 1;
+    }
+
+    std::printf("%u actors, %u assets, best of %u rounds, ns per operation\n\n", options.actors, options.assets, options.rounds);
+    std::printf("%-12s %-16s %12s %12s %10s\n", "shape", "operation", "std", "TFlatHashMap", "speedup");
+
+    RunComponents(options);
+    RunActors(options);
+    RunAssets(options);
+    RunUniforms(options);
+    return 0;
+}
@@ -0,0 +1,278 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorJobBenchmark - scaling of the Core/Jobs scheduler
+//
+//   VantorJobBenchmark [--scenario transforms|assets] [--max-threads N] [options]
+//
+// transforms [--transforms N] [--grain N] [--frames N]
+//   Every frame spins each transform's rotation a little and rebuilds its world matrix
+//   (translation * rotation * scale). The frames run once single threaded without the job system
+//   as the baseline, then with 1..max-threads threads (workers plus the calling thread).
+//
+// assets [--models N] [--textures N] [--work N] [--rounds N]
+//   A dependency heavy load graph: every model job parses its file, starts a decode job per
+//   texture, waits for them and builds its GPU data. Runs with 1..max-threads threads, once with
+//   waiting jobs helping (running other jobs on their own stack) and once parking their fiber.
+//   Utilization is the time spent in parse/decode/build over wall time * threads.
+
+#include <Core/Jobs/VCO_JobSystem.hpp>
+#include <Core/VCO_Timer.hpp>
+#include <Math/Linear/VMA_Quaternation.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace VE::Internal::Core::Jobs;
+using VE::Math::VMat4;
+using VE::Math::VQuaternion;
+using VE::Math::VVector3;
+
+namespace
+{
+    struct VOptions
+    {
+            bool     assets     = false;
+            uint32_t transforms = 200000;
+            uint32_t grain      = 512;
+            uint32_t frames     = 60;
+            uint32_t models     = 256;
+            uint32_t textures   = 6;
+            uint32_t work       = 20000; // iterations of the fake parse/decode/build kernel
+            uint32_t rounds     = 10;
+            uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    struct VTransforms
+    {
+            std::vector<VVector3>    positions;
+            std::vector<VQuaternion> rotations;
+            std::vector<VQuaternion> spins; // rotation added every frame
+            std::vector<VVector3>    scales;
+            std::vector<VMat4>       world;
+
+            explicit VTransforms(uint32_t count)
+            {
+                positions.reserve(count);
+                rotations.reserve(count);
+                spins.reserve(count);
+                scales.reserve(count);
+                world.resize(count);
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const float f = static_cast<float>(i);
+                    positions.push_back({f * 0.5f, f * 0.25f, -f});
+                    rotations.push_back(VQuaternion::FromEulerAngles({f * 0.1f, f * 0.7f, f * 0.3f}));
+                    spins.push_back(VQuaternion::FromAxisAngle({0.0f, 1.0f, 0.0f}, 0.5f + static_cast<float>(i % 7)));
+                    scales.push_back({1.0f, 1.0f + static_cast<float>(i % 3), 1.0f});
+                }
+            }
+
+            void Update(uint32_t i)
+            {
+                rotations[i] = (spins[i] * rotations[i]).Normalized();
+                world[i]     = VMat4::Translate(positions[i]) * rotations[i].ToMat4() * VMat4::Scale(scales[i]);
+            }
+
+            // Keeps the compiler from dropping the work
+            float Checksum() const
+            {
+                float sum = 0.0f;
+                for (const VMat4 &m : world)
+                {
+                    sum += m.m[0] + m.m[5] + m.m[10] + m.m[12];
+                }
+                return sum;
+            }
+    };
+
+    // Stands in for parsing or decoding, returns something depending on every iteration
+    uint32_t Crunch(uint32_t seed, uint32_t iterations)
+    {
+        uint32_t state = seed | 1u;
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+        }
+        return state;
+    }
+
+    struct VAssetGraph
+    {
+            const VOptions       &options;
+            std::atomic<uint64_t> busyNanoseconds{0};
+            std::atomic<uint32_t> checksum{0};
+
+            explicit VAssetGraph(const VOptions &options) : options(options) {}
+
+            void Work(uint32_t seed, uint32_t iterations)
+            {
+                const auto     start  = std::chrono::steady_clock::now();
+                const uint32_t result = Crunch(seed, iterations);
+                busyNanoseconds.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+                checksum.fetch_add(result, std::memory_order_relaxed);
+            }
+
+            void LoadModel(VJobSystem &jobs, uint32_t model)
+            {
+                Work(model, options.work); // parse
+
+                VJobCounter textures;
+                for (uint32_t i = 0; i < options.textures; ++i)
+                {
+                    // Textures differ in size, so some decodes finish long before others
+                    jobs.Run([this, model, i] { Work(model * 31 + i, options.work * (1 + (model + i) % 4)); }, &textures);
+                }
+                jobs.Wait(textures);
+
+                Work(~model, options.work / 2); // build
+            }
+    };
+
+    void RunTransforms(const VOptions &options)
+    {
+        std::printf("%u transforms, grain %u, %u frames, %u hardware threads\n\n", options.transforms, options.grain, options.frames, std::thread::hardware_concurrency());
+        std::printf("%-10s %12s %10s %12s %10s\n", "threads", "ms/frame", "speedup", "efficiency", "checksum");
+
+        double baselineMs = 0.0;
+        {
+            VTransforms                transforms(options.transforms);
+            VE::Internal::Core::VTimer timer;
+            for (uint32_t frame = 0; frame < options.frames; ++frame)
+            {
+                for (uint32_t i = 0; i < options.transforms; ++i)
+                {
+                    transforms.Update(i);
+                }
+            }
+            baselineMs = timer.elapsed_milliseconds() / options.frames;
+            std::printf("%-10s %12.3f %10s %12s %10.3g\n", "serial", baselineMs, "1.00x", "-", transforms.Checksum());
+        }
+
+        for (uint32_t threads = 1; threads <= options.maxThreads; ++threads)
+        {
+            VTransforms transforms(options.transforms);
+            VJobSystem  jobs(threads - 1);
+
+            // One warm up frame so worker start up and first allocations are not measured
+            jobs.ParallelFor(options.transforms, options.grain, [&](uint32_t i) { transforms.Update(i); });
+
+            VE::Internal::Core::VTimer timer;
+            for (uint32_t frame = 1; frame < options.frames; ++frame)
+            {
+                jobs.ParallelFor(options.transforms, options.grain, [&](uint32_t i) { transforms.Update(i); });
+            }
+            const double ms      = timer.elapsed_milliseconds() / (options.frames - 1);
+            const double speedup = baselineMs / ms;
+            std::printf("%-10u %12.3f %9.2fx %11.0f%% %10.3g\n", threads, ms, speedup, 100.0 * speedup / threads, transforms.Checksum());
+        }
+    }
+
+    void RunAssets(const VOptions &options)
+    {
+        std::printf("%u models with %u textures, work %u, %u rounds, %u hardware threads\n\n", options.models, options.textures, options.work, options.rounds,
+                    std::thread::hardware_concurrency());
+        std::printf("%-10s %-8s %12s %12s %14s %10s\n", "threads", "wait", "ms/round", "utilization", "parked/round", "checksum");
+
+        for (uint32_t threads = 1; threads <= options.maxThreads; ++threads)
+        {
+            for (const bool fibers : {false, true})
+            {
+                // Only workers run fibers, the calling thread always helps
+                if (fibers && threads == 1) continue;
+
+                VJobSystemDesc desc;
+                desc.workerCount = threads - 1;
+                desc.useFibers   = fibers;
+                VJobSystem jobs(desc);
+                if (fibers && !jobs.IsUsingFibers())
+                {
+                    std::printf("%-10u %-8s %12s\n", threads, "fibers", "n/a");
+                    continue;
+                }
+
+                VAssetGraph graph(options);
+                double      totalMs = 0.0;
+                for (uint32_t round = 0; round <= options.rounds; ++round)
+                {
+                    // Round 0 warms up workers, fiber stacks and the job allocator
+                    if (round == 1) graph.busyNanoseconds = 0;
+
+                    VE::Internal::Core::VTimer timer;
+                    VJobCounter                models;
+                    for (uint32_t model = 0; model < options.models; ++model)
+                    {
+                        jobs.Run([&jobs, &graph, model] { graph.LoadModel(jobs, model); }, &models);
+                    }
+                    jobs.Wait(models);
+                    if (round > 0) totalMs += timer.elapsed_milliseconds();
+                }
+
+                const double ms          = totalMs / options.rounds;
+                const double utilization = graph.busyNanoseconds.load() / (totalMs * 1.0e6 * threads);
+                std::printf("%-10u %-8s %12.3f %11.0f%% %14.1f %10u\n", threads, fibers ? "fibers" : "helping", ms, 100.0 * utilization,
+                            static_cast<double>(jobs.GetParkedFiberCount()) / (options.rounds + 1), graph.checksum.load());
+            }
+        }
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--scenario")
+            {
+                const std::string_view scenario = argv[i + 1];
+                if (scenario != "transforms" && scenario != "assets") return false;
+                options.assets = scenario == "assets";
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--transforms") options.transforms = value;
+            else if (arg == "--grain") options.grain = value;
+            else if (arg == "--frames") options.frames = value;
+            else if (arg == "--models") options.models = value;
+            else if (arg == "--textures") options.textures = value;
+            else if (arg == "--work") options.work = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else if (arg == "--max-threads") options.maxThreads = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorJobBenchmark [--scenario transforms|assets] [--max-threads N]\n"
+                             "                          [--transforms N] [--grain N] [--frames N]\n"
+                             "                          [--models N] [--textures N] [--work N] [--rounds N]\n");
+        return 1;
+    }
+
+    if (options.assets) RunAssets(options);
+    else RunTransforms(options);
+    return 0;
+}
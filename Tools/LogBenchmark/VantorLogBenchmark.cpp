@@ -0,0 +1,302 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorLogBenchmark - throughput of the Backlog logger
+//
+//   VantorLogBenchmark [--sink null|file|binary] [--records N] [--rounds N] [--dir PATH]
+//
+// 1 and 8 producer threads each log --records asset load lines ("Loaded texture <path> (<n> bytes)")
+// through three loggers:
+//
+//   mutex   the synchronous logger Backlog::Log() used to be: a global mutex, the entry appended to a
+//           vector, the line written and flushed on every call
+//   Log()   the asynchronous Backlog, the caller formats the message like engine code does today
+//   VE_LOG  the asynchronous Backlog with binary arguments, formatted on the logger thread
+//
+// --sink null counts the lines, file writes them to a file in --dir (the old logger flushes per line,
+// the Backlog once per batch through VFileLogSink), binary has the Backlog write Backlog.vlog through
+// VBinaryLogSink instead and prints its size against the text it stands for. The console sink is removed;
+// the bounded memory sink of the backlog panel stays, as in the engine.
+//
+// "producer" is the wall time until every producer returned from its last call, which is what a logging
+// thread pays. "end to end" waits until every record reached the sinks (Flush()). Stalls count calls that
+// found their ring full and waited for the logger thread. Best of --rounds rounds.
+
+#include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/BackLog/VCO_BinaryLog.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/BackLog/VCO_LogSinks.hpp>
+#include <Core/VCO_Timer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Backlog = VE::Internal::Core::Backlog;
+
+namespace
+{
+    enum class ESink
+    {
+        Null,
+        File,
+        Binary
+    };
+
+    struct VOptions
+    {
+            ESink       sink    = ESink::Null;
+            uint32_t    records = 200000; // per producer
+            uint32_t    rounds  = 3;
+            std::string dir     = (std::filesystem::temp_directory_path() / "VantorLogBenchmark").string();
+    };
+
+    enum class ELogger
+    {
+        Mutex,
+        Log,
+        Format
+    };
+
+    // Stands in for a sink that does real work, without any I/O
+    class VCountingSink : public Backlog::ILogSink
+    {
+        public:
+            void Write(const Backlog::VLogEntry & /*entry*/, std::string_view line) override
+            {
+                m_Lines++;
+                m_Bytes += line.size();
+            }
+
+            uint64_t GetLines() const { return m_Lines; }
+
+        private:
+            uint64_t m_Lines = 0;
+            uint64_t m_Bytes = 0;
+    };
+
+    // What Backlog::Log() did before it became asynchronous
+    class VMutexLogger
+    {
+        public:
+            explicit VMutexLogger(std::ofstream *file) : m_File(file) {}
+
+            void Log(std::string_view source, std::string_view msg, Backlog::ELogLevel level)
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+
+                Backlog::VLogEntry entry;
+                entry.source = source;
+                entry.text   = msg;
+                entry.level  = level;
+                m_Entries.push_back(std::move(entry));
+
+                if (m_File)
+                {
+                    *m_File << "[" << Backlog::LogLevelToString(level) << "] [" << source << "] " << msg << std::endl;
+                }
+                else
+                {
+                    m_Lines++;
+                }
+            }
+
+        private:
+            std::mutex                      m_Mutex;
+            std::vector<Backlog::VLogEntry> m_Entries;
+            std::ofstream                  *m_File  = nullptr;
+            uint64_t                        m_Lines = 0;
+    };
+
+    struct VResult
+    {
+            double   producerMs = 0.0;
+            double   endToEndMs = 0.0;
+            uint64_t stalls     = 0;
+    };
+
+    void Produce(ELogger logger, VMutexLogger &mutexLogger, uint32_t thread, uint32_t records)
+    {
+        char message[128];
+        for (uint32_t i = 0; i < records; ++i)
+        {
+            const uint32_t texture = thread * records + i;
+            const uint32_t bytes   = 4096 + (texture % 64) * 1024;
+            switch (logger)
+            {
+                case ELogger::Mutex:
+                case ELogger::Log:
+                {
+                    const int length = std::snprintf(message, sizeof(message), "Loaded texture Assets/Textures/Brick_%u.png (%u bytes)", texture, bytes);
+                    const std::string_view text(message, static_cast<size_t>(length));
+                    if (logger == ELogger::Mutex) mutexLogger.Log("AssetManager", text, Backlog::ELogLevel::INFO);
+                    else Backlog::Log("AssetManager", text, Backlog::ELogLevel::INFO);
+                    break;
+                }
+                case ELogger::Format:
+                {
+                    VE_LOG(INFO, "AssetManager", "Loaded texture Assets/Textures/Brick_{}.png ({} bytes)", texture, bytes);
+                    break;
+                }
+            }
+        }
+    }
+
+    VResult RunRound(const VOptions &options, ELogger logger, uint32_t producers, std::ofstream *file)
+    {
+        VMutexLogger             mutexLogger(file);
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t>    ready{0};
+        std::atomic<bool>        start{false};
+
+        for (uint32_t t = 0; t < producers; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    ready.fetch_add(1);
+                    while (!start.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+                    Produce(logger, mutexLogger, t, options.records);
+                });
+        }
+        while (ready.load() != producers)
+        {
+            std::this_thread::yield();
+        }
+
+        const uint64_t             stallsBefore = Backlog::GetLoggerStats().producerStalls;
+        VE::Internal::Core::VTimer timer;
+        start.store(true, std::memory_order_release);
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        VResult result;
+        result.producerMs = timer.elapsed_milliseconds();
+        if (logger != ELogger::Mutex) Backlog::Flush();
+        if (file) file->flush();
+        result.endToEndMs = timer.elapsed_milliseconds();
+        result.stalls     = Backlog::GetLoggerStats().producerStalls - stallsBefore;
+        return result;
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--sink")
+            {
+                const std::string_view sink = argv[i + 1];
+                if (sink == "null") options.sink = ESink::Null;
+                else if (sink == "file") options.sink = ESink::File;
+                else if (sink == "binary") options.sink = ESink::Binary;
+                else return false;
+                continue;
+            }
+            if (arg == "--dir")
+            {
+                options.dir = argv[i + 1];
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--records") options.records = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorLogBenchmark [--sink null|file|binary] [--records N] [--rounds N] [--dir PATH]\n");
+        return 1;
+    }
+
+    // Same sink for both: a counter, or a file the old logger writes directly and the Backlog through VFileLogSink
+    // (or VBinaryLogSink)
+    Backlog::RemoveSink(Backlog::GetConsoleSink());
+    std::unique_ptr<std::ofstream>           mutexFile;
+    auto                                     countingSink = std::make_shared<VCountingSink>();
+    std::shared_ptr<Backlog::VBinaryLogSink> binarySink;
+    if (options.sink == ESink::Null)
+    {
+        Backlog::AddSink(countingSink);
+    }
+    else
+    {
+        const std::filesystem::path dir(options.dir);
+        std::filesystem::create_directories(dir);
+        mutexFile = std::make_unique<std::ofstream>(dir / "Mutex.log", std::ios::trunc);
+        if (options.sink == ESink::File)
+        {
+            Backlog::AddSink(std::make_shared<Backlog::VFileLogSink>((dir / "Backlog.log").string()));
+        }
+        else
+        {
+            binarySink = std::make_shared<Backlog::VBinaryLogSink>((dir / "Backlog.vlog").string());
+            Backlog::AddSink(binarySink);
+        }
+    }
+
+    const char *sinkNames[] = {"null", "file", "binary"};
+    std::printf("%u records per producer, %s sink, best of %u rounds, %u hardware threads\n\n", options.records, sinkNames[static_cast<int>(options.sink)],
+                options.rounds, std::thread::hardware_concurrency());
+    std::printf("%-10s %-8s %12s %14s %16s %18s %8s\n", "producers", "logger", "producer ms", "producer Mrec/s", "end to end ms", "end to end Mrec/s", "stalls");
+
+    const std::pair<ELogger, const char *> loggers[] = {{ELogger::Mutex, "mutex"}, {ELogger::Log, "Log()"}, {ELogger::Format, "VE_LOG"}};
+    for (const uint32_t producers : {1u, 8u})
+    {
+        for (const auto &[logger, name] : loggers)
+        {
+            VResult best;
+            for (uint32_t round = 0; round < options.rounds; ++round)
+            {
+                const VResult result = RunRound(options, logger, producers, mutexFile.get());
+                if (round == 0 || result.endToEndMs < best.endToEndMs) best = result;
+            }
+
+            const double records = double(options.records) * producers;
+            std::printf("%-10u %-8s %12.2f %14.2f %16.2f %18.2f %8llu\n", producers, name, best.producerMs, records / (best.producerMs * 1.0e3), best.endToEndMs,
+                        records / (best.endToEndMs * 1.0e3), static_cast<unsigned long long>(best.stalls));
+        }
+    }
+
+    if (options.sink == ESink::Null) std::printf("\nlines written by the Backlog: %llu\n", static_cast<unsigned long long>(countingSink->GetLines()));
+    if (binarySink)
+    {
+        Backlog::Flush();
+        const uint64_t binaryBytes = binarySink->GetBytesWritten();
+        const uint64_t textBytes   = binarySink->GetTextBytes();
+        std::printf("\nbinary log: %llu bytes for %llu bytes of text (%.1fx)\n", static_cast<unsigned long long>(binaryBytes), static_cast<unsigned long long>(textBytes),
+                    binaryBytes ? double(textBytes) / double(binaryBytes) : 0.0);
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorLogDecode - expands binary logs (VBinaryLogSink, ".vlog") to text or JSON lines
+//
+//   VantorLogDecode <file.vlog> [options]
+//
+//   --json              one JSON object per line instead of "[time] [thread] [LEVEL] [source] text"
+//   --level L[,L...]    only these levels (INFO, DEBUG, WARNING, ERROR)
+//   --source S          only this source, can be repeated
+//   --from SECONDS      only records at or after this time (seconds since the file was created)
+//   --to SECONDS        only records before this time
+//   --stats             print record count and size comparison to stderr
+
+#include <Core/BackLog/VCO_BinaryLog.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace VE::Internal::Core::Backlog;
+
+namespace
+{
+    struct VOptions
+    {
+            std::string              path;
+            bool                     json      = false;
+            bool                     stats     = false;
+            unsigned                 levelMask = 0; // 0 = all levels
+            std::vector<std::string> sources;
+            double                   from = -1.0;
+            double                   to   = -1.0;
+    };
+
+    void PrintUsage()
+    {
+        std::fprintf(stderr, "Usage: VantorLogDecode <file.vlog> [--json] [--level L[,L...]] [--source S]... [--from SECONDS] [--to SECONDS] [--stats]\n");
+    }
+
+    bool ParseLevels(std::string_view list, unsigned &mask)
+    {
+        while (!list.empty())
+        {
+            const size_t           comma = list.find(',');
+            const std::string_view name  = list.substr(0, comma);
+            bool                   found = false;
+
+            for (uint8_t level = 0; level <= static_cast<uint8_t>(ELogLevel::ERR); ++level)
+            {
+                if (name == LogLevelToString(static_cast<ELogLevel>(level)))
+                {
+                    mask |= 1u << level;
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                std::fprintf(stderr, "Unknown log level: %.*s\n", static_cast<int>(name.size()), name.data());
+                return false;
+            }
+            list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+        }
+        return true;
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg     = argv[i];
+            const bool             hasNext = i + 1 < argc;
+
+            if (arg == "--json") options.json = true;
+            else if (arg == "--stats") options.stats = true;
+            else if (arg == "--level" && hasNext)
+            {
+                if (!ParseLevels(argv[++i], options.levelMask)) return false;
+            }
+            else if (arg == "--source" && hasNext) options.sources.emplace_back(argv[++i]);
+            else if (arg == "--from" && hasNext) options.from = std::atof(argv[++i]);
+            else if (arg == "--to" && hasNext) options.to = std::atof(argv[++i]);
+            else if (!arg.starts_with("--") && options.path.empty()) options.path = arg;
+            else return false;
+        }
+        return !options.path.empty();
+    }
+
+    bool Matches(const VOptions &options, const VLogEntry &entry, double seconds)
+    {
+        if (options.levelMask != 0 && (options.levelMask & (1u << static_cast<unsigned>(entry.level))) == 0) return false;
+        if (options.from >= 0.0 && seconds < options.from) return false;
+        if (options.to >= 0.0 && seconds >= options.to) return false;
+        if (!options.sources.empty())
+        {
+            bool found = false;
+            for (const std::string &source : options.sources)
+            {
+                found |= source == entry.source;
+            }
+            if (!found) return false;
+        }
+        return true;
+    }
+
+    void AppendJsonString(std::string &out, std::string_view str)
+    {
+        out.push_back('"');
+        for (const char c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    out.append("\\\"");
+                    break;
+                case '\\':
+                    out.append("\\\\");
+                    break;
+                case '\n':
+                    out.append("\\n");
+                    break;
+                case '\r':
+                    out.append("\\r");
+                    break;
+                case '\t':
+                    out.append("\\t");
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                        out.append(escaped);
+                    }
+                    else
+                    {
+                        out.push_back(c);
+                    }
+                    break;
+            }
+        }
+        out.push_back('"');
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    VBinaryLogReader reader;
+    if (!reader.Open(options.path))
+    {
+        std::fprintf(stderr, "%s is not a readable binary log\n", options.path.c_str());
+        return 1;
+    }
+
+    const VBinaryLogFileHeader &header = reader.GetHeader();
+
+    VLogEntry   entry;
+    std::string line;
+    uint64_t    printed   = 0;
+    uint64_t    textBytes = 0;
+    char        prefix[128];
+
+    while (reader.Next(entry))
+    {
+        const int64_t relative = static_cast<int64_t>(entry.timestamp - header.steadyTime);
+        const double  seconds  = static_cast<double>(relative) * 1e-9;
+
+        // Size of the line as the text log would have written it
+        textBytes += std::strlen(LogLevelToString(entry.level)) + entry.source.size() + entry.text.size() + 7;
+
+        if (!Matches(options, entry, seconds)) continue;
+
+        line.clear();
+        if (options.json)
+        {
+            std::snprintf(prefix, sizeof(prefix), "{\"time\":%lld,\"seconds\":%.6f,\"thread\":%u,\"level\":", static_cast<long long>(header.systemTime + relative), seconds, entry.threadId);
+            line.append(prefix);
+            AppendJsonString(line, LogLevelToString(entry.level));
+            line.append(",\"source\":");
+            AppendJsonString(line, entry.source);
+            line.append(",\"text\":");
+            AppendJsonString(line, entry.text);
+            if (!entry.format.empty())
+            {
+                line.append(",\"format\":");
+                AppendJsonString(line, entry.format);
+            }
+            line.append("}\n");
+        }
+        else
+        {
+            std::snprintf(prefix, sizeof(prefix), "[%12.6f] [T%u] [", seconds, entry.threadId);
+            line.append(prefix).append(LogLevelToString(entry.level)).append("] [").append(entry.source).append("] ").append(entry.text).push_back('\n');
+        }
+
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        printed++;
+    }
+
+    if (options.stats)
+    {
+        const VBinaryLogReaderStats &stats = reader.GetStats();
+        std::fprintf(stderr, "%llu records (%llu printed), %llu sync markers, %llu bytes skipped\n", static_cast<unsigned long long>(stats.records),
+                     static_cast<unsigned long long>(printed), static_cast<unsigned long long>(stats.syncMarkers), static_cast<unsigned long long>(stats.skippedBytes));
+        std::fprintf(stderr, "%llu bytes binary, %llu bytes as text (%.1fx)\n", static_cast<unsigned long long>(reader.GetFileSize()),
+                     static_cast<unsigned long long>(textBytes), reader.GetFileSize() != 0 ? static_cast<double>(textBytes) / static_cast<double>(reader.GetFileSize()) : 0.0);
+    }
+    return reader.GetStats().skippedBytes != 0 ? 2 : 0;
+}
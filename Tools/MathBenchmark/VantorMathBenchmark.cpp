@@ -0,0 +1,1157 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorMathBenchmark - speed and accuracy of the math kernels
+//
+//   VantorMathBenchmark [--suite NAME] [--count N] [--rounds N]
+//
+// Suites (all of them by default):
+//
+//   matrix     VMat4 multiply, transpose, inverse, affine inverse and TransformPoints
+//   transform  world matrices of 10k, 100k and 1M transforms with parents, VTransformSoA against
+//              CTransformComponent::GetTransform() per component
+//   quat       VQuaternion multiply, rotate, nlerp, slerp and matrix conversions, members and batches
+//   functions  Sin, Cos, Tan, Sqrt and RSqrt (VMA_Functions.hpp): error sweeps in ulp, compile time
+//              against run time matrices, and VPrecision::Fast against the C library
+//   fastmath   rsqrt, exp, log, pow, atan2 and sincos of VMA_FastMath.hpp in every VAccuracy tier: error
+//              sweeps over each function's domain, batches against the C library and the scalar functions
+//
+// Every suite first checks the compiled SIMD backend against the scalar backend, which runs the same
+// kernels with plain floats (transform: the per component path, quat: also the members). They have to
+// agree bit for bit, any mismatch is printed and makes the exit code 1. This needs floating point
+// contraction off (-ffp-contract=off, set by the CMakeLists), else the compiler fuses the scalar backend's
+// multiplies and adds on its own. Inverses and quaternion ops are also compared against a double precision
+// reference. Timings are the best of --rounds rounds over --count inputs.
+
+#include <Math/Linear/VMA_Matrix.hpp>
+#include <Math/VMA_FastMath.hpp>
+#include <Math/VMA_Functions.hpp>
+#include <Math/Linear/VMA_Quaternation.hpp>
+#include <Math/Linear/VMA_Transform.hpp>
+
+#include <ActorRuntime/Public/Components/VAR_Base.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using VE::Math::VMat4;
+    using VE::Math::VQuaternion;
+    using VE::Math::VTransformSoA;
+    using VE::Math::VVector3;
+
+    namespace Detail = VE::Math::Detail;
+
+    struct VOptions
+    {
+            std::string_view suite  = "all";
+            uint32_t         count  = 0; // 0: the suite's own sizes
+            uint32_t         rounds = 20;
+    };
+
+    // Keeps results alive without the cost of storing them
+    volatile float g_Sink = 0.0f;
+
+    int g_Failures = 0;
+
+    template <typename F> double BestNsPerItem(const VOptions &options, size_t items, F &&run)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best            = std::min(best, ns / static_cast<double>(items));
+        }
+        return best;
+    }
+
+    uint32_t UlpDistance(float a, float b)
+    {
+        if (a == b) return 0; // also +0 and -0
+        int32_t ia, ib;
+        std::memcpy(&ia, &a, sizeof(float));
+        std::memcpy(&ib, &b, sizeof(float));
+        // Map the sign-magnitude bits to a monotonic integer line
+        if (ia < 0) ia = std::numeric_limits<int32_t>::min() - ia;
+        if (ib < 0) ib = std::numeric_limits<int32_t>::min() - ib;
+        return static_cast<uint32_t>(std::abs(static_cast<int64_t>(ia) - static_cast<int64_t>(ib)));
+    }
+
+    void ReportBitExact(const char *what, const float *simd, const float *scalar, size_t count)
+    {
+        size_t   mismatches = 0;
+        uint32_t worst      = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (std::memcmp(&simd[i], &scalar[i], sizeof(float)) != 0)
+            {
+                mismatches++;
+                worst = std::max(worst, UlpDistance(simd[i], scalar[i]));
+            }
+        }
+        std::printf("  %-36s %s", what, mismatches == 0 ? "bit exact" : "MISMATCH");
+        if (mismatches != 0)
+        {
+            std::printf(" (%zu of %zu floats, worst %u ulp)", mismatches, count, worst);
+            g_Failures++;
+        }
+        std::printf("\n");
+    }
+
+    // ----------------- matrix -----------------
+
+    // VMat4::operator* before the kernels, the baseline for the timings
+    VMat4 LegacyMultiply(const VMat4 &a, const VMat4 &b)
+    {
+        VMat4 result{};
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                float sum = 0.f;
+                for (int i = 0; i < 4; ++i)
+                {
+                    sum += a.m[row * 4 + i] * b.m[i * 4 + col];
+                }
+                result.m[row * 4 + col] = sum;
+            }
+        }
+        return result;
+    }
+
+    // Gauss-Jordan with partial pivoting in double precision
+    bool ReferenceInverse(const VMat4 &matrix, double out[16])
+    {
+        double a[4][8];
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                a[r][c]     = matrix.m[r * 4 + c];
+                a[r][c + 4] = r == c ? 1.0 : 0.0;
+            }
+        }
+        for (int c = 0; c < 4; ++c)
+        {
+            int pivot = c;
+            for (int r = c + 1; r < 4; ++r)
+            {
+                if (std::fabs(a[r][c]) > std::fabs(a[pivot][c])) pivot = r;
+            }
+            if (a[pivot][c] == 0.0) return false;
+            std::swap(a[c], a[pivot]);
+
+            const double inv = 1.0 / a[c][c];
+            for (double &value : a[c]) value *= inv;
+            for (int r = 0; r < 4; ++r)
+            {
+                if (r == c) continue;
+                const double factor = a[r][c];
+                for (int k = 0; k < 8; ++k) a[r][k] -= factor * a[c][k];
+            }
+        }
+        for (int r = 0; r < 4; ++r)
+        {
+            for (int c = 0; c < 4; ++c) out[r * 4 + c] = a[r][c + 4];
+        }
+        return true;
+    }
+
+    double InverseError(const VMat4 &matrix, const VMat4 &inverse)
+    {
+        double reference[16];
+        if (!ReferenceInverse(matrix, reference)) return 0.0;
+        double worst = 0.0;
+        for (int i = 0; i < 16; ++i)
+        {
+            worst = std::max(worst, std::fabs(inverse.m[i] - reference[i]) / std::max(1.0, std::fabs(reference[i])));
+        }
+        return worst;
+    }
+
+    void RunMatrixSuite(VOptions options)
+    {
+        if (options.count == 0) options.count = 4096;
+        std::printf("matrix (%u matrices, %u points)\n", options.count, options.count * 4);
+
+        std::mt19937                          random(1234);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        // Half of them affine TRS matrices, half general ones with a strong diagonal so they are invertible
+        std::vector<VMat4> matrices(options.count);
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                matrices[i] = VMat4::Scale(VVector3(1.0f + unit(random) * 0.5f, 1.0f + unit(random) * 0.5f, 1.0f + unit(random) * 0.5f)) *
+                              VMat4::RotationYawPitch(unit(random) * 180.0f, unit(random) * 90.0f) *
+                              VMat4::Translate(VVector3(unit(random) * 100.0f, unit(random) * 100.0f, unit(random) * 100.0f));
+            }
+            else
+            {
+                for (int k = 0; k < 16; ++k) matrices[i].m[k] = unit(random) + (k % 5 == 0 ? 4.0f : 0.0f);
+            }
+        }
+        std::vector<VVector3> points(options.count * 4);
+        for (VVector3 &point : points) point = VVector3(unit(random) * 50.0f, unit(random) * 50.0f, unit(random) * 50.0f);
+
+        // Bit exactness against the scalar backend
+        std::vector<VMat4>    simd(options.count), scalar(options.count);
+        std::vector<VVector3> simdPoints(points.size()), scalarPoints(points.size());
+        const size_t          floats = options.count * 16;
+
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            const VMat4 &next = matrices[(i + 1) % options.count];
+            Detail::MatrixMultiply<Detail::VFloat4>(matrices[i].m.data(), next.m.data(), simd[i].m.data());
+            Detail::MatrixMultiply<Detail::VFloat4Scalar>(matrices[i].m.data(), next.m.data(), scalar[i].m.data());
+        }
+        ReportBitExact("multiply", simd[0].m.data(), scalar[0].m.data(), floats);
+
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            Detail::MatrixTranspose<Detail::VFloat4>(matrices[i].m.data(), simd[i].m.data());
+            Detail::MatrixTranspose<Detail::VFloat4Scalar>(matrices[i].m.data(), scalar[i].m.data());
+        }
+        ReportBitExact("transpose", simd[0].m.data(), scalar[0].m.data(), floats);
+
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            Detail::MatrixInverse<Detail::VFloat4>(matrices[i].m.data(), simd[i].m.data());
+            Detail::MatrixInverse<Detail::VFloat4Scalar>(matrices[i].m.data(), scalar[i].m.data());
+        }
+        ReportBitExact("inverse", simd[0].m.data(), scalar[0].m.data(), floats);
+
+        double inverseError = 0.0;
+        for (uint32_t i = 0; i < options.count; ++i) inverseError = std::max(inverseError, InverseError(matrices[i], simd[i]));
+
+        double affineError = 0.0;
+        for (uint32_t i = 0; i < options.count; i += 2)
+        {
+            Detail::MatrixInverseAffine<Detail::VFloat4>(matrices[i].m.data(), simd[i].m.data());
+            Detail::MatrixInverseAffine<Detail::VFloat4Scalar>(matrices[i].m.data(), scalar[i].m.data());
+            affineError = std::max(affineError, InverseError(matrices[i], simd[i]));
+        }
+        ReportBitExact("affine inverse", simd[0].m.data(), scalar[0].m.data(), floats);
+
+        Detail::MatrixTransformPoints<Detail::VFloat4>(matrices[0].m.data(), points.data(), simdPoints.data(), points.size());
+        Detail::MatrixTransformPoints<Detail::VFloat4Scalar>(matrices[0].m.data(), points.data(), scalarPoints.data(), points.size());
+        ReportBitExact("transform points", &simdPoints[0].x, &scalarPoints[0].x, points.size() * 3);
+
+        // The batch and the single point path have to agree too, the batch tail uses the single one
+        for (size_t i = 0; i < points.size(); ++i) scalarPoints[i] = matrices[0].TransformPoint(points[i]);
+        ReportBitExact("transform points vs single", &simdPoints[0].x, &scalarPoints[0].x, points.size() * 3);
+
+        // Against the triple loop the kernels are exact without FMA, with FMA they round once less
+        double legacyError = 0.0;
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            const VMat4 legacy = LegacyMultiply(matrices[i], matrices[(i + 1) % options.count]);
+            const VMat4 fresh  = matrices[i] * matrices[(i + 1) % options.count];
+            for (int k = 0; k < 16; ++k) legacyError = std::max(legacyError, std::fabs(static_cast<double>(legacy.m[k]) - fresh.m[k]) / std::max(1.0, std::fabs(static_cast<double>(legacy.m[k]))));
+        }
+        std::printf("  %-28s %.3g relative\n", "multiply vs old triple loop", legacyError);
+        std::printf("  %-28s %.3g relative (double precision reference)\n", "inverse error", inverseError);
+        std::printf("  %-28s %.3g relative\n", "affine inverse error", affineError);
+
+        // Timings. Kernels are called through function pointers the compiler cannot see through, else it
+        // inlines the scalar ones into the loop and vectorizes across matrices, which says little about a single call.
+        const size_t n = options.count;
+        std::printf("\n  %-28s %10s %10s %10s\n", "ns per call", "old loop", "scalar", Detail::GetSimdBackendName());
+
+        using VBinaryKernel = void (*)(const float *, const float *, float *);
+        using VUnaryKernel  = void (*)(const float *, float *);
+        using VPointsKernel = void (*)(const float *, const VVector3 *, VVector3 *, size_t);
+
+        auto timeBinary = [&](VBinaryKernel kernel) {
+            VBinaryKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                for (size_t i = 0; i < n; ++i) opaque(matrices[i].m.data(), matrices[(i + 1) % n].m.data(), simd[i].m.data());
+                g_Sink = g_Sink + simd[n / 2].m[5];
+            });
+        };
+        auto timeUnary = [&](VUnaryKernel kernel) {
+            VUnaryKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                for (size_t i = 0; i < n; ++i) opaque(matrices[i].m.data(), simd[i].m.data());
+                g_Sink = g_Sink + simd[n / 2].m[5];
+            });
+        };
+        auto timePoints = [&](VPointsKernel kernel) {
+            VPointsKernel volatile opaque = kernel;
+            return BestNsPerItem(options, points.size(), [&] {
+                opaque(matrices[1].m.data(), points.data(), simdPoints.data(), points.size());
+                g_Sink = g_Sink + simdPoints[points.size() / 2].y;
+            });
+        };
+
+        std::printf("  %-28s %10.2f %10.2f %10.2f\n", "multiply", timeBinary([](const float *a, const float *b, float *out) {
+                        VMat4 lhs, rhs;
+                        std::memcpy(lhs.m.data(), a, sizeof(lhs.m));
+                        std::memcpy(rhs.m.data(), b, sizeof(rhs.m));
+                        const VMat4 result = LegacyMultiply(lhs, rhs);
+                        std::memcpy(out, result.m.data(), sizeof(result.m));
+                    }),
+                    timeBinary(&Detail::MatrixMultiply<Detail::VFloat4Scalar>), timeBinary(&Detail::MatrixMultiply<Detail::VFloat4>));
+        std::printf("  %-28s %10s %10.2f %10.2f\n", "inverse", "-", timeUnary([](const float *m, float *out) { Detail::MatrixInverse<Detail::VFloat4Scalar>(m, out); }),
+                    timeUnary([](const float *m, float *out) { Detail::MatrixInverse<Detail::VFloat4>(m, out); }));
+        std::printf("  %-28s %10s %10.2f %10.2f\n", "affine inverse", "-",
+                    timeUnary([](const float *m, float *out) { Detail::MatrixInverseAffine<Detail::VFloat4Scalar>(m, out); }),
+                    timeUnary([](const float *m, float *out) { Detail::MatrixInverseAffine<Detail::VFloat4>(m, out); }));
+        std::printf("  %-28s %10s %10.2f %10.2f\n", "transpose", "-", timeUnary(&Detail::MatrixTranspose<Detail::VFloat4Scalar>),
+                    timeUnary(&Detail::MatrixTranspose<Detail::VFloat4>));
+
+        std::printf("  %-28s %10.2f %10.2f %10.2f\n", "transform point (batch)",
+                    timePoints([](const float *m, const VVector3 *in, VVector3 *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            const VVector3 &p = in[i];
+                            out[i] = VVector3(p.x * m[0] + p.y * m[4] + p.z * m[8] + m[12], p.x * m[1] + p.y * m[5] + p.z * m[9] + m[13],
+                                              p.x * m[2] + p.y * m[6] + p.z * m[10] + m[14]);
+                        }
+                    }),
+                    timePoints(&Detail::MatrixTransformPoints<Detail::VFloat4Scalar>), timePoints(&Detail::MatrixTransformPoints<Detail::VFloat4>));
+        std::printf("  (old loop for transform point: a plain per point expression, there was no such function)\n\n");
+    }
+
+    // ----------------- transform -----------------
+
+    // CTransformComponent::GetTransform() before VTransformSoA: two full matrices and the triple loop multiply
+    VMat4 LegacyGetTransform(const VE::Components::CTransformComponent &component)
+    {
+        const VMat4 S      = VMat4::Scale(component.GetScale());
+        const VMat4 R      = component.GetRotation().ToMat4();
+        VMat4       result = LegacyMultiply(R, S);
+        result.m[12]       = component.GetPosition().x;
+        result.m[13]       = component.GetPosition().y;
+        result.m[14]       = component.GetPosition().z;
+        return result;
+    }
+
+    // Equal as floats, +0 and -0 count as the same: composing with the zeros of full matrices flips some signs
+    size_t CountUnequal(const std::vector<VMat4> &a, const std::vector<VMat4> &b)
+    {
+        size_t unequal = 0;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            for (int k = 0; k < 16; ++k) unequal += a[i].m[k] != b[i].m[k];
+        }
+        return unequal;
+    }
+
+    void RunTransformSize(const VOptions &options, uint32_t count)
+    {
+        std::mt19937                          random(count);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        // Small hierarchies of eight: every eighth entry is a root, the others hang off an earlier entry of their group
+        VTransformSoA                                                  soa;
+        std::vector<std::shared_ptr<VE::Components::CTransformComponent>> components;
+        soa.Reserve(count);
+        components.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const VVector3    position(unit(random) * 100.0f, unit(random) * 100.0f, unit(random) * 100.0f);
+            const VQuaternion rotation = VQuaternion(unit(random), unit(random), unit(random), unit(random) + 1.5f).Normalized();
+            const VVector3    scale(1.0f + unit(random) * 0.5f, 1.0f + unit(random) * 0.5f, 1.0f + unit(random) * 0.5f);
+            const int32_t     parent = i % 8 == 0 ? -1 : static_cast<int32_t>(i - 1 - random() % (i % 8));
+
+            soa.Add(position, rotation, scale, parent);
+
+            // Like AActor::AddComponent does it, one shared allocation per component
+            auto component = std::make_shared<VE::Components::CTransformComponent>(nullptr);
+            component->SetPosition(position);
+            component->SetRotation(rotation);
+            component->SetScale(scale);
+            components.push_back(std::move(component));
+        }
+
+        std::vector<VMat4> legacyWorld(count), componentWorld(count), soaLocal(count), soaWorld(count);
+
+        auto legacyPath = [&] {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const VMat4 local = LegacyGetTransform(*components[i]);
+                legacyWorld[i]    = soa.parent[i] < 0 ? local : LegacyMultiply(local, legacyWorld[soa.parent[i]]);
+            }
+        };
+        auto componentPath = [&] {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const VMat4 local = components[i]->GetTransform();
+                componentWorld[i] = soa.parent[i] < 0 ? local : local * componentWorld[soa.parent[i]];
+            }
+        };
+
+        // Fewer rounds for the big sizes, a 1M round alone takes milliseconds
+        VOptions sized = options;
+        sized.rounds   = std::clamp<uint32_t>(options.rounds * 10000 / count, 3, options.rounds);
+
+        const double legacyNs    = BestNsPerItem(sized, count, legacyPath);
+        const double componentNs = BestNsPerItem(sized, count, componentPath);
+        const double localNs     = BestNsPerItem(sized, count, [&] { soa.ComputeLocalMatrices(soaLocal.data()); });
+        const double worldNs     = BestNsPerItem(sized, count, [&] { soa.ComputeWorldMatrices(soaWorld.data()); });
+        g_Sink = g_Sink + legacyWorld[count / 2].m[5] + componentWorld[count / 2].m[5] + soaLocal[count / 2].m[5] + soaWorld[count / 2].m[5];
+
+        // The SoA path has to give the matrices of the component path
+        std::vector<VMat4> componentLocal(count);
+        for (uint32_t i = 0; i < count; ++i) componentLocal[i] = LegacyGetTransform(*components[i]);
+        const size_t localUnequal = CountUnequal(soaLocal, componentLocal);
+        const size_t worldUnequal = CountUnequal(soaWorld, componentWorld);
+        if (localUnequal != 0 || worldUnequal != 0) g_Failures++;
+
+        std::printf("  %8u  %10.2f %10.2f %10.2f %10.2f   %6.1fx %6.1fx   %s\n", count, legacyNs, componentNs, localNs, worldNs, legacyNs / worldNs, componentNs / worldNs,
+                    localUnequal == 0 && worldUnequal == 0 ? "equal" : "MISMATCH");
+        if (localUnequal != 0 || worldUnequal != 0) std::printf("            %zu local and %zu world floats differ\n", localUnequal, worldUnequal);
+    }
+
+    void RunTransformSuite(const VOptions &options)
+    {
+        std::printf("transform (ns per transform, world = local * parent world, 7 of 8 entries have a parent)\n");
+        std::printf("  %8s  %10s %10s %10s %10s   %7s %7s   %s\n", "count", "old Get", "GetTransf", "SoA local", "SoA world", "vs old", "vs Get", "matrices");
+
+        if (options.count != 0)
+        {
+            RunTransformSize(options, options.count);
+        }
+        else
+        {
+            for (uint32_t count : {10000u, 100000u, 1000000u}) RunTransformSize(options, count);
+        }
+        std::printf("  (old Get: GetTransform() as it was, Scale() * ToMat4() with the triple loop multiply)\n\n");
+    }
+
+    // ----------------- quaternion -----------------
+
+    // VQuaternion::operator*, Rotate() and Slerp() before the kernels, the baseline for the timings
+    VQuaternion LegacyQuaternionMultiply(const VQuaternion &a, const VQuaternion &b)
+    {
+        return VQuaternion{a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y, a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                           a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w, a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+    }
+
+    VVector3 LegacyQuaternionRotate(const VQuaternion &q, const VVector3 &v)
+    {
+        const float       normSq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+        const VQuaternion inverse(-q.x / normSq, -q.y / normSq, -q.z / normSq, q.w / normSq);
+        const VQuaternion result = LegacyQuaternionMultiply(LegacyQuaternionMultiply(q, VQuaternion{v.x, v.y, v.z, 0}), inverse);
+        return {result.x, result.y, result.z};
+    }
+
+    VQuaternion LegacyQuaternionSlerp(const VQuaternion &a, const VQuaternion &other, float t)
+    {
+        float       dot = a.x * other.x + a.y * other.y + a.z * other.z + a.w * other.w;
+        VQuaternion b   = other;
+        if (dot < 0.0f)
+        {
+            b   = VQuaternion(-other.x, -other.y, -other.z, -other.w);
+            dot = -dot;
+        }
+        if (dot > 0.9995f)
+        {
+            const VQuaternion result(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y), a.z + t * (b.z - a.z), a.w + t * (b.w - a.w));
+            const float       length = std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w);
+            return VQuaternion(result.x / length, result.y / length, result.z / length, result.w / length);
+        }
+        const float theta0 = std::acos(std::abs(dot));
+        const float theta  = theta0 * t;
+        const float s0     = std::cos(theta) - dot * std::sin(theta) / std::sin(theta0);
+        const float s1     = std::sin(theta) / std::sin(theta0);
+        return VQuaternion(s0 * a.x + s1 * b.x, s0 * a.y + s1 * b.y, s0 * a.z + s1 * b.z, s0 * a.w + s1 * b.w);
+    }
+
+    // Double precision references, (x y z w)
+    struct VQuatD
+    {
+            double x, y, z, w;
+    };
+
+    VQuatD ToDouble(const VQuaternion &q) { return {q.x, q.y, q.z, q.w}; }
+
+    VQuatD ReferenceMultiply(const VQuatD &a, const VQuatD &b)
+    {
+        return {a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y, a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x, a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+    }
+
+    VQuatD ReferenceNormalize(const VQuatD &q)
+    {
+        const double length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return {q.x / length, q.y / length, q.z / length, q.w / length};
+    }
+
+    // Interpolation along the shorter arc with sin(t a) / sin(a) coefficients, or normalized lerp
+    VQuatD ReferenceInterpolate(const VQuatD &a, VQuatD b, double t, bool spherical)
+    {
+        double dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        if (dot < 0.0)
+        {
+            b   = {-b.x, -b.y, -b.z, -b.w};
+            dot = -dot;
+        }
+        double ca = 1.0 - t, cb = t;
+        if (spherical)
+        {
+            const double angle = std::acos(std::min(dot, 1.0));
+            if (angle > 1e-12)
+            {
+                ca = std::sin((1.0 - t) * angle) / std::sin(angle);
+                cb = std::sin(t * angle) / std::sin(angle);
+            }
+        }
+        const VQuatD result{ca * a.x + cb * b.x, ca * a.y + cb * b.y, ca * a.z + cb * b.z, ca * a.w + cb * b.w};
+        return spherical ? result : ReferenceNormalize(result);
+    }
+
+    double QuaternionError(const VQuaternion &q, const VQuatD &reference)
+    {
+        return std::max({std::fabs(q.x - reference.x), std::fabs(q.y - reference.y), std::fabs(q.z - reference.z), std::fabs(q.w - reference.w)});
+    }
+
+    void RunQuaternionSuite(VOptions options)
+    {
+        // Odd by default so the batches end in a partial group
+        if (options.count == 0) options.count = 4099;
+        const size_t n = options.count;
+        std::printf("quaternion (%zu quaternions)\n", n);
+
+        std::mt19937                          random(4321);
+        std::normal_distribution<float>       normal;
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        auto randomRotation = [&] { return VQuaternion(normal(random), normal(random), normal(random), normal(random)).Normalized(); };
+
+        // Pairs to interpolate: identical, opposite signs (the same rotation), 0.05 and 3.6 degrees apart (the
+        // latter just inside the old Slerp()'s lerp fallback) and random
+        std::vector<VQuaternion> a(n), b(n);
+        std::vector<VVector3>    vectors(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            a[i] = randomRotation();
+            switch (i % 8)
+            {
+                case 0: b[i] = a[i]; break;
+                case 1: b[i] = a[i] * -1.0f; break;
+                case 2: b[i] = (a[i] * VQuaternion::FromAxisAngle(VVector3(unit(random), unit(random), 1.0f), 0.05f)).Normalized(); break;
+                case 3: b[i] = (a[i] * VQuaternion::FromAxisAngle(VVector3(unit(random), unit(random), 1.0f), 3.6f)).Normalized(); break;
+                default: b[i] = randomRotation(); break;
+            }
+            vectors[i] = VVector3(unit(random) * 50.0f, unit(random) * 50.0f, unit(random) * 50.0f);
+        }
+        std::vector<VMat4> matrices(n);
+        for (size_t i = 0; i < n; ++i) matrices[i] = a[i].ToMat4();
+
+        std::vector<VQuaternion> simd(n), scalar(n);
+        std::vector<VVector3>    simdVectors(n), scalarVectors(n);
+        std::vector<VMat4>       simdMatrices(n), scalarMatrices(n);
+        const float              t = 0.3f;
+
+        // Bit exactness, the batches against the scalar backend and against the members
+        auto checkQuaternions = [&](const char *what, auto batch, auto member) {
+            batch.template operator()<Detail::VFloat4>(simd.data());
+            batch.template operator()<Detail::VFloat4Scalar>(scalar.data());
+            ReportBitExact(what, &simd[0].x, &scalar[0].x, n * 4);
+            for (size_t i = 0; i < n; ++i) scalar[i] = member(i);
+            ReportBitExact("  vs members", &simd[0].x, &scalar[0].x, n * 4);
+        };
+        checkQuaternions(
+            "multiply", [&]<typename V>(VQuaternion *out) { Detail::MultiplyQuaternions<V>(a.data(), b.data(), out, n); }, [&](size_t i) { return a[i] * b[i]; });
+        checkQuaternions(
+            "conjugate", [&]<typename V>(VQuaternion *out) { Detail::ConjugateQuaternions<V>(a.data(), out, n); }, [&](size_t i) { return a[i].Conjugated(); });
+        checkQuaternions(
+            "normalize", [&]<typename V>(VQuaternion *out) { Detail::NormalizeQuaternions<V>(b.data(), out, n); }, [&](size_t i) { return b[i].Normalized(); });
+        checkQuaternions(
+            "nlerp", [&]<typename V>(VQuaternion *out) { Detail::NlerpQuaternions<V>(a.data(), b.data(), t, out, n); }, [&](size_t i) { return a[i].Nlerp(b[i], t); });
+        checkQuaternions(
+            "slerp", [&]<typename V>(VQuaternion *out) { Detail::SlerpQuaternions<V>(a.data(), b.data(), t, out, n); }, [&](size_t i) { return a[i].Slerp(b[i], t); });
+        checkQuaternions(
+            "from matrix", [&]<typename V>(VQuaternion *out) { Detail::QuaternionsFromMatrices<V>(matrices.data(), out, n); },
+            [&](size_t i) { return VQuaternion::FromMat4(matrices[i]); });
+
+        Detail::RotateVectors<Detail::VFloat4>(a.data(), vectors.data(), simdVectors.data(), n);
+        Detail::RotateVectors<Detail::VFloat4Scalar>(a.data(), vectors.data(), scalarVectors.data(), n);
+        ReportBitExact("rotate", &simdVectors[0].x, &scalarVectors[0].x, n * 3);
+        for (size_t i = 0; i < n; ++i) scalarVectors[i] = a[i].Rotate(vectors[i]);
+        ReportBitExact("  vs members", &simdVectors[0].x, &scalarVectors[0].x, n * 3);
+
+        Detail::QuaternionsToMatrices<Detail::VFloat4>(a.data(), simdMatrices.data(), n);
+        Detail::QuaternionsToMatrices<Detail::VFloat4Scalar>(a.data(), scalarMatrices.data(), n);
+        ReportBitExact("to matrix", simdMatrices[0].m.data(), scalarMatrices[0].m.data(), n * 16);
+        for (size_t i = 0; i < n; ++i) scalarMatrices[i] = a[i].ToMat4();
+        ReportBitExact("  vs members", simdMatrices[0].m.data(), scalarMatrices[0].m.data(), n * 16);
+
+        // Accuracy of the members against double precision, old Rotate() and Slerp() for comparison
+        double multiplyError = 0.0, rotateError = 0.0, legacyRotateError = 0.0, nlerpError = 0.0, slerpError = 0.0, legacySlerpError = 0.0;
+        double toMatrixError = 0.0, fromMatrixError = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const VQuatD qa = ToDouble(a[i]), qb = ToDouble(b[i]);
+            multiplyError   = std::max(multiplyError, QuaternionError(a[i] * b[i], ReferenceMultiply(qa, qb)));
+
+            // q v q*, a is a unit quaternion up to rounding, so divide by its norm
+            const VQuatD rotated = ReferenceMultiply(ReferenceMultiply(qa, {vectors[i].x, vectors[i].y, vectors[i].z, 0.0}), {-qa.x, -qa.y, -qa.z, qa.w});
+            const double normSq  = qa.x * qa.x + qa.y * qa.y + qa.z * qa.z + qa.w * qa.w;
+            auto vectorError = [&](const VVector3 &v) {
+                return std::max({std::fabs(v.x - rotated.x / normSq), std::fabs(v.y - rotated.y / normSq), std::fabs(v.z - rotated.z / normSq)}) / 50.0;
+            };
+            rotateError       = std::max(rotateError, vectorError(a[i].Rotate(vectors[i])));
+            legacyRotateError = std::max(legacyRotateError, vectorError(LegacyQuaternionRotate(a[i], vectors[i])));
+
+            for (int step = 0; step <= 16; ++step)
+            {
+                const float s    = step / 16.0f;
+                nlerpError       = std::max(nlerpError, QuaternionError(a[i].Nlerp(b[i], s), ReferenceInterpolate(qa, qb, s, false)));
+                slerpError       = std::max(slerpError, QuaternionError(a[i].Slerp(b[i], s), ReferenceInterpolate(qa, qb, s, true)));
+                legacySlerpError = std::max(legacySlerpError, QuaternionError(LegacyQuaternionSlerp(a[i], b[i], s), ReferenceInterpolate(qa, qb, s, true)));
+            }
+
+            const double xx = qa.x * qa.x, yy = qa.y * qa.y, zz = qa.z * qa.z;
+            const double xy = qa.x * qa.y, xz = qa.x * qa.z, yz = qa.y * qa.z;
+            const double wx = qa.w * qa.x, wy = qa.w * qa.y, wz = qa.w * qa.z;
+            const double reference[9] = {1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy), 2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx), 2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)};
+            for (int k = 0; k < 9; ++k) toMatrixError = std::max(toMatrixError, std::fabs(matrices[i].m[(k / 3) * 4 + k % 3] - reference[k]));
+
+            // q and -q are the same rotation
+            const VQuaternion fromMatrix = VQuaternion::FromMat4(matrices[i]);
+            fromMatrixError = std::max(fromMatrixError, std::min(QuaternionError(fromMatrix, qa), QuaternionError(fromMatrix * -1.0f, qa)));
+        }
+        std::printf("  %-28s %.3g max abs\n", "multiply error", multiplyError);
+        std::printf("  %-28s %.3g relative, old %.3g\n", "rotate error", rotateError, legacyRotateError);
+        std::printf("  %-28s %.3g max abs\n", "nlerp error", nlerpError);
+        std::printf("  %-28s %.3g max abs, old %.3g (t in 0..1, sin based reference)\n", "slerp error", slerpError, legacySlerpError);
+        std::printf("  %-28s %.3g max abs\n", "to matrix error", toMatrixError);
+        std::printf("  %-28s %.3g max abs (against the quaternion the matrix was made of)\n", "from matrix error", fromMatrixError);
+
+        // Timings over the arrays, every variant called through a pointer the compiler cannot see through
+        std::printf("\n  %-28s %10s %10s %10s %10s\n", "ns per quaternion", "old", "member", "scalar", Detail::GetSimdBackendName());
+
+        using VQuaternionsKernel = void (*)(const VQuaternion *, const VQuaternion *, VQuaternion *, size_t);
+        using VRotateKernel      = void (*)(const VQuaternion *, const VVector3 *, VVector3 *, size_t);
+        using VToMatrixKernel    = void (*)(const VQuaternion *, VMat4 *, size_t);
+        using VFromMatrixKernel  = void (*)(const VMat4 *, VQuaternion *, size_t);
+
+        auto timeQuaternions = [&](VQuaternionsKernel kernel) {
+            VQuaternionsKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                opaque(a.data(), b.data(), simd.data(), n);
+                g_Sink = g_Sink + simd[n / 2].w;
+            });
+        };
+        auto timeRotate = [&](VRotateKernel kernel) {
+            VRotateKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                opaque(a.data(), vectors.data(), simdVectors.data(), n);
+                g_Sink = g_Sink + simdVectors[n / 2].y;
+            });
+        };
+        auto timeToMatrix = [&](VToMatrixKernel kernel) {
+            VToMatrixKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                opaque(a.data(), simdMatrices.data(), n);
+                g_Sink = g_Sink + simdMatrices[n / 2].m[5];
+            });
+        };
+        auto timeFromMatrix = [&](VFromMatrixKernel kernel) {
+            VFromMatrixKernel volatile opaque = kernel;
+            return BestNsPerItem(options, n, [&] {
+                opaque(matrices.data(), simd.data(), n);
+                g_Sink = g_Sink + simd[n / 2].w;
+            });
+        };
+
+        std::printf("  %-28s %10.2f %10.2f %10.2f %10.2f\n", "multiply", timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = LegacyQuaternionMultiply(x[i], y[i]);
+                    }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = x[i] * y[i];
+                    }),
+                    timeQuaternions(&Detail::MultiplyQuaternions<Detail::VFloat4Scalar>), timeQuaternions(&Detail::MultiplyQuaternions<Detail::VFloat4>));
+        std::printf("  %-28s %10.2f %10.2f %10.2f %10.2f\n", "rotate vector", timeRotate([](const VQuaternion *q, const VVector3 *v, VVector3 *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = LegacyQuaternionRotate(q[i], v[i]);
+                    }),
+                    timeRotate([](const VQuaternion *q, const VVector3 *v, VVector3 *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = q[i].Rotate(v[i]);
+                    }),
+                    timeRotate(&Detail::RotateVectors<Detail::VFloat4Scalar>), timeRotate(&Detail::RotateVectors<Detail::VFloat4>));
+        std::printf("  %-28s %10s %10.2f %10.2f %10.2f\n", "nlerp", "-", timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = x[i].Nlerp(y[i], 0.3f);
+                    }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) { Detail::NlerpQuaternions<Detail::VFloat4Scalar>(x, y, 0.3f, out, count); }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) { Detail::NlerpQuaternions<Detail::VFloat4>(x, y, 0.3f, out, count); }));
+        std::printf("  %-28s %10.2f %10.2f %10.2f %10.2f\n", "slerp", timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = LegacyQuaternionSlerp(x[i], y[i], 0.3f);
+                    }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = x[i].Slerp(y[i], 0.3f);
+                    }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) { Detail::SlerpQuaternions<Detail::VFloat4Scalar>(x, y, 0.3f, out, count); }),
+                    timeQuaternions([](const VQuaternion *x, const VQuaternion *y, VQuaternion *out, size_t count) { Detail::SlerpQuaternions<Detail::VFloat4>(x, y, 0.3f, out, count); }));
+        std::printf("  %-28s %10s %10.2f %10.2f %10.2f\n", "to matrix", "-", timeToMatrix([](const VQuaternion *q, VMat4 *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = q[i].ToMat4();
+                    }),
+                    timeToMatrix(&Detail::QuaternionsToMatrices<Detail::VFloat4Scalar>), timeToMatrix(&Detail::QuaternionsToMatrices<Detail::VFloat4>));
+        std::printf("  %-28s %10s %10.2f %10.2f %10.2f\n", "from matrix", "-", timeFromMatrix([](const VMat4 *m, VQuaternion *out, size_t count) {
+                        for (size_t i = 0; i < count; ++i) out[i] = VQuaternion::FromMat4(m[i]);
+                    }),
+                    timeFromMatrix(&Detail::QuaternionsFromMatrices<Detail::VFloat4Scalar>), timeFromMatrix(&Detail::QuaternionsFromMatrices<Detail::VFloat4>));
+        std::printf("  (old: the members as they were, a loop over them; member: the new members in a loop; to matrix did not change,\n"
+                    "   nlerp and from matrix are new)\n\n");
+    }
+
+    // ----------------- functions -----------------
+
+    // Built by the compiler, compared against the same calls at run time
+    constexpr VMat4 g_ConstexprProjection = VMat4::Perspective(60.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+    constexpr auto  g_ConstexprYaws       = [] {
+        std::array<VMat4, 360> table{};
+        for (int degrees = 0; degrees < 360; ++degrees) table[degrees] = VMat4::RotationYaw(static_cast<float>(degrees));
+        return table;
+    }();
+    static_assert(VE::Math::Sqrt(2.25f) == 1.5f && VE::Math::Sin(0.0f) == 0.0f && VE::Math::Cos(0.0f) == 1.0f);
+
+    uint32_t WorstUlp(const VMat4 &a, const VMat4 &b)
+    {
+        uint32_t worst = 0;
+        for (int k = 0; k < 16; ++k) worst = std::max(worst, UlpDistance(a.m[k], b.m[k]));
+        return worst;
+    }
+
+    void RunFunctionsSuite(VOptions options)
+    {
+        using VE::Math::VPrecision;
+
+        if (options.count == 0) options.count = 1 << 16;
+        std::printf("functions (%u inputs per timing)\n", options.count);
+
+        // Errors in ulp against the double precision function rounded to float, over evenly spaced inputs
+        constexpr uint32_t samples = 1 << 22;
+        std::printf("  %-28s %10s %10s\n", "max error (ulp)", "constexpr", "C library");
+        struct VTrig
+        {
+                const char *name;
+                float (*ours)(float);
+                float (*library)(float);
+                double (*reference)(double);
+        };
+        const VTrig trig[] = {
+            {"sin", [](float x) { return VE::Math::Sin(x, VPrecision::Fast); }, [](float x) { return std::sin(x); }, [](double x) { return std::sin(x); }},
+            {"cos", [](float x) { return VE::Math::Cos(x, VPrecision::Fast); }, [](float x) { return std::cos(x); }, [](double x) { return std::cos(x); }},
+            {"tan", [](float x) { return VE::Math::Tan(x, VPrecision::Fast); }, [](float x) { return std::tan(x); }, [](double x) { return std::tan(x); }},
+        };
+        for (const VTrig &function : trig)
+        {
+            for (float range : {VE::Math::VTAU, 1000.0f, 1e6f})
+            {
+                uint32_t ours = 0, library = 0;
+                for (uint32_t i = 0; i <= samples; ++i)
+                {
+                    const float x         = range * (2.0f * static_cast<float>(i) / samples - 1.0f);
+                    const float reference = static_cast<float>(function.reference(x));
+                    ours                  = std::max(ours, UlpDistance(function.ours(x), reference));
+                    library               = std::max(library, UlpDistance(function.library(x), reference));
+                }
+                char label[64];
+                std::snprintf(label, sizeof(label), "%s |x| <= %g", function.name, range);
+                std::printf("  %-28s %10u %10u\n", label, ours, library);
+                if (ours > 1) g_Failures++;
+            }
+        }
+
+        // Square roots over [1, 4), every float: the rounding only depends on the mantissa and the exponent's parity
+        uint32_t sqrtUlp = 0, rsqrtUlp = 0, libraryRsqrtUlp = 0;
+        double   fastRsqrtError = 0.0;
+        for (float x = 1.0f; x < 4.0f; x = std::nextafter(x, 4.0f))
+        {
+            const double exact = 1.0 / std::sqrt(static_cast<double>(x));
+            sqrtUlp            = std::max(sqrtUlp, UlpDistance(VE::Math::Detail::ConstexprSqrt(x), std::sqrt(x)));
+            rsqrtUlp           = std::max(rsqrtUlp, UlpDistance(VE::Math::Detail::ConstexprRSqrt(x), static_cast<float>(exact)));
+            libraryRsqrtUlp    = std::max(libraryRsqrtUlp, UlpDistance(1.0f / std::sqrt(x), static_cast<float>(exact)));
+            fastRsqrtError     = std::max(fastRsqrtError, std::fabs(VE::Math::RSqrt(x, VPrecision::Fast) - exact) / exact);
+        }
+        std::printf("  %-28s %10u %10u\n", "sqrt [1, 4)", sqrtUlp, 0u);
+        std::printf("  %-28s %10u %10u   (C library: 1 / std::sqrt)\n", "rsqrt [1, 4)", rsqrtUlp, libraryRsqrtUlp);
+        std::printf("  %-28s %10.3g relative\n", "rsqrt Fast [1, 4)", fastRsqrtError);
+        if (sqrtUlp != 0 || rsqrtUlp > 1) g_Failures++;
+
+        // Compile time against run time, Exact uses the C library at run time
+        uint32_t yawUlp = 0;
+        for (int degrees = 0; degrees < 360; ++degrees) yawUlp = std::max(yawUlp, WorstUlp(g_ConstexprYaws[degrees], VMat4::RotationYaw(static_cast<float>(degrees))));
+        std::printf("  %-28s %10u ulp\n", "constexpr Perspective", WorstUlp(g_ConstexprProjection, VMat4::Perspective(60.0f, 16.0f / 9.0f, 0.1f, 500.0f)));
+        std::printf("  %-28s %10u ulp\n", "constexpr RotationYaw table", yawUlp);
+
+        // Timings
+        std::vector<float> angles(options.count), wide(options.count), positives(options.count), results(options.count);
+        std::mt19937       random(99);
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            angles[i]    = std::uniform_real_distribution<float>(-VE::Math::VPI, VE::Math::VPI)(random);
+            wide[i]      = std::uniform_real_distribution<float>(-1000.0f, 1000.0f)(random);
+            positives[i] = std::uniform_real_distribution<float>(1e-3f, 1e3f)(random);
+        }
+
+        using VArrayKernel = void (*)(const float *, float *, size_t);
+        auto time          = [&](const std::vector<float> &inputs, VArrayKernel kernel) {
+            VArrayKernel volatile opaque = kernel;
+            return BestNsPerItem(options, inputs.size(), [&] {
+                opaque(inputs.data(), results.data(), inputs.size());
+                g_Sink = g_Sink + results[inputs.size() / 2];
+            });
+        };
+
+        std::printf("\n  %-28s %10s %10s\n", "ns per call", "C library", "Fast");
+#define VANTOR_TIME_FUNCTION(label, inputs, library, fast)                                                                                                    \
+    std::printf("  %-28s %10.2f %10.2f\n", label, time(inputs, [](const float *in, float *out, size_t count) {                                                  \
+                    for (size_t i = 0; i < count; ++i) out[i] = library;                                                                                        \
+                }),                                                                                                                                             \
+                time(inputs, [](const float *in, float *out, size_t count) {                                                                                    \
+                    for (size_t i = 0; i < count; ++i) out[i] = fast;                                                                                           \
+                }))
+        VANTOR_TIME_FUNCTION("sin |x| <= pi", angles, std::sin(in[i]), VE::Math::Sin(in[i], VPrecision::Fast));
+        VANTOR_TIME_FUNCTION("sin |x| <= 1000", wide, std::sin(in[i]), VE::Math::Sin(in[i], VPrecision::Fast));
+        VANTOR_TIME_FUNCTION("cos |x| <= pi", angles, std::cos(in[i]), VE::Math::Cos(in[i], VPrecision::Fast));
+        VANTOR_TIME_FUNCTION("tan |x| <= pi", angles, std::tan(in[i]), VE::Math::Tan(in[i], VPrecision::Fast));
+        VANTOR_TIME_FUNCTION("sqrt", positives, std::sqrt(in[i]), VE::Math::Detail::ConstexprSqrt(in[i]));
+        VANTOR_TIME_FUNCTION("rsqrt", positives, 1.0f / std::sqrt(in[i]), VE::Math::RSqrt(in[i], VPrecision::Fast));
+#undef VANTOR_TIME_FUNCTION
+        std::printf("  (sqrt Fast is std::sqrt, the column shows the constexpr iteration for comparison)\n\n");
+    }
+
+    // ----------------- fastmath -----------------
+
+    using VE::Math::VAccuracy;
+
+    enum class VErrorKind
+    {
+        Relative,
+        Absolute,
+        RelativeAbove1 // absolute where the result is below 1 in magnitude
+    };
+
+    constexpr const char *ErrorKindName(VErrorKind kind)
+    {
+        return kind == VErrorKind::Relative ? "relative" : kind == VErrorKind::Absolute ? "absolute" : "rel, abs <1";
+    }
+
+    // One per function: the kernel, the public scalar and batch versions, the reference and the sweep domain
+    struct VFastRSqrt
+    {
+            static constexpr const char *Name  = "rsqrt";
+            static constexpr VErrorKind  Error = VErrorKind::Relative;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V) { return Detail::RSqrt<A>(a); }
+            template <VAccuracy A> static void          Batch(const float *a, const float *, float *out, size_t count) { VE::Math::FastRSqrt<A>(a, out, count); }
+            template <VAccuracy A> static float         Scalar(float a, float) { return VE::Math::FastRSqrt<A>(a); }
+            static float                                Library(float a, float) { return 1.0f / std::sqrt(a); }
+            static double                               Reference(double a, double) { return 1.0 / std::sqrt(a); }
+
+            // Every binade of the positive normal floats
+            static void Generate(size_t i, size_t count, float &a, float &) { a = std::exp2(-126.0f + 253.0f * static_cast<float>(i) / count); }
+    };
+
+    struct VFastExp
+    {
+            static constexpr const char *Name  = "exp";
+            static constexpr VErrorKind  Error = VErrorKind::Relative;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V) { return Detail::Exp<A>(a); }
+            template <VAccuracy A> static void          Batch(const float *a, const float *, float *out, size_t count) { VE::Math::FastExp<A>(a, out, count); }
+            template <VAccuracy A> static float         Scalar(float a, float) { return VE::Math::FastExp<A>(a); }
+            static float                                Library(float a, float) { return std::exp(a); }
+            static double                               Reference(double a, double) { return std::exp(a); }
+
+            // Normal results
+            static void Generate(size_t i, size_t count, float &a, float &) { a = -87.33f + 176.04f * static_cast<float>(i) / count; }
+    };
+
+    struct VFastLog
+    {
+            static constexpr const char *Name  = "log";
+            static constexpr VErrorKind  Error = VErrorKind::RelativeAbove1;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V) { return Detail::Log<A>(a); }
+            template <VAccuracy A> static void          Batch(const float *a, const float *, float *out, size_t count) { VE::Math::FastLog<A>(a, out, count); }
+            template <VAccuracy A> static float         Scalar(float a, float) { return VE::Math::FastLog<A>(a); }
+            static float                                Library(float a, float) { return std::log(a); }
+            static double                               Reference(double a, double) { return std::log(a); }
+
+            // Subnormals to the largest binade
+            static void Generate(size_t i, size_t count, float &a, float &) { a = std::exp2(-149.0f + 277.0f * static_cast<float>(i) / count); }
+    };
+
+    struct VFastPow
+    {
+            static constexpr const char *Name  = "pow";
+            static constexpr VErrorKind  Error = VErrorKind::Relative;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V b) { return Detail::Pow<A>(a, b); }
+            template <VAccuracy A> static void          Batch(const float *a, const float *b, float *out, size_t count) { VE::Math::FastPow<A>(a, b, out, count); }
+            template <VAccuracy A> static float         Scalar(float a, float b) { return VE::Math::FastPow<A>(a, b); }
+            static float                                Library(float a, float b) { return std::pow(a, b); }
+            static double                               Reference(double a, double b) { return std::pow(a, b); }
+
+            // x in [2^-10, 2^10], y in [-8, 8] on a 1024 x N / 1024 grid, |y log x| <= 55
+            static void Generate(size_t i, size_t count, float &a, float &b)
+            {
+                const size_t columns = 1024, rows = std::max<size_t>(count / columns, 1);
+                a                    = std::exp2(-10.0f + 20.0f * static_cast<float>(i % columns) / columns);
+                b                    = -8.0f + 16.0f * static_cast<float>(i / columns % rows) / rows;
+            }
+    };
+
+    struct VFastAtan2
+    {
+            static constexpr const char *Name  = "atan2";
+            static constexpr VErrorKind  Error = VErrorKind::Absolute;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V b) { return Detail::Atan2<A>(a, b); }
+            template <VAccuracy A> static void          Batch(const float *a, const float *b, float *out, size_t count) { VE::Math::FastAtan2<A>(a, b, out, count); }
+            template <VAccuracy A> static float         Scalar(float a, float b) { return VE::Math::FastAtan2<A>(a, b); }
+            static float                                Library(float a, float b) { return std::atan2(a, b); }
+            static double                               Reference(double a, double b) { return std::atan2(a, b); }
+
+            // Points all around the circle at radii from 2^-20 to 2^20
+            static void Generate(size_t i, size_t count, float &a, float &b)
+            {
+                const double angle  = -3.14159265358979 + 6.28318530717959 * static_cast<double>(i) / count;
+                const double radius = std::exp2(-20.0 + 40.0 * static_cast<double>(i * 7919 % count) / count);
+                a                   = static_cast<float>(radius * std::sin(angle));
+                b                   = static_cast<float>(radius * std::cos(angle));
+            }
+    };
+
+    template <bool Cos> struct VFastSinCos
+    {
+            static constexpr const char *Name  = Cos ? "cos (SinCos)" : "sin (SinCos)";
+            static constexpr VErrorKind  Error = VErrorKind::Absolute;
+
+            template <VAccuracy A, typename V> static V Kernel(V a, V)
+            {
+                V sin, cos;
+                Detail::SinCos<A>(a, sin, cos);
+                return Cos ? cos : sin;
+            }
+            template <VAccuracy A> static void Batch(const float *a, const float *, float *out, size_t count)
+            {
+                std::vector<float> other(count);
+                Cos ? VE::Math::FastSinCos<A>(a, other.data(), out, count) : VE::Math::FastSinCos<A>(a, out, other.data(), count);
+            }
+            template <VAccuracy A> static float Scalar(float a, float)
+            {
+                const VE::Math::VSinCos sinCos = VE::Math::FastSinCos<A>(a);
+                return Cos ? sinCos.cos : sinCos.sin;
+            }
+            static float  Library(float a, float) { return Cos ? std::cos(a) : std::sin(a); }
+            static double Reference(double a, double) { return Cos ? std::cos(a) : std::sin(a); }
+
+            static void Generate(size_t i, size_t count, float &a, float &) { a = -8192.0f + 16384.0f * static_cast<float>(i) / count; }
+    };
+
+    // Largest error of out against the double precision reference over the sweep
+    template <typename F> double SweepError(const std::vector<float> &a, const std::vector<float> &b, const std::vector<float> &out)
+    {
+        double worst = 0.0;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            const double reference = F::Reference(a[i], b[i]);
+            double       error     = std::fabs(out[i] - reference);
+            if (F::Error == VErrorKind::Relative) error /= std::fabs(reference);
+            if (F::Error == VErrorKind::RelativeAbove1) error /= std::max(std::fabs(reference), 1.0);
+            if (!(error <= worst)) worst = error; // NaN sticks
+        }
+        return worst;
+    }
+
+    template <typename F, VAccuracy A> void CheckFastBackends(const std::vector<float> &a, const std::vector<float> &b, std::vector<float> &out)
+    {
+        // The compiled backend (the batch), the scalar backend and the scalar function have to agree
+        const size_t       count = a.size();
+        std::vector<float> scalarBackend(count), scalarFunction(count);
+        F::template Batch<A>(a.data(), b.data(), out.data(), count);
+        for (size_t i = 0; i < count; i += 4)
+        {
+            float lanesA[4] = {}, lanesB[4] = {}, lanes[4];
+            for (size_t k = 0; k < 4 && i + k < count; ++k)
+            {
+                lanesA[k] = a[i + k];
+                lanesB[k] = b[i + k];
+            }
+            Detail::VFloat4Scalar::Store(lanes, F::template Kernel<A>(Detail::VFloat4Scalar::Load(lanesA), Detail::VFloat4Scalar::Load(lanesB)));
+            for (size_t k = 0; k < 4 && i + k < count; ++k) scalarBackend[i + k] = lanes[k];
+        }
+        for (size_t i = 0; i < count; ++i) scalarFunction[i] = F::template Scalar<A>(a[i], b[i]);
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s %s backends", F::Name, A == VAccuracy::Medium ? "Medium" : "Low");
+        ReportBitExact(label, out.data(), scalarBackend.data(), count);
+        std::snprintf(label, sizeof(label), "%s %s scalar function", F::Name, A == VAccuracy::Medium ? "Medium" : "Low");
+        ReportBitExact(label, out.data(), scalarFunction.data(), count);
+    }
+
+    struct VFastResult
+    {
+            const char *name;
+            VErrorKind  kind;
+            double      error[4]; // C library, Exact, Medium, Low
+            double      ns[4];    // C library, Medium, Low, Medium scalar function
+    };
+
+    template <typename F> VFastResult RunFastFunction(const VOptions &options, size_t sweep)
+    {
+        VFastResult result{F::Name, F::Error, {}, {}};
+
+        // Error sweep, odd counts so the batch tails are covered too
+        std::vector<float> a(sweep), b(sweep), out(sweep);
+        for (size_t i = 0; i < sweep; ++i) F::Generate(i, sweep, a[i], b[i]);
+
+        for (size_t i = 0; i < sweep; ++i) out[i] = F::Library(a[i], b[i]);
+        result.error[0] = SweepError<F>(a, b, out);
+        F::template Batch<VAccuracy::Exact>(a.data(), b.data(), out.data(), sweep);
+        result.error[1] = SweepError<F>(a, b, out);
+        CheckFastBackends<F, VAccuracy::Medium>(a, b, out);
+        result.error[2] = SweepError<F>(a, b, out);
+        CheckFastBackends<F, VAccuracy::Low>(a, b, out);
+        result.error[3] = SweepError<F>(a, b, out);
+        if (!(result.error[2] <= 1e-5) || !(result.error[3] <= 1e-3)) g_Failures++;
+
+        // Timings over shuffled inputs from the same domain
+        std::vector<float> inputsA(options.count), inputsB(options.count), results(options.count);
+        std::mt19937       random(23);
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            const size_t k = std::uniform_int_distribution<size_t>(0, sweep - 1)(random);
+            inputsA[i]     = a[k];
+            inputsB[i]     = b[k];
+        }
+
+        using VArrayKernel = void (*)(const float *, const float *, float *, size_t);
+        auto time          = [&](VArrayKernel kernel) {
+            VArrayKernel volatile opaque = kernel;
+            return BestNsPerItem(options, options.count, [&] {
+                opaque(inputsA.data(), inputsB.data(), results.data(), options.count);
+                g_Sink = g_Sink + results[options.count / 2];
+            });
+        };
+        result.ns[0] = time([](const float *x, const float *y, float *o, size_t count) {
+            for (size_t i = 0; i < count; ++i) o[i] = F::Library(x[i], y[i]);
+        });
+        result.ns[1] = time([](const float *x, const float *y, float *o, size_t count) { F::template Batch<VAccuracy::Medium>(x, y, o, count); });
+        result.ns[2] = time([](const float *x, const float *y, float *o, size_t count) { F::template Batch<VAccuracy::Low>(x, y, o, count); });
+        result.ns[3] = time([](const float *x, const float *y, float *o, size_t count) {
+            for (size_t i = 0; i < count; ++i) o[i] = F::template Scalar<VAccuracy::Medium>(x[i], y[i]);
+        });
+        return result;
+    }
+
+    void RunFastMathSuite(VOptions options)
+    {
+        if (options.count == 0) options.count = 1 << 16;
+        constexpr size_t sweep = (1 << 20) + 3;
+        std::printf("fastmath (%zu sweep points, %u inputs per timing)\n", sweep, options.count);
+
+        const VFastResult results[] = {
+            RunFastFunction<VFastRSqrt>(options, sweep), RunFastFunction<VFastExp>(options, sweep),          RunFastFunction<VFastLog>(options, sweep),
+            RunFastFunction<VFastPow>(options, sweep),   RunFastFunction<VFastAtan2>(options, sweep),        RunFastFunction<VFastSinCos<false>>(options, sweep),
+            RunFastFunction<VFastSinCos<true>>(options, sweep),
+        };
+
+        std::printf("\n  %-14s %-12s %10s %10s %10s %10s\n", "max error", "", "C library", "Exact", "Medium", "Low");
+        for (const VFastResult &r : results)
+            std::printf("  %-14s %-12s %10.2g %10.2g %10.2g %10.2g\n", r.name, ErrorKindName(r.kind), r.error[0], r.error[1], r.error[2], r.error[3]);
+
+        std::printf("\n  %-14s %10s %10s %10s %10s\n", "ns per call", "C library", "Medium", "Low", "Medium 1x1");
+        for (const VFastResult &r : results) std::printf("  %-14s %10.2f %10.2f %10.2f %10.2f\n", r.name, r.ns[0], r.ns[1], r.ns[2], r.ns[3]);
+        std::printf("  (batches, Medium 1x1 is the scalar function called per element; SinCos computes both in each timing)\n\n");
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--suite")
+            {
+                options.suite = argv[i + 1];
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--count") options.count = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorMathBenchmark [--suite all|matrix|transform|quat|functions|fastmath] [--count N] [--rounds N]\n");
+        return 1;
+    }
+
+#if defined(VANTOR_MATH_FMA)
+    std::printf("backend %s, fused multiply-add\n\n", Detail::GetSimdBackendName());
+#else
+    std::printf("backend %s\n\n", Detail::GetSimdBackendName());
+#endif
+
+    bool ran = false;
+    if (options.suite == "all" || options.suite == "matrix")
+    {
+        RunMatrixSuite(options);
+        ran = true;
+    }
+    if (options.suite == "all" || options.suite == "transform")
+    {
+        RunTransformSuite(options);
+        ran = true;
+    }
+    if (options.suite == "all" || options.suite == "quat")
+    {
+        RunQuaternionSuite(options);
+        ran = true;
+    }
+    if (options.suite == "all" || options.suite == "functions")
+    {
+        RunFunctionsSuite(options);
+        ran = true;
+    }
+    if (options.suite == "all" || options.suite == "fastmath")
+    {
+        RunFastMathSuite(options);
+        ran = true;
+    }
+    if (!ran)
+    {
+        std::fprintf(stderr, "Unknown suite %.*s\n", static_cast<int>(options.suite.size()), options.suite.data());
+        return 1;
+    }
+
+    if (g_Failures != 0) std::printf("%d check(s) failed\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
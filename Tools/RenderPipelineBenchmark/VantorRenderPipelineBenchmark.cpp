@@ -0,0 +1,233 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorRenderPipelineBenchmark - game thread / render thread pipelining on the null RHI device
+//
+//   VantorRenderPipelineBenchmark [--objects N] [--frames N] [--drawcost NS] [--meshes N]
+//
+// Every frame the game thread moves --objects objects, fills a frame packet with their transforms,
+// the camera and a few lights, and submits it through VRenderThread. The render stage walks the
+// packet like the forward pass does (uniform updates and one draw per command) against a NullDevice
+// that busy waits --drawcost nanoseconds per draw to stand in for the driver.
+//
+// It runs twice, serial (render stage on the game thread) and pipelined (render thread), and reports:
+//
+//   throughput  frames per second over --frames frames
+//   latency     time from the start of a frame's simulation to the end of its render stage
+//   wait        time the game thread spent blocked in Submit()
+//
+// Pipelining only pays off with a spare hardware thread, the thread count is printed along.
+
+#include <RenderPipeline/Pipeline/VREP_RenderThread.hpp>
+
+#include <RHI/Null/VRHI_NullDevice.hpp>
+
+#include <Core/Types/VCO_Name.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using VClock = std::chrono::steady_clock;
+
+    struct VOptions
+    {
+            uint32_t objects  = 5000;
+            uint32_t frames   = 600;
+            uint32_t drawCost = 200; // ns
+            uint32_t meshes   = 16;
+    };
+
+    struct VScene
+    {
+            std::vector<VE::Math::VVector3> positions;
+            std::vector<VE::Math::VVector3> velocities;
+            std::vector<float>              yaws;
+
+            explicit VScene(uint32_t count)
+            {
+                positions.resize(count);
+                velocities.resize(count);
+                yaws.resize(count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    positions[i]  = VE::Math::VVector3(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100));
+                    velocities[i] = VE::Math::VVector3(static_cast<float>(i % 7) - 3.0f, 0.0f, static_cast<float>(i % 5) - 2.0f);
+                    yaws[i]       = static_cast<float>(i % 360);
+                }
+            }
+
+            void Tick(float dt)
+            {
+                for (size_t i = 0; i < positions.size(); ++i)
+                {
+                    positions[i] = positions[i] + velocities[i] * dt;
+                    if (positions[i].x < 0.0f || positions[i].x > 100.0f) velocities[i].x = -velocities[i].x;
+                    if (positions[i].z < 0.0f || positions[i].z > 100.0f) velocities[i].z = -velocities[i].z;
+                    yaws[i] += 90.0f * dt;
+                }
+            }
+    };
+
+    struct VResult
+    {
+            double fps            = 0.0;
+            double latencyMeanMs  = 0.0;
+            double latencyP99Ms   = 0.0;
+            double gameWaitMs     = 0.0; // per frame
+            double renderMs       = 0.0; // per frame
+            uint64_t drawCalls    = 0;
+            double   checksum     = 0.0;
+    };
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg   = argv[i];
+            const uint32_t         value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+
+            if (arg == "--objects" && value > 0) options.objects = value;
+            else if (arg == "--frames" && value > 0) options.frames = value;
+            else if (arg == "--drawcost") options.drawCost = value;
+            else if (arg == "--meshes" && value > 0) options.meshes = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+
+    VResult Run(const VOptions &options, bool threaded)
+    {
+        namespace RP  = VE::Internal::RenderPipeline;
+        namespace RHI = VE::Internal::RHI;
+
+        RHI::NullDevice device;
+        device.Initialize();
+        device.SetDrawCost(options.drawCost);
+
+        const std::shared_ptr<RHI::IRHIShader> shader = device.CreateShader("", "");
+        std::vector<std::shared_ptr<RHI::IRHIMesh>> meshes;
+        for (uint32_t i = 0; i < options.meshes; ++i)
+        {
+            meshes.push_back(device.CreateMesh(nullptr, 0, nullptr, 0, RHI::VVertexLayout()));
+        }
+
+        // Written by the game thread before a frame is submitted, read by the render stage after it got the frame
+        std::vector<VClock::time_point> simStart(options.frames);
+        std::vector<VClock::time_point> renderEnd(options.frames);
+        double checksum = 0.0; // render stage only
+
+        RP::VRenderThreadDesc desc;
+        desc.threaded = threaded;
+        RP::VRenderThread pipeline(
+            [&](RP::VFramePacket &packet) {
+                for (const RP::VRenderCommand &command : packet.Commands.GetForwardRenderCommands())
+                {
+                    shader->Use();
+                    shader->SetMat4(VE_NAME("uModel"), command.Transform);
+                    shader->SetMat4(VE_NAME("uView"), packet.Camera.View);
+                    shader->SetMat4(VE_NAME("uProj"), packet.Camera.Projection);
+                    shader->SetVec3(VE_NAME("uCameraPos"), packet.Camera.Position);
+                    // The model pointer only carries the mesh index here, there are no loaded models
+                    meshes[reinterpret_cast<uintptr_t>(command.Model) % meshes.size()]->Draw();
+                    checksum += command.Transform.m[12];
+                }
+                for (const auto &light : packet.PointLights)
+                {
+                    shader->SetVec3(VE_NAME("uLightPosition"), light.position);
+                }
+                renderEnd[packet.FrameIndex] = VClock::now();
+            },
+            desc);
+
+        VScene scene(options.objects);
+        VE::Internal::Graphics::VPointLightData light = {};
+
+        const auto start = VClock::now();
+        for (uint32_t frame = 0; frame < options.frames; ++frame)
+        {
+            simStart[frame] = VClock::now();
+            scene.Tick(1.0f / 60.0f);
+
+            RP::VFramePacket &packet = pipeline.GetWritePacket();
+            packet.HasCamera         = true;
+            packet.Camera.Position   = VE::Math::VVector3(50.0f, 20.0f, -10.0f + frame * 0.01f);
+            packet.Camera.View       = VE::Math::VMat4::LookAt(packet.Camera.Position, VE::Math::VVector3(50.0f, 0.0f, 50.0f), VE::Math::VVector3(0.0f, 1.0f, 0.0f));
+            packet.Camera.Projection = VE::Math::VMat4::Perspective(60.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                light.position = VE::Math::VVector3(25.0f * i, 10.0f, 50.0f);
+                packet.PointLights.push_back(light);
+            }
+            for (uint32_t i = 0; i < options.objects; ++i)
+            {
+                const VE::Math::VMat4 transform = VE::Math::VMat4::Translate(scene.positions[i]) * VE::Math::VMat4::RotationYaw(scene.yaws[i]);
+                packet.Commands.Push(reinterpret_cast<VE::Graphics::VModel *>(static_cast<uintptr_t>(i)), nullptr, transform);
+            }
+
+            pipeline.Submit();
+        }
+        pipeline.Flush();
+        const double seconds = std::chrono::duration<double>(VClock::now() - start).count();
+
+        std::vector<double> latencies(options.frames);
+        for (uint32_t frame = 0; frame < options.frames; ++frame)
+        {
+            latencies[frame] = std::chrono::duration<double, std::milli>(renderEnd[frame] - simStart[frame]).count();
+        }
+
+        VResult result;
+        result.fps = options.frames / seconds;
+        for (double latency : latencies)
+        {
+            result.latencyMeanMs += latency / options.frames;
+        }
+        std::sort(latencies.begin(), latencies.end());
+        result.latencyP99Ms = latencies[std::min<size_t>(latencies.size() - 1, latencies.size() * 99 / 100)];
+        result.gameWaitMs   = 1000.0 * pipeline.GetStats().gameWaitSeconds / options.frames;
+        result.renderMs     = 1000.0 * pipeline.GetStats().renderSeconds / options.frames;
+        result.drawCalls    = device.GetStats().drawCalls.load();
+        result.checksum     = checksum;
+        return result;
+    }
+
+    void Print(const char *name, const VResult &result)
+    {
+        std::printf("%-10s %8.1f frames/s   latency mean %7.3f ms, p99 %7.3f ms   render %7.3f ms/frame   game wait %7.3f ms/frame   %llu draws, checksum %.6g\n", name,
+                    result.fps, result.latencyMeanMs, result.latencyP99Ms, result.renderMs, result.gameWaitMs, static_cast<unsigned long long>(result.drawCalls),
+                    result.checksum);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorRenderPipelineBenchmark [--objects N] [--frames N] [--drawcost NS] [--meshes N]\n");
+        return 1;
+    }
+
+    std::printf("%u objects, %u frames, %u ns per draw, %u hardware threads\n\n", options.objects, options.frames, options.drawCost,
+                std::thread::hardware_concurrency());
+
+    const VResult serial    = Run(options, false);
+    const VResult pipelined = Run(options, true);
+    Print("serial", serial);
+    Print("pipelined", pipelined);
+    std::printf("\nspeedup %.2fx, latency %.2fx\n", pipelined.fps / serial.fps, pipelined.latencyMeanMs / serial.latencyMeanMs);
+    return 0;
+}
@@ -0,0 +1,555 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorStringBenchmark - TSafeString against std::string
+//
+//   VantorStringBenchmark [--suite all|fuzz|bench] [--seed N] [--steps N] [--count N] [--rounds N]
+//
+// fuzz   --steps random operations on a few TSafeString / std::string pairs: assign, append, push_back,
+//        replace, substr, copy/move construction and assignment, swap, reserve, clear, element writes and
+//        find. A third of the sources are ranges of the string itself (or the whole string), so the self
+//        aliasing paths of assign/append/replace run as often as the plain ones. After every step both
+//        strings have to match, be null terminated and hash like VName (HashFNV1a). The strings use a
+//        checking allocator, any unknown or size mismatched deallocate and any leak fails the run.
+//        Failures print the seed and step, the exit code is 1.
+//
+// bench  --count names, once short (engine names like "Actor_17", inline in TSafeString) and once long
+//        (asset paths, on the heap in both): construct, copy, build from parts, hash 4x (TSafeString
+//        caches it) and compare. Best of --rounds rounds, in ns per name.
+
+#include <Core/Container/VCO_SafeString.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using VE::Internal::Core::Container::TSafeString;
+using VE::Internal::Core::Types::HashFNV1a;
+
+namespace
+{
+    struct VOptions
+    {
+            std::string_view suite  = "all";
+            uint32_t         seed   = 1;
+            uint32_t         steps  = 200000;
+            uint32_t         count  = 100000;
+            uint32_t         rounds = 20;
+    };
+
+    // Keeps results alive without the cost of storing them
+    volatile size_t g_Sink = 0;
+
+    int g_Failures = 0;
+
+    // Every heap block of the fuzzed strings, to catch double frees, wrong sizes and leaks
+    struct VAllocationLedger
+    {
+            std::unordered_map<void *, size_t> live;
+            size_t                             errors = 0;
+    };
+
+    VAllocationLedger g_Ledger;
+
+    template <typename T> struct VCheckedAllocator
+    {
+            using value_type = T;
+
+            VCheckedAllocator() = default;
+            template <typename U> VCheckedAllocator(const VCheckedAllocator<U> &) {}
+
+            T *allocate(size_t count)
+            {
+                T *ptr = std::allocator<T>().allocate(count);
+                g_Ledger.live[ptr] = count;
+                return ptr;
+            }
+
+            void deallocate(T *ptr, size_t count)
+            {
+                auto it = g_Ledger.live.find(ptr);
+                if (it == g_Ledger.live.end() || it->second != count) g_Ledger.errors++;
+                if (it != g_Ledger.live.end()) g_Ledger.live.erase(it);
+                std::allocator<T>().deallocate(ptr, count);
+            }
+
+            friend bool operator==(const VCheckedAllocator &, const VCheckedAllocator &) { return true; }
+            friend bool operator!=(const VCheckedAllocator &, const VCheckedAllocator &) { return false; }
+    };
+
+    using VFuzzString = TSafeString<VCheckedAllocator<char>>;
+
+    class VFuzzer
+    {
+        public:
+            static constexpr uint32_t SLOTS    = 6;
+            static constexpr size_t   MAX_SIZE = 4096; // longer strings are cleared, self appends double them
+
+            explicit VFuzzer(uint32_t seed) : m_Seed(seed), m_Rng(seed) {}
+
+            // Returns false on the first mismatch
+            bool Run(uint32_t steps)
+            {
+                for (m_Step = 0; m_Step < steps; ++m_Step)
+                {
+                    const uint32_t a = Random(SLOTS);
+                    const uint32_t b = Random(SLOTS);
+                    if (!Step(a, b)) return false;
+                    if (!Verify(a) || !Verify(b)) return false;
+
+                    if (m_Expected[a].size() > MAX_SIZE)
+                    {
+                        m_Actual[a].clear();
+                        m_Expected[a].clear();
+                    }
+                }
+                return true;
+            }
+
+            uint32_t GetOperationCount(size_t op) const { return m_Counts[op]; }
+
+            static constexpr const char *OPERATIONS[] = {"assign",       "assign self", "append",  "append self", "append whole self", "append other",
+                                                         "push_back",    "replace",     "replace self", "substr", "copy assign",  "move assign",
+                                                         "construct",    "swap",        "clear",   "reserve",     "element write",     "find",
+                                                         "compare"};
+            static constexpr size_t      OPERATION_COUNT = sizeof(OPERATIONS) / sizeof(OPERATIONS[0]);
+
+        private:
+            uint32_t Random(uint32_t bound) { return bound == 0 ? 0 : static_cast<uint32_t>(m_Rng() % bound); }
+
+            // Half of the lengths sit around the inline threshold, the rest go up to a few heap growths
+            std::string RandomText()
+            {
+                const size_t length = Random(2) == 0 ? Random(VFuzzString::SSO_THRESHOLD + 4) : Random(100);
+                std::string  text(length, ' ');
+                for (char &c : text)
+                {
+                    c = static_cast<char>('a' + Random(26));
+                }
+                return text;
+            }
+
+            // A range of slot, the length may run past the end (clamped like std::string)
+            std::pair<size_t, size_t> RandomRange(uint32_t slot)
+            {
+                const size_t size = m_Expected[slot].size();
+                const size_t pos  = Random(static_cast<uint32_t>(size + 1));
+                const size_t len  = Random(8) == 0 ? VFuzzString::npos : Random(static_cast<uint32_t>(size - pos + 4));
+                return {pos, len};
+            }
+
+            bool Step(uint32_t a, uint32_t b)
+            {
+                VFuzzString &actual   = m_Actual[a];
+                std::string &expected = m_Expected[a];
+
+                m_Op = Random(static_cast<uint32_t>(OPERATION_COUNT));
+                m_Counts[m_Op]++;
+                switch (m_Op)
+                {
+                    case 0:
+                    {
+                        const std::string text = RandomText();
+                        actual.assign(text.data(), text.size());
+                        expected.assign(text);
+                        break;
+                    }
+                    case 1:
+                    {
+                        const auto [pos, len] = RandomRange(a);
+                        const size_t clamped  = std::min(len, expected.size() - pos);
+                        actual.assign(actual.c_str() + pos, clamped);
+                        expected = expected.substr(pos, clamped);
+                        break;
+                    }
+                    case 2:
+                    {
+                        const std::string text = RandomText();
+                        actual.append(text);
+                        expected.append(text);
+                        break;
+                    }
+                    case 3:
+                    {
+                        const auto [pos, len] = RandomRange(a);
+                        const size_t clamped  = std::min(len, expected.size() - pos);
+                        actual.append(actual.c_str() + pos, clamped);
+                        expected.append(expected.substr(pos, clamped));
+                        break;
+                    }
+                    case 4:
+                    {
+                        actual += actual;
+                        expected += std::string(expected);
+                        break;
+                    }
+                    case 5:
+                    {
+                        actual += m_Actual[b];
+                        expected += std::string(m_Expected[b]);
+                        break;
+                    }
+                    case 6:
+                    {
+                        const char c = static_cast<char>('A' + Random(26));
+                        actual.push_back(c);
+                        expected.push_back(c);
+                        break;
+                    }
+                    case 7:
+                    {
+                        const auto [pos, len] = RandomRange(a);
+                        const std::string text = RandomText();
+                        actual.replace(pos, len, text);
+                        expected.replace(pos, len, text);
+                        break;
+                    }
+                    case 8:
+                    {
+                        const auto [pos, len]       = RandomRange(a);
+                        const auto [source, length] = RandomRange(a);
+                        const size_t clamped        = std::min(length, expected.size() - source);
+                        actual.replace(pos, len, std::string_view(actual.c_str() + source, clamped));
+                        expected.replace(pos, len, expected.substr(source, clamped));
+                        break;
+                    }
+                    case 9:
+                    {
+                        const auto [pos, len]   = RandomRange(a);
+                        const VFuzzString piece = actual.substr(pos, len);
+                        if (piece.view() != expected.substr(pos, len)) return Fail(a, "substr result differs");
+                        if (piece.c_str()[piece.size()] != '\0') return Fail(a, "substr result is not null terminated");
+                        break;
+                    }
+                    case 10:
+                    {
+                        // a == b is a self assignment
+                        actual   = m_Actual[b];
+                        expected = m_Expected[b];
+                        break;
+                    }
+                    case 11:
+                    {
+                        if (a == b) break;
+                        actual   = std::move(m_Actual[b]);
+                        expected = std::move(m_Expected[b]);
+                        if (!m_Actual[b].empty()) return Fail(b, "moved from string is not empty");
+                        m_Expected[b].clear();
+                        break;
+                    }
+                    case 12:
+                    {
+                        VFuzzString copy(actual);
+                        VFuzzString moved(std::move(copy));
+                        if (!copy.empty()) return Fail(a, "moved from string is not empty");
+                        if (moved.view() != expected) return Fail(a, "copy then move constructed string differs");
+                        break;
+                    }
+                    case 13:
+                    {
+                        actual.swap(m_Actual[b]);
+                        expected.swap(m_Expected[b]);
+                        break;
+                    }
+                    case 14:
+                    {
+                        actual.clear();
+                        expected.clear();
+                        break;
+                    }
+                    case 15:
+                    {
+                        const size_t capacity = Random(200);
+                        actual.reserve(capacity);
+                        if (actual.capacity() < capacity) return Fail(a, "reserve did not reach the capacity");
+                        break;
+                    }
+                    case 16:
+                    {
+                        if (expected.empty()) break;
+                        const size_t i = Random(static_cast<uint32_t>(expected.size()));
+                        const char   c = static_cast<char>('0' + Random(10));
+                        actual[i]      = c;
+                        expected[i]    = c;
+                        break;
+                    }
+                    case 17:
+                    {
+                        const auto [pos, len]  = RandomRange(b);
+                        const std::string text = m_Expected[b].substr(pos, std::min<size_t>(len, 4));
+                        const size_t      from = Random(static_cast<uint32_t>(expected.size() + 2));
+                        if (actual.find(text, from) != expected.find(text, from)) return Fail(a, "find differs");
+                        break;
+                    }
+                    case 18:
+                    {
+                        // Both hashes are cached by Verify(), so the hash shortcut of operator== is taken
+                        if ((actual == m_Actual[b]) != (expected == m_Expected[b])) return Fail(a, "operator== differs");
+                        if ((actual < m_Actual[b]) != (expected < m_Expected[b])) return Fail(a, "operator< differs");
+                        break;
+                    }
+                }
+                return true;
+            }
+
+            bool Verify(uint32_t slot)
+            {
+                const VFuzzString &actual   = m_Actual[slot];
+                const std::string &expected = m_Expected[slot];
+                if (actual.view() != expected) return Fail(slot, "contents differ");
+                if (actual.c_str()[actual.size()] != '\0') return Fail(slot, "not null terminated");
+                if (actual.capacity() < actual.size()) return Fail(slot, "capacity below size");
+                if (actual.hash() != HashFNV1a(expected)) return Fail(slot, "stale or wrong hash");
+                return true;
+            }
+
+            bool Fail(uint32_t slot, const char *what)
+            {
+                std::printf("  seed %u step %u (%s on slot %u): %s\n", m_Seed, m_Step, OPERATIONS[m_Op], slot, what);
+                std::printf("    expected \"%s\"\n    actual   \"%.*s\"\n", m_Expected[slot].c_str(), static_cast<int>(m_Actual[slot].size()), m_Actual[slot].c_str());
+                g_Failures++;
+                return false;
+            }
+
+            uint32_t     m_Seed;
+            uint32_t     m_Step = 0;
+            size_t       m_Op   = 0;
+            std::mt19937 m_Rng;
+            VFuzzString  m_Actual[SLOTS];
+            std::string  m_Expected[SLOTS];
+            uint32_t     m_Counts[OPERATION_COUNT] = {};
+    };
+
+    void RunFuzzSuite(const VOptions &options)
+    {
+        std::printf("fuzz: %u steps, seed %u\n", options.steps, options.seed);
+
+        bool                passed = false;
+        std::vector<size_t> counts;
+        {
+            VFuzzer fuzzer(options.seed);
+            passed = fuzzer.Run(options.steps);
+            for (size_t op = 0; op < VFuzzer::OPERATION_COUNT; ++op)
+            {
+                counts.push_back(fuzzer.GetOperationCount(op));
+            }
+        }
+
+        if (g_Ledger.errors != 0)
+        {
+            std::printf("  %zu deallocate calls with an unknown pointer or a wrong size\n", g_Ledger.errors);
+            g_Failures++;
+        }
+        if (!g_Ledger.live.empty())
+        {
+            std::printf("  %zu heap blocks leaked\n", g_Ledger.live.size());
+            g_Failures++;
+        }
+
+        for (size_t op = 0; op < VFuzzer::OPERATION_COUNT; ++op)
+        {
+            std::printf("  %-20s %10zu\n", VFuzzer::OPERATIONS[op], counts[op]);
+        }
+        std::printf("  %s\n\n", passed && g_Failures == 0 ? "passed" : "FAILED");
+    }
+
+    template <typename F> double BestNsPerItem(const VOptions &options, size_t items, F &&run)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best            = std::min(best, ns / static_cast<double>(items));
+        }
+        return best;
+    }
+
+    template <typename S> size_t HashOf(const S &str) { return std::hash<S>{}(str); }
+
+    struct VWorkloadTimes
+    {
+            double construct = 0.0;
+            double copy      = 0.0;
+            double build     = 0.0;
+            double hash      = 0.0;
+            double compare   = 0.0;
+    };
+
+    template <typename S> VWorkloadTimes RunWorkloads(const VOptions &options, const std::vector<std::string> &names, std::string_view prefix)
+    {
+        VWorkloadTimes times;
+        const size_t   count = names.size();
+
+        std::vector<S> strings;
+        strings.reserve(count);
+        times.construct = BestNsPerItem(options, count,
+                                        [&]
+                                        {
+                                            for (const std::string &name : names)
+                                            {
+                                                strings.emplace_back(std::string_view(name));
+                                            }
+                                            g_Sink = g_Sink + strings.back().size();
+                                            strings.clear();
+                                        });
+
+        for (const std::string &name : names)
+        {
+            strings.emplace_back(std::string_view(name));
+        }
+
+        times.copy = BestNsPerItem(options, count,
+                                   [&]
+                                   {
+                                       std::vector<S> copies(strings);
+                                       g_Sink = g_Sink + copies.back().size();
+                                   });
+
+        // prefix + '_' + number + suffix, like generated actor and component names
+        times.build = BestNsPerItem(options, count,
+                                    [&]
+                                    {
+                                        size_t total = 0;
+                                        char   number[16];
+                                        for (size_t i = 0; i < count; ++i)
+                                        {
+                                            const int length = std::snprintf(number, sizeof(number), "%zu", i);
+                                            S         name(prefix);
+                                            name += '_';
+                                            name += std::string_view(number, static_cast<size_t>(length));
+                                            name += std::string_view(".Mesh");
+                                            total += name.size();
+                                        }
+                                        g_Sink = g_Sink + total;
+                                    });
+
+        // Lookups hash the same key over and over (map, set, then the name pool)
+        times.hash = BestNsPerItem(options, count,
+                                   [&]
+                                   {
+                                       size_t total = 0;
+                                       for (const S &str : strings)
+                                       {
+                                           total += HashOf(str) + HashOf(str) + HashOf(str) + HashOf(str);
+                                       }
+                                       g_Sink = g_Sink + total;
+                                   });
+
+        times.compare = BestNsPerItem(options, count,
+                                      [&]
+                                      {
+                                          size_t equal = 0;
+                                          for (size_t i = 0; i < count; ++i)
+                                          {
+                                              equal += strings[i] == strings[(i * 7 + 1) % count];
+                                              equal += strings[i] == strings[i];
+                                          }
+                                          g_Sink = g_Sink + equal;
+                                      });
+        return times;
+    }
+
+    void PrintWorkloads(const char *shape, const VWorkloadTimes &reference, const VWorkloadTimes &safe)
+    {
+        const std::pair<const char *, double VWorkloadTimes::*> workloads[] = {
+            {"construct", &VWorkloadTimes::construct}, {"copy", &VWorkloadTimes::copy},       {"build", &VWorkloadTimes::build},
+            {"hash 4x", &VWorkloadTimes::hash},        {"compare", &VWorkloadTimes::compare},
+        };
+        for (const auto &[name, member] : workloads)
+        {
+            std::printf("  %-8s %-12s %14.2f %14.2f %9.2fx\n", shape, name, reference.*member, safe.*member, reference.*member / safe.*member);
+        }
+    }
+
+    void RunBenchSuite(const VOptions &options)
+    {
+        std::printf("bench: %u names, best of %u rounds, ns per name\n\n", options.count, options.rounds);
+        std::printf("  %-8s %-12s %14s %14s %10s\n", "shape", "workload", "std::string", "TSafeString", "speedup");
+
+        std::vector<std::string> shortNames;
+        std::vector<std::string> longNames;
+        const char              *kinds[] = {"Actor", "Mesh.LOD", "Light", "Camera", "Collider", "Material"};
+        for (uint32_t i = 0; i < options.count; ++i)
+        {
+            shortNames.push_back(std::string(kinds[i % 6]) + "_" + std::to_string(i));
+            longNames.push_back("Assets/Environment/Props/" + std::string(kinds[i % 6]) + "_" + std::to_string(i) + "/BaseColor.png");
+        }
+
+        PrintWorkloads("short", RunWorkloads<std::string>(options, shortNames, "Actor"), RunWorkloads<TSafeString<>>(options, shortNames, "Actor"));
+        PrintWorkloads("long", RunWorkloads<std::string>(options, longNames, "Assets/Environment/Props/Barrel"),
+                       RunWorkloads<TSafeString<>>(options, longNames, "Assets/Environment/Props/Barrel"));
+        std::printf("\n");
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--suite")
+            {
+                options.suite = argv[i + 1];
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--seed") options.seed = value;
+            else if (arg == "--steps") options.steps = value;
+            else if (arg == "--count") options.count = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorStringBenchmark [--suite all|fuzz|bench] [--seed N] [--steps N] [--count N] [--rounds N]\n");
+        return 1;
+    }
+
+    bool ran = false;
+    if (options.suite == "all" || options.suite == "fuzz")
+    {
+        RunFuzzSuite(options);
+        ran = true;
+    }
+    if (options.suite == "all" || options.suite == "bench")
+    {
+        RunBenchSuite(options);
+        ran = true;
+    }
+    if (!ran)
+    {
+        std::fprintf(stderr, "Unknown suite %.*s\n", static_cast<int>(options.suite.size()), options.suite.data());
+        return 1;
+    }
+
+    if (g_Failures != 0) std::printf("%d check(s) failed\n", g_Failures);
+    return g_Failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorTextureImportBenchmark - time and peak memory of VTextureAsset imports
+//
+//   VantorTextureImportBenchmark [--format png|jpg] [--textures N] [--size N] [--channels 3|4] [--rounds N] [--dir PATH]
+//
+// Writes --textures images of --size x --size pixels (noise over gradients, so they compress like real
+// textures) to --dir once, then loads all of them through VTextureAsset::Load() per round and keeps them
+// loaded until the round ends, like a level load does. Prints ms per texture, decoded MB/s and the process
+// peak RSS after the first round (the decode arena plus every live texture). The last line times one
+// memcpy of all decoded pixels, which is what an extra copy out of the decode arena costs.
+// Peak RSS only grows, so compare two builds by running each in its own process.
+
+#include <AssetManager/Public/VAM_TextureAsset.hpp>
+#include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/BackLog/VCO_LogSinks.hpp>
+#include <Core/VCO_Timer.hpp>
+
+#include <stb_image_write.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+using VE::Asset::VTextureAsset;
+
+namespace
+{
+    struct VOptions
+    {
+            bool        jpg      = false;
+            uint32_t    textures = 32;
+            uint32_t    size     = 1024;
+            uint32_t    channels = 4;
+            uint32_t    rounds   = 3;
+            std::string dir      = (std::filesystem::temp_directory_path() / "VantorTextureImport").string();
+    };
+
+    // Peak resident set in MiB, 0 where it can't be read
+    double PeakRssMiB()
+    {
+#if defined(__linux__)
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#else
+        return 0.0;
+#endif
+    }
+
+    std::vector<std::string> WriteTextures(const VOptions &options)
+    {
+        std::filesystem::create_directories(options.dir);
+
+        const int                size     = static_cast<int>(options.size);
+        const int                channels = static_cast<int>(options.channels);
+        std::vector<std::string> paths;
+        std::vector<uint8_t>     pixels(size_t(size) * size * channels);
+        std::mt19937             rng(1);
+
+        for (uint32_t t = 0; t < options.textures; ++t)
+        {
+            char name[64];
+            std::snprintf(name, sizeof(name), "Texture_%u_%u_%u.%s", t, options.size, options.channels, options.jpg ? "jpg" : "png");
+            const std::string path = (std::filesystem::path(options.dir) / name).string();
+            paths.push_back(path);
+            if (std::filesystem::exists(path)) continue;
+
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    uint8_t *pixel = &pixels[(size_t(y) * size + x) * channels];
+                    for (int c = 0; c < channels; ++c)
+                    {
+                        const int gradient = (x * (c + 1) + y * (3 - c) + int(t) * 17) & 255;
+                        pixel[c]           = static_cast<uint8_t>(gradient ^ (rng() & 15));
+                    }
+                }
+            }
+
+            const int written = options.jpg ? stbi_write_jpg(path.c_str(), size, size, channels, pixels.data(), 90)
+                                            : stbi_write_png(path.c_str(), size, size, channels, pixels.data(), size * channels);
+            if (written == 0)
+            {
+                std::fprintf(stderr, "Could not write %s\n", path.c_str());
+                return {};
+            }
+        }
+        return paths;
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+            if (arg == "--format")
+            {
+                const std::string_view format = argv[i + 1];
+                if (format != "png" && format != "jpg") return false;
+                options.jpg = format == "jpg";
+                continue;
+            }
+            if (arg == "--dir")
+            {
+                options.dir = argv[i + 1];
+                continue;
+            }
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--textures") options.textures = value;
+            else if (arg == "--size") options.size = value;
+            else if (arg == "--channels" && (value == 3 || value == 4)) options.channels = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorTextureImportBenchmark [--format png|jpg] [--textures N] [--size N] [--channels 3|4]\n"
+                             "                                    [--rounds N] [--dir PATH]\n");
+        return 1;
+    }
+
+    const std::vector<std::string> paths = WriteTextures(options);
+    if (paths.empty()) return 1;
+
+    // Every load logs a line, only the results are wanted here
+    VE::Internal::Core::Backlog::RemoveSink(VE::Internal::Core::Backlog::GetConsoleSink());
+
+    const double decodedBytes = double(options.size) * options.size * options.channels * options.textures;
+    std::printf("%u %s textures, %ux%u, %u channels, %.1f MiB decoded per round, %u rounds\n\n", options.textures, options.jpg ? "jpg" : "png",
+                options.size, options.size, options.channels, decodedBytes / (1024.0 * 1024.0), options.rounds);
+    std::printf("%-8s %14s %12s %14s\n", "round", "ms/texture", "MB/s", "peak RSS MiB");
+
+    const double baselineRss = PeakRssMiB();
+    double       totalMs     = 0.0;
+    for (uint32_t round = 0; round < options.rounds; ++round)
+    {
+        std::vector<std::unique_ptr<VTextureAsset>> textures;
+        textures.reserve(paths.size());
+
+        VE::Internal::Core::VTimer timer;
+        for (const std::string &path : paths)
+        {
+            auto texture = std::make_unique<VTextureAsset>(path);
+            if (!texture->Load())
+            {
+                std::fprintf(stderr, "Could not load %s\n", path.c_str());
+                return 1;
+            }
+            textures.push_back(std::move(texture));
+        }
+        const double ms = timer.elapsed_milliseconds();
+        totalMs += ms;
+
+        std::printf("%-8u %14.3f %12.1f %14.1f\n", round, ms / paths.size(), decodedBytes / (ms * 1.0e3), PeakRssMiB());
+    }
+
+    std::printf("\naverage %.3f ms/texture, peak RSS %.1f MiB above the %.1f MiB before the first load\n", totalMs / (options.rounds * paths.size()),
+                PeakRssMiB() - baselineRss, baselineRss);
+
+    // Reference: one full copy of every decoded texture
+    std::vector<uint8_t> source(size_t(options.size) * options.size * options.channels, 1);
+    std::vector<uint8_t> target(source.size());
+    VE::Internal::Core::VTimer copyTimer;
+    for (uint32_t t = 0; t < options.textures; ++t)
+    {
+        source[t % source.size()] = static_cast<uint8_t>(t);
+        std::memcpy(target.data(), source.data(), source.size());
+    }
+    std::printf("one memcpy of the decoded pixels: %.3f ms/texture (checksum %u)\n", copyTimer.elapsed_milliseconds() / options.textures, target[0]);
+    return 0;
+}
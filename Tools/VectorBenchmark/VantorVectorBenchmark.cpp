@@ -0,0 +1,312 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VantorVectorBenchmark - TSmallVector and TVector against std::vector
+//
+//   VantorVectorBenchmark [--objects N] [--rounds N]
+//
+// mesh      What VModel::ProcessMesh does: build the vertex (VVertex, 56 bytes) and index (uint32_t)
+//           arrays of a mesh one element at a time from the importer's separate attribute arrays.
+//           "push" grows the arrays as it goes, like ProcessMesh did before it reserved, "reserve"
+//           sizes them up front like it does now. Meshes of 24, 1k and 64k vertices, ns per vertex.
+// small     --objects short lists of 1..8 uint32_t that live for one iteration, like per actor
+//           component lists or per draw binding lists. TSmallVector keeps them inline. ns per list.
+// copy      copy construct a list of 8 and of 4096 uint32_t, ns per copy.
+// insert    insert and erase a range of 16 in the middle of 4096 uint32_t, ns per insert/erase pair.
+// fill      resize(4096, value) from empty, ns per element. TVector has neither range insert nor
+//           resize with a value, so it only runs the first three.
+//
+// Best of --rounds rounds.
+
+#include <Core/Container/VCO_SmallVector.hpp>
+#include <Core/Container/VCO_Vector.hpp>
+#include <Math/Linear/VMA_Vector.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+using VE::Internal::Core::Container::TSmallVector;
+using VE::Internal::Core::Container::TVector;
+
+namespace
+{
+    struct VOptions
+    {
+            uint32_t objects = 100000;
+            uint32_t rounds  = 10;
+    };
+
+    // Same layout as VE::Graphics::VVertex (VGFX_Model.hpp), which pulls in the importer
+    struct VVertex
+    {
+            VE::Math::VVector3 Position;
+            VE::Math::VVector3 Normal;
+            VE::Math::VVector2 TexCoords;
+            VE::Math::VVector3 Tangent;
+            VE::Math::VVector3 Bitangent;
+    };
+
+    static_assert(VE::Internal::Core::Container::TIsTriviallyRelocatable_v<VVertex>, "ProcessMesh relies on VVertex being relocated with memcpy");
+
+    // Keeps results alive without the cost of storing them
+    volatile float g_Sink = 0.0f;
+
+    template <typename F> double BestNsPerItem(const VOptions &options, size_t items, F &&run)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (uint32_t round = 0; round < options.rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best            = std::min(best, ns / static_cast<double>(items));
+        }
+        return best;
+    }
+
+    // Attribute arrays the way the importer hands them over (aiMesh::mVertices, mNormals, ...)
+    struct VSourceMesh
+    {
+            std::vector<VE::Math::VVector3> positions;
+            std::vector<VE::Math::VVector3> normals;
+            std::vector<VE::Math::VVector2> texCoords;
+            std::vector<VE::Math::VVector3> tangents;
+            std::vector<uint32_t>           faces; // triangulated
+
+            explicit VSourceMesh(uint32_t vertexCount)
+            {
+                for (uint32_t i = 0; i < vertexCount; ++i)
+                {
+                    const float f = static_cast<float>(i);
+                    positions.push_back({f, f * 0.5f, -f});
+                    normals.push_back({0.0f, 1.0f, 0.0f});
+                    texCoords.push_back({f * 0.01f, 1.0f - f * 0.01f});
+                    tangents.push_back({1.0f, 0.0f, 0.0f});
+                }
+                // About two triangles per vertex, like a closed grid
+                for (uint32_t i = 0; i < vertexCount * 2; ++i)
+                {
+                    faces.push_back(i % vertexCount);
+                    faces.push_back((i + 1) % vertexCount);
+                    faces.push_back((i + 7) % vertexCount);
+                }
+            }
+    };
+
+    template <typename VertexArray, typename IndexArray> float BuildMesh(const VSourceMesh &source, bool reserve)
+    {
+        VertexArray vertices;
+        IndexArray  indices;
+        if (reserve)
+        {
+            vertices.reserve(source.positions.size());
+            indices.reserve(source.faces.size());
+        }
+
+        for (size_t i = 0; i < source.positions.size(); ++i)
+        {
+            VVertex vertex{};
+            vertex.Position  = source.positions[i];
+            vertex.Normal    = source.normals[i];
+            vertex.TexCoords = source.texCoords[i];
+            vertex.Tangent   = source.tangents[i];
+            vertex.Bitangent = source.tangents[i];
+            vertices.emplace_back(vertex);
+        }
+        for (uint32_t index : source.faces)
+        {
+            indices.push_back(index);
+        }
+        return vertices[vertices.size() / 2].Position.x + static_cast<float>(indices[indices.size() - 1]);
+    }
+
+    // One row of results, NaN where a container does not have the operation
+    void PrintRow(const char *workload, const char *shape, double stdNs, double tvectorNs, double smallNs)
+    {
+        std::printf("%-10s %-12s %12.2f", workload, shape, stdNs);
+        if (!std::isnan(tvectorNs)) std::printf(" %12.2f", tvectorNs);
+        else std::printf(" %12s", "-");
+        std::printf(" %14.2f %9.2fx\n", smallNs, stdNs / smallNs);
+    }
+
+    void RunMesh(const VOptions &options)
+    {
+        for (const uint32_t vertexCount : {24u, 1024u, 65536u})
+        {
+            const VSourceMesh source(vertexCount);
+            const uint32_t    meshes = std::max(1u, (1u << 20) / vertexCount);
+
+            for (const bool reserve : {false, true})
+            {
+                auto run = [&]<typename VertexArray, typename IndexArray>()
+                {
+                    return BestNsPerItem(options, size_t(meshes) * vertexCount,
+                                         [&]
+                                         {
+                                             float sum = 0.0f;
+                                             for (uint32_t m = 0; m < meshes; ++m)
+                                             {
+                                                 sum += BuildMesh<VertexArray, IndexArray>(source, reserve);
+                                             }
+                                             g_Sink = g_Sink + sum;
+                                         });
+                };
+
+                const double stdNs     = run.template operator()<std::vector<VVertex>, std::vector<uint32_t>>();
+                const double tvectorNs = run.template operator()<TVector<VVertex>, TVector<uint32_t>>();
+                const double smallNs   = run.template operator()<TSmallVector<VVertex, 32>, TSmallVector<uint32_t, 96>>();
+
+                char shape[32];
+                std::snprintf(shape, sizeof(shape), "%s %u", reserve ? "reserve" : "push", vertexCount);
+                PrintRow("mesh", shape, stdNs, tvectorNs, smallNs);
+            }
+        }
+    }
+
+    template <typename List> double RunSmallLists(const VOptions &options)
+    {
+        return BestNsPerItem(options, options.objects,
+                             [&]
+                             {
+                                 uint32_t sum = 0;
+                                 for (uint32_t object = 0; object < options.objects; ++object)
+                                 {
+                                     List           list;
+                                     const uint32_t count = 1 + object % 8;
+                                     for (uint32_t i = 0; i < count; ++i)
+                                     {
+                                         list.push_back(object + i);
+                                     }
+                                     for (size_t i = 0; i < list.size(); ++i)
+                                     {
+                                         sum += list[i];
+                                     }
+                                 }
+                                 g_Sink = g_Sink + static_cast<float>(sum);
+                             });
+    }
+
+    template <typename List> double RunCopy(const VOptions &options, uint32_t size)
+    {
+        List source;
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            source.push_back(i);
+        }
+
+        const uint32_t copies = std::max(1u, (1u << 22) / size);
+        return BestNsPerItem(options, copies,
+                             [&]
+                             {
+                                 uint32_t sum = 0;
+                                 for (uint32_t c = 0; c < copies; ++c)
+                                 {
+                                     List copy(source);
+                                     sum += copy[c % size];
+                                 }
+                                 g_Sink = g_Sink + static_cast<float>(sum);
+                             });
+    }
+
+    template <typename List> double RunInsert(const VOptions &options)
+    {
+        List list;
+        for (uint32_t i = 0; i < 4096; ++i)
+        {
+            list.push_back(i);
+        }
+        uint32_t range[16];
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            range[i] = ~i;
+        }
+
+        constexpr uint32_t PAIRS = 4096;
+        return BestNsPerItem(options, PAIRS,
+                             [&]
+                             {
+                                 for (uint32_t p = 0; p < PAIRS; ++p)
+                                 {
+                                     const size_t middle = list.size() / 2 + p % 64;
+                                     list.insert(list.begin() + middle, range, range + 16);
+                                     list.erase(list.begin() + middle, list.begin() + middle + 16);
+                                 }
+                                 g_Sink = g_Sink + static_cast<float>(list[list.size() / 2]);
+                             });
+    }
+
+    template <typename List> double RunFill(const VOptions &options)
+    {
+        constexpr uint32_t SIZE    = 4096;
+        constexpr uint32_t REPEATS = 256;
+        return BestNsPerItem(options, size_t(SIZE) * REPEATS,
+                             [&]
+                             {
+                                 uint32_t sum = 0;
+                                 for (uint32_t r = 0; r < REPEATS; ++r)
+                                 {
+                                     List list;
+                                     list.resize(SIZE, r);
+                                     sum += list[r];
+                                 }
+                                 g_Sink = g_Sink + static_cast<float>(sum);
+                             });
+    }
+
+    bool ParseArguments(int argc, char **argv, VOptions &options)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            const std::string_view arg = argv[i];
+
+            const uint32_t value = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+            if (value == 0) return false;
+
+            if (arg == "--objects") options.objects = value;
+            else if (arg == "--rounds") options.rounds = value;
+            else return false;
+        }
+        return argc % 2 == 1;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    VOptions options;
+    if (!ParseArguments(argc, argv, options))
+    {
+        std::fprintf(stderr, "Usage: VantorVectorBenchmark [--objects N] [--rounds N]\n");
+        return 1;
+    }
+
+    const double none = std::numeric_limits<double>::quiet_NaN();
+
+    std::printf("best of %u rounds, TSmallVector inline sizes: mesh 32 vertices / 96 indices, lists 8\n\n", options.rounds);
+    std::printf("%-10s %-12s %12s %12s %14s %10s\n", "workload", "shape", "std::vector", "TVector", "TSmallVector", "vs std");
+
+    RunMesh(options);
+
+    PrintRow("small", "1..8", RunSmallLists<std::vector<uint32_t>>(options), RunSmallLists<TVector<uint32_t>>(options),
+             RunSmallLists<TSmallVector<uint32_t, 8>>(options));
+
+    PrintRow("copy", "8", RunCopy<std::vector<uint32_t>>(options, 8), RunCopy<TVector<uint32_t>>(options, 8), RunCopy<TSmallVector<uint32_t, 8>>(options, 8));
+    PrintRow("copy", "4096", RunCopy<std::vector<uint32_t>>(options, 4096), RunCopy<TVector<uint32_t>>(options, 4096),
+             RunCopy<TSmallVector<uint32_t, 8>>(options, 4096));
+
+    PrintRow("insert", "16 in 4096", RunInsert<std::vector<uint32_t>>(options), none, RunInsert<TSmallVector<uint32_t, 8>>(options));
+    PrintRow("fill", "4096", RunFill<std::vector<uint32_t>>(options), none, RunFill<TSmallVector<uint32_t, 8>>(options));
+    return 0;
+}
@@ -360,6 +360,8 @@ namespace OffsetAllocator
 #ifdef DEBUG_VERBOSE
 		printf("Getting node %u from freelist[%u]\n", nodeIndex, m_freeOffset + 1);
 #endif
+		// Nodes come back from the freelist with the state of their last use (used flag, bin and neighbor links), start clean
+		m_nodes[nodeIndex] = Node();
 		m_nodes[nodeIndex].dataOffset = dataOffset;
 		m_nodes[nodeIndex].dataSize = size;
 		m_nodes[nodeIndex].binListNext = topNodeIndex;
@@ -20,12 +20,32 @@
 // Core Types and Containers
 #include "../../Source/Vantor/Core/Include/Core/Container/VCO_SafeString.hpp"
 #include "../../Source/Vantor/Core/Include/Core/Container/VCO_Vector.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Container/VCO_SmallVector.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Container/VCO_FlatHashMap.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Container/VCO_SlotMap.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Types/VCO_Name.hpp"
 
 // Memory Management
-// TODO : #include "../../Source/Vantor/Core/Include/Core/Memory/VCO_Allocator.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Memory/VCO_Allocator.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Memory/VCO_FrameAllocator.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Memory/VCO_MemoryTracker.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Memory/VCO_VirtualArena.hpp"
 
 // Backlog
 #include "../../Source/Vantor/Core/Include/Core/BackLog/VCO_Backlog.hpp"
+#include "../../Source/Vantor/Core/Include/Core/BackLog/VCO_LogSinks.hpp"
+#include "../../Source/Vantor/Core/Include/Core/BackLog/VCO_Log.hpp"
+#include "../../Source/Vantor/Core/Include/Core/BackLog/VCO_BinaryLog.hpp"
+
+// Jobs
+#include "../../Source/Vantor/Core/Include/Core/Jobs/VCO_WorkStealingDeque.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Jobs/VCO_Fiber.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Jobs/VCO_JobSystem.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Jobs/VCO_Task.hpp"
+
+// Profiler
+#include "../../Source/Vantor/Core/Include/Core/Profiler/VCO_Profiler.hpp"
+#include "../../Source/Vantor/Core/Include/Core/Profiler/VCO_ProfilerTrace.hpp"
 
 // =============================================================================
 // Math Library
@@ -34,6 +54,7 @@
 #include "../../Source/Vantor/Math/Include/Math/Linear/VMA_Vector.hpp"
 #include "../../Source/Vantor/Math/Include/Math/Linear/VMA_Matrix.hpp"
 #include "../../Source/Vantor/Math/Include/Math/Linear/VMA_Quaternation.hpp"
+#include "../../Source/Vantor/Math/Include/Math/Linear/VMA_Transform.hpp"
 
 // =============================================================================
 // Render Hardware Interface (RHI)
@@ -48,6 +69,9 @@
 #include "../../Source/Vantor/RHI/Include/RHI/Interface/VRHI_Mesh.hpp"
 #include "../../Source/Vantor/RHI/Include/RHI/Interface/VRHI_RenderTarget.hpp"
 
+// RHI Null Device
+#include "../../Source/Vantor/RHI/Include/RHI/Null/VRHI_NullDevice.hpp"
+
 // =============================================================================
 // Context and Window Management
 // =============================================================================
@@ -119,6 +143,9 @@
 
 // RenderPipeline
 #include "../../Source/Vantor/RenderPipeline/Include/RenderPipeline/Public/VREP_RenderPath.hpp"
+#include "../../Source/Vantor/RenderPipeline/Include/RenderPipeline/Pipeline/VREP_FramePacket.hpp"
+#include "../../Source/Vantor/RenderPipeline/Include/RenderPipeline/Pipeline/VREP_RenderThread.hpp"
 
 // Engine Core
-#include "../../Source/Vantor/EngineCore/Include/EngineCore/Public/VECO_Engine.hpp"
\ No newline at end of file
+#include "../../Source/Vantor/EngineCore/Include/EngineCore/Public/VECO_Engine.hpp"
+#include "../../Source/Vantor/EngineCore/Include/EngineCore/Public/VECO_FrameLoop.hpp"
\ No newline at end of file
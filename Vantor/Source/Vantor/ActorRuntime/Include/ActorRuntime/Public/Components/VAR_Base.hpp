@@ -11,6 +11,7 @@
 
 #include <RHI/Interface/VRHI_Mesh.hpp>
 #include <Math/Linear/VMA_Quaternation.hpp>
+#include <Math/Linear/VMA_Transform.hpp>
 #include <MaterialSystem/Public/VMAS_Material.hpp>
 
 #include <ActorRuntime/Public/VAR_Component.hpp>
@@ -69,26 +70,9 @@ namespace VE::Components
             const VE::Math::VVector3    &GetScale() const { return m_scale; }
 
             // === Transform Matrix ===
-            VE::Math::VMat4 GetTransform() const
-            {
-                // 1. Scale the object in local space
-                // 2. Rotate the object around its local center  
-                // 3. Then translate to world position
-                
-                VE::Math::VMat4 S = VE::Math::VMat4::Scale(m_scale);
-                VE::Math::VMat4 R = m_rotation.ToMat4();
-                
-                // First apply scale then rotation in local space
-                VE::Math::VMat4 RS = R * S;
-                
-                // Then manually set the translation component without affecting the rotation
-                VE::Math::VMat4 result = RS;
-                result.m[12] = m_position.x;  // Set translation X
-                result.m[13] = m_position.y;  // Set translation Y
-                result.m[14] = m_position.z;  // Set translation Z
-                
-                return result;
-            }
+            // Scales the object in local space, rotates it around its local center, then translates it to
+            // its world position. Many transforms at once are cheaper through VE::Math::VTransformSoA.
+            VE::Math::VMat4 GetTransform() const { return VE::Math::ComposeTransform(m_position, m_rotation, m_scale); }
 
         private:
             VE::Math::VVector3    m_position;
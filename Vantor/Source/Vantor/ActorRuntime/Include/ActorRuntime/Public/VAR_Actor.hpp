@@ -10,6 +10,7 @@
 #pragma once
 
 #include <Core/Container/VCO_Vector.hpp>
+#include <Core/Container/VCO_FlatHashMap.hpp>
 #include <ActorRuntime/Public/VAR_Component.hpp>
 
 #include <algorithm>
@@ -18,17 +19,28 @@
 #include <string>
 #include <typeindex>
 #include <typeinfo>
-#include <unordered_map>
 
 namespace VE {
 
     using VActorID = uint64_t;
 
-    class AActor : public std::enable_shared_from_this<AActor>
+    class AActor
     {
         public:
             AActor() : id(nextID++) {}
-            virtual ~AActor() = default;
+
+            // The scene graph links are plain pointers, so an actor unlinks itself when it goes away
+            virtual ~AActor()
+            {
+                if (parent) parent->RemoveChild(this);
+                for (AActor *child : children)
+                {
+                    child->parent = nullptr;
+                }
+            }
+
+            AActor(const AActor &)            = delete;
+            AActor &operator=(const AActor &) = delete;
 
             VActorID GetID() const { return id; }
 
@@ -62,38 +74,39 @@ namespace VE {
 
             void RemoveComponent(std::type_index compType) { components.erase(compType); }
 
-            // Scene graph
-            void AddChild(std::shared_ptr<AActor> child)
+            // Scene graph, non-owning: actors are owned by their VWorld (or whoever created them)
+            void AddChild(AActor *child)
             {
-                if (child)
+                if (child && child != this)
                 {
-                    child->parent = shared_from_this();
-                    children.push_back(std::move(child));
+                    if (child->parent) child->parent->RemoveChild(child);
+                    child->parent = this;
+                    children.push_back(child);
                 }
             }
 
-            void RemoveChild(std::shared_ptr<AActor> child)
+            void RemoveChild(AActor *child)
             {
                 if (!child) return;
                 auto it = std::find(children.begin(), children.end(), child);
                 if (it != children.end())
                 {
-                    (*it)->parent.reset();
+                    (*it)->parent = nullptr;
                     children.erase(it);
                 }
             }
 
-            std::weak_ptr<AActor> GetParent() const { return parent; }
+            AActor *GetParent() const { return parent; }
 
-            const VE::Internal::Core::Container::TVector<std::shared_ptr<AActor>> &GetChildren() const { return children; }
+            const VE::Internal::Core::Container::TVector<AActor *> &GetChildren() const { return children; }
 
             VActorID id; // The Entity Actor ID
 
         private:
-            std::unordered_map<std::type_index, VComponentPtr> components;
+            VE::Internal::Core::Container::TFlatHashMap<std::type_index, VComponentPtr> components;
 
-            VE::Internal::Core::Container::TVector<std::shared_ptr<AActor>> children;
-            std::weak_ptr<AActor>                parent;
+            VE::Internal::Core::Container::TVector<AActor *> children;
+            AActor                                          *parent = nullptr;
 
             static VActorID nextID;
     };
@@ -11,8 +11,14 @@
 
 #include <ActorRuntime/Public/VAR_Actor.hpp>
 
+#include <Core/Container/VCO_SlotMap.hpp>
+#include <Core/Memory/VCO_FrameAllocator.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
 #include <memory>
-#include <queue>
+#include <new>
+#include <span>
+#include <type_traits>
 
 namespace VE {
     
@@ -21,70 +27,92 @@ namespace VE {
     // will exectute their Poll every Frame
     class VWorld {
         public:
+            // Frees an actor through the allocator it was created with, which needs the concrete type
+            struct VActorDeleter
+            {
+                    void (*destroy)(AActor *) = nullptr;
+
+                    void operator()(AActor *actor) const noexcept { destroy(actor); }
+            };
+
+            // The world is the only owner, the slot map holds the actor pointers directly
+            using VActorPtr = std::unique_ptr<AActor, VActorDeleter>;
+
             VWorld() = default;
 
             template <typename T, typename... Args> 
-            std::shared_ptr<T> CreateActor(Args &&...args)
+            T *CreateActor(Args &&...args)
             {
                 static_assert(std::is_base_of_v<AActor, T>, "T must inherit from AActor");
-                auto entity = std::make_shared<T>(std::forward<Args>(args)...);
-
-                // Reuse ID if available, otherwise increment
-                VActorID id;
-                if (!m_FreeIDs.empty())
+                // Accounted to EMemoryTag::Actors
+                ActorAllocator<T> allocator;
+                T                *memory = allocator.allocate(1);
+                T                *entity = nullptr;
+                try
                 {
-                    id = m_FreeIDs.front();
-                    m_FreeIDs.pop();
+                    entity = ::new (static_cast<void *>(memory)) T(std::forward<Args>(args)...);
                 }
-                else
+                catch (...)
                 {
-                    id = m_NextID++;
+                    allocator.deallocate(memory, 1);
+                    throw;
                 }
 
-                entity->id     = id;
-                m_Actors[id]   = entity;
+                // The ID is the packed slot handle, so IDs of destroyed actors never resolve to a newer actor
+                entity->id = m_Actors.insert(VActorPtr(entity, VActorDeleter{&FreeActor<T>})).ToU64();
                 return entity;
             }
 
-            std::shared_ptr<AActor> GetActor(VActorID id)
+            // nullptr once the actor was destroyed
+            AActor *GetActor(VActorID id)
             {
-                auto it = m_Actors.find(id);
-                if (it != m_Actors.end())
-                {
-                    return it->second;
-                }
-                return nullptr;
+                VActorPtr *entity = m_Actors.get(VActorHandle::FromU64(id));
+                return entity != nullptr ? entity->get() : nullptr;
             }
 
-            const std::unordered_map<VActorID, std::shared_ptr<AActor>> &GetAllActors() { return m_Actors; }
+            // Actors are stored contiguously, iterate this instead of building a list
+            const VE::Internal::Core::Container::TSlotMap<VActorPtr> &GetAllActors() { return m_Actors; }
 
-            VE::Internal::Core::Container::TVector<std::shared_ptr<AActor>> GetAllActorsList()
+            VE::Internal::Core::Container::TVector<AActor *> GetAllActorsList()
             {
-                VE::Internal::Core::Container::TVector<std::shared_ptr<AActor>> list;
+                VE::Internal::Core::Container::TVector<AActor *> list;
                 list.reserve(m_Actors.size());
-                for (const auto &[id, entity] : m_Actors)
+                for (const VActorPtr &entity : m_Actors)
                 {
-                    list.push_back(entity);
+                    list.push_back(entity.get());
                 }
                 return list;
             }
 
-            void DestroyActor(VActorID id) 
+            // Same as GetAllActorsList(), but the list lives in frame scratch memory, so there is no heap
+            // allocation per call
+            std::span<AActor *> GetAllActorsList(VE::Internal::Core::Memory::VFrameArena &arena)
             {
-                auto it = m_Actors.find(id);
-                if (it != m_Actors.end())
+                AActor **list  = arena.Allocate<AActor *>(m_Actors.size());
+                size_t   count = 0;
+                for (const VActorPtr &entity : m_Actors)
                 {
-                    m_Actors.erase(it);
-                    m_FreeIDs.push(id); // mark ID for reuse
+                    list[count++] = entity.get();
                 }
+                return std::span<AActor *>(list, count);
             }
 
+            // Pointers to the actor dangle afterwards, hold on to its VActorID instead
+            void DestroyActor(VActorID id) { m_Actors.erase(VActorHandle::FromU64(id)); }
+
         private:
-            std::unordered_map<VActorID, std::shared_ptr<AActor>>  m_Actors;
-            VActorID                                               m_NextID = 0;
-            
-            // pool of reusable IDs
-            std::queue<VActorID>                                   m_FreeIDs;
+            using VActorHandle = VE::Internal::Core::Container::THandle<VActorPtr>;
+
+            template <typename T> using ActorAllocator = VE::Internal::Core::Memory::TTaggedAllocator<T, VE::Internal::Core::Memory::EMemoryTag::Actors>;
+
+            template <typename T> static void FreeActor(AActor *actor) noexcept
+            {
+                T *entity = static_cast<T *>(actor);
+                entity->~T();
+                ActorAllocator<T>().deallocate(entity, 1);
+            }
+
+            VE::Internal::Core::Container::TSlotMap<VActorPtr> m_Actors;
     };
     
 }
\ No newline at end of file
@@ -16,7 +16,9 @@
 
 #include <RHI/Interface/VRHI_Device.hpp>
 
-#include <unordered_map>
+#include <Core/Container/VCO_FlatHashMap.hpp>
+#include <Core/Jobs/VCO_Task.hpp>
+
 #include <string>
 #include <memory>
 
@@ -40,25 +42,44 @@ namespace VE::Internal::AssetManager {
         VE::Asset::ModelAssetPtr LoadModel(const std::string& path);
         VE::Asset::TextAssetPtr LoadText(const std::string& path);
 
+        // Asynchronous loading: reading and decoding run on job workers, the cache and the GPU upload
+        // (only with a device) on the scheduler's main thread. Results are nullptr if loading failed.
+        template<typename T>
+        VE::Internal::Core::Jobs::VTask<std::shared_ptr<T>> LoadAssetAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device = nullptr);
+
+        VE::Internal::Core::Jobs::VTask<VE::Asset::TextureAssetPtr> LoadTextureAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device = nullptr);
+        VE::Internal::Core::Jobs::VTask<VE::Asset::ModelAssetPtr> LoadModelAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device = nullptr);
+        VE::Internal::Core::Jobs::VTask<VE::Asset::TextAssetPtr> LoadTextAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path);
+
         // Asset management
         void UnloadAsset(const std::string& path);
         void UnloadAllAssets();
         bool IsAssetLoaded(const std::string& path) const;
 
+        // Returns the scratch memory the calling thread used while decoding/importing to the OS, call after a batch
+        // of loads. Job workers give back what async loads used once they run out of jobs.
+        void TrimTransientMemory();
+
         // Asset caching
         void SetCacheSize(size_t maxAssets) { m_MaxCachedAssets = maxAssets; }
         void ClearCache();
 
         // Statistics
         size_t GetLoadedAssetCount() const { return m_LoadedAssets.size(); }
-        size_t GetMemoryUsage() const; // TODO: Implement memory tracking
+        // Sum of what the loaded assets report, see VMemoryTracker for the per-subsystem view
+        size_t GetMemoryUsage() const { return GetCpuMemoryUsage() + GetGpuMemoryUsage(); }
+        size_t GetCpuMemoryUsage() const;
+        size_t GetGpuMemoryUsage() const;
 
     private:
-        std::unordered_map<std::string, VE::Asset::AssetPtr> m_LoadedAssets;
+        VE::Internal::Core::Container::TFlatHashMap<std::string, VE::Asset::AssetPtr> m_LoadedAssets;
         size_t m_MaxCachedAssets;
 
         // Helper methods
         std::string NormalizePath(const std::string& path) const;
+        template<typename T>
+        std::shared_ptr<T> FindLoadedAsset(const std::string& normalizedPath);
+        void StoreAsset(const std::string& normalizedPath, const VE::Asset::AssetPtr& asset);
         void EvictOldestAsset();
         VE::Asset::EAssetType GetAssetTypeFromPath(const std::string& path) const;
     };
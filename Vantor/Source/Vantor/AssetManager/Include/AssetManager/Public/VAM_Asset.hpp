@@ -48,6 +48,10 @@ namespace VE::Asset {
         EAssetState GetState() const { return m_State; }
         uint32_t GetRefCount() const { return m_RefCount; }
 
+        // Bytes the asset currently holds in system memory and (estimated) in GPU memory
+        virtual size_t GetCpuMemoryUsage() const { return 0; }
+        virtual size_t GetGpuMemoryUsage() const { return 0; }
+
         // Reference counting
         void AddRef() { m_RefCount++; }
         void RemoveRef() { 
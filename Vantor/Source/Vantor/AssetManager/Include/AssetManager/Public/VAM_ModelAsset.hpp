@@ -12,6 +12,8 @@
 #include <AssetManager/Public/VAM_Asset.hpp>
 #include <Graphics/Public/Model/VGFX_Model.hpp>
 
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
 #include <memory>
 
 namespace VE::Internal::RHI {
@@ -30,6 +32,11 @@ namespace VE::Asset {
         void Unload() override;
         bool IsValid() const override;
 
+        // CPU geometry is read straight from the model. It is already tracked by the mesh allocators, so only
+        // the GPU buffers go through m_TrackedMemory and nothing is counted twice in the memory tracker
+        size_t GetCpuMemoryUsage() const override { return m_Model ? m_Model->GetCpuMemoryUsage() : 0; }
+        size_t GetGpuMemoryUsage() const override { return m_TrackedMemory.GetGpuBytes(); }
+
         // Model-specific getters
         std::shared_ptr<VE::Graphics::VModel> GetModel() const { return m_Model; }
         const VE::Graphics::VModel* GetModelPtr() const { return m_Model.get(); }
@@ -46,6 +53,7 @@ namespace VE::Asset {
     private:
         std::shared_ptr<VE::Graphics::VModel> m_Model;
         bool m_HasGPUResources = false;
+        VE::Internal::Core::Memory::VTrackedMemory m_TrackedMemory{VE::Internal::Core::Memory::EMemoryTag::Geometry};
 
         // Helper methods
         bool IsModelFile(const std::string& path) const;
@@ -11,6 +11,8 @@
 
 #include <AssetManager/Public/VAM_Asset.hpp>
 
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
 #include <string>
 #include <memory>
 
@@ -30,11 +32,14 @@ namespace VE::Asset {
         void Unload() override;
         bool IsValid() const override;
 
+        size_t GetCpuMemoryUsage() const override { return m_TrackedMemory.GetCpuBytes(); }
+
         std::string GetText() const { return m_Text; }
 
     private:
         
         std::string m_Text;
+        VE::Internal::Core::Memory::VTrackedMemory m_TrackedMemory{VE::Internal::Core::Memory::EMemoryTag::Assets};
 
         // Helper methods
         bool IsTextFile(const std::string& path) const;
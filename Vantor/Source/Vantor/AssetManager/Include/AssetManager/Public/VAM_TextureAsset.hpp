@@ -13,6 +13,8 @@
 
 #include <RHI/Interface/VRHI_Device.hpp>
 
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
 #include <memory>
 
 namespace VE::Asset {
@@ -35,6 +37,9 @@ namespace VE::Asset {
         void Unload() override;
         bool IsValid() const override;
 
+        size_t GetCpuMemoryUsage() const override { return m_TrackedMemory.GetCpuBytes(); }
+        size_t GetGpuMemoryUsage() const override { return m_TrackedMemory.GetGpuBytes(); }
+
         // Texture-specific getters
         const VTextureData& GetTextureData() const { return m_TextureData; }
         std::shared_ptr<VE::Internal::RHI::IRHITexture> GetRHITexture() const { return m_RHITexture; }
@@ -48,9 +53,14 @@ namespace VE::Asset {
         // Create RHI texture from loaded data
         bool CreateRHITexture(VE::Internal::RHI::IRHIDevice* device);
 
+        // Returns the pages of the calling thread's decode scratch arena to the OS, call after a load batch
+        static void DecommitDecodeScratch();
+
     private:
         VTextureData m_TextureData;
         std::shared_ptr<VE::Internal::RHI::IRHITexture> m_RHITexture;
+        // The pixels are allocated outside the tagged allocators, so they are reported by hand
+        VE::Internal::Core::Memory::VTrackedMemory m_TrackedMemory{VE::Internal::Core::Memory::EMemoryTag::Textures};
 
         bool LoadSTBImage();
         void FreeTextureData();
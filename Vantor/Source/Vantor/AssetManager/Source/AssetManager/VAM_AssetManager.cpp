@@ -11,8 +11,9 @@
 
 #include <AssetManager/Public/VAM_TextureAsset.hpp>
 #include <AssetManager/Public/VAM_ModelAsset.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/Profiler/VCO_Profiler.hpp>
 
-#include <iostream>
 #include <filesystem>
 #include <algorithm>
 
@@ -32,32 +33,28 @@ namespace VE::Internal::AssetManager {
 
     void VAssetManager::Initialize()
     {
-        std::cout << "VAssetManager::Initialize() - Asset manager initialized" << std::endl;
+        VE_LOG(INFO, "AssetManager", "VAssetManager::Initialize() - Asset manager initialized");
     }
 
     void VAssetManager::Shutdown()
     {
         UnloadAllAssets();
-        std::cout << "VAssetManager::Shutdown() - Asset manager shut down" << std::endl;
+        TrimTransientMemory();
+        VE_LOG(INFO, "AssetManager", "VAssetManager::Shutdown() - Asset manager shut down");
     }
 
     template<typename T>
     std::shared_ptr<T> VAssetManager::LoadAsset(const std::string& path)
     {
         static_assert(std::is_base_of_v<VE::Asset::VBaseAsset, T>, "T must derive from VBaseAsset");
-        
+        VE_PROFILE_SCOPE("VAssetManager::LoadAsset");
+
         std::string normalizedPath = NormalizePath(path);
         
         // Check if already loaded
-        auto it = m_LoadedAssets.find(normalizedPath);
-        if (it != m_LoadedAssets.end())
+        if (auto loadedAsset = FindLoadedAsset<T>(normalizedPath))
         {
-            auto typedAsset = std::dynamic_pointer_cast<T>(it->second);
-            if (typedAsset)
-            {
-                typedAsset->AddRef();
-                return typedAsset;
-            }
+            return loadedAsset;
         }
 
         // Create new asset
@@ -66,10 +63,83 @@ namespace VE::Internal::AssetManager {
         // Load the asset
         if (!asset->Load())
         {
-            std::cerr << "VAssetManager::LoadAsset() - Failed to load asset: " << normalizedPath << std::endl;
+            VE_LOG(ERR, "AssetManager", "VAssetManager::LoadAsset() - Failed to load asset: {}", normalizedPath);
+            return nullptr;
+        }
+
+        StoreAsset(normalizedPath, asset);
+        return asset;
+    }
+
+    template<typename T>
+    VE::Internal::Core::Jobs::VTask<std::shared_ptr<T>> VAssetManager::LoadAssetAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device)
+    {
+        static_assert(std::is_base_of_v<VE::Asset::VBaseAsset, T>, "T must derive from VBaseAsset");
+
+        // The cache is only touched on the main thread
+        co_await tasks.MainThread();
+
+        std::string normalizedPath = NormalizePath(path);
+        if (auto loadedAsset = FindLoadedAsset<T>(normalizedPath))
+        {
+            co_return loadedAsset;
+        }
+
+        auto asset = std::make_shared<T>(normalizedPath);
+
+        co_await tasks.Schedule();
+        bool loaded;
+        {
+            VE_PROFILE_SCOPE("VAssetManager::LoadAssetAsync");
+            loaded = asset->Load();
+
+            // The decode scratch is per thread and TrimTransientMemory() only reaches the main thread's. A worker
+            // keeps its pages committed while it has loads queued and gives them back once it runs out of jobs.
+            VE::Internal::Core::Jobs::VJobSystem::RunWhenIdle(&VE::Asset::VTextureAsset::DecommitDecodeScratch);
+        }
+        co_await tasks.MainThread();
+
+        if (!loaded)
+        {
+            VE_LOG(ERR, "AssetManager", "VAssetManager::LoadAssetAsync() - Failed to load asset: {}", normalizedPath);
+            co_return nullptr;
+        }
+
+        // Another load of the same path may have finished while this one was on a worker
+        if (auto loadedAsset = FindLoadedAsset<T>(normalizedPath))
+        {
+            co_return loadedAsset;
+        }
+
+        if (device)
+        {
+            if constexpr (std::is_same_v<T, VE::Asset::VTextureAsset>) asset->CreateRHITexture(device);
+            else if constexpr (std::is_same_v<T, VE::Asset::VModelAsset>) asset->CreateGPUResources(device);
+        }
+
+        StoreAsset(normalizedPath, asset);
+        co_return asset;
+    }
+
+    template<typename T>
+    std::shared_ptr<T> VAssetManager::FindLoadedAsset(const std::string& normalizedPath)
+    {
+        auto it = m_LoadedAssets.find(normalizedPath);
+        if (it == m_LoadedAssets.end())
+        {
             return nullptr;
         }
 
+        auto typedAsset = std::dynamic_pointer_cast<T>(it->second);
+        if (typedAsset)
+        {
+            typedAsset->AddRef();
+        }
+        return typedAsset;
+    }
+
+    void VAssetManager::StoreAsset(const std::string& normalizedPath, const VE::Asset::AssetPtr& asset)
+    {
         // Store in cache
         m_LoadedAssets[normalizedPath] = asset;
         asset->AddRef();
@@ -79,8 +149,6 @@ namespace VE::Internal::AssetManager {
         {
             EvictOldestAsset();
         }
-
-        return asset;
     }
 
 
@@ -105,6 +173,21 @@ namespace VE::Internal::AssetManager {
         return textAsset;
     }
 
+    VE::Internal::Core::Jobs::VTask<VE::Asset::TextureAssetPtr> VAssetManager::LoadTextureAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device)
+    {
+        return LoadAssetAsync<VE::Asset::VTextureAsset>(tasks, std::move(path), device);
+    }
+
+    VE::Internal::Core::Jobs::VTask<VE::Asset::ModelAssetPtr> VAssetManager::LoadModelAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path, VE::Internal::RHI::IRHIDevice* device)
+    {
+        return LoadAssetAsync<VE::Asset::VModelAsset>(tasks, std::move(path), device);
+    }
+
+    VE::Internal::Core::Jobs::VTask<VE::Asset::TextAssetPtr> VAssetManager::LoadTextAsync(VE::Internal::Core::Jobs::VTaskScheduler& tasks, std::string path)
+    {
+        return LoadAssetAsync<VE::Asset::VTextAsset>(tasks, std::move(path), nullptr);
+    }
+
     void VAssetManager::UnloadAsset(const std::string& path)
     {
         std::string normalizedPath = NormalizePath(path);
@@ -119,7 +202,7 @@ namespace VE::Internal::AssetManager {
             {
                 it->second->Unload();
                 m_LoadedAssets.erase(it);
-                std::cout << "VAssetManager::UnloadAsset() - Unloaded asset: " << normalizedPath << std::endl;
+                VE_LOG(INFO, "AssetManager", "VAssetManager::UnloadAsset() - Unloaded asset: {}", normalizedPath);
             }
         }
     }
@@ -131,7 +214,12 @@ namespace VE::Internal::AssetManager {
             asset->Unload();
         }
         m_LoadedAssets.clear();
-        std::cout << "VAssetManager::UnloadAllAssets() - All assets unloaded" << std::endl;
+        VE_LOG(INFO, "AssetManager", "VAssetManager::UnloadAllAssets() - All assets unloaded");
+    }
+
+    void VAssetManager::TrimTransientMemory()
+    {
+        VE::Asset::VTextureAsset::DecommitDecodeScratch();
     }
 
     bool VAssetManager::IsAssetLoaded(const std::string& path) const
@@ -156,13 +244,27 @@ namespace VE::Internal::AssetManager {
                 ++it;
             }
         }
-        std::cout << "VAssetManager::ClearCache() - Cache cleared" << std::endl;
+        VE_LOG(INFO, "AssetManager", "VAssetManager::ClearCache() - Cache cleared");
+    }
+
+    size_t VAssetManager::GetCpuMemoryUsage() const
+    {
+        size_t bytes = 0;
+        for (const auto& [path, asset] : m_LoadedAssets)
+        {
+            bytes += asset->GetCpuMemoryUsage();
+        }
+        return bytes;
     }
 
-    size_t VAssetManager::GetMemoryUsage() const
+    size_t VAssetManager::GetGpuMemoryUsage() const
     {
-        // TODO: Implement proper memory tracking
-        return m_LoadedAssets.size() * sizeof(VE::Asset::AssetPtr);
+        size_t bytes = 0;
+        for (const auto& [path, asset] : m_LoadedAssets)
+        {
+            bytes += asset->GetGpuMemoryUsage();
+        }
+        return bytes;
     }
 
     std::string VAssetManager::NormalizePath(const std::string& path) const
@@ -183,7 +285,7 @@ namespace VE::Internal::AssetManager {
         {
             if (it->second->GetRefCount() == 0)
             {
-                std::cout << "VAssetManager::EvictOldestAsset() - Evicting: " << it->first << std::endl;
+                VE_LOG(INFO, "AssetManager", "VAssetManager::EvictOldestAsset() - Evicting: {}", it->first);
                 it->second->Unload();
                 m_LoadedAssets.erase(it);
                 return;
@@ -194,7 +296,7 @@ namespace VE::Internal::AssetManager {
         if (!m_LoadedAssets.empty())
         {
             auto it = m_LoadedAssets.begin();
-            std::cout << "VAssetManager::EvictOldestAsset() - Force evicting: " << it->first << std::endl;
+            VE_LOG(INFO, "AssetManager", "VAssetManager::EvictOldestAsset() - Force evicting: {}", it->first);
             it->second->Unload();
             m_LoadedAssets.erase(it);
         }
@@ -9,8 +9,8 @@
 
 #include <AssetManager/Public/VAM_ModelAsset.hpp>
 #include <RHI/Interface/VRHI_Device.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
-#include <iostream>
 #include <filesystem>
 #include <algorithm>
 
@@ -20,7 +20,7 @@ namespace VE::Asset {
         : VBaseAsset(path, EAssetType::Model), m_Model(nullptr) {
         
         if (!IsModelFile(path)) {
-            std::cerr << "VModelAsset::VModelAsset() - Invalid model file extension: " << path << std::endl;
+            VE_LOG(ERR, "AssetManager", "VModelAsset::VModelAsset() - Invalid model file extension: {}", path);
             SetState(EAssetState::Failed);
         }
     }
@@ -46,19 +46,18 @@ namespace VE::Asset {
             
             // Load the model from file
             if (!m_Model->LoadFromFile(GetPath())) {
-                std::cerr << "VModelAsset::Load() - Failed to load model from file: " << GetPath() << std::endl;
+                VE_LOG(ERR, "AssetManager", "VModelAsset::Load() - Failed to load model from file: {}", GetPath());
                 m_Model.reset();
                 SetState(EAssetState::Failed);
                 return false;
             }
 
             SetState(EAssetState::Loaded);
-            std::cout << "VModelAsset::Load() - Successfully loaded model: " << GetPath() << std::endl;
+            VE_LOG(INFO, "AssetManager", "VModelAsset::Load() - Successfully loaded model: {}", GetPath());
             return true;
 
         } catch (const std::exception& e) {
-            std::cerr << "VModelAsset::Load() - Exception loading model " << GetPath() 
-                      << ": " << e.what() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VModelAsset::Load() - Exception loading model {}: {}", GetPath(), e.what());
             m_Model.reset();
             SetState(EAssetState::Failed);
             return false;
@@ -76,7 +75,7 @@ namespace VE::Asset {
         // Release the model
         if (m_Model) {
             m_Model.reset();
-            std::cout << "VModelAsset::Unload() - Unloaded model: " << GetPath() << std::endl;
+            VE_LOG(INFO, "AssetManager", "VModelAsset::Unload() - Unloaded model: {}", GetPath());
         }
 
         SetState(EAssetState::Unloaded);
@@ -88,7 +87,7 @@ namespace VE::Asset {
 
     bool VModelAsset::CreateGPUResources(VE::Internal::RHI::IRHIDevice* device) {
         if (!IsValid()) {
-            std::cerr << "VModelAsset::CreateGPUResources() - Model is not valid" << std::endl;
+            VE_LOG(ERR, "AssetManager", "VModelAsset::CreateGPUResources() - Model is not valid");
             return false;
         }
 
@@ -97,18 +96,17 @@ namespace VE::Asset {
         }
 
         if (!device) {
-            std::cerr << "VModelAsset::CreateGPUResources() - Device is null" << std::endl;
+            VE_LOG(ERR, "AssetManager", "VModelAsset::CreateGPUResources() - Device is null");
             return false;
         }
 
         bool success = m_Model->CreateGPUResources(device);
         if (success) {
             m_HasGPUResources = true;
-            std::cout << "VModelAsset::CreateGPUResources() - Created GPU resources for model: " 
-                      << GetPath() << std::endl;
+            m_TrackedMemory.SetGpu(m_Model->GetGpuMemoryUsage());
+            VE_LOG(INFO, "AssetManager", "VModelAsset::CreateGPUResources() - Created GPU resources for model: {}", GetPath());
         } else {
-            std::cerr << "VModelAsset::CreateGPUResources() - Failed to create GPU resources for model: " 
-                      << GetPath() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VModelAsset::CreateGPUResources() - Failed to create GPU resources for model: {}", GetPath());
         }
 
         return success;
@@ -124,8 +122,8 @@ namespace VE::Asset {
         }
 
         m_HasGPUResources = false;
-        std::cout << "VModelAsset::DestroyGPUResources() - Destroyed GPU resources for model: " 
-                  << GetPath() << std::endl;
+        m_TrackedMemory.SetGpu(0);
+        VE_LOG(INFO, "AssetManager", "VModelAsset::DestroyGPUResources() - Destroyed GPU resources for model: {}", GetPath());
     }
 
     uint32_t VModelAsset::GetMeshCount() const {
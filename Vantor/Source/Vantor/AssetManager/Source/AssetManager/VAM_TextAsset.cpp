@@ -8,8 +8,8 @@
  ****************************************************************************/
 
 #include <AssetManager/Public/VAM_TextAsset.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
-#include <iostream>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
@@ -36,7 +36,7 @@ namespace VE::Asset {
         // Check if file exists
         if (!std::filesystem::exists(GetPath()))
         {
-            std::cerr << "VTextAsset::Load() - File does not exist: " << GetPath() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextAsset::Load() - File does not exist: {}", GetPath());
             SetState(EAssetState::Failed);
             return false;
         }
@@ -44,7 +44,7 @@ namespace VE::Asset {
         // Check if it's a text file
         if (!IsTextFile(GetPath()))
         {
-            std::cerr << "VTextAsset::Load() - File is not a recognized text format: " << GetPath() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextAsset::Load() - File is not a recognized text format: {}", GetPath());
             SetState(EAssetState::Failed);
             return false;
         }
@@ -55,7 +55,7 @@ namespace VE::Asset {
             std::ifstream file(GetPath(), std::ios::in);
             if (!file.is_open())
             {
-                std::cerr << "VTextAsset::Load() - Failed to open file: " << GetPath() << std::endl;
+                VE_LOG(ERR, "AssetManager", "VTextAsset::Load() - Failed to open file: {}", GetPath());
                 SetState(EAssetState::Failed);
                 return false;
             }
@@ -64,19 +64,18 @@ namespace VE::Asset {
             std::stringstream buffer;
             buffer << file.rdbuf();
             m_Text = buffer.str();
+            m_TrackedMemory.SetCpu(m_Text.capacity());
 
             file.close();
 
-            std::cout << "VTextAsset::Load() - Successfully loaded text file: " << GetPath() 
-                      << " (" << m_Text.length() << " characters)" << std::endl;
+            VE_LOG(INFO, "AssetManager", "VTextAsset::Load() - Successfully loaded text file: {} ({} characters)", GetPath(), m_Text.length());
 
             SetState(EAssetState::Loaded);
             return true;
         }
         catch (const std::exception& e)
         {
-            std::cerr << "VTextAsset::Load() - Exception while loading file: " << GetPath() 
-                      << " - " << e.what() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextAsset::Load() - Exception while loading file: {} - {}", GetPath(), e.what());
             SetState(EAssetState::Failed);
             return false;
         }
@@ -86,9 +85,10 @@ namespace VE::Asset {
     {
         if (GetState() == EAssetState::Loaded)
         {
-            m_Text.clear();
+            std::string().swap(m_Text); // clear() would keep the buffer
+            m_TrackedMemory.SetCpu(0);
             SetState(EAssetState::Unloaded);
-            std::cout << "VTextAsset::Unload() - Text asset unloaded: " << GetPath() << std::endl;
+            VE_LOG(INFO, "AssetManager", "VTextAsset::Unload() - Text asset unloaded: {}", GetPath());
         }
     }
 
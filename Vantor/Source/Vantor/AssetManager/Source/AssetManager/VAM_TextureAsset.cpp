@@ -11,13 +11,96 @@
 
 #include <RHI/Interface/VRHI_Device.hpp>
 
+#include <Core/Memory/VCO_VirtualArena.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+
+    using VE::Internal::Core::Memory::VVirtualArena;
+
+    // stb_image reallocs its scratch buffers (zlib output, PNG IDAT data) while they grow. Decoding
+    // into reserved address space lets the newest buffer grow in place instead of being copied,
+    // and the pages stay committed for the next texture until DecommitDecodeScratch().
+    constexpr size_t DECODE_ARENA_RESERVE = sizeof(void*) >= 8 ? (size_t(4) << 30) : (size_t(256) << 20);
+    // Every block is prefixed with its size, stb does not always pass the old size to realloc
+    constexpr size_t DECODE_HEADER_SIZE = 16;
+
+    thread_local VVirtualArena t_DecodeArena;
+    // Size of the image being decoded. stb allocates its result with this size (the JPEG decoder adds one byte), those
+    // blocks come from the heap so the texture can keep the result after the arena is reset, without copying the pixels out
+    thread_local size_t t_DecodeResultSize = 0;
+
+    void* HeapMalloc(size_t size) {
+        void* block = std::malloc(size + DECODE_HEADER_SIZE);
+        if (!block) return nullptr;
+        std::memcpy(block, &size, sizeof(size_t));
+        return static_cast<uint8_t*>(block) + DECODE_HEADER_SIZE;
+    }
+
+    VVirtualArena* GetDecodeArena() {
+        if (!t_DecodeArena.IsReserved()) {
+            t_DecodeArena.Reserve(DECODE_ARENA_RESERVE, VE::Internal::Core::Memory::EMemoryTag::Textures);
+        }
+        return t_DecodeArena.IsReserved() ? &t_DecodeArena : nullptr;
+    }
+
+    void* DecodeMalloc(size_t size) {
+        if (t_DecodeResultSize != 0 && (size == t_DecodeResultSize || size == t_DecodeResultSize + 1)) return HeapMalloc(size);
+
+        VVirtualArena* arena = GetDecodeArena();
+        void* block = arena ? arena->Allocate(size + DECODE_HEADER_SIZE, DECODE_HEADER_SIZE) : nullptr;
+        if (!block) {
+            // Out of reserved space, fall back to the heap
+            return HeapMalloc(size);
+        }
+        std::memcpy(block, &size, sizeof(size_t));
+        return static_cast<uint8_t*>(block) + DECODE_HEADER_SIZE;
+    }
+
+    void DecodeFree(void* ptr) {
+        if (!ptr) return;
+        uint8_t* block = static_cast<uint8_t*>(ptr) - DECODE_HEADER_SIZE;
+        if (t_DecodeArena.Owns(block)) {
+            size_t size;
+            std::memcpy(&size, block, sizeof(size_t));
+            t_DecodeArena.Free(block, size + DECODE_HEADER_SIZE);
+        } else {
+            std::free(block);
+        }
+    }
+
+    void* DecodeRealloc(void* ptr, size_t newSize) {
+        if (!ptr) return DecodeMalloc(newSize);
+
+        uint8_t* block = static_cast<uint8_t*>(ptr) - DECODE_HEADER_SIZE;
+        size_t oldSize;
+        std::memcpy(&oldSize, block, sizeof(size_t));
+
+        if (t_DecodeArena.Owns(block) && t_DecodeArena.Resize(block, newSize + DECODE_HEADER_SIZE)) {
+            std::memcpy(block, &newSize, sizeof(size_t));
+            return ptr;
+        }
+
+        void* newPtr = DecodeMalloc(newSize);
+        if (!newPtr) return nullptr;
+        std::memcpy(newPtr, ptr, oldSize < newSize ? oldSize : newSize);
+        DecodeFree(ptr);
+        return newPtr;
+    }
+
+}
+
 // STB Image includes
+#define STBI_MALLOC(sz) DecodeMalloc(sz)
+#define STBI_REALLOC(p, newsz) DecodeRealloc(p, newsz)
+#define STBI_FREE(p) DecodeFree(p)
 #define STB_IMAGE_IMPLEMENTATION
 #include <Shared/STB/stb_image.h>
 
-#include <iostream>
-#include <filesystem>
-
 namespace VE::Asset {
 
     VTextureAsset::VTextureAsset(const std::string& path)
@@ -45,7 +128,7 @@ namespace VE::Asset {
         // Check if file exists
         if (!std::filesystem::exists(GetPath()))
         {
-            std::cerr << "VTextureAsset::Load() - File not found: " << GetPath() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextureAsset::Load() - File not found: {}", GetPath());
             SetState(EAssetState::Failed);
             return false;
         }
@@ -53,15 +136,15 @@ namespace VE::Asset {
         // Load image data using STB
         if (!LoadSTBImage())
         {
-            std::cerr << "VTextureAsset::Load() - Failed to load image: " << GetPath() << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextureAsset::Load() - Failed to load image: {}", GetPath());
             SetState(EAssetState::Failed);
             return false;
         }
 
+        m_TrackedMemory.SetCpu(size_t(m_TextureData.width) * size_t(m_TextureData.height) * size_t(m_TextureData.channels));
+
         SetState(EAssetState::Loaded);
-        std::cout << "VTextureAsset::Load() - Successfully loaded: " << GetPath() 
-                  << " (" << m_TextureData.width << "x" << m_TextureData.height 
-                  << ", " << m_TextureData.channels << " channels)" << std::endl;
+        VE_LOG(INFO, "AssetManager", "VTextureAsset::Load() - Successfully loaded: {} ({}x{}, {} channels)", GetPath(), m_TextureData.width, m_TextureData.height, m_TextureData.channels);
         
         return true;
     }
@@ -70,6 +153,7 @@ namespace VE::Asset {
     {
         FreeTextureData();
         m_RHITexture.reset();
+        m_TrackedMemory.Set(0, 0);
         SetState(EAssetState::Unloaded);
     }
 
@@ -85,7 +169,7 @@ namespace VE::Asset {
     {
         if (!IsValid() || !device)
         {
-            std::cerr << "VTextureAsset::CreateRHITexture() - Invalid texture data or device" << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextureAsset::CreateRHITexture() - Invalid texture data or device");
             return false;
         }
 
@@ -109,8 +193,7 @@ namespace VE::Asset {
                 format = VE::Internal::RHI::ERHIFormat::R8G8B8A8_UNORM;
                 break;
             default:
-                std::cerr << "VTextureAsset::CreateRHITexture() - Unsupported channel count: " 
-                          << m_TextureData.channels << std::endl;
+                VE_LOG(ERR, "AssetManager", "VTextureAsset::CreateRHITexture() - Unsupported channel count: {}", m_TextureData.channels);
                 return false;
         }
 
@@ -125,18 +208,34 @@ namespace VE::Asset {
 
         if (!m_RHITexture)
         {
-            std::cerr << "VTextureAsset::CreateRHITexture() - Failed to create RHI texture" << std::endl;
+            VE_LOG(ERR, "AssetManager", "VTextureAsset::CreateRHITexture() - Failed to create RHI texture");
             return false;
         }
 
-        std::cout << "VTextureAsset::CreateRHITexture() - Successfully created RHI texture for: " 
-                  << GetPath() << std::endl;
+        // Uploads are RGB(A)8 with a full mip chain, which adds a third on top of the base level
+        const size_t baseLevelBytes = size_t(m_TextureData.width) * size_t(m_TextureData.height) * size_t(m_TextureData.channels);
+        m_TrackedMemory.SetGpu(baseLevelBytes + baseLevelBytes / 3);
+
+        VE_LOG(INFO, "AssetManager", "VTextureAsset::CreateRHITexture() - Successfully created RHI texture for: {}", GetPath());
         
         return true;
     }
 
+    void VTextureAsset::DecommitDecodeScratch()
+    {
+        t_DecodeArena.Decommit();
+    }
+
     bool VTextureAsset::LoadSTBImage()
     {
+        // Everything stb allocates lives in the decode arena, except for the result (see t_DecodeResultSize)
+        struct VDecodeScope {
+            ~VDecodeScope() {
+                t_DecodeResultSize = 0;
+                t_DecodeArena.Reset();
+            }
+        } decodeScope;
+
         // Free any existing data
         FreeTextureData();
 
@@ -157,14 +256,18 @@ namespace VE::Asset {
             
             if (!hdrData)
             {
-                std::cerr << "VTextureAsset::LoadSTBImage() - STB failed to load HDR image: " 
-                          << stbi_failure_reason() << std::endl;
+                VE_LOG(ERR, "AssetManager", "VTextureAsset::LoadSTBImage() - STB failed to load HDR image: {}", stbi_failure_reason());
                 return false;
             }
 
             // Convert float data to byte data for now (we can add HDR support later)
-            size_t pixelCount = m_TextureData.width * m_TextureData.height * m_TextureData.channels;
-            m_TextureData.pixels = new uint8_t[pixelCount];
+            size_t pixelCount = size_t(m_TextureData.width) * size_t(m_TextureData.height) * size_t(m_TextureData.channels);
+            m_TextureData.pixels = static_cast<uint8_t*>(HeapMalloc(pixelCount));
+            if (!m_TextureData.pixels)
+            {
+                stbi_image_free(hdrData);
+                return false;
+            }
             
             for (size_t i = 0; i < pixelCount; ++i)
             {
@@ -178,19 +281,39 @@ namespace VE::Asset {
         }
         else
         {
-            // Load regular LDR image
-            m_TextureData.pixels = stbi_load(GetPath().c_str(), 
-                                           &m_TextureData.width, 
-                                           &m_TextureData.height, 
-                                           &m_TextureData.channels, 
-                                           0);
+            // Load regular LDR image, the result is allocated with the size from the header
+            int infoWidth = 0, infoHeight = 0, infoChannels = 0;
+            if (stbi_info(GetPath().c_str(), &infoWidth, &infoHeight, &infoChannels))
+            {
+                t_DecodeResultSize = size_t(infoWidth) * size_t(infoHeight) * size_t(infoChannels);
+            }
+
+            stbi_uc* ldrData = stbi_load(GetPath().c_str(), 
+                                         &m_TextureData.width, 
+                                         &m_TextureData.height, 
+                                         &m_TextureData.channels, 
+                                         0);
             
-            if (!m_TextureData.pixels)
+            if (!ldrData)
             {
-                std::cerr << "VTextureAsset::LoadSTBImage() - STB failed to load image: " 
-                          << stbi_failure_reason() << std::endl;
+                VE_LOG(ERR, "AssetManager", "VTextureAsset::LoadSTBImage() - STB failed to load image: {}", stbi_failure_reason());
                 return false;
             }
+
+            if (!t_DecodeArena.Owns(ldrData))
+            {
+                // Already a heap block, the texture takes it over
+                m_TextureData.pixels = ldrData;
+            }
+            else
+            {
+                // The result ended up in the arena (header size unknown or grown in place), copy it out before the reset
+                size_t byteCount = size_t(m_TextureData.width) * size_t(m_TextureData.height) * size_t(m_TextureData.channels);
+                m_TextureData.pixels = static_cast<uint8_t*>(HeapMalloc(byteCount));
+                if (m_TextureData.pixels) std::memcpy(m_TextureData.pixels, ldrData, byteCount);
+                stbi_image_free(ldrData);
+                if (!m_TextureData.pixels) return false;
+            }
         }
 
         return true;
@@ -200,17 +323,8 @@ namespace VE::Asset {
     {
         if (m_TextureData.pixels)
         {
-            if (m_TextureData.isHDR)
-            {
-                // We allocated this ourselves for HDR conversion
-                delete[] m_TextureData.pixels;
-            }
-            else
-            {
-                // STB allocated this
-                stbi_image_free(m_TextureData.pixels);
-            }
-            
+            // Always a heap block with a decode header, DecodeFree() releases those on any thread
+            DecodeFree(m_TextureData.pixels);
             m_TextureData.pixels = nullptr;
         }
 
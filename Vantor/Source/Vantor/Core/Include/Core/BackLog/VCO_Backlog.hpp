@@ -9,18 +9,27 @@
 
 #pragma once
 
-#include <fstream>
-#include <iostream>
-#include <mutex>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 
-#include <Core/Container/VCO_Vector.hpp>
+// Asynchronous logging.
+//
+// Log() only copies the message into a lock-free ring owned by the calling thread (see
+// VLogRing), it never takes a lock, allocates or touches a stream. A background logger thread
+// drains the rings of all threads, orders the records by time, formats them and hands them to
+// the registered sinks (VCO_LogSinks.hpp). By default that is a console sink and a bounded
+// in-memory sink for the Studio backlog panel.
+//
+// Flush() waits until everything logged before it reached the sinks, Shutdown() drains and stops
+// the logger thread (it is started on first use and stopped at exit).
 
 namespace VE::Internal::Core::Backlog
 {
 
     // Different Log Levels
-    enum class ELogLevel
+    enum class ELogLevel : uint8_t
     {
         INFO,
         DEBUG,
@@ -32,16 +41,51 @@ namespace VE::Internal::Core::Backlog
     {
             std::string source;
             std::string text;
-            ELogLevel    level;
+            ELogLevel   level     = ELogLevel::INFO;
+            uint64_t    timestamp = 0; // steady clock nanoseconds
+            uint32_t    threadId  = 0; // sequential id of the logging thread, 1 is the first thread that logged
+
+            // Unformatted VE_LOG record (VCO_Log.hpp): its format string and binary arguments, text is
+            // the two combined. format is empty for plain Log() messages.
+            std::string_view format;
+            std::string      args;
+    };
+
+    // Output of the logger thread. Write()/Flush() are only ever called from that thread.
+    class ILogSink
+    {
+        public:
+            virtual ~ILogSink() = default;
+
+            // line is the formatted "[LEVEL] [source] text" without a line break
+            virtual void Write(const VLogEntry &entry, std::string_view line) = 0;
+            // Called after every batch of records
+            virtual void Flush() {}
+    };
+
+    class VConsoleLogSink;
+    class VMemoryLogSink;
+
+    struct VLoggerStats
+    {
+            uint64_t recordsWritten = 0; // records handed to the sinks
+            uint64_t producerStalls = 0; // Log() calls that had to wait for the logger thread to make room
+            uint64_t recordsDropped = 0; // records lost because the logger thread itself logged into a full ring
+            uint32_t threadCount    = 0; // threads with a live ring
     };
 
     // Function Declarations
-    std::string LogLevelToString(ELogLevel level);
-    void        Log(const std::string &source, const std::string &msg, ELogLevel level = ELogLevel::INFO);
-    // void        SaveLogs(const std::string &filename = "Vantor.log");
+    const char *LogLevelToString(ELogLevel level);
+    void        Log(std::string_view source, std::string_view msg, ELogLevel level = ELogLevel::INFO);
+
+    void Flush();
+    void Shutdown();
 
-    extern std::mutex logMutex;
-    extern VE::Internal::Core::Container::TVector<VLogEntry> logEntries;
+    void                             AddSink(std::shared_ptr<ILogSink> sink);
+    void                             RemoveSink(const std::shared_ptr<ILogSink> &sink);
+    std::shared_ptr<VConsoleLogSink> GetConsoleSink();
+    std::shared_ptr<VMemoryLogSink>  GetMemorySink();
 
+    VLoggerStats GetLoggerStats();
 
-} // namespace VE::Internal::Backlog
\ No newline at end of file
+} // namespace VE::Internal::Core::Backlog
@@ -0,0 +1,217 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/Types/VCO_Name.hpp>
+
+// Structured logging.
+//
+//     VE_LOG(WARNING, "AssetManager", "Failed to load {} ({} bytes)", path, size);
+//
+// The format string is checked at compile time: every "{}" needs exactly one argument, literal
+// braces are written "{{" and "}}". The arguments are copied in binary form (a type tag and the
+// raw value, strings by content) into the calling thread's log ring, no std::string is built
+// and nothing is allocated. The text is only formatted on the logger thread.
+//
+// Supported arguments: bool, char, integers, enums (as their underlying value), floating point,
+// anything convertible to std::string_view (literals, std::string, TSafeString), VName and
+// pointers.
+//
+// DEBUG logs are removed at compile time when VANTOR_LOG_STRIP_DEBUG is 1, which is the default
+// for NDEBUG builds. Their arguments are not even evaluated.
+
+#ifndef VANTOR_LOG_STRIP_DEBUG
+#ifdef NDEBUG
+#define VANTOR_LOG_STRIP_DEBUG 1
+#else
+#define VANTOR_LOG_STRIP_DEBUG 0
+#endif
+#endif
+
+namespace VE::Internal::Core::Backlog
+{
+    constexpr bool IsLogLevelEnabled(ELogLevel level) { return !(VANTOR_LOG_STRIP_DEBUG && level == ELogLevel::DEBUG); }
+
+    // Tag stored in front of every binary argument
+    enum class ELogArgType : uint8_t
+    {
+        Bool,
+        Char,
+        Int64,
+        UInt64,
+        Double,
+        String, // uint32_t length + characters
+        Pointer,
+        Float
+    };
+
+    namespace Detail
+    {
+        // Never defined, reaching them in a constant evaluation fails the compilation with their name
+        void LogFormatError_UnmatchedBrace();
+        void LogFormatError_TooFewArguments();
+        void LogFormatError_TooManyArguments();
+
+        // Number of "{}" in fmt, fails the compilation for malformed format strings
+        consteval size_t CountFormatPlaceholders(std::string_view fmt)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < fmt.size(); ++i)
+            {
+                if (fmt[i] == '{')
+                {
+                    if (i + 1 < fmt.size() && fmt[i + 1] == '{') ++i;
+                    else if (i + 1 < fmt.size() && fmt[i + 1] == '}') ++count, ++i;
+                    else LogFormatError_UnmatchedBrace();
+                }
+                else if (fmt[i] == '}')
+                {
+                    if (i + 1 < fmt.size() && fmt[i + 1] == '}') ++i;
+                    else LogFormatError_UnmatchedBrace();
+                }
+            }
+            return count;
+        }
+
+        template <typename T> using TLogDecay = std::remove_cvref_t<std::decay_t<T>>;
+
+        template <typename T> consteval ELogArgType GetLogArgType()
+        {
+            using U = TLogDecay<T>;
+            if constexpr (std::is_same_v<U, bool>) return ELogArgType::Bool;
+            else if constexpr (std::is_same_v<U, char>) return ELogArgType::Char;
+            else if constexpr (std::is_enum_v<U>) return std::is_signed_v<std::underlying_type_t<U>> ? ELogArgType::Int64 : ELogArgType::UInt64;
+            else if constexpr (std::is_integral_v<U>) return std::is_signed_v<U> ? ELogArgType::Int64 : ELogArgType::UInt64;
+            else if constexpr (std::is_same_v<U, float>) return ELogArgType::Float;
+            else if constexpr (std::is_floating_point_v<U>) return ELogArgType::Double;
+            else if constexpr (std::is_same_v<U, VE::Internal::Core::Types::VName>) return ELogArgType::String;
+            else if constexpr (std::is_convertible_v<const T &, std::string_view>) return ELogArgType::String;
+            else if constexpr (std::is_pointer_v<U>) return ELogArgType::Pointer;
+            else static_assert(sizeof(T) == 0, "VE_LOG: unsupported argument type");
+        }
+
+        template <typename T> inline std::string_view GetLogArgString(const T &arg)
+        {
+            if constexpr (std::is_same_v<TLogDecay<T>, VE::Internal::Core::Types::VName>) return arg.GetString();
+            else if constexpr (std::is_pointer_v<TLogDecay<T>>) return arg != nullptr ? std::string_view(arg) : std::string_view("(null)");
+            else return std::string_view(arg);
+        }
+
+        template <typename T> inline size_t GetLogArgSize(const T &arg)
+        {
+            constexpr ELogArgType type = GetLogArgType<T>();
+            if constexpr (type == ELogArgType::String) return 1 + sizeof(uint32_t) + GetLogArgString(arg).size();
+            else if constexpr (type == ELogArgType::Bool || type == ELogArgType::Char) return 2;
+            else if constexpr (type == ELogArgType::Float) return 1 + 4;
+            else return 1 + 8;
+        }
+
+        template <typename T> inline uint8_t *EncodeLogArg(uint8_t *dst, const T &arg)
+        {
+            constexpr ELogArgType type = GetLogArgType<T>();
+            *dst++                     = static_cast<uint8_t>(type);
+
+            if constexpr (type == ELogArgType::String)
+            {
+                const std::string_view str    = GetLogArgString(arg);
+                const uint32_t         length = static_cast<uint32_t>(str.size());
+                std::memcpy(dst, &length, sizeof(uint32_t));
+                std::memcpy(dst + sizeof(uint32_t), str.data(), str.size());
+                return dst + sizeof(uint32_t) + str.size();
+            }
+            else if constexpr (type == ELogArgType::Bool || type == ELogArgType::Char)
+            {
+                *dst = static_cast<uint8_t>(arg);
+                return dst + 1;
+            }
+            else if constexpr (type == ELogArgType::Float)
+            {
+                std::memcpy(dst, &arg, 4);
+                return dst + 4;
+            }
+            else
+            {
+                if constexpr (type == ELogArgType::Int64)
+                {
+                    const int64_t value = static_cast<int64_t>(arg);
+                    std::memcpy(dst, &value, 8);
+                }
+                else if constexpr (type == ELogArgType::UInt64)
+                {
+                    const uint64_t value = static_cast<uint64_t>(arg);
+                    std::memcpy(dst, &value, 8);
+                }
+                else if constexpr (type == ELogArgType::Double)
+                {
+                    const double value = static_cast<double>(arg);
+                    std::memcpy(dst, &value, 8);
+                }
+                else
+                {
+                    const uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg));
+                    std::memcpy(dst, &value, 8);
+                }
+                return dst + 8;
+            }
+        }
+
+        // Reserves a formatted record in the calling thread's log ring and returns where argBytes
+        // of encoded arguments go, nullptr if the record has to be dropped. Must be followed by
+        // CommitFormattedRecord().
+        uint8_t *BeginFormattedRecord(ELogLevel level, std::string_view source, std::string_view fmt, size_t argBytes);
+        void     CommitFormattedRecord();
+
+        // Replaces out with fmt, its placeholders filled from the encoded arguments
+        void FormatLogArgs(std::string &out, std::string_view fmt, const uint8_t *args, size_t argBytes);
+    } // namespace Detail
+
+    // Format string checked against the argument count at compile time
+    template <typename... Args> struct TLogFormat
+    {
+            template <typename S>
+                requires std::convertible_to<const S &, std::string_view>
+            consteval TLogFormat(const S &str) : fmt(str)
+            {
+                const size_t placeholders = Detail::CountFormatPlaceholders(fmt);
+                if (placeholders > sizeof...(Args)) Detail::LogFormatError_TooFewArguments();
+                if (placeholders < sizeof...(Args)) Detail::LogFormatError_TooManyArguments();
+            }
+
+            std::string_view fmt; // always a literal, so it outlives the record
+    };
+
+    template <typename... Args> inline void LogFormat(ELogLevel level, std::string_view source, TLogFormat<std::type_identity_t<Args>...> format, const Args &...args)
+    {
+        const size_t argBytes = (size_t(0) + ... + Detail::GetLogArgSize(args));
+        uint8_t     *dst      = Detail::BeginFormattedRecord(level, source, format.fmt, argBytes);
+        if (dst == nullptr) return;
+        ((dst = Detail::EncodeLogArg(dst, args)), ...);
+        Detail::CommitFormattedRecord();
+    }
+} // namespace VE::Internal::Core::Backlog
+
+// level is one of INFO, DEBUG, WARNING, ERR
+#define VE_LOG(level, source, fmt, ...)                                                                                                \
+    do                                                                                                                                 \
+    {                                                                                                                                  \
+        if constexpr (::VE::Internal::Core::Backlog::IsLogLevelEnabled(::VE::Internal::Core::Backlog::ELogLevel::level))               \
+        {                                                                                                                              \
+            ::VE::Internal::Core::Backlog::LogFormat(::VE::Internal::Core::Backlog::ELogLevel::level, source, fmt __VA_OPT__(, ) __VA_ARGS__); \
+        }                                                                                                                              \
+    } while (0)
@@ -0,0 +1,139 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
+// Lock-free single producer / single consumer byte ring for log records.
+//
+// Every thread that logs owns one ring (producer), the logger thread drains all of them
+// (consumer), which together makes the MPSC queue behind VE::Internal::Core::Backlog::Log().
+// Records are variable sized and always contiguous: a record that does not fit before the
+// end of the buffer is preceded by a padding record that fills the rest, and starts at 0.
+// Head and tail are monotonic byte positions, each on its own cache line.
+
+namespace VE::Internal::Core::Backlog
+{
+    class VLogRing
+    {
+        public:
+            static constexpr size_t RECORD_ALIGNMENT = 8;
+
+            struct RecordHeader
+            {
+                    uint32_t size;    // whole record including this header, multiple of RECORD_ALIGNMENT
+                    uint32_t padding; // 1 = filler up to the end of the buffer, no payload
+            };
+
+            // capacity must be a power of two
+            explicit VLogRing(size_t capacity) : m_Mask(capacity - 1)
+            {
+                assert(capacity >= 256 && (capacity & (capacity - 1)) == 0);
+                m_Buffer.resize(capacity);
+            }
+
+            VLogRing(const VLogRing &)            = delete;
+            VLogRing &operator=(const VLogRing &) = delete;
+
+            size_t GetCapacity() const { return m_Mask + 1; }
+            // Largest payload a single record may have
+            size_t GetMaxPayload() const { return GetCapacity() / 2 - sizeof(RecordHeader); }
+
+            // ----- Producer -----
+
+            // Returns space for payloadSize bytes, nullptr while the ring is too full. Must be followed by Commit().
+            uint8_t *Reserve(size_t payloadSize)
+            {
+                assert(payloadSize <= GetMaxPayload());
+                const size_t recordSize = AlignRecord(sizeof(RecordHeader) + payloadSize);
+                const size_t head       = m_Head.load(std::memory_order_relaxed);
+                const size_t untilEnd   = GetCapacity() - (head & m_Mask);
+                const size_t needed     = recordSize <= untilEnd ? recordSize : untilEnd + recordSize;
+
+                if (head + needed - m_CachedTail > GetCapacity())
+                {
+                    m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                    if (head + needed - m_CachedTail > GetCapacity()) return nullptr;
+                }
+
+                size_t start = head;
+                if (recordSize > untilEnd)
+                {
+                    WriteHeader(head, static_cast<uint32_t>(untilEnd), 1);
+                    start += untilEnd;
+                }
+
+                WriteHeader(start, static_cast<uint32_t>(recordSize), 0);
+                m_PendingHead = start + recordSize;
+                return m_Buffer.data() + (start & m_Mask) + sizeof(RecordHeader);
+            }
+
+            // Publishes the record of the last Reserve()
+            void Commit() { m_Head.store(m_PendingHead, std::memory_order_release); }
+
+            // ----- Consumer -----
+
+            // Returns the payload of the oldest record or nullptr if the ring is empty. Must be followed by Pop().
+            const uint8_t *Peek(size_t &payloadSize)
+            {
+                size_t       tail = m_Tail.load(std::memory_order_relaxed);
+                const size_t head = m_Head.load(std::memory_order_acquire);
+                while (tail != head)
+                {
+                    RecordHeader header;
+                    std::memcpy(&header, m_Buffer.data() + (tail & m_Mask), sizeof(RecordHeader));
+                    if (header.padding == 0)
+                    {
+                        m_PeekedSize = header.size;
+                        payloadSize  = header.size - sizeof(RecordHeader);
+                        return m_Buffer.data() + (tail & m_Mask) + sizeof(RecordHeader);
+                    }
+                    tail += header.size;
+                    m_Tail.store(tail, std::memory_order_release);
+                }
+                return nullptr;
+            }
+
+            // Releases the record returned by the last Peek() to the producer
+            void Pop() { m_Tail.store(m_Tail.load(std::memory_order_relaxed) + m_PeekedSize, std::memory_order_release); }
+
+            bool IsEmpty() const { return m_Tail.load(std::memory_order_acquire) == m_Head.load(std::memory_order_acquire); }
+
+        private:
+            static constexpr size_t AlignRecord(size_t size) { return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1); }
+
+            void WriteHeader(size_t position, uint32_t size, uint32_t padding)
+            {
+                const RecordHeader header{size, padding};
+                std::memcpy(m_Buffer.data() + (position & m_Mask), &header, sizeof(RecordHeader));
+            }
+
+            using Buffer = VE::Internal::Core::Container::TVector<uint8_t, VE::Internal::Core::Memory::TTaggedAllocator<uint8_t, VE::Internal::Core::Memory::EMemoryTag::Log>>;
+
+            Buffer m_Buffer;
+            size_t m_Mask;
+
+            // Producer side
+            alignas(64) std::atomic<size_t> m_Head{0};
+            size_t m_CachedTail  = 0;
+            size_t m_PendingHead = 0;
+
+            // Consumer side
+            alignas(64) std::atomic<size_t> m_Tail{0};
+            size_t m_PeekedSize = 0;
+    };
+} // namespace VE::Internal::Core::Backlog
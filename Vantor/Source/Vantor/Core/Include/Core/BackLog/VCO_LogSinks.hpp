@@ -0,0 +1,90 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
+namespace VE::Internal::Core::Backlog
+{
+    // Writes every line to std::cout, flushed once per batch instead of once per line
+    class VConsoleLogSink : public ILogSink
+    {
+        public:
+            void Write(const VLogEntry &entry, std::string_view line) override;
+            void Flush() override;
+    };
+
+    // Appends to a file. Once it grows past maxBytes it is rotated to "<path>.1" (replacing the
+    // previous backup) and started over, so at most 2 * maxBytes stay on disk. 0 = unbounded.
+    class VFileLogSink : public ILogSink
+    {
+        public:
+            explicit VFileLogSink(const std::string &path, size_t maxBytes = 0);
+
+            bool IsOpen() const { return m_File.is_open(); }
+
+            void Write(const VLogEntry &entry, std::string_view line) override;
+            void Flush() override;
+
+        private:
+            void Rotate();
+
+            std::string   m_Path;
+            std::ofstream m_File;
+            size_t        m_MaxBytes = 0;
+            size_t        m_Written  = 0;
+    };
+
+    // Keeps the last capacity entries, older ones are evicted. Backs the Studio backlog panel,
+    // which reads it from the UI thread, hence the lock (never contended by Log() itself).
+    class VMemoryLogSink : public ILogSink
+    {
+        public:
+            using EntryVector = VE::Internal::Core::Container::TVector<VLogEntry, VE::Internal::Core::Memory::TTaggedAllocator<VLogEntry, VE::Internal::Core::Memory::EMemoryTag::Log>>;
+
+            explicit VMemoryLogSink(size_t capacity = 4096);
+
+            void Write(const VLogEntry &entry, std::string_view line) override;
+
+            // Calls fn(const VLogEntry&) for every retained entry, oldest first. fn must not log.
+            template <typename Fn> void ForEach(Fn &&fn) const
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                for (size_t i = 0; i < m_Entries.size(); ++i)
+                {
+                    fn(m_Entries[(m_First + i) % m_Entries.size()]);
+                }
+            }
+
+            EntryVector Snapshot() const;
+            void        Clear();
+
+            // Shrinking keeps the newest entries
+            void     SetCapacity(size_t capacity);
+            size_t   GetCapacity() const;
+            size_t   GetSize() const;
+            uint64_t GetEvictedCount() const;
+
+        private:
+            mutable std::mutex m_Mutex;
+            EntryVector        m_Entries;     // ring once full
+            size_t             m_First   = 0; // oldest entry
+            size_t             m_Capacity;
+            uint64_t           m_Evicted = 0;
+    };
+} // namespace VE::Internal::Core::Backlog
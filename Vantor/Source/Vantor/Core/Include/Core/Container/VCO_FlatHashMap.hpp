@@ -0,0 +1,675 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VCO_FlatHashMap.hpp - Open addressing hash map / set (SwissTable layout)
+//
+// Elements live in one flat slot array next to an array of one byte control codes
+// (empty, deleted or the low 7 bits of the element hash). Lookups compare a whole
+// group of control bytes at once (16 with SSE2, 8 with a portable SWAR fallback)
+// and only touch slots whose 7 bit tag matches, so there are no node allocations
+// and no pointer chasing.
+//
+// Differences to std::unordered_map:
+//  - inserting may move elements, references and iterators are invalidated by inserts
+//  - erase() does not move elements, so erasing while iterating is fine
+//  - value_type is std::pair<K, V>, the key must not be modified through an iterator
+//
+// Lookups are heterogeneous when Hash and Eq are transparent (the default for std::string
+// keys, which can be found with std::string_view or const char*). A hash computed once
+// with hash_function() can be passed to find()/contains() to skip rehashing the key.
+
+#pragma once
+
+#include <cassert>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VANTOR_FLATHASH_SSE2 1
+#endif
+
+namespace VE::Internal::Core::Container
+{
+    // Default hasher, std::hash with transparent string hashing
+    template <typename K> struct TFlatHash : std::hash<K>
+    {
+    };
+
+    template <> struct TFlatHash<std::string>
+    {
+            using is_transparent = void;
+
+            // std::hash<std::string> and std::hash<std::string_view> are guaranteed to agree
+            inline size_t operator()(std::string_view value) const noexcept { return std::hash<std::string_view>{}(value); }
+    };
+
+    namespace Detail
+    {
+        using FlatCtrl = int8_t;
+
+        static constexpr FlatCtrl FLAT_CTRL_EMPTY   = -128; // 0b10000000
+        static constexpr FlatCtrl FLAT_CTRL_DELETED = -2;   // 0b11111110, full slots are 0b0xxxxxxx
+
+        // Spreads the hash over all bits, std::hash is the identity for integers on most standard libraries
+        inline size_t FlatMixHash(size_t hash) noexcept
+        {
+            uint64_t x = hash;
+            x ^= x >> 32;
+            x *= 0x9E3779B97F4A7C15ull;
+            x ^= x >> 29;
+            return static_cast<size_t>(x);
+        }
+
+        // Set of matching positions inside a group
+        struct TFlatBitMask
+        {
+#ifdef VANTOR_FLATHASH_SSE2
+                static constexpr uint32_t SHIFT = 0; // one bit per byte
+                using Bits                      = uint32_t;
+#else
+                static constexpr uint32_t SHIFT = 3; // the high bit of every byte
+                using Bits                      = uint64_t;
+#endif
+                Bits bits;
+
+                explicit operator bool() const noexcept { return bits != 0; }
+                uint32_t Lowest() const noexcept { return static_cast<uint32_t>(std::countr_zero(bits)) >> SHIFT; }
+                void     RemoveLowest() noexcept { bits &= bits - 1; }
+        };
+
+#ifdef VANTOR_FLATHASH_SSE2
+        struct TFlatGroup
+        {
+                static constexpr size_t WIDTH = 16;
+
+                __m128i ctrl;
+
+                explicit TFlatGroup(const FlatCtrl *pos) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+                TFlatBitMask Match(FlatCtrl tag) const noexcept
+                {
+                    return {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrl)))};
+                }
+                TFlatBitMask MatchEmpty() const noexcept { return Match(FLAT_CTRL_EMPTY); }
+                // Empty and deleted are the only negative codes besides -1, which is never used
+                TFlatBitMask MatchEmptyOrDeleted() const noexcept
+                {
+                    return {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)))};
+                }
+        };
+#else
+        struct TFlatGroup
+        {
+                static_assert(std::endian::native == std::endian::little, "The portable flat hash group expects a little endian target");
+
+                static constexpr size_t   WIDTH = 8;
+                static constexpr uint64_t LSBS  = 0x0101010101010101ull;
+                static constexpr uint64_t MSBS  = 0x8080808080808080ull;
+
+                uint64_t ctrl;
+
+                explicit TFlatGroup(const FlatCtrl *pos) noexcept { std::memcpy(&ctrl, pos, sizeof(ctrl)); }
+
+                // May report a false positive next to a real match, those are always full slots so the key compare rejects them
+                TFlatBitMask Match(FlatCtrl tag) const noexcept
+                {
+                    const uint64_t x = ctrl ^ (LSBS * static_cast<uint8_t>(tag));
+                    return {(x - LSBS) & ~x & MSBS};
+                }
+                TFlatBitMask MatchEmpty() const noexcept { return {(ctrl & ~(ctrl << 6)) & MSBS}; }
+                TFlatBitMask MatchEmptyOrDeleted() const noexcept { return {(ctrl & ~(ctrl << 7)) & MSBS}; }
+        };
+#endif
+
+        template <typename T, typename = void> struct TIsTransparent : std::false_type
+        {
+        };
+        template <typename T> struct TIsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type
+        {
+        };
+
+        template <typename K, typename V> struct TFlatMapPolicy
+        {
+                using key_type  = K;
+                using slot_type = std::pair<K, V>;
+                static const K &Key(const slot_type &slot) noexcept { return slot.first; }
+        };
+
+        template <typename K> struct TFlatSetPolicy
+        {
+                using key_type  = K;
+                using slot_type = K;
+                static const K &Key(const slot_type &slot) noexcept { return slot; }
+        };
+
+        // Shared implementation of TFlatHashMap and TFlatHashSet
+        template <typename Policy, typename Hash, typename Eq, typename A> class TFlatHashTable
+        {
+            public:
+                using key_type       = typename Policy::key_type;
+                using value_type     = typename Policy::slot_type;
+                using hasher         = Hash;
+                using key_equal      = Eq;
+                using allocator_type = A;
+
+            protected:
+                using SlotAlloc       = typename std::allocator_traits<A>::template rebind_alloc<value_type>;
+                using CtrlAlloc       = typename std::allocator_traits<A>::template rebind_alloc<FlatCtrl>;
+                using SlotTraits      = std::allocator_traits<SlotAlloc>;
+                using CtrlTraits      = std::allocator_traits<CtrlAlloc>;
+                using Group           = TFlatGroup;
+                static constexpr bool TRANSPARENT = TIsTransparent<Hash>::value && TIsTransparent<Eq>::value;
+                static constexpr size_t NPOS      = ~size_t(0);
+
+            public:
+                template <bool Const> class TIterator
+                {
+                        friend class TFlatHashTable;
+
+                    public:
+                        using value_type        = typename Policy::slot_type;
+                        using reference         = std::conditional_t<Const, const value_type &, value_type &>;
+                        using pointer           = std::conditional_t<Const, const value_type *, value_type *>;
+                        using difference_type   = std::ptrdiff_t;
+                        using iterator_category = std::forward_iterator_tag;
+
+                        TIterator() noexcept = default;
+                        // iterator -> const_iterator
+                        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+                        TIterator(const TIterator<OtherConst> &other) noexcept : m_ctrl(other.m_ctrl), m_end(other.m_end), m_slot(other.m_slot)
+                        {
+                        }
+
+                        reference operator*() const noexcept { return *m_slot; }
+                        pointer   operator->() const noexcept { return m_slot; }
+
+                        TIterator &operator++() noexcept
+                        {
+                            ++m_ctrl;
+                            ++m_slot;
+                            SkipEmpty();
+                            return *this;
+                        }
+                        TIterator operator++(int) noexcept
+                        {
+                            TIterator copy = *this;
+                            ++*this;
+                            return copy;
+                        }
+
+                        friend bool operator==(const TIterator &lhs, const TIterator &rhs) noexcept { return lhs.m_ctrl == rhs.m_ctrl; }
+                        friend bool operator!=(const TIterator &lhs, const TIterator &rhs) noexcept { return lhs.m_ctrl != rhs.m_ctrl; }
+
+                    private:
+                        template <bool> friend class TIterator;
+
+                        TIterator(const FlatCtrl *ctrl, const FlatCtrl *end, pointer slot) noexcept : m_ctrl(ctrl), m_end(end), m_slot(slot) {}
+
+                        void SkipEmpty() noexcept
+                        {
+                            while (m_ctrl < m_end && *m_ctrl < 0)
+                            {
+                                ++m_ctrl;
+                                ++m_slot;
+                            }
+                        }
+
+                        const FlatCtrl *m_ctrl = nullptr;
+                        const FlatCtrl *m_end  = nullptr;
+                        pointer         m_slot = nullptr;
+                };
+
+                using iterator       = TIterator<false>;
+                using const_iterator = TIterator<true>;
+
+                TFlatHashTable() = default;
+                explicit TFlatHashTable(size_t capacity, const Hash &hash = Hash(), const Eq &eq = Eq(), const A &allocator = A())
+                    : m_hash(hash), m_eq(eq), m_slotAlloc(allocator), m_ctrlAlloc(allocator)
+                {
+                    reserve(capacity);
+                }
+
+                TFlatHashTable(const TFlatHashTable &other)
+                    : m_hash(other.m_hash), m_eq(other.m_eq), m_slotAlloc(SlotTraits::select_on_container_copy_construction(other.m_slotAlloc)),
+                      m_ctrlAlloc(CtrlTraits::select_on_container_copy_construction(other.m_ctrlAlloc))
+                {
+                    copy_from(other);
+                }
+
+                TFlatHashTable(TFlatHashTable &&other) noexcept
+                    : m_hash(std::move(other.m_hash)), m_eq(std::move(other.m_eq)), m_slotAlloc(std::move(other.m_slotAlloc)), m_ctrlAlloc(std::move(other.m_ctrlAlloc))
+                {
+                    steal_from(other);
+                }
+
+                ~TFlatHashTable() { destroy(); }
+
+                TFlatHashTable &operator=(const TFlatHashTable &other)
+                {
+                    if (this != &other)
+                    {
+                        destroy();
+                        m_hash = other.m_hash;
+                        m_eq   = other.m_eq;
+                        copy_from(other);
+                    }
+                    return *this;
+                }
+
+                TFlatHashTable &operator=(TFlatHashTable &&other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        destroy();
+                        m_hash      = std::move(other.m_hash);
+                        m_eq        = std::move(other.m_eq);
+                        m_slotAlloc = std::move(other.m_slotAlloc);
+                        m_ctrlAlloc = std::move(other.m_ctrlAlloc);
+                        steal_from(other);
+                    }
+                    return *this;
+                }
+
+                // Iteration
+                iterator begin() noexcept
+                {
+                    iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+                    it.SkipEmpty();
+                    return it;
+                }
+                const_iterator begin() const noexcept
+                {
+                    const_iterator it(m_ctrl, m_ctrl + m_capacity, m_slots);
+                    it.SkipEmpty();
+                    return it;
+                }
+                iterator       end() noexcept { return iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity); }
+                const_iterator end() const noexcept { return const_iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity); }
+
+                // Capacity
+                size_t size() const noexcept { return m_size; }
+                bool   empty() const noexcept { return m_size == 0; }
+                size_t capacity() const noexcept { return m_capacity; }
+                float  load_factor() const noexcept { return m_capacity == 0 ? 0.0f : float(m_size) / float(m_capacity); }
+
+                const Hash &hash_function() const noexcept { return m_hash; }
+                const Eq   &key_eq() const noexcept { return m_eq; }
+
+                // Makes room for count elements without rehashing
+                void reserve(size_t count)
+                {
+                    if (count > m_size + m_growthLeft) rehash(CapacityFor(count));
+                }
+
+                void clear() noexcept
+                {
+                    if (m_capacity == 0) return;
+                    for (size_t i = 0; i < m_capacity; ++i)
+                    {
+                        if (m_ctrl[i] >= 0) SlotTraits::destroy(m_slotAlloc, m_slots + i);
+                    }
+                    std::memset(m_ctrl, static_cast<uint8_t>(FLAT_CTRL_EMPTY), m_capacity + Group::WIDTH);
+                    m_size       = 0;
+                    m_growthLeft = GrowthLimit(m_capacity);
+                }
+
+                // Lookup (Q is any key type when hasher and key_equal are transparent)
+                template <typename Q = key_type> iterator find(const Q &key) { return find(key, HashOf(key)); }
+                template <typename Q = key_type> const_iterator find(const Q &key) const { return find(key, HashOf(key)); }
+
+                // Lookup with a hash computed earlier through hash_function()
+                template <typename Q = key_type> iterator find(const Q &key, size_t hash)
+                {
+                    const size_t index = FindIndex(LookupKey(key), hash);
+                    return index == NPOS ? end() : IteratorAt(index);
+                }
+                template <typename Q = key_type> const_iterator find(const Q &key, size_t hash) const
+                {
+                    const size_t index = FindIndex(LookupKey(key), hash);
+                    return index == NPOS ? end() : const_iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+                }
+
+                template <typename Q = key_type> bool   contains(const Q &key) const { return FindIndex(LookupKey(key), HashOf(key)) != NPOS; }
+                template <typename Q = key_type> bool   contains(const Q &key, size_t hash) const { return FindIndex(LookupKey(key), hash) != NPOS; }
+                template <typename Q = key_type> size_t count(const Q &key) const { return contains(key) ? 1 : 0; }
+
+                // Removal, iterators to other elements stay valid
+                template <typename Q = key_type> size_t erase(const Q &key)
+                {
+                    const size_t index = FindIndex(LookupKey(key), HashOf(key));
+                    if (index == NPOS) return 0;
+                    EraseAt(index);
+                    return 1;
+                }
+
+                iterator erase(const_iterator position)
+                {
+                    const size_t index = static_cast<size_t>(position.m_ctrl - m_ctrl);
+                    assert(index < m_capacity && m_ctrl[index] >= 0);
+                    EraseAt(index);
+                    iterator next = IteratorAt(index);
+                    ++next;
+                    return next;
+                }
+                iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+            protected:
+                static size_t GrowthLimit(size_t capacity) noexcept { return capacity - capacity / 8; } // max load factor 7/8
+
+                static size_t CapacityFor(size_t count) noexcept
+                {
+                    size_t capacity = Group::WIDTH;
+                    while (GrowthLimit(capacity) < count)
+                    {
+                        capacity *= 2;
+                    }
+                    return capacity;
+                }
+
+                template <typename Q> size_t HashOf(const Q &key) const { return m_hash(LookupKey(key)); }
+
+                // Heterogeneous keys are only passed through when hasher and key_equal both accept them
+                template <typename Q> static decltype(auto) LookupKey(const Q &key)
+                {
+                    if constexpr (TRANSPARENT || std::is_same_v<Q, key_type>)
+                    {
+                        return (key);
+                    }
+                    else
+                    {
+                        return key_type(key);
+                    }
+                }
+
+                iterator IteratorAt(size_t index) noexcept { return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index); }
+
+                void SetCtrl(size_t index, FlatCtrl value) noexcept
+                {
+                    m_ctrl[index] = value;
+                    // The first group is mirrored past the end so a group load never has to wrap around
+                    if (index < Group::WIDTH) m_ctrl[m_capacity + index] = value;
+                }
+
+                template <typename Q> size_t FindIndex(const Q &key, size_t hash) const
+                {
+                    if (m_capacity == 0) return NPOS;
+
+                    const size_t   mixed = FlatMixHash(hash);
+                    const FlatCtrl tag   = static_cast<FlatCtrl>(mixed & 0x7F);
+                    const size_t   mask  = m_capacity - 1;
+                    size_t         pos   = (mixed >> 7) & mask;
+                    size_t         step  = 0;
+                    while (true)
+                    {
+                        const Group group(m_ctrl + pos);
+                        for (TFlatBitMask match = group.Match(tag); match; match.RemoveLowest())
+                        {
+                            const size_t index = (pos + match.Lowest()) & mask;
+                            if (m_eq(Policy::Key(m_slots[index]), key)) return index;
+                        }
+                        if (group.MatchEmpty()) return NPOS;
+
+                        // Triangular probing visits every group once for power of two capacities
+                        step += Group::WIDTH;
+                        pos = (pos + step) & mask;
+                    }
+                }
+
+                size_t FindFirstNonFull(size_t mixed) const noexcept
+                {
+                    const size_t mask = m_capacity - 1;
+                    size_t       pos  = (mixed >> 7) & mask;
+                    size_t       step = 0;
+                    while (true)
+                    {
+                        const TFlatBitMask free = Group(m_ctrl + pos).MatchEmptyOrDeleted();
+                        if (free) return (pos + free.Lowest()) & mask;
+                        step += Group::WIDTH;
+                        pos = (pos + step) & mask;
+                    }
+                }
+
+                // Returns the slot index of key and whether the slot is new (and still has to be constructed)
+                template <typename Q> std::pair<size_t, bool> FindOrPrepareInsert(const Q &key, size_t hash)
+                {
+                    size_t index = FindIndex(key, hash);
+                    if (index != NPOS) return {index, false};
+
+                    if (m_growthLeft == 0)
+                    {
+                        // Mostly tombstones: clean up at the same size, otherwise grow
+                        if (m_capacity == 0)
+                            rehash(Group::WIDTH);
+                        else
+                            rehash(m_size + 1 > GrowthLimit(m_capacity) / 2 ? m_capacity * 2 : m_capacity);
+                    }
+
+                    const size_t mixed = FlatMixHash(hash);
+                    index              = FindFirstNonFull(mixed);
+                    if (m_ctrl[index] == FLAT_CTRL_EMPTY) m_growthLeft--;
+                    SetCtrl(index, static_cast<FlatCtrl>(mixed & 0x7F));
+                    m_size++;
+                    return {index, true};
+                }
+
+                void EraseAt(size_t index)
+                {
+                    SlotTraits::destroy(m_slotAlloc, m_slots + index);
+                    SetCtrl(index, FLAT_CTRL_DELETED);
+                    m_size--;
+                }
+
+                void rehash(size_t new_capacity)
+                {
+                    assert(new_capacity >= Group::WIDTH && (new_capacity & (new_capacity - 1)) == 0);
+
+                    FlatCtrl   *old_ctrl     = m_ctrl;
+                    value_type *old_slots    = m_slots;
+                    size_t      old_capacity = m_capacity;
+
+                    Allocate(new_capacity);
+                    for (size_t i = 0; i < old_capacity; ++i)
+                    {
+                        if (old_ctrl[i] < 0) continue;
+
+                        const size_t mixed = FlatMixHash(m_hash(Policy::Key(old_slots[i])));
+                        const size_t index = FindFirstNonFull(mixed);
+                        SetCtrl(index, static_cast<FlatCtrl>(mixed & 0x7F));
+                        SlotTraits::construct(m_slotAlloc, m_slots + index, std::move(old_slots[i]));
+                        SlotTraits::destroy(m_slotAlloc, old_slots + i);
+                    }
+                    m_growthLeft -= m_size;
+
+                    Deallocate(old_ctrl, old_slots, old_capacity);
+                }
+
+                void Allocate(size_t capacity)
+                {
+                    m_capacity   = capacity;
+                    m_ctrl       = CtrlTraits::allocate(m_ctrlAlloc, capacity + Group::WIDTH);
+                    m_slots      = SlotTraits::allocate(m_slotAlloc, capacity);
+                    m_growthLeft = GrowthLimit(capacity);
+                    std::memset(m_ctrl, static_cast<uint8_t>(FLAT_CTRL_EMPTY), capacity + Group::WIDTH);
+                }
+
+                void Deallocate(FlatCtrl *ctrl, value_type *slots, size_t capacity)
+                {
+                    if (capacity == 0) return;
+                    CtrlTraits::deallocate(m_ctrlAlloc, ctrl, capacity + Group::WIDTH);
+                    SlotTraits::deallocate(m_slotAlloc, slots, capacity);
+                }
+
+                void destroy()
+                {
+                    clear();
+                    Deallocate(m_ctrl, m_slots, m_capacity);
+                    m_ctrl       = nullptr;
+                    m_slots      = nullptr;
+                    m_capacity   = 0;
+                    m_growthLeft = 0;
+                }
+
+                // Same capacity and layout, so control bytes can be copied as is
+                void copy_from(const TFlatHashTable &other)
+                {
+                    if (other.m_capacity == 0) return;
+                    Allocate(other.m_capacity);
+                    std::memcpy(m_ctrl, other.m_ctrl, m_capacity + Group::WIDTH);
+                    for (size_t i = 0; i < m_capacity; ++i)
+                    {
+                        if (m_ctrl[i] >= 0) SlotTraits::construct(m_slotAlloc, m_slots + i, other.m_slots[i]);
+                    }
+                    m_size       = other.m_size;
+                    m_growthLeft = other.m_growthLeft;
+                }
+
+                void steal_from(TFlatHashTable &other) noexcept
+                {
+                    m_ctrl             = other.m_ctrl;
+                    m_slots            = other.m_slots;
+                    m_capacity         = other.m_capacity;
+                    m_size             = other.m_size;
+                    m_growthLeft       = other.m_growthLeft;
+                    other.m_ctrl       = nullptr;
+                    other.m_slots      = nullptr;
+                    other.m_capacity   = 0;
+                    other.m_size       = 0;
+                    other.m_growthLeft = 0;
+                }
+
+                FlatCtrl   *m_ctrl       = nullptr;
+                value_type *m_slots      = nullptr;
+                size_t      m_capacity   = 0; // 0 or a power of two >= Group::WIDTH
+                size_t      m_size       = 0;
+                size_t      m_growthLeft = 0; // inserts into empty slots left before a rehash
+
+                [[no_unique_address]] Hash      m_hash;
+                [[no_unique_address]] Eq        m_eq;
+                [[no_unique_address]] SlotAlloc m_slotAlloc;
+                [[no_unique_address]] CtrlAlloc m_ctrlAlloc;
+        };
+    } // namespace Detail
+
+    template <typename K, typename V, typename Hash = TFlatHash<K>, typename Eq = std::equal_to<>, typename A = std::allocator<std::pair<K, V>>>
+    class TFlatHashMap : public Detail::TFlatHashTable<Detail::TFlatMapPolicy<K, V>, Hash, Eq, A>
+    {
+            using Base = Detail::TFlatHashTable<Detail::TFlatMapPolicy<K, V>, Hash, Eq, A>;
+
+        public:
+            using mapped_type = V;
+            using typename Base::iterator;
+            using typename Base::const_iterator;
+
+            using Base::Base;
+            TFlatHashMap() = default;
+
+            TFlatHashMap(std::initializer_list<std::pair<K, V>> init_list)
+            {
+                this->reserve(init_list.size());
+                for (const auto &entry : init_list)
+                {
+                    insert(entry);
+                }
+            }
+
+            // Constructs the value from args if key is not present yet
+            template <typename KeyArg, typename... Args> std::pair<iterator, bool> try_emplace(KeyArg &&key, Args &&...args)
+            {
+                const auto [index, inserted] = this->FindOrPrepareInsert(this->LookupKey(key), this->HashOf(key));
+                if (inserted)
+                {
+                    Base::SlotTraits::construct(this->m_slotAlloc, this->m_slots + index, std::piecewise_construct,
+                                                std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+                }
+                return {this->IteratorAt(index), inserted};
+            }
+
+            // try_emplace with a precomputed hash
+            template <typename KeyArg, typename... Args> std::pair<iterator, bool> try_emplace_hashed(size_t hash, KeyArg &&key, Args &&...args)
+            {
+                const auto [index, inserted] = this->FindOrPrepareInsert(this->LookupKey(key), hash);
+                if (inserted)
+                {
+                    Base::SlotTraits::construct(this->m_slotAlloc, this->m_slots + index, std::piecewise_construct,
+                                                std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+                }
+                return {this->IteratorAt(index), inserted};
+            }
+
+            std::pair<iterator, bool> insert(const std::pair<K, V> &value) { return try_emplace(value.first, value.second); }
+            std::pair<iterator, bool> insert(std::pair<K, V> &&value) { return try_emplace(std::move(value.first), std::move(value.second)); }
+
+            template <typename KeyArg, typename M> std::pair<iterator, bool> insert_or_assign(KeyArg &&key, M &&value)
+            {
+                auto result = try_emplace(std::forward<KeyArg>(key), std::forward<M>(value));
+                if (!result.second) result.first->second = std::forward<M>(value);
+                return result;
+            }
+
+            template <typename KeyArg> V &operator[](KeyArg &&key) { return try_emplace(std::forward<KeyArg>(key)).first->second; }
+
+            // The key has to exist
+            template <typename Q> V &at(const Q &key)
+            {
+                auto it = this->find(key);
+                assert(it != this->end() && "TFlatHashMap::at() - key not found");
+                return it->second;
+            }
+            template <typename Q> const V &at(const Q &key) const
+            {
+                auto it = this->find(key);
+                assert(it != this->end() && "TFlatHashMap::at() - key not found");
+                return it->second;
+            }
+    };
+
+    template <typename K, typename Hash = TFlatHash<K>, typename Eq = std::equal_to<>, typename A = std::allocator<K>>
+    class TFlatHashSet : public Detail::TFlatHashTable<Detail::TFlatSetPolicy<K>, Hash, Eq, A>
+    {
+            using Base = Detail::TFlatHashTable<Detail::TFlatSetPolicy<K>, Hash, Eq, A>;
+
+        public:
+            using typename Base::iterator;
+            using typename Base::const_iterator;
+
+            using Base::Base;
+            TFlatHashSet() = default;
+
+            TFlatHashSet(std::initializer_list<K> init_list)
+            {
+                this->reserve(init_list.size());
+                for (const auto &entry : init_list)
+                {
+                    insert(entry);
+                }
+            }
+
+            template <typename KeyArg> std::pair<iterator, bool> insert(KeyArg &&key)
+            {
+                const auto [index, inserted] = this->FindOrPrepareInsert(this->LookupKey(key), this->HashOf(key));
+                if (inserted) Base::SlotTraits::construct(this->m_slotAlloc, this->m_slots + index, std::forward<KeyArg>(key));
+                return {this->IteratorAt(index), inserted};
+            }
+
+            template <typename... Args> std::pair<iterator, bool> emplace(Args &&...args)
+            {
+                K key(std::forward<Args>(args)...);
+                return insert(std::move(key));
+            }
+    };
+} // namespace VE::Internal::Core::Container
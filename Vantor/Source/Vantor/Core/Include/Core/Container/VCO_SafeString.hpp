@@ -7,146 +7,345 @@
  *             See LICENSE file for full details.
  ****************************************************************************/
 
+// VCO_SafeString.hpp - Small string optimized string
+// Strings of up to SSO_THRESHOLD characters are stored inline, longer ones on the heap with
+// geometric capacity growth. The FNV-1a hash is cached until the string is modified, it is the
+// same hash VName uses, so a TSafeString can be interned without hashing it again.
+// Non-const element access (operator[], begin(), data()) drops the cached hash.
+
 #pragma once
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
+#include <string_view>
+#include <utility>
+
+#include <Core/Types/VCO_Name.hpp>
 
 namespace VE::Internal::Core::Container
 {
     // Internal Implementation for a TSafeString
     template <typename Alloc = std::allocator<char>> class TSafeString
     {
+            using AllocatorTraits = std::allocator_traits<Alloc>;
+
         public:
+            using value_type     = char;
+            using allocator_type = Alloc;
+            using size_type      = size_t;
+            using iterator       = char *;
+            using const_iterator = const char *;
+
             static constexpr size_t SSO_THRESHOLD = 23;
+            static constexpr size_t npos          = static_cast<size_t>(-1);
 
             TSafeString() noexcept : m_size(0), m_using_sso(true) { m_sso_data[0] = '\0'; }
+            explicit TSafeString(const Alloc &allocator) noexcept : m_allocator(allocator) { m_sso_data[0] = '\0'; }
 
-            TSafeString(const char *str) : TSafeString() { assign(str); }
+            TSafeString(const char *str, const Alloc &allocator = Alloc()) : TSafeString(allocator) { assign(str); }
+            TSafeString(const char *str, size_t len, const Alloc &allocator = Alloc()) : TSafeString(allocator) { assign(str, len); }
+            TSafeString(std::string_view str, const Alloc &allocator = Alloc()) : TSafeString(allocator) { assign(str); }
 
+            TSafeString(const TSafeString &other) : TSafeString(AllocatorTraits::select_on_container_copy_construction(other.m_allocator))
+            {
+                assign(other.data(), other.m_size);
+                m_hash       = other.m_hash;
+                m_hash_valid = other.m_hash_valid;
+            }
 
-            ~TSafeString()
+            TSafeString(TSafeString &&other) noexcept : m_allocator(std::move(other.m_allocator)) { steal_from(other); }
+
+            ~TSafeString() { release(); }
+
+            TSafeString &operator=(const TSafeString &other)
             {
-                if (!m_using_sso)
+                if (this == &other) return *this;
+                if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
                 {
-                    m_allocator.deallocate(m_data, m_capacity + 1);
+                    if (m_allocator != other.m_allocator)
+                    {
+                        release();
+                        m_allocator = other.m_allocator;
+                    }
                 }
+                assign(other.data(), other.m_size);
+                m_hash       = other.m_hash;
+                m_hash_valid = other.m_hash_valid;
+                return *this;
             }
 
-            void assign(const char *str)
+            TSafeString &operator=(TSafeString &&other) noexcept
             {
-                size_t len = std::strlen(str);
-                if (len <= SSO_THRESHOLD)
+                if (this == &other) return *this;
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value)
                 {
-                    std::memcpy(m_sso_data, str, len + 1);
-                    m_size      = len;
-                    m_using_sso = true;
+                    release();
+                    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) m_allocator = std::move(other.m_allocator);
+                    steal_from(other);
+                }
+                else if (m_allocator == other.m_allocator)
+                {
+                    release();
+                    steal_from(other);
                 }
                 else
                 {
-                    m_data = m_allocator.allocate(len + 1);
-                    std::memcpy(m_data, str, len + 1);
-                    m_size      = len;
+                    // Storage of a different allocator can't be adopted
+                    assign(other.data(), other.m_size);
+                    other.clear();
+                }
+                return *this;
+            }
+
+            TSafeString &operator=(const char *str) { return assign(str); }
+            TSafeString &operator=(std::string_view str) { return assign(str); }
+
+            TSafeString &assign(const char *str) { return assign(str, std::strlen(str)); }
+            TSafeString &assign(std::string_view str) { return assign(str.data(), str.size()); }
+            TSafeString &assign(const char *str, size_t len)
+            {
+                if (len > capacity())
+                {
+                    // str may point into our own buffer, keep it alive until it was copied
+                    char *new_data = m_allocator.allocate(len + 1);
+                    std::memcpy(new_data, str, len);
+                    release();
+                    m_data      = new_data;
                     m_capacity  = len;
                     m_using_sso = false;
                 }
+                else
+                {
+                    std::memmove(data_ptr(), str, len);
+                }
+                set_size(len);
+                return *this;
             }
 
             size_t      size() const { return m_size; }
+            size_t      length() const { return m_size; }
+            bool        empty() const { return m_size == 0; }
+            size_t      capacity() const { return m_using_sso ? SSO_THRESHOLD : m_capacity; }
             const char *c_str() const { return m_using_sso ? m_sso_data : m_data; }
-
-            size_t find(const char *substr) const
+            const char *data() const { return c_str(); }
+            char       *data()
             {
-                const char *found = std::strstr(c_str(), substr);
-                return found ? static_cast<size_t>(found - c_str()) : std::string::npos;
+                m_hash_valid = false;
+                return data_ptr();
             }
+            Alloc get_allocator() const { return m_allocator; }
+
+            std::string_view view() const { return std::string_view(c_str(), m_size); }
+            operator std::string_view() const { return view(); }
 
-            TSafeString substr(size_t pos, size_t len) const
+            // Makes sure at least capacity characters fit without reallocating
+            void reserve(size_t new_capacity)
             {
-                assert(pos + len <= m_size);
-                char temp[SSO_THRESHOLD + 1] = {};
-                std::memcpy(temp, c_str() + pos, len);
-                temp[len] = '\0';
-                return TSafeString(temp);
+                if (new_capacity > capacity()) reallocate(new_capacity);
             }
 
-            u_int32_t hash() const noexcept
+            void clear() { set_size(0); }
+
+            void push_back(char c)
             {
-                constexpr u_int32_t FNV_offset_basis = 2166136261u;
-                constexpr u_int32_t FNV_prime = 16777619u;
+                if (m_size == capacity()) grow(m_size + 1);
+                data_ptr()[m_size] = c;
+                set_size(m_size + 1);
+            }
 
-                u_int32_t hash = FNV_offset_basis;
-                const char* ptr = c_str();
-                for (size_t i = 0; i < m_size; ++i)
+            TSafeString &append(const char *str, size_t len)
+            {
+                if (len == 0) return *this;
+                const size_t new_size = m_size + len;
+                if (new_size > capacity())
                 {
-                    hash ^= static_cast<u_int8_t>(ptr[i]);
-                    hash *= FNV_prime;
+                    // str may point into our own buffer
+                    const char  *old    = c_str();
+                    const bool   alias  = str >= old && str < old + m_size;
+                    const size_t offset = static_cast<size_t>(str - old);
+                    grow(new_size);
+                    if (alias) str = c_str() + offset;
                 }
-                return hash;
+                std::memmove(data_ptr() + m_size, str, len);
+                set_size(new_size);
+                return *this;
+            }
+            TSafeString &append(const char *str) { return append(str, std::strlen(str)); }
+            TSafeString &append(std::string_view str) { return append(str.data(), str.size()); }
+
+            TSafeString &operator+=(const char *str) { return append(str); }
+            TSafeString &operator+=(std::string_view str) { return append(str); }
+            TSafeString &operator+=(const TSafeString &str) { return append(str.data(), str.size()); }
+            TSafeString &operator+=(char c)
+            {
+                push_back(c);
+                return *this;
             }
 
-            void replace(size_t pos, size_t len, const char *str)
+            size_t find(std::string_view substr, size_t pos = 0) const { return view().find(substr, pos); }
+            size_t find(const char *substr, size_t pos = 0) const { return view().find(substr, pos); }
+            size_t find(char c, size_t pos = 0) const { return view().find(c, pos); }
+
+            // len is clamped to the end of the string, like std::string::substr
+            TSafeString substr(size_t pos, size_t len = npos) const
             {
-                assert(pos + len <= m_size);
-                TSafeString temp = substr(0, pos);
-                temp += str;
-                temp += substr(pos + len, m_size - pos - len);
-                *this = temp;
+                assert(pos <= m_size);
+                return TSafeString(c_str() + pos, std::min(len, m_size - pos), m_allocator);
             }
 
-            TSafeString &operator+=(const char *str)
+            // Replaces the len characters at pos with str, in place
+            TSafeString &replace(size_t pos, size_t len, std::string_view str)
             {
-                size_t new_len = m_size + std::strlen(str);
-                if (new_len <= SSO_THRESHOLD)
+                assert(pos <= m_size);
+                len = std::min(len, m_size - pos);
+
+                const char *old = c_str();
+                if (str.data() < old + m_size && str.data() + str.size() > old)
                 {
-                    std::strcat(m_sso_data, str);
-                    m_size = new_len;
+                    // The replacement overlaps our own buffer, resolve it on a copy
+                    TSafeString copy(str, m_allocator);
+                    return replace(pos, len, copy.view());
                 }
-                else
+
+                const size_t tail     = m_size - pos - len;
+                const size_t new_size = m_size - len + str.size();
+                if (new_size > capacity()) grow(new_size);
+
+                char *ptr = data_ptr();
+                std::memmove(ptr + pos + str.size(), ptr + pos + len, tail);
+                if (!str.empty()) std::memcpy(ptr + pos, str.data(), str.size());
+                set_size(new_size);
+                return *this;
+            }
+            TSafeString &replace(size_t pos, size_t len, const char *str) { return replace(pos, len, std::string_view(str)); }
+
+            // FNV-1a, computed on first use after every modification
+            uint32_t hash() const noexcept
+            {
+                if (!m_hash_valid)
                 {
-                    char *new_data = m_allocator.allocate(new_len + 1);
-                    std::strcpy(new_data, c_str());
-                    std::strcat(new_data, str);
-                    if (!m_using_sso) m_allocator.deallocate(m_data, m_capacity + 1);
-                    m_data      = new_data;
-                    m_capacity  = new_len;
-                    m_size      = new_len;
-                    m_using_sso = false;
+                    m_hash       = VE::Internal::Core::Types::HashFNV1a(view());
+                    m_hash_valid = true;
                 }
-                return *this;
+                return m_hash;
             }
 
             const char &operator[](size_t i) const
             {
                 assert(i < m_size);
-                return m_using_sso ? m_sso_data[i] : m_data[i];
+                return c_str()[i];
             }
 
             char &operator[](size_t i)
             {
                 assert(i < m_size);
-                return m_using_sso ? m_sso_data[i] : m_data[i];
+                m_hash_valid = false;
+                return data_ptr()[i];
             }
 
-            const char* begin() const { return c_str(); }
-            const char* end() const { return c_str() + m_size; }
+            const char *begin() const { return c_str(); }
+            const char *end() const { return c_str() + m_size; }
+
+            char *begin() { return data(); }
+            char *end() { return data() + m_size; }
 
-            char* begin() { return const_cast<char*>(c_str()); }
-            char* end() { return const_cast<char*>(c_str() + m_size); }
+            void swap(TSafeString &other) noexcept
+            {
+                TSafeString temp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temp);
+            }
 
+            friend bool operator==(const TSafeString &a, const TSafeString &b)
+            {
+                if (a.m_size != b.m_size) return false;
+                if (a.m_hash_valid && b.m_hash_valid && a.m_hash != b.m_hash) return false;
+                return std::memcmp(a.c_str(), b.c_str(), a.m_size) == 0;
+            }
+            friend bool operator!=(const TSafeString &a, const TSafeString &b) { return !(a == b); }
+            friend bool operator==(const TSafeString &a, std::string_view b) { return a.view() == b; }
+            friend bool operator!=(const TSafeString &a, std::string_view b) { return a.view() != b; }
+            friend bool operator==(const TSafeString &a, const char *b) { return a.view() == b; }
+            friend bool operator!=(const TSafeString &a, const char *b) { return a.view() != b; }
+            friend bool operator<(const TSafeString &a, const TSafeString &b) { return a.view() < b.view(); }
 
         private:
+            char *data_ptr() { return m_using_sso ? m_sso_data : m_data; }
+
+            void set_size(size_t size)
+            {
+                m_size             = size;
+                data_ptr()[m_size] = '\0';
+                m_hash_valid       = false;
+            }
+
+            // Geometric growth, so repeated appends are amortized O(1)
+            void grow(size_t min_capacity) { reallocate(std::max(min_capacity, capacity() * 2)); }
+
+            void reallocate(size_t new_capacity)
+            {
+                char *new_data = m_allocator.allocate(new_capacity + 1);
+                std::memcpy(new_data, c_str(), m_size + 1);
+                release();
+                m_data      = new_data;
+                m_capacity  = new_capacity;
+                m_using_sso = false;
+            }
+
+            // Frees the heap buffer, the caller has to set up the contents again
+            void release()
+            {
+                if (!m_using_sso)
+                {
+                    m_allocator.deallocate(m_data, m_capacity + 1);
+                    m_using_sso = true;
+                }
+            }
+
+            // Takes over other's buffer (or copies its inline storage), leaves other empty
+            void steal_from(TSafeString &other) noexcept
+            {
+                if (other.m_using_sso)
+                {
+                    std::memcpy(m_sso_data, other.m_sso_data, other.m_size + 1);
+                    m_using_sso = true;
+                }
+                else
+                {
+                    m_data            = other.m_data;
+                    m_capacity        = other.m_capacity;
+                    m_using_sso       = false;
+                    other.m_using_sso = true;
+                }
+                m_size       = other.m_size;
+                m_hash       = other.m_hash;
+                m_hash_valid = other.m_hash_valid;
+
+                other.m_sso_data[0] = '\0';
+                other.m_size        = 0;
+                other.m_hash_valid  = false;
+            }
+
             union
             {
                     char  m_sso_data[SSO_THRESHOLD + 1]; // +1 for null terminator
                     char *m_data;
             };
-            size_t m_size      = 0;
-            size_t m_capacity  = 0;
-            bool   m_using_sso = true;
-            Alloc  m_allocator;
+            size_t                      m_size       = 0;
+            size_t                      m_capacity   = 0;
+            bool                        m_using_sso  = true;
+            mutable bool                m_hash_valid = false;
+            mutable uint32_t            m_hash       = 0;
+            [[no_unique_address]] Alloc m_allocator;
     };
 
-} // namespace VE::Internal::Core
\ No newline at end of file
+} // namespace VE::Internal::Core::Container
+
+template <typename Alloc> struct std::hash<VE::Internal::Core::Container::TSafeString<Alloc>>
+{
+        inline size_t operator()(const VE::Internal::Core::Container::TSafeString<Alloc> &str) const noexcept { return str.hash(); }
+};
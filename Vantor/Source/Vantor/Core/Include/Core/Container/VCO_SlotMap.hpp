@@ -0,0 +1,193 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VCO_SlotMap.hpp - Generational handle pool
+// TSlotMap stores its values densely packed in a TVector, so iterating touches contiguous memory
+// only. Values are referenced through THandle (32 bit slot index + 32 bit generation). Every
+// erase bumps the generation of the slot, so handles to erased values are detected instead of
+// silently resolving to whatever reuses the slot later.
+//
+// insert/erase/lookup are O(1). erase() moves the last value into the hole, so pointers and
+// iteration order are not stable across erase(), handles are.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include <Core/Container/VCO_Vector.hpp>
+
+namespace VE::Internal::Core::Container
+{
+    // Typed handle into a TSlotMap<T>, a default constructed handle is invalid
+    template <typename T> struct THandle
+    {
+            static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+            uint32_t index      = INVALID_INDEX;
+            uint32_t generation = 0; // occupied slots always have an odd generation, so 0 never matches
+
+            constexpr bool IsValid() const noexcept { return generation != 0; }
+
+            // Packs the handle into a single integer (e.g. to store it in untyped ids)
+            constexpr uint64_t ToU64() const noexcept { return (static_cast<uint64_t>(generation) << 32) | index; }
+            static constexpr THandle FromU64(uint64_t value) noexcept { return THandle{static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32)}; }
+
+            friend constexpr bool operator==(THandle a, THandle b) noexcept { return a.index == b.index && a.generation == b.generation; }
+            friend constexpr bool operator!=(THandle a, THandle b) noexcept { return !(a == b); }
+    };
+
+    template <typename T, typename A = std::allocator<T>> class TSlotMap
+    {
+            struct Slot
+            {
+                    uint32_t dense;      // index into m_values while occupied, next free slot otherwise
+                    uint32_t generation; // even = free, odd = occupied
+            };
+
+            using SlotAlloc  = typename std::allocator_traits<A>::template rebind_alloc<Slot>;
+            using IndexAlloc = typename std::allocator_traits<A>::template rebind_alloc<uint32_t>;
+
+            static constexpr uint32_t FREE_LIST_END = std::numeric_limits<uint32_t>::max();
+
+        public:
+            using value_type     = T;
+            using handle_type    = THandle<T>;
+            using iterator       = T *;
+            using const_iterator = const T *;
+
+            TSlotMap() = default;
+            explicit TSlotMap(const A &allocator) : m_values(allocator), m_slots(SlotAlloc(allocator)), m_denseToSlot(IndexAlloc(allocator)) {}
+
+            template <typename... Args> handle_type emplace(Args &&...args)
+            {
+                uint32_t slotIndex;
+                if (m_freeHead != FREE_LIST_END)
+                {
+                    slotIndex  = m_freeHead;
+                    m_freeHead = m_slots[slotIndex].dense;
+                }
+                else
+                {
+                    assert(m_slots.size() < FREE_LIST_END && "TSlotMap is full");
+                    slotIndex = static_cast<uint32_t>(m_slots.size());
+                    m_slots.push_back(Slot{0, 0});
+                }
+
+                m_values.emplace_back(std::forward<Args>(args)...);
+                m_denseToSlot.push_back(slotIndex);
+
+                Slot &slot = m_slots[slotIndex];
+                slot.dense = static_cast<uint32_t>(m_values.size() - 1);
+                slot.generation++;
+                return handle_type{slotIndex, slot.generation};
+            }
+
+            handle_type insert(const T &value) { return emplace(value); }
+            handle_type insert(T &&value) { return emplace(std::move(value)); }
+
+            // Returns false if handle was already stale
+            bool erase(handle_type handle)
+            {
+                if (!contains(handle)) return false;
+
+                Slot          &slot = m_slots[handle.index];
+                const uint32_t hole = slot.dense;
+                const uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+                if (hole != last)
+                {
+                    m_values[hole]                     = std::move(m_values[last]);
+                    m_denseToSlot[hole]                = m_denseToSlot[last];
+                    m_slots[m_denseToSlot[hole]].dense = hole;
+                }
+                m_values.pop_back();
+                m_denseToSlot.pop_back();
+
+                // A slot whose generation would wrap is retired instead of risking a false match
+                slot.generation++;
+                if (slot.generation != std::numeric_limits<uint32_t>::max() - 1)
+                {
+                    slot.dense = m_freeHead;
+                    m_freeHead = handle.index;
+                }
+                return true;
+            }
+
+            bool contains(handle_type handle) const noexcept
+            {
+                return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation && (handle.generation & 1) != 0;
+            }
+
+            // nullptr for stale handles
+            T *get(handle_type handle) noexcept { return contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr; }
+            const T *get(handle_type handle) const noexcept { return contains(handle) ? &m_values[m_slots[handle.index].dense] : nullptr; }
+
+            T &operator[](handle_type handle) noexcept
+            {
+                assert(contains(handle) && "Stale or invalid THandle");
+                return m_values[m_slots[handle.index].dense];
+            }
+            const T &operator[](handle_type handle) const noexcept
+            {
+                assert(contains(handle) && "Stale or invalid THandle");
+                return m_values[m_slots[handle.index].dense];
+            }
+
+            // Handle of the value at position index of the dense storage (e.g. while iterating)
+            handle_type handle_at(size_t index) const noexcept
+            {
+                assert(index < m_values.size());
+                const uint32_t slotIndex = m_denseToSlot[index];
+                return handle_type{slotIndex, m_slots[slotIndex].generation};
+            }
+
+            void reserve(size_t count)
+            {
+                m_values.reserve(count);
+                m_denseToSlot.reserve(count);
+                m_slots.reserve(count);
+            }
+
+            // Erases everything, all handles become stale
+            void clear()
+            {
+                while (!m_values.empty())
+                {
+                    erase(handle_at(m_values.size() - 1));
+                }
+            }
+
+            size_t size() const noexcept { return m_values.size(); }
+            bool   empty() const noexcept { return m_values.empty(); }
+            size_t capacity() const noexcept { return m_values.capacity(); }
+
+            T       *data() noexcept { return m_values.data(); }
+            const T *data() const noexcept { return m_values.data(); }
+
+            iterator       begin() noexcept { return m_values.begin(); }
+            iterator       end() noexcept { return m_values.end(); }
+            const_iterator begin() const noexcept { return m_values.begin(); }
+            const_iterator end() const noexcept { return m_values.end(); }
+
+        private:
+            TVector<T, A>                 m_values;
+            TVector<Slot, SlotAlloc>      m_slots;
+            TVector<uint32_t, IndexAlloc> m_denseToSlot;
+            uint32_t                      m_freeHead = FREE_LIST_END;
+    };
+} // namespace VE::Internal::Core::Container
+
+template <typename T> struct std::hash<VE::Internal::Core::Container::THandle<T>>
+{
+        inline size_t operator()(VE::Internal::Core::Container::THandle<T> handle) const noexcept { return std::hash<uint64_t>{}(handle.ToU64()); }
+};
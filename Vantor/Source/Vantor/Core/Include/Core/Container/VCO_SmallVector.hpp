@@ -0,0 +1,533 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// VCO_SmallVector.hpp - Dynamic array with inline storage for the first N elements
+// Only touches the allocator once more than N elements are stored. Trivially relocatable
+// element types (see TIsTriviallyRelocatable) are moved around with memcpy/memmove.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Core/Container/VCO_Vector.hpp>
+
+namespace VE::Internal::Core::Container
+{
+    // T: element type, N: number of elements stored inline, A: allocator used once the inline storage is exhausted
+    template <typename T, size_t N, typename A = std::allocator<T>> class TSmallVector
+    {
+            using AllocatorTraits = std::allocator_traits<A>;
+
+            static constexpr bool RELOCATABLE = TIsTriviallyRelocatable_v<T>;
+
+        public:
+            using value_type     = T;
+            using allocator_type = A;
+            using size_type      = size_t;
+            using iterator       = T *;
+            using const_iterator = const T *;
+
+            static constexpr size_t INLINE_CAPACITY = N;
+
+            // Constructors
+            inline TSmallVector() noexcept(std::is_nothrow_default_constructible_v<A>) {}
+            inline explicit TSmallVector(const A &allocator) noexcept : m_allocator(allocator) {}
+            inline explicit TSmallVector(size_t count, const A &allocator = A()) : m_allocator(allocator) { resize(count); }
+            inline TSmallVector(size_t count, const T &value, const A &allocator = A()) : m_allocator(allocator) { assign(count, value); }
+            template <std::input_iterator It> inline TSmallVector(It first, It last, const A &allocator = A()) : m_allocator(allocator) { assign(first, last); }
+            inline TSmallVector(std::initializer_list<T> init_list, const A &allocator = A()) : m_allocator(allocator) { assign(init_list); }
+
+            inline TSmallVector(const TSmallVector &other) : m_allocator(AllocatorTraits::select_on_container_copy_construction(other.m_allocator))
+            {
+                assign(other.begin(), other.end());
+            }
+
+            inline TSmallVector(TSmallVector &&other) noexcept : m_allocator(std::move(other.m_allocator)) { steal_from(other); }
+
+            inline ~TSmallVector()
+            {
+                clear();
+                release_heap();
+            }
+
+            // Assignment
+            inline TSmallVector &operator=(const TSmallVector &other)
+            {
+                if (this != &other)
+                {
+                    if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+                    {
+                        if (m_allocator != other.m_allocator)
+                        {
+                            clear();
+                            release_heap();
+                        }
+                        m_allocator = other.m_allocator;
+                    }
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            inline TSmallVector &operator=(TSmallVector &&other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                                          AllocatorTraits::is_always_equal::value)
+            {
+                if (this == &other) return *this;
+
+                clear();
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+                {
+                    release_heap();
+                    m_allocator = std::move(other.m_allocator);
+                    steal_from(other);
+                }
+                else
+                {
+                    if (AllocatorTraits::is_always_equal::value || m_allocator == other.m_allocator)
+                    {
+                        release_heap();
+                        steal_from(other);
+                    }
+                    else
+                    {
+                        // The heap buffer of other belongs to a different memory source, move the elements instead
+                        reserve(other.m_size);
+                        relocate_or_move(data(), other.data(), other.m_size);
+                        m_size = other.m_size;
+                        other.clear();
+                    }
+                }
+                return *this;
+            }
+
+            inline TSmallVector &operator=(std::initializer_list<T> init_list)
+            {
+                assign(init_list);
+                return *this;
+            }
+
+            // Replace the contents with count copies of value
+            inline void assign(size_t count, const T &value)
+            {
+                if (is_own_element(&value))
+                {
+                    T copy(value);
+                    assign(count, copy);
+                    return;
+                }
+                clear();
+                reserve(count);
+                std::uninitialized_fill_n(data(), count, value);
+                m_size = count;
+            }
+
+            // Replace the contents with the range [first, last)
+            template <std::input_iterator It> inline void assign(It first, It last)
+            {
+                clear();
+                if constexpr (std::forward_iterator<It>)
+                {
+                    const size_t count = static_cast<size_t>(std::distance(first, last));
+                    reserve(count);
+                    std::uninitialized_copy(first, last, data());
+                    m_size = count;
+                }
+                else
+                {
+                    for (; first != last; ++first)
+                    {
+                        emplace_back(*first);
+                    }
+                }
+            }
+
+            inline void assign(std::initializer_list<T> init_list) { assign(init_list.begin(), init_list.end()); }
+
+            // Element access
+            constexpr T &operator[](size_t index) noexcept
+            {
+                assert(index < m_size);
+                return data()[index];
+            }
+            constexpr const T &operator[](size_t index) const noexcept
+            {
+                assert(index < m_size);
+                return data()[index];
+            }
+            constexpr T &front() noexcept
+            {
+                assert(m_size > 0);
+                return data()[0];
+            }
+            constexpr const T &front() const noexcept
+            {
+                assert(m_size > 0);
+                return data()[0];
+            }
+            constexpr T &back() noexcept
+            {
+                assert(m_size > 0);
+                return data()[m_size - 1];
+            }
+            constexpr const T &back() const noexcept
+            {
+                assert(m_size > 0);
+                return data()[m_size - 1];
+            }
+
+            inline T       *data() noexcept { return m_heap != nullptr ? m_heap : inline_data(); }
+            inline const T *data() const noexcept { return m_heap != nullptr ? m_heap : inline_data(); }
+
+            // Iterators
+            inline T       *begin() noexcept { return data(); }
+            inline const T *begin() const noexcept { return data(); }
+            inline T       *end() noexcept { return data() + m_size; }
+            inline const T *end() const noexcept { return data() + m_size; }
+
+            // Capacity
+            constexpr size_t size() const noexcept { return m_size; }
+            constexpr bool   empty() const noexcept { return m_size == 0; }
+            constexpr size_t capacity() const noexcept { return m_heap != nullptr ? m_capacity : N; }
+            // True while the elements live in the inline storage
+            constexpr bool is_inline() const noexcept { return m_heap == nullptr; }
+
+            constexpr const A &get_allocator() const noexcept { return m_allocator; }
+
+            inline void reserve(size_t requested_capacity)
+            {
+                if (requested_capacity > capacity()) reallocate(requested_capacity);
+            }
+
+            // Moves the elements back into the inline storage if they fit, otherwise trims the heap buffer
+            inline void shrink_to_fit()
+            {
+                if (m_heap == nullptr) return;
+                if (m_size <= N)
+                {
+                    T     *old_heap     = m_heap;
+                    size_t old_capacity = m_capacity;
+                    relocate(inline_data(), old_heap, m_size);
+                    m_heap     = nullptr;
+                    m_capacity = 0;
+                    AllocatorTraits::deallocate(m_allocator, old_heap, old_capacity);
+                }
+                else if (m_size < m_capacity)
+                {
+                    reallocate(m_size);
+                }
+            }
+
+            // Resize with value-initialized elements
+            inline void resize(size_t new_size)
+            {
+                if (new_size > m_size)
+                {
+                    reserve(new_size);
+                    std::uninitialized_value_construct_n(data() + m_size, new_size - m_size);
+                    m_size = new_size;
+                }
+                else
+                {
+                    truncate(new_size);
+                }
+            }
+
+            // Resize with copies of value, new elements are copy constructed directly
+            inline void resize(size_t new_size, const T &value)
+            {
+                if (new_size > m_size)
+                {
+                    if (new_size > capacity() && is_own_element(&value))
+                    {
+                        T copy(value);
+                        resize(new_size, copy);
+                        return;
+                    }
+                    reserve(new_size);
+                    std::uninitialized_fill_n(data() + m_size, new_size - m_size, value);
+                    m_size = new_size;
+                }
+                else
+                {
+                    truncate(new_size);
+                }
+            }
+
+            // Modifiers
+            inline void clear() noexcept { truncate(0); }
+
+            template <typename... Args> inline T &emplace_back(Args &&...args)
+            {
+                if (m_size == capacity())
+                {
+                    // Construct the new element before relocating, args may reference an element of this vector
+                    const size_t new_capacity = grow_capacity(m_size + 1);
+                    T           *new_data     = AllocatorTraits::allocate(m_allocator, new_capacity);
+                    new (new_data + m_size) T(std::forward<Args>(args)...);
+                    adopt(new_data, new_capacity);
+                }
+                else
+                {
+                    new (data() + m_size) T(std::forward<Args>(args)...);
+                }
+                return data()[m_size++];
+            }
+
+            inline void push_back(const T &value) { emplace_back(value); }
+            inline void push_back(T &&value) { emplace_back(std::move(value)); }
+
+            inline void pop_back() noexcept
+            {
+                assert(m_size > 0);
+                data()[--m_size].~T();
+            }
+
+            // Insert a single element before position, returns an iterator to it
+            template <typename... Args> inline T *emplace(const T *position, Args &&...args)
+            {
+                const size_t index = static_cast<size_t>(position - begin());
+                assert(index <= m_size);
+                if (index == m_size)
+                {
+                    emplace_back(std::forward<Args>(args)...);
+                    return begin() + index;
+                }
+
+                if constexpr (RELOCATABLE)
+                {
+                    // Build the element first, args may reference one of our elements that is about to move
+                    T value(std::forward<Args>(args)...);
+                    reserve(m_size + 1);
+                    T *gap = open_gap(index, 1);
+                    new (gap) T(std::move(value));
+                    return gap;
+                }
+                else
+                {
+                    emplace_back(std::forward<Args>(args)...);
+                    std::rotate(begin() + index, end() - 1, end());
+                    return begin() + index;
+                }
+            }
+
+            inline T *insert(const T *position, const T &value) { return emplace(position, value); }
+            inline T *insert(const T *position, T &&value) { return emplace(position, std::move(value)); }
+
+            // Insert count copies of value before position, returns an iterator to the first inserted element
+            inline T *insert(const T *position, size_t count, const T &value)
+            {
+                const size_t index = static_cast<size_t>(position - begin());
+                assert(index <= m_size);
+                if (count == 0) return begin() + index;
+                if (is_own_element(&value))
+                {
+                    T copy(value);
+                    return insert(begin() + index, count, copy);
+                }
+
+                reserve(m_size + count);
+                if constexpr (RELOCATABLE)
+                {
+                    T *gap = open_gap(index, count);
+                    std::uninitialized_fill_n(gap, count, value);
+                }
+                else
+                {
+                    std::uninitialized_fill_n(end(), count, value);
+                    m_size += count;
+                    std::rotate(begin() + index, end() - count, end());
+                }
+                return begin() + index;
+            }
+
+            // Insert the range [first, last) before position, returns an iterator to the first inserted element
+            template <std::input_iterator It> inline T *insert(const T *position, It first, It last)
+            {
+                const size_t index = static_cast<size_t>(position - begin());
+                assert(index <= m_size);
+
+                if constexpr (std::forward_iterator<It> && RELOCATABLE)
+                {
+                    const size_t count = static_cast<size_t>(std::distance(first, last));
+                    if (count == 0) return begin() + index;
+                    reserve(m_size + count);
+                    T *gap = open_gap(index, count);
+                    std::uninitialized_copy(first, last, gap);
+                }
+                else
+                {
+                    const size_t old_size = m_size;
+                    if constexpr (std::forward_iterator<It>)
+                    {
+                        reserve(m_size + static_cast<size_t>(std::distance(first, last)));
+                    }
+                    for (; first != last; ++first)
+                    {
+                        emplace_back(*first);
+                    }
+                    std::rotate(begin() + index, begin() + old_size, end());
+                }
+                return begin() + index;
+            }
+
+            inline T *insert(const T *position, std::initializer_list<T> init_list) { return insert(position, init_list.begin(), init_list.end()); }
+
+            // Remove the element at position, returns an iterator to the element after it
+            inline T *erase(const T *position) { return erase(position, position + 1); }
+
+            // Remove the range [first, last), returns an iterator to the element after it
+            inline T *erase(const T *first, const T *last)
+            {
+                const size_t index = static_cast<size_t>(first - begin());
+                const size_t count = static_cast<size_t>(last - first);
+                assert(index + count <= m_size);
+                if (count == 0) return begin() + index;
+
+                T *dst = begin() + index;
+                if constexpr (RELOCATABLE)
+                {
+                    std::destroy_n(dst, count);
+                    std::memmove(static_cast<void *>(dst), dst + count, sizeof(T) * (m_size - index - count));
+                    m_size -= count;
+                }
+                else
+                {
+                    std::move(dst + count, end(), dst);
+                    truncate(m_size - count);
+                }
+                return begin() + index;
+            }
+
+        private:
+            inline T       *inline_data() noexcept { return std::launder(reinterpret_cast<T *>(m_inline)); }
+            inline const T *inline_data() const noexcept { return std::launder(reinterpret_cast<const T *>(m_inline)); }
+
+            inline bool is_own_element(const T *ptr) const noexcept
+            {
+                return std::less_equal<const T *>()(begin(), ptr) && std::less<const T *>()(ptr, end());
+            }
+
+            inline size_t grow_capacity(size_t required) const noexcept { return std::max(required, capacity() * 2); }
+
+            // Destroys the elements past new_size
+            inline void truncate(size_t new_size) noexcept
+            {
+                if (new_size < m_size)
+                {
+                    std::destroy(data() + new_size, data() + m_size);
+                    m_size = new_size;
+                }
+            }
+
+            // Moves count elements from src to uninitialized dst and ends the lifetime of the sources
+            static inline void relocate(T *dst, T *src, size_t count)
+            {
+                if constexpr (RELOCATABLE)
+                {
+                    if (count > 0) std::memcpy(static_cast<void *>(dst), src, sizeof(T) * count);
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        new (dst + i) T(std::move(src[i]));
+                        src[i].~T();
+                    }
+                }
+            }
+
+            // Like relocate, but the sources stay alive (moved-from) so their owner can destroy them
+            static inline void relocate_or_move(T *dst, T *src, size_t count)
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    if (count > 0) std::memcpy(static_cast<void *>(dst), src, sizeof(T) * count);
+                }
+                else
+                {
+                    std::uninitialized_move_n(src, count, dst);
+                }
+            }
+
+            // Moves the current elements into new_data (already holding anything constructed past m_size) and takes ownership of it
+            inline void adopt(T *new_data, size_t new_capacity)
+            {
+                relocate(new_data, data(), m_size);
+                release_heap();
+                m_heap     = new_data;
+                m_capacity = new_capacity;
+            }
+
+            inline void reallocate(size_t new_capacity)
+            {
+                assert(new_capacity >= m_size);
+                adopt(AllocatorTraits::allocate(m_allocator, new_capacity), new_capacity);
+            }
+
+            // Shifts [index, size) up by count (capacity must suffice), returns the uninitialized gap
+            inline T *open_gap(size_t index, size_t count)
+            {
+                static_assert(RELOCATABLE);
+                T *gap = data() + index;
+                std::memmove(static_cast<void *>(gap + count), gap, sizeof(T) * (m_size - index));
+                m_size += count;
+                return gap;
+            }
+
+            inline void release_heap() noexcept
+            {
+                if (m_heap != nullptr)
+                {
+                    AllocatorTraits::deallocate(m_allocator, m_heap, m_capacity);
+                    m_heap     = nullptr;
+                    m_capacity = 0;
+                }
+            }
+
+            // Takes over the elements of other, which must use a compatible allocator. Our storage must be empty.
+            inline void steal_from(TSmallVector &other) noexcept
+            {
+                assert(m_size == 0 && m_heap == nullptr);
+                if (other.m_heap != nullptr)
+                {
+                    m_heap           = other.m_heap;
+                    m_capacity       = other.m_capacity;
+                    other.m_heap     = nullptr;
+                    other.m_capacity = 0;
+                }
+                else
+                {
+                    relocate(inline_data(), other.inline_data(), other.m_size);
+                }
+                m_size       = other.m_size;
+                other.m_size = 0;
+            }
+
+            // Members
+            T     *m_heap     = nullptr; // nullptr while the elements live in m_inline
+            size_t m_size     = 0;
+            size_t m_capacity = 0; // capacity of m_heap
+            [[no_unique_address]] A m_allocator;
+            alignas(T) unsigned char m_inline[sizeof(T) * (N > 0 ? N : 1)];
+    };
+
+    template <typename T, size_t N, typename A> inline bool operator==(const TSmallVector<T, N, A> &lhs, const TSmallVector<T, N, A> &rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+} // namespace VE::Internal::Core::Container
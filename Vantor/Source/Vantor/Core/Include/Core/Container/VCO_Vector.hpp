@@ -15,28 +15,46 @@
 
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
 #include <new>
+#include <type_traits>
 #include <utility>
 
 namespace VE::Internal::Core::Container
 {
+    // Types that can be moved to a new address with memcpy (no self references, no address bookkeeping).
+    // Specialize for types that are not trivially copyable but still safe to relocate bitwise.
+    template <typename T> struct TIsTriviallyRelocatable : std::is_trivially_copyable<T>
+    {
+    };
+    template <typename T> inline constexpr bool TIsTriviallyRelocatable_v = TIsTriviallyRelocatable<T>::value;
+
     // Custom TVector container template class
     // T: element type, A: allocator type (defaults to std::allocator<T>)
     template <typename T, typename A = std::allocator<T>> class TVector
     {
+            using AllocatorTraits = std::allocator_traits<A>;
+
         public:
-            using value_type = T;
+            using value_type     = T;
+            using allocator_type = A;
 
             // Default constructor - creates empty TVector or with specified initial size
             inline TVector(size_t initial_size = 0) { resize(initial_size); }
 
+            // Empty TVector taking its memory from the given allocator (e.g. a frame arena)
+            inline explicit TVector(const A &allocator) : m_allocator(allocator) {}
+
             // Copy constructor - creates deep copy of another TVector
-            inline TVector(const TVector<T> &source_TVector) { copy_from(source_TVector); }
+            inline TVector(const TVector &source_TVector) : m_allocator(AllocatorTraits::select_on_container_copy_construction(source_TVector.m_allocator))
+            {
+                copy_from(source_TVector);
+            }
 
-            // Move constructor - transfers ownership from another TVector
-            inline TVector(TVector<T> &&source_TVector) noexcept { move_from(std::move(source_TVector)); }
+            // Move constructor - transfers ownership (and the allocator) from another TVector
+            inline TVector(TVector &&source_TVector) noexcept : m_allocator(std::move(source_TVector.m_allocator)) { move_from(std::move(source_TVector)); }
 
             // Initializer list constructor - creates TVector from brace-enclosed list
             inline TVector(std::initializer_list<T> init_list)
@@ -54,24 +72,64 @@ namespace VE::Internal::Core::Container
                 clear();
                 if (m_data_ptr != nullptr)
                 {
-                    m_allocator.deallocate(m_data_ptr, m_capacity);
+                    AllocatorTraits::deallocate(m_allocator, m_data_ptr, m_capacity);
                 }
             }
 
             // Copy assignment - replaces contents with deep copy of another TVector
-            inline TVector<T> &operator=(const TVector<T> &source_TVector)
+            inline TVector &operator=(const TVector &source_TVector)
             {
-                copy_from(source_TVector);
+                if (this != &source_TVector)
+                {
+                    if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+                    {
+                        if (m_allocator != source_TVector.m_allocator) release_storage();
+                        m_allocator = source_TVector.m_allocator;
+                    }
+                    copy_from(source_TVector);
+                }
                 return *this;
             }
 
             // Move assignment - replaces contents by transferring ownership
-            inline TVector<T> &operator=(TVector<T> &&source_TVector)
+            inline TVector &operator=(TVector &&source_TVector)
             {
-                move_from(std::move(source_TVector));
+                if (this == &source_TVector) return *this;
+
+                if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value)
+                {
+                    release_storage();
+                    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+                    {
+                        m_allocator = std::move(source_TVector.m_allocator);
+                    }
+                    move_from(std::move(source_TVector));
+                }
+                else if (m_allocator == source_TVector.m_allocator)
+                {
+                    release_storage();
+                    move_from(std::move(source_TVector));
+                }
+                else
+                {
+                    // Different memory source, the buffer can't be adopted so the elements are moved one by one
+                    clear();
+                    reserve(source_TVector.size());
+                    for (auto &element : source_TVector)
+                    {
+                        emplace_back(std::move(element));
+                    }
+                    source_TVector.clear();
+                }
                 return *this;
             }
 
+            // Allocator used for the element storage
+            constexpr const A &get_allocator() const noexcept { return m_allocator; }
+
+            // Get the number of elements the TVector can hold without reallocating
+            constexpr size_t capacity() const noexcept { return m_capacity; }
+
             // Array subscript operator - provides direct access to element at index (no bounds checking)
             constexpr T &operator[](size_t element_index) noexcept
             {
@@ -95,7 +153,7 @@ namespace VE::Internal::Core::Container
                     T     *old_data_ptr = allocate_and_move(requested_capacity);
                     if (old_data_ptr != nullptr)
                     {
-                        m_allocator.deallocate(old_data_ptr, old_capacity);
+                        AllocatorTraits::deallocate(m_allocator, old_data_ptr, old_capacity);
                     }
                 }
             }
@@ -133,7 +191,7 @@ namespace VE::Internal::Core::Container
                     T     *old_data_ptr = allocate_and_move(m_current_size);
                     if (old_data_ptr != nullptr)
                     {
-                        m_allocator.deallocate(old_data_ptr, old_capacity);
+                        AllocatorTraits::deallocate(m_allocator, old_data_ptr, old_capacity);
                     }
                 }
             }
@@ -159,7 +217,7 @@ namespace VE::Internal::Core::Container
                 // Clean up old allocation if we reallocated
                 if (old_data_ptr != nullptr)
                 {
-                    m_allocator.deallocate(old_data_ptr, old_capacity);
+                    AllocatorTraits::deallocate(m_allocator, old_data_ptr, old_capacity);
                 }
                 return *new_element_ptr;
             }
@@ -272,12 +330,20 @@ namespace VE::Internal::Core::Container
                     m_capacity = new_capacity;
 
                     // Allocate new memory block
-                    T *new_allocation = m_allocator.allocate(m_capacity);
+                    T *new_allocation = AllocatorTraits::allocate(m_allocator, m_capacity);
 
                     // Move existing elements to new location
-                    for (size_t i = 0; i < m_current_size; ++i)
+                    if constexpr (TIsTriviallyRelocatable_v<T>)
                     {
-                        new (new_allocation + i) T(std::move(m_data_ptr[i]));
+                        if (m_current_size > 0) std::memcpy(static_cast<void *>(new_allocation), m_data_ptr, sizeof(T) * m_current_size);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < m_current_size; ++i)
+                        {
+                            new (new_allocation + i) T(std::move(m_data_ptr[i]));
+                            m_data_ptr[i].~T();
+                        }
                     }
 
                     // Swap data pointers and return old allocation for cleanup
@@ -288,23 +354,44 @@ namespace VE::Internal::Core::Container
             }
 
             // Copy all elements from another TVector (used by copy constructor and assignment)
-            inline void copy_from(const TVector<T> &source_TVector)
+            inline void copy_from(const TVector &source_TVector)
             {
-                resize(source_TVector.size());
-                for (size_t i = 0; i < m_current_size; ++i)
+                clear();
+                reserve(source_TVector.size());
+                if constexpr (std::is_trivially_copyable_v<T>)
                 {
-                    m_data_ptr[i] = source_TVector.m_data_ptr[i];
+                    if (source_TVector.m_current_size > 0)
+                    {
+                        std::memcpy(static_cast<void *>(m_data_ptr), source_TVector.m_data_ptr, sizeof(T) * source_TVector.m_current_size);
+                    }
                 }
+                else
+                {
+                    for (size_t i = 0; i < source_TVector.m_current_size; ++i)
+                    {
+                        new (m_data_ptr + i) T(source_TVector.m_data_ptr[i]);
+                    }
+                }
+                m_current_size = source_TVector.m_current_size;
             }
 
-            // Transfer ownership from another TVector (used by move constructor and assignment)
-            inline void move_from(TVector<T> &&source_TVector)
+            // Destroys all elements and gives the memory back to the allocator
+            inline void release_storage()
             {
                 clear();
                 if (m_data_ptr != nullptr)
                 {
-                    m_allocator.deallocate(m_data_ptr, m_capacity);
+                    AllocatorTraits::deallocate(m_allocator, m_data_ptr, m_capacity);
                 }
+                m_data_ptr = nullptr;
+                m_capacity = 0;
+            }
+
+            // Transfer ownership from another TVector (used by move constructor and assignment)
+            // The storage of this TVector must already be released and the allocators must be compatible
+            inline void move_from(TVector &&source_TVector)
+            {
+                assert(m_data_ptr == nullptr);
 
                 // Take ownership of source TVector's data
                 m_capacity     = source_TVector.m_capacity;
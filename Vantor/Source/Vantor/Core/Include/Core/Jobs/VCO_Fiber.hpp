@@ -0,0 +1,82 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Fibers for the job system: an execution context with its own stack that a thread switches to
+// and from explicitly.
+//
+// On Linux x86-64 and AArch64 the switch is a hand written routine that saves only the callee
+// saved registers (and the SSE/x87 control words on x86-64), on other POSIX systems it falls back
+// to ucontext. Elsewhere VANTOR_JOBS_FIBERS is 0 and VJobSystem ignores VJobSystemDesc::useFibers.
+
+#ifndef VANTOR_JOBS_FIBERS
+#if defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define VANTOR_JOBS_FIBERS        1
+#define VANTOR_JOBS_FIBERS_NATIVE 1
+#elif defined(__unix__) || defined(__APPLE__)
+#define VANTOR_JOBS_FIBERS        1
+#define VANTOR_JOBS_FIBERS_NATIVE 0
+#else
+#define VANTOR_JOBS_FIBERS        0
+#define VANTOR_JOBS_FIBERS_NATIVE 0
+#endif
+#endif
+
+#if VANTOR_JOBS_FIBERS && !VANTOR_JOBS_FIBERS_NATIVE
+#include <ucontext.h>
+#endif
+
+namespace VE::Internal::Core::Jobs
+{
+    struct VFiberContext
+    {
+#if VANTOR_JOBS_FIBERS_NATIVE
+            void *stackPointer = nullptr; // saved registers are stored on the fiber's stack
+#elif VANTOR_JOBS_FIBERS
+            ucontext_t context{};
+#endif
+    };
+
+    // Prepares context to call entry(arg) on the given stack at the next switch to it. entry must never return.
+    void MakeFiberContext(VFiberContext &context, void *stack, size_t stackSize, void (*entry)(void *), void *arg);
+
+    // Saves the running context in from and continues to. Returns when something switches back to from.
+    void SwitchFiberContext(VFiberContext &from, VFiberContext &to);
+
+    // Fiber stacks carved from one reserved range of pages. Every stack has an inaccessible guard
+    // page below it, so an overflow faults instead of corrupting its neighbour.
+    class VFiberStackPool
+    {
+        public:
+            VFiberStackPool() = default;
+            ~VFiberStackPool();
+
+            VFiberStackPool(const VFiberStackPool &)            = delete;
+            VFiberStackPool &operator=(const VFiberStackPool &) = delete;
+
+            // stackSize is rounded up to whole pages, false if the pages could not be reserved
+            bool Initialize(uint32_t stackCount, size_t stackSize);
+
+            uint32_t GetStackCount() const { return m_StackCount; }
+            size_t   GetStackSize() const { return m_StackSize; }
+            // Lowest address of stack i, stacks grow down from GetStack(i) + GetStackSize()
+            void *GetStack(uint32_t i) const { return m_Base + static_cast<size_t>(i) * (m_StackSize + m_PageSize) + m_PageSize; }
+
+        private:
+            uint8_t *m_Base       = nullptr;
+            size_t   m_Reserved   = 0;
+            size_t   m_PageSize   = 0;
+            size_t   m_StackSize  = 0;
+            uint32_t m_StackCount = 0;
+    };
+} // namespace VE::Internal::Core::Jobs
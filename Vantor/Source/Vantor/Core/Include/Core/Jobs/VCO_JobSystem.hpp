@@ -0,0 +1,309 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/Jobs/VCO_Fiber.hpp>
+#include <Core/Jobs/VCO_WorkStealingDeque.hpp>
+#include <Core/Memory/VCO_ConcurrentAllocator.hpp>
+
+// Work-stealing job system.
+//
+//     VJobCounter counter;
+//     jobs.Run([&] { LoadMeshes(); }, &counter);
+//     jobs.Run([&] { LoadTextures(); }, &counter);
+//     jobs.RunAfter(counter, [&] { BuildGpuData(); }, &done); // starts once both loads finished
+//     jobs.ParallelFor(transformCount, 256, [&](uint32_t i) { UpdateTransform(i); });
+//     jobs.Wait(done);
+//
+// A fixed pool of worker threads, plus the thread that created the system, each own a Chase-Lev
+// deque (VCO_WorkStealingDeque.hpp). Jobs submitted from one of these threads go to its own
+// deque, jobs from any other thread to a shared queue. A thread without work steals from a
+// random other deque, and workers sleep after a short spin when nothing is left anywhere.
+//
+// Dependencies are expressed with counters: a job started with a counter increments it and
+// decrements it when it finished. Wait() does not block, it executes other jobs until the counter
+// reaches zero, so waiting inside a job can not starve the pool.
+//
+// With VJobSystemDesc::useFibers the workers run jobs on fibers (VCO_Fiber.hpp) instead: a job
+// that waits for an unfinished counter parks its fiber on the counter and the worker continues
+// on a fresh fiber from the pool, so long dependency chains do not pile up on one thread's stack
+// and a waiting job resumes as soon as its counter is done instead of when the job it helped with
+// returns. A parked fiber may resume on another worker, so thread_local values and profiler
+// zones must not span a Wait() inside a job. Without a free fiber Wait() falls back to helping.
+//
+// Callables up to Detail::VJob::STORAGE_SIZE bytes are stored in the job itself, larger ones
+// are moved to the heap. Jobs come from a VConcurrentBlockAllocator.
+
+namespace VE::Internal::Core::Jobs
+{
+    class VJobSystem;
+    class VJobCounter;
+
+    namespace Detail
+    {
+        struct VFiber;
+
+        struct VJob
+        {
+                static constexpr size_t STORAGE_SIZE = 64;
+
+                void (*invoke)(VJob &)  = nullptr;
+                void (*destroy)(VJob &) = nullptr;
+                VJobCounter *counter    = nullptr; // decremented when the job finished
+                VJob        *next       = nullptr; // waiting list of a counter
+                VFiber      *fiber      = nullptr; // resumes this parked fiber instead of calling a function
+                alignas(16) unsigned char storage[STORAGE_SIZE];
+
+                template <typename F> void Bind(F &&fn)
+                {
+                    using Fn = std::decay_t<F>;
+                    if constexpr (sizeof(Fn) <= STORAGE_SIZE && alignof(Fn) <= 16)
+                    {
+                        new (storage) Fn(std::forward<F>(fn));
+                        invoke  = [](VJob &job) { (*std::launder(reinterpret_cast<Fn *>(job.storage)))(); };
+                        destroy = [](VJob &job) { std::launder(reinterpret_cast<Fn *>(job.storage))->~Fn(); };
+                    }
+                    else
+                    {
+                        Fn *heap = new Fn(std::forward<F>(fn));
+                        std::memcpy(storage, &heap, sizeof(heap));
+                        invoke  = [](VJob &job) { (*job.GetHeap<Fn>())(); };
+                        destroy = [](VJob &job) { delete job.GetHeap<Fn>(); };
+                    }
+                }
+
+                template <typename Fn> Fn *GetHeap()
+                {
+                    Fn *heap;
+                    std::memcpy(&heap, storage, sizeof(heap));
+                    return heap;
+                }
+        };
+
+        // What the next fiber does for the one that switched to it, once that one's stack is no longer in use
+        enum class EFiberHandoff : uint8_t
+        {
+            None,
+            Release, // return the fiber to the pool
+            Park     // resume the fiber when the counter is done
+        };
+
+        // Per thread state of the thread's job system
+        struct VWorkerContext
+        {
+                VJobSystem   *system         = nullptr;
+                uint32_t      index          = 0;       // 0 is the thread that created the system
+                uint32_t      random         = 0;       // steal victim selection
+                VFiber       *currentFiber   = nullptr; // fiber the thread is running, nullptr outside of fibers
+                EFiberHandoff handoff        = EFiberHandoff::None;
+                VFiber       *handoffFiber   = nullptr;
+                VJobCounter  *handoffCounter = nullptr;
+
+                VE::Internal::Core::Container::TVector<void (*)()> idleCallbacks; // see VJobSystem::RunWhenIdle()
+        };
+
+        struct VFiber
+        {
+                VFiberContext   context;
+                VWorkerContext *thread   = nullptr; // set by whoever switches to the fiber
+                void           *stack    = nullptr; // nullptr for a thread's own stack
+                VFiber         *nextFree = nullptr;
+                VJobSystem     *system   = nullptr;
+        };
+    } // namespace Detail
+
+    struct VJobSystemDesc
+    {
+            uint32_t workerCount    = UINT32_MAX; // VJobSystem::AUTO_WORKER_COUNT
+            bool     useFibers      = false;      // ignored where VANTOR_JOBS_FIBERS is 0
+            uint32_t fiberCount     = 128;        // including one per worker for its scheduling loop
+            size_t   fiberStackSize = 256 * 1024;
+    };
+
+    // Number of unfinished jobs started with it. Must outlive those jobs, Wait() on it guarantees that.
+    class VJobCounter
+    {
+        public:
+            VJobCounter() = default;
+
+            VJobCounter(const VJobCounter &)            = delete;
+            VJobCounter &operator=(const VJobCounter &) = delete;
+
+            bool    IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+            int32_t GetValue() const { return std::max(m_Value.load(std::memory_order_relaxed), 0); }
+
+        private:
+            friend class VJobSystem;
+
+            // Set by the job that brings the counter to zero while it collects the waiting jobs
+            static constexpr int32_t RELEASING = INT32_MIN / 2;
+
+            std::atomic<int32_t> m_Value{0};
+            std::atomic<bool>    m_Locked{false}; // guards m_Waiting
+            Detail::VJob        *m_Waiting = nullptr;
+    };
+
+    class VJobSystem
+    {
+        public:
+            static constexpr uint32_t AUTO_WORKER_COUNT = UINT32_MAX; // one per hardware thread minus one
+
+            // workerCount threads are started next to the calling thread. With 0 workers jobs only run inside Wait().
+            explicit VJobSystem(uint32_t workerCount = AUTO_WORKER_COUNT) : VJobSystem(VJobSystemDesc{workerCount}) {}
+            explicit VJobSystem(const VJobSystemDesc &desc);
+            // Runs all queued jobs, then stops the workers. Jobs still waiting for a counter are not run.
+            ~VJobSystem();
+
+            VJobSystem(const VJobSystem &)            = delete;
+            VJobSystem &operator=(const VJobSystem &) = delete;
+
+            uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+            // Worker threads and the thread that created the system
+            uint32_t GetThreadCount() const { return GetWorkerCount() + 1; }
+            bool     IsUsingFibers() const { return !m_Fibers.empty(); }
+
+            template <typename F> void Run(F &&fn, VJobCounter *counter = nullptr) { Submit(CreateJob(std::forward<F>(fn), counter)); }
+
+            // Runs fn once dependency reaches zero, right away if it already is
+            template <typename F> void RunAfter(VJobCounter &dependency, F &&fn, VJobCounter *counter = nullptr)
+            {
+                SubmitAfter(dependency, CreateJob(std::forward<F>(fn), counter));
+            }
+
+            // Calls fn(i) for i in [0, count) and returns when all calls finished. The range is split in
+            // halves down to grain indices, so idle threads steal large parts first.
+            template <typename F> void ParallelFor(uint32_t count, uint32_t grain, F &&fn)
+            {
+                VJobCounter counter;
+                ParallelFor(count, grain, [&fn](uint32_t i) { fn(i); }, counter);
+                Wait(counter);
+            }
+
+            // Like above without waiting, fn is copied into every part of the range
+            template <typename F> void ParallelFor(uint32_t count, uint32_t grain, F &&fn, VJobCounter &counter)
+            {
+                if (count == 0) return;
+                SplitRange(0, count, std::max<uint32_t>(grain, 1), std::decay_t<F>(std::forward<F>(fn)), counter);
+            }
+
+            // Executes other jobs until counter reaches zero. Inside a job on a fiber the fiber is parked instead.
+            void Wait(VJobCounter &counter);
+
+            // Executes one queued job on the calling thread, false if none was found
+            bool RunPendingJob();
+
+            // Calls fn on the calling worker once it ran out of jobs, right before it goes to sleep or stops.
+            // Registering the same fn again before that has no effect. For per thread caches that should
+            // stay warm while a batch of jobs runs. Returns false (and never calls fn) outside of workers.
+            static bool RunWhenIdle(void (*fn)());
+
+            // Jobs submitted and not finished yet, including those waiting for a counter
+            uint32_t GetPendingJobs() const { return m_PendingJobs.load(std::memory_order_relaxed); }
+            // Fibers that were parked in Wait() so far
+            uint64_t GetParkedFiberCount() const { return m_ParkedFibers.load(std::memory_order_relaxed); }
+
+        private:
+            using VWorkerContext = Detail::VWorkerContext;
+
+            template <typename F> Detail::VJob *CreateJob(F &&fn, VJobCounter *counter)
+            {
+                Detail::VJob *job = m_JobAllocator.allocate();
+                job->Bind(std::forward<F>(fn));
+                job->counter = counter;
+                if (counter != nullptr) counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+                m_PendingJobs.fetch_add(1, std::memory_order_relaxed);
+                return job;
+            }
+
+            template <typename Fn> void SplitRange(uint32_t begin, uint32_t end, uint32_t grain, Fn fn, VJobCounter &counter)
+            {
+                Run(
+                    [this, begin, end, grain, fn, &counter]() mutable
+                    {
+                        // Give the upper halves away and keep the lowest part
+                        uint32_t last = end;
+                        while (last - begin > grain)
+                        {
+                            const uint32_t middle = begin + (last - begin) / 2;
+                            SplitRange(middle, last, grain, fn, counter);
+                            last = middle;
+                        }
+                        for (uint32_t i = begin; i < last; ++i)
+                        {
+                            fn(i);
+                        }
+                    },
+                    &counter);
+            }
+
+            void          Submit(Detail::VJob *job);
+            void          SubmitAfter(VJobCounter &dependency, Detail::VJob *job);
+            void          Execute(Detail::VJob *job);
+            void          ReleaseCounter(VJobCounter &counter);
+            Detail::VJob *FindJob(VWorkerContext *context, bool resumeFibers);
+            bool          HasQueuedJobs() const;
+            void          WakeWorkers();
+            void          WorkerMain(uint32_t index);
+            void          WorkerLoop(Detail::VFiber *fiber);
+            void          Sleep();
+            static void   RunIdleCallbacks(VWorkerContext *context);
+
+            // ----- Fibers -----
+            Detail::VFiber *AcquireFiber();
+            void            ReleaseFiber(Detail::VFiber *fiber);
+            void            SwitchToFiber(Detail::VFiber *from, Detail::VFiber *to, Detail::EFiberHandoff handoff, VJobCounter *counter = nullptr);
+            void            FinishHandoff(VWorkerContext *context);
+            void            ResumeFiber(Detail::VFiber *fiber);
+            static void     FiberEntry(void *fiber);
+
+            static VWorkerContext *GetContext();
+
+            VE::Internal::Core::Container::TVector<std::unique_ptr<TWorkStealingDeque<Detail::VJob *>>> m_Deques; // one per thread, index 0 for the creator
+            VE::Internal::Core::Container::TVector<std::thread>                                         m_Workers;
+            VE::Internal::Core::Memory::VConcurrentBlockAllocator<Detail::VJob>                         m_JobAllocator;
+
+            // Jobs submitted from threads that are not part of the system
+            std::mutex                m_InjectedMutex;
+            std::deque<Detail::VJob *> m_Injected;
+            std::atomic<uint32_t>     m_InjectedCount{0};
+
+            std::mutex              m_SleepMutex;
+            std::condition_variable m_SleepCondition;
+            uint64_t                m_WakeEpoch = 0; // guarded by m_SleepMutex
+            std::atomic<uint32_t>   m_SleepingWorkers{0};
+            std::atomic<uint32_t>   m_PendingJobs{0};
+            std::atomic<bool>       m_Stop{false};
+
+            VFiberStackPool                                                   m_FiberStacks;
+            VE::Internal::Core::Container::TVector<Detail::VFiber>            m_Fibers;
+            VE::Internal::Core::Container::TVector<Detail::VFiber>            m_ThreadFibers; // one per worker
+            std::mutex                                                        m_FiberMutex;
+            Detail::VFiber                                                   *m_FreeFibers = nullptr; // guarded by m_FiberMutex
+            std::mutex                                                        m_ReadyMutex;
+            std::deque<Detail::VJob *>                                        m_ReadyFibers; // resume jobs of fibers whose counter is done
+            std::atomic<uint32_t>                                             m_ReadyCount{0};
+            std::atomic<uint64_t>                                             m_ParkedFibers{0};
+    };
+} // namespace VE::Internal::Core::Jobs
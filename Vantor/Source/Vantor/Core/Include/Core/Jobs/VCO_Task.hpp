@@ -0,0 +1,361 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Core/Jobs/VCO_JobSystem.hpp>
+
+// Coroutine tasks on top of the job system.
+//
+//     VTask<TextureAssetPtr> LoadSkin(VTaskScheduler &tasks, std::string path)
+//     {
+//         std::optional<std::string> bytes = co_await tasks.ReadFile(path); // on a worker
+//         VImage image = Decode(*bytes);                                    // still on the worker
+//         co_await tasks.MainThread();                                      // GPU upload on the main thread
+//         co_return Upload(image);
+//     }
+//
+//     tasks.Spawn(StreamLevel(tasks));   // fire and forget, owned by the scheduler
+//     auto skin = tasks.Wait(LoadSkin(tasks, "Skin.png"));
+//
+// A VTask is lazy: its body starts when it is awaited, passed to Spawn()/Wait() or Start()ed. Awaiting
+// a task runs it right away on the awaiting thread and continues the awaiting coroutine wherever the
+// task finished. The thread a coroutine continues on is decided by what it awaits: Schedule(),
+// WaitFor() and ReadFile() continue on a job worker, MainThread() and NextFrame() on the thread that
+// created the scheduler.
+//
+// Cancel() makes the next scheduler co_await of the task, and of every task it is awaiting, throw
+// VTaskCancelled, which unwinds to whoever awaits the task like any other exception.
+//
+// Coroutine frames come from pooled size classes (Detail::AllocateTaskFrame), so starting a task does
+// not hit the heap once the pools are warm, and co_await itself never allocates.
+
+namespace VE::Internal::Core::Jobs
+{
+    template <typename T = void> class VTask;
+    class VTaskScheduler;
+
+    // Thrown from a co_await on the scheduler once the awaiting task was cancelled
+    class VTaskCancelled : public std::exception
+    {
+        public:
+            const char *what() const noexcept override { return "Task was cancelled"; }
+    };
+
+    namespace Detail
+    {
+        // Frames up to MAX_POOLED_TASK_FRAME bytes come from per size class block allocators, larger ones from the heap
+        constexpr size_t MAX_POOLED_TASK_FRAME = 2048;
+
+        void *AllocateTaskFrame(size_t size);
+        void  FreeTaskFrame(void *frame, size_t size);
+
+        struct VTaskPromiseBase
+        {
+                std::coroutine_handle<> continuation; // resumed once the task finished
+                std::exception_ptr      exception;
+                std::atomic<bool>       cancelRequested{false};
+                std::atomic<bool>      *cancel = &cancelRequested; // of the outermost task, awaited tasks share it
+                std::atomic<bool>       done{false};
+                bool                    started = false;
+
+                static void *operator new(size_t size) { return AllocateTaskFrame(size); }
+                static void  operator delete(void *frame, size_t size) { FreeTaskFrame(frame, size); }
+
+                struct VFinalAwaiter
+                {
+                        bool await_ready() const noexcept { return false; }
+
+                        template <typename P> std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept
+                        {
+                            // A thread polling IsDone() may destroy the frame right after the store
+                            const std::coroutine_handle<> continuation = handle.promise().continuation;
+                            handle.promise().done.store(true, std::memory_order_release);
+                            return continuation ? continuation : std::noop_coroutine();
+                        }
+
+                        void await_resume() const noexcept {}
+                };
+
+                std::suspend_always initial_suspend() const noexcept { return {}; }
+                VFinalAwaiter       final_suspend() const noexcept { return {}; }
+                void                unhandled_exception() { exception = std::current_exception(); }
+
+                bool IsCancelled() const { return cancel->load(std::memory_order_relaxed); }
+        };
+
+        template <typename T> struct VTaskPromise : VTaskPromiseBase
+        {
+                std::optional<T> value;
+
+                VTask<T> get_return_object();
+
+                template <typename U> void return_value(U &&result) { value.emplace(std::forward<U>(result)); }
+
+                T &GetResult()
+                {
+                    if (exception) std::rethrow_exception(exception);
+                    return *value;
+                }
+        };
+
+        template <> struct VTaskPromise<void> : VTaskPromiseBase
+        {
+                VTask<void> get_return_object();
+
+                void return_void() const {}
+
+                void GetResult()
+                {
+                    if (exception) std::rethrow_exception(exception);
+                }
+        };
+
+        // Shares the cancel flag of the awaiting task, if it is one of ours
+        template <typename P> std::atomic<bool> *GetCancelFlag(std::coroutine_handle<P> handle)
+        {
+            if constexpr (std::is_base_of_v<VTaskPromiseBase, P>) return handle.promise().cancel;
+            else return nullptr;
+        }
+    } // namespace Detail
+
+    template <typename T> class VTask
+    {
+        public:
+            using promise_type = Detail::VTaskPromise<T>;
+
+            VTask() = default;
+            explicit VTask(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+            VTask(VTask &&other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+            VTask &operator=(VTask &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    Reset();
+                    m_Handle = std::exchange(other.m_Handle, nullptr);
+                }
+                return *this;
+            }
+            // A task must not be destroyed while it runs, only before it started or once it is done
+            ~VTask() { Reset(); }
+
+            VTask(const VTask &)            = delete;
+            VTask &operator=(const VTask &) = delete;
+
+            bool IsValid() const { return static_cast<bool>(m_Handle); }
+            bool IsStarted() const { return m_Handle && m_Handle.promise().started; }
+            bool IsDone() const { return !m_Handle || m_Handle.promise().done.load(std::memory_order_acquire); }
+            bool IsCancelled() const { return m_Handle && m_Handle.promise().IsCancelled(); }
+
+            // Cancels this task and the ones it awaits. Cancelling a task that is awaited cancels its awaiter too.
+            void Cancel()
+            {
+                if (m_Handle) m_Handle.promise().cancel->store(true, std::memory_order_relaxed);
+            }
+
+            // Runs the task on the calling thread up to its first suspension
+            void Start()
+            {
+                assert(m_Handle && !m_Handle.promise().started);
+                m_Handle.promise().started = true;
+                m_Handle.resume();
+            }
+
+            // The co_returned value, rethrows what the task threw. Only once IsDone().
+            decltype(auto) GetResult()
+            {
+                assert(IsDone());
+                return m_Handle.promise().GetResult();
+            }
+
+            auto operator co_await() & noexcept { return VAwaiter<false>{m_Handle}; }
+            auto operator co_await() && noexcept { return VAwaiter<true>{m_Handle}; }
+
+        private:
+            template <bool Move> struct VAwaiter
+            {
+                    std::coroutine_handle<promise_type> handle;
+
+                    bool await_ready() const noexcept { return !handle || handle.promise().done.load(std::memory_order_acquire); }
+
+                    template <typename P> std::coroutine_handle<> await_suspend(std::coroutine_handle<P> awaiting) noexcept
+                    {
+                        promise_type &promise = handle.promise();
+                        promise.continuation  = awaiting;
+                        if (std::atomic<bool> *cancel = Detail::GetCancelFlag(awaiting))
+                        {
+                            if (promise.cancelRequested.load(std::memory_order_relaxed)) cancel->store(true, std::memory_order_relaxed);
+                            promise.cancel = cancel;
+                        }
+                        promise.started = true;
+                        return handle; // runs the task on this thread right away
+                    }
+
+                    decltype(auto) await_resume()
+                    {
+                        if constexpr (std::is_void_v<T>) handle.promise().GetResult();
+                        else if constexpr (Move) return std::move(handle.promise().GetResult());
+                        else return handle.promise().GetResult();
+                    }
+            };
+
+            void Reset()
+            {
+                if (!m_Handle) return;
+                assert(!IsStarted() || IsDone());
+                m_Handle.destroy();
+                m_Handle = nullptr;
+            }
+
+            std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    namespace Detail
+    {
+        template <typename T> VTask<T> VTaskPromise<T>::get_return_object() { return VTask<T>(std::coroutine_handle<VTaskPromise<T>>::from_promise(*this)); }
+        inline VTask<void> VTaskPromise<void>::get_return_object() { return VTask<void>(std::coroutine_handle<VTaskPromise<void>>::from_promise(*this)); }
+    } // namespace Detail
+
+    // Connects tasks to a job system and to the thread that created it (the main thread)
+    class VTaskScheduler
+    {
+        private:
+            // Remembers the awaiting task's cancel flag and checks it when continuing
+            struct VAwaiterBase
+            {
+                    VTaskScheduler    *scheduler = nullptr;
+                    std::atomic<bool> *cancel    = nullptr;
+
+                    void await_resume() const
+                    {
+                        if (cancel != nullptr && cancel->load(std::memory_order_relaxed)) throw VTaskCancelled();
+                    }
+            };
+
+            struct VScheduleAwaiter : VAwaiterBase
+            {
+                    bool await_ready() const noexcept { return false; }
+
+                    template <typename P> void await_suspend(std::coroutine_handle<P> handle)
+                    {
+                        cancel = Detail::GetCancelFlag(handle);
+                        scheduler->m_Jobs.Run([handle] { handle.resume(); });
+                    }
+            };
+
+            struct VMainThreadAwaiter : VAwaiterBase
+            {
+                    bool nextFrame = false;
+
+                    // Never ready, so the cancel flag is picked up even when continuing right away on the main thread
+                    bool await_ready() const noexcept { return false; }
+
+                    template <typename P> bool await_suspend(std::coroutine_handle<P> handle)
+                    {
+                        cancel = Detail::GetCancelFlag(handle);
+                        if (!nextFrame && scheduler->IsMainThread()) return false;
+                        scheduler->Post(handle, nextFrame);
+                        return true;
+                    }
+            };
+
+            struct VCounterAwaiter : VAwaiterBase
+            {
+                    VJobCounter *counter = nullptr;
+
+                    // Same as VMainThreadAwaiter, a counter that is already done still checks the cancel flag
+                    bool await_ready() const noexcept { return false; }
+
+                    template <typename P> bool await_suspend(std::coroutine_handle<P> handle)
+                    {
+                        cancel = Detail::GetCancelFlag(handle);
+                        if (counter->IsDone()) return false;
+                        scheduler->m_Jobs.RunAfter(*counter, [handle] { handle.resume(); });
+                        return true;
+                    }
+            };
+
+        public:
+            explicit VTaskScheduler(VJobSystem &jobs);
+            // Cancels the spawned tasks and runs main thread work until they finished
+            ~VTaskScheduler();
+
+            VTaskScheduler(const VTaskScheduler &)            = delete;
+            VTaskScheduler &operator=(const VTaskScheduler &) = delete;
+
+            VJobSystem &GetJobSystem() const { return m_Jobs; }
+            bool        IsMainThread() const { return std::this_thread::get_id() == m_MainThread; }
+
+            // Main thread, once per frame: continues the tasks waiting for the next frame, then runs the main thread queue
+            void BeginFrame();
+            // Main thread: continues the tasks waiting for the main thread, until none are left
+            void RunMainThreadWork();
+
+            // Starts the task and keeps it until it finished. Main thread only.
+            void Spawn(VTask<> task);
+            size_t GetSpawnedTaskCount() const { return m_Spawned.size(); }
+
+            // Starts the task if needed and helps with jobs (and main thread work on the main thread) until it
+            // finished. Does not begin frames, a task awaiting NextFrame() would never finish here.
+            template <typename T> decltype(auto) Wait(VTask<T> &task)
+            {
+                if (!task.IsStarted()) task.Start();
+                while (!task.IsDone())
+                {
+                    if (IsMainThread()) RunMainThreadWork();
+                    if (!m_Jobs.RunPendingJob()) std::this_thread::yield();
+                }
+                return task.GetResult();
+            }
+
+            template <typename T> T Wait(VTask<T> &&task)
+            {
+                VTask<T> owned = std::move(task);
+                if constexpr (std::is_void_v<T>) Wait(owned);
+                else return std::move(Wait(owned));
+            }
+
+            // co_await Schedule(): continues on a job worker
+            auto Schedule() { return VScheduleAwaiter{{this}}; }
+            // co_await MainThread(): continues on the main thread, right away if already on it
+            auto MainThread() { return VMainThreadAwaiter{{this}, false}; }
+            // co_await NextFrame(): continues on the main thread in the next BeginFrame()
+            auto NextFrame() { return VMainThreadAwaiter{{this}, true}; }
+            // co_await WaitFor(counter): continues on a job worker once the counter is done
+            auto WaitFor(VJobCounter &counter) { return VCounterAwaiter{{this}, &counter}; }
+
+            // Reads the whole file on a job worker, nullopt if it could not be read. Continues on the worker.
+            VTask<std::optional<std::string>> ReadFile(std::string path);
+
+        private:
+            void Post(std::coroutine_handle<> handle, bool nextFrame);
+
+            VJobSystem     &m_Jobs;
+            std::thread::id m_MainThread;
+
+            std::mutex                           m_QueueMutex;
+            std::vector<std::coroutine_handle<>> m_MainQueue;      // guarded by m_QueueMutex
+            std::vector<std::coroutine_handle<>> m_NextFrameQueue; // guarded by m_QueueMutex
+
+            std::vector<VTask<>> m_Spawned; // main thread only
+    };
+} // namespace VE::Internal::Core::Jobs
@@ -13,17 +13,20 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
 
 #include <Math/VMA_Common.hpp>
 #include <Core/Container/VCO_Vector.hpp>
+#include <Core/Memory/VCO_ConcurrentAllocator.hpp>
 
 // Implementation of VPageAllocator from @turanszkij
 
 namespace VE::Internal::Core::Memory
 {
+    // Bump pointer over a caller-owned memory range (see VFrameArena for an owning variant)
     struct VLinearAllocator
     {
             uint8_t *data     = nullptr;
@@ -36,11 +39,15 @@ namespace VE::Internal::Core::Memory
                 capacity = size;
                 reset();
             }
-            constexpr uint8_t *allocate(size_t size)
+            // alignment must be a power of two, the returned address is aligned to it
+            inline uint8_t *allocate(size_t size, size_t alignment = 1)
             {
-                if (offset + size >= capacity) return nullptr;
-                uint8_t *ptr = data + offset;
-                offset += size;
+                assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+                const uintptr_t address = reinterpret_cast<uintptr_t>(data) + offset;
+                const size_t    padding = size_t((alignment - (address & (alignment - 1))) & (alignment - 1));
+                if (offset + padding + size > capacity) return nullptr;
+                uint8_t *ptr = data + offset + padding;
+                offset += padding + size;
                 return ptr;
             }
             constexpr void free(size_t size)
@@ -51,11 +58,12 @@ namespace VE::Internal::Core::Memory
             constexpr void reset() { offset = 0; }
     };
 
-    template <typename T, size_t block_size = 256> struct VBlockAllocator
+    // A allocates the block memory, e.g. a TTaggedAllocator<uint8_t, Tag> to account it to a subsystem
+    template <typename T, size_t block_size = 256, typename A = std::allocator<uint8_t>> struct VBlockAllocator
     {
             struct Block
             {
-                    VE::Internal::Core::Container::TVector<uint8_t> mem;
+                    VE::Internal::Core::Container::TVector<uint8_t, A> mem;
             };
             VE::Internal::Core::Container::TVector<Block> blocks;
             VE::Internal::Core::Container::TVector<T *>   free_list;
@@ -99,7 +107,7 @@ namespace VE::Internal::Core::Memory
             {
                     std::mutex                                                   locker;
                     OffsetAllocator::Allocator                                   allocator;
-                    VBlockAllocator<AllocationInternal>                           internal_blocks;
+                    VConcurrentBlockAllocator<AllocationInternal>                internal_blocks; // thread-safe, used outside of locker
                     bool                                                         deferred_release_enabled = false;
                     uint64_t                                                     deferred_release_frame   = 0;
                     std::deque<std::pair<OffsetAllocator::Allocation, uint64_t>> deferred_release_queue;
@@ -110,7 +118,7 @@ namespace VE::Internal::Core::Memory
 
             constexpr uint32_t page_count_from_bytes(uint64_t sizeInBytes) const
             {
-                return uint32_t(VE::Internal::Math::align((uint64_t) sizeInBytes, (uint64_t) page_size) / (uint64_t) page_size);
+                return uint32_t(VE::Math::align((uint64_t) sizeInBytes, (uint64_t) page_size) / (uint64_t) page_size);
             }
 
             // Initializes the allocator, only after which it can be used
@@ -195,16 +203,18 @@ namespace VE::Internal::Core::Memory
                     {
                         if (IsValid() && (internal_state->refcount.fetch_sub(1) <= 1))
                         {
-                            std::scoped_lock lck(allocator->locker);
-                            if (allocator->deferred_release_enabled)
                             {
-                                // can only be reclaimed after buffering amount of frames passed, this is usually used for GPU resources:
-                                allocator->deferred_release_queue.push_back(std::make_pair(internal_state->allocation, allocator->deferred_release_frame));
-                            }
-                            else
-                            {
-                                // reclaimed immediately:
-                                allocator->allocator.free(internal_state->allocation);
+                                std::scoped_lock lck(allocator->locker);
+                                if (allocator->deferred_release_enabled)
+                                {
+                                    // can only be reclaimed after buffering amount of frames passed, this is usually used for GPU resources:
+                                    allocator->deferred_release_queue.push_back(std::make_pair(internal_state->allocation, allocator->deferred_release_frame));
+                                }
+                                else
+                                {
+                                    // reclaimed immediately:
+                                    allocator->allocator.free(internal_state->allocation);
+                                }
                             }
                             allocator->internal_blocks.free(internal_state);
                         }
@@ -219,9 +229,12 @@ namespace VE::Internal::Core::Memory
             inline Allocation allocate(size_t sizeInBytes)
             {
                 const uint32_t              pages = page_count_from_bytes(sizeInBytes);
-                std::scoped_lock            lck(allocator->locker);
-                OffsetAllocator::Allocation offsetallocation = allocator->allocator.allocate(pages);
-                Allocation                  alloc;
+                OffsetAllocator::Allocation offsetallocation;
+                {
+                    std::scoped_lock lck(allocator->locker);
+                    offsetallocation = allocator->allocator.allocate(pages);
+                }
+                Allocation alloc;
                 if (offsetallocation.offset != OffsetAllocator::Allocation::NO_SPACE)
                 {
                     alloc.allocator      = allocator;
@@ -0,0 +1,261 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <Core/Container/VCO_Vector.hpp>
+
+// Thread-safe counterpart of VBlockAllocator.
+//
+// Every thread keeps two magazines (chains of up to magazine_size free slots) per allocator, so
+// allocate()/free() normally only touch thread-local memory. Full/empty magazines are exchanged
+// with a global lock-free stack of magazines, which is only hit once every magazine_size calls.
+// The global stack head is a tagged pointer (48 bit address + 16 bit version) to make the
+// compare-exchange ABA safe; since only whole magazines travel through it, the tag only wraps
+// after 65536 * magazine_size operations of other threads during a single pop.
+//
+// Objects may be freed on a different thread than they were allocated on. Blocks are never
+// returned to the system before the allocator is destroyed, and like VBlockAllocator the
+// allocator does not destroy objects that are still alive at that point.
+
+namespace VE::Internal::Core::Memory
+{
+    template <typename T, size_t block_size = 256, uint32_t magazine_size = 32> class VConcurrentBlockAllocator
+    {
+            static_assert(magazine_size > 0 && block_size % magazine_size == 0, "block_size must be a multiple of magazine_size");
+
+        private:
+            union Slot
+            {
+                    struct
+                    {
+                            Slot    *next;          // next free slot of the same magazine
+                            Slot    *next_magazine; // next magazine on the global stack (only valid on the first slot)
+                            uint32_t count;         // slots in this magazine (only valid on the first slot)
+                    } link;
+                    alignas(T) uint8_t storage[sizeof(T)];
+            };
+
+            struct Block
+            {
+                    Block *next = nullptr;
+                    Slot   slots[block_size];
+            };
+
+            struct Magazine
+            {
+                    Slot    *head  = nullptr;
+                    uint32_t count = 0;
+            };
+
+            static constexpr uint64_t POINTER_BITS = 48;
+            static constexpr uint64_t POINTER_MASK = (uint64_t(1) << POINTER_BITS) - 1;
+
+            // Shared between the allocator and every thread cache that touched it, so a cache can still be flushed after the allocator is gone
+            struct State
+            {
+                    std::atomic<uint64_t> magazines{0}; // tagged head of the global magazine stack
+                    std::atomic<Block *>  blocks{nullptr};
+                    std::atomic<uint32_t> block_count{0};
+                    std::atomic<bool>     alive{true};
+
+                    ~State()
+                    {
+                        Block *block = blocks.load(std::memory_order_acquire);
+                        while (block != nullptr)
+                        {
+                            Block *next = block->next;
+                            delete block;
+                            block = next;
+                        }
+                    }
+
+                    void push_magazine(const Magazine &magazine)
+                    {
+                        assert((reinterpret_cast<uint64_t>(magazine.head) & ~POINTER_MASK) == 0);
+                        magazine.head->link.count = magazine.count;
+
+                        uint64_t head = magazines.load(std::memory_order_relaxed);
+                        uint64_t desired;
+                        do
+                        {
+                            std::atomic_ref<Slot *>(magazine.head->link.next_magazine).store(reinterpret_cast<Slot *>(head & POINTER_MASK), std::memory_order_relaxed);
+                            desired = reinterpret_cast<uint64_t>(magazine.head) | ((head & ~POINTER_MASK) + (uint64_t(1) << POINTER_BITS));
+                        } while (!magazines.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+                    }
+
+                    bool pop_magazine(Magazine &magazine)
+                    {
+                        uint64_t head = magazines.load(std::memory_order_acquire);
+                        Slot    *slot;
+                        uint64_t desired;
+                        do
+                        {
+                            slot = reinterpret_cast<Slot *>(head & POINTER_MASK);
+                            if (slot == nullptr) return false;
+
+                            // slot may already be popped and reused by another thread here, the memory stays mapped
+                            // and the version tag makes the exchange fail in that case
+                            Slot *next = std::atomic_ref<Slot *>(slot->link.next_magazine).load(std::memory_order_relaxed);
+                            desired    = reinterpret_cast<uint64_t>(next) | ((head & ~POINTER_MASK) + (uint64_t(1) << POINTER_BITS));
+                        } while (!magazines.compare_exchange_weak(head, desired, std::memory_order_acquire, std::memory_order_acquire));
+
+                        magazine.head  = slot;
+                        magazine.count = slot->link.count;
+                        return true;
+                    }
+
+                    // Allocates a new block, keeps the first magazine for the caller and publishes the rest
+                    void grow(Magazine &magazine)
+                    {
+                        Block *block = new Block;
+                        block->next  = blocks.load(std::memory_order_relaxed);
+                        while (!blocks.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed))
+                        {
+                        }
+                        block_count.fetch_add(1, std::memory_order_relaxed);
+
+                        for (size_t first = 0; first < block_size; first += magazine_size)
+                        {
+                            Slot *slots = block->slots + first;
+                            for (uint32_t i = 0; i < magazine_size - 1; ++i)
+                            {
+                                slots[i].link.next = slots + i + 1;
+                            }
+                            slots[magazine_size - 1].link.next = nullptr;
+
+                            if (first == 0)
+                            {
+                                magazine = Magazine{slots, magazine_size};
+                            }
+                            else
+                            {
+                                push_magazine(Magazine{slots, magazine_size});
+                            }
+                        }
+                    }
+            };
+
+            struct CacheEntry
+            {
+                    std::shared_ptr<State> state;
+                    Magazine               loaded;
+                    Magazine               previous;
+
+                    void flush()
+                    {
+                        if (loaded.count > 0) state->push_magazine(loaded);
+                        if (previous.count > 0) state->push_magazine(previous);
+                        loaded   = {};
+                        previous = {};
+                    }
+            };
+
+            // One per thread and allocator type, holds a magazine pair for every allocator of this type the thread used
+            struct ThreadCache
+            {
+                    VE::Internal::Core::Container::TVector<CacheEntry> entries;
+
+                    ~ThreadCache()
+                    {
+                        for (auto &entry : entries)
+                        {
+                            entry.flush();
+                        }
+                    }
+
+                    CacheEntry &get(const std::shared_ptr<State> &state)
+                    {
+                        for (size_t i = 0; i < entries.size(); ++i)
+                        {
+                            CacheEntry &entry = entries[i];
+                            if (entry.state == state) return entry;
+                            if (!entry.state->alive.load(std::memory_order_relaxed))
+                            {
+                                // the allocator is gone, drop our reference so its blocks can be released
+                                entries.erase(&entry);
+                                --i;
+                            }
+                        }
+                        CacheEntry &entry = entries.emplace_back();
+                        entry.state       = state;
+                        return entry;
+                    }
+            };
+
+            static inline ThreadCache &get_thread_cache()
+            {
+                thread_local ThreadCache cache;
+                return cache;
+            }
+
+            std::shared_ptr<State> state = std::make_shared<State>();
+
+        public:
+            VConcurrentBlockAllocator() = default;
+            ~VConcurrentBlockAllocator() { state->alive.store(false, std::memory_order_relaxed); }
+
+            VConcurrentBlockAllocator(const VConcurrentBlockAllocator &)            = delete;
+            VConcurrentBlockAllocator &operator=(const VConcurrentBlockAllocator &) = delete;
+
+            template <typename... ARG> inline T *allocate(ARG &&...args)
+            {
+                CacheEntry &cache = get_thread_cache().get(state);
+                if (cache.loaded.count == 0)
+                {
+                    if (cache.previous.count > 0)
+                    {
+                        std::swap(cache.loaded, cache.previous);
+                    }
+                    else if (!state->pop_magazine(cache.loaded))
+                    {
+                        state->grow(cache.loaded);
+                    }
+                }
+
+                Slot *slot = cache.loaded.head;
+                cache.loaded.head = slot->link.next;
+                cache.loaded.count--;
+                return new (slot->storage) T(std::forward<ARG>(args)...);
+            }
+
+            inline void free(T *ptr)
+            {
+                ptr->~T();
+                Slot *slot = reinterpret_cast<Slot *>(ptr);
+
+                CacheEntry &cache = get_thread_cache().get(state);
+                if (cache.loaded.count == magazine_size)
+                {
+                    // keep one full magazine around so alternating allocate()/free() does not hit the global stack
+                    if (cache.previous.count > 0) state->push_magazine(cache.previous);
+                    cache.previous = cache.loaded;
+                    cache.loaded   = {};
+                }
+
+                slot->link.next = cache.loaded.head;
+                cache.loaded.head = slot;
+                cache.loaded.count++;
+            }
+
+            // Returns the magazines of the calling thread to the global stack (e.g. before a worker goes idle)
+            inline void flush_thread_cache() { get_thread_cache().get(state).flush(); }
+
+            inline size_t get_block_count() const { return state->block_count.load(std::memory_order_relaxed); }
+            inline size_t get_capacity() const { return get_block_count() * block_size; }
+    };
+} // namespace VE::Internal::Core::Memory
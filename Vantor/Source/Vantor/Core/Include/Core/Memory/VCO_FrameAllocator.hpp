@@ -0,0 +1,198 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/Memory/VCO_Allocator.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
+// Per-frame scratch memory.
+//
+// A VFrameArena owns a chain of VLinearAllocator blocks. Allocations are bumped out of the
+// current block; when it runs full the arena moves on to the next chained block (allocating
+// one if the chain is too short). Blocks are kept across Reset(), so once the chain has grown
+// to the peak demand of a frame there is no more heap traffic at all.
+//
+// VFrameAllocator is a ring of N arenas (double/triple buffering). Memory handed out during
+// frame F stays valid until BeginFrame() wraps around to F's arena again, so data can be
+// consumed one or two frames later (e.g. by the GPU or a render thread) without copying.
+//
+// Neither type runs destructors: only trivially destructible types may live in them.
+
+namespace VE::Internal::Core::Memory
+{
+    struct VFrameArenaStats
+    {
+            size_t   reservedBytes   = 0; // memory owned by the arena (all chained blocks)
+            size_t   usedBytes       = 0; // bytes handed out since the last Reset(), including alignment padding
+            size_t   highWaterMark   = 0; // peak usedBytes ever observed
+            uint32_t blockCount      = 0; // number of chained blocks (1 = no overflow ever happened)
+            uint32_t overflowCount   = 0; // how often an allocation had to spill into a new chained block
+            uint64_t allocationCount = 0; // allocations since the last Reset()
+    };
+
+    class VFrameArena
+    {
+        public:
+            static constexpr size_t BLOCK_ALIGNMENT = 64; // cache line
+
+            // Position inside the arena, used to rewind scoped allocations
+            struct Marker
+            {
+                    uint32_t block  = 0;
+                    size_t   offset = 0;
+                    size_t   used   = 0;
+            };
+
+            VFrameArena() = default;
+            explicit VFrameArena(size_t blockSize, EMemoryTag tag = EMemoryTag::Core) { Initialize(blockSize, tag); }
+            ~VFrameArena() { Shutdown(); }
+
+            VFrameArena(const VFrameArena &)            = delete;
+            VFrameArena &operator=(const VFrameArena &) = delete;
+
+            // Allocates the first block. blockSize is also the default size of overflow blocks.
+            // The blocks are accounted to tag in the VMemoryTracker.
+            void Initialize(size_t blockSize, EMemoryTag tag = EMemoryTag::Core);
+            // Releases every block
+            void Shutdown();
+
+            // Returns size bytes aligned to alignment (power of two), never nullptr for an initialized arena
+            void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+            // Typed allocation of count value-initialized elements
+            template <typename T> inline T *Allocate(size_t count = 1)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "VFrameArena never runs destructors");
+                T *ptr = static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+                for (size_t i = 0; i < count; ++i)
+                {
+                    new (ptr + i) T();
+                }
+                return ptr;
+            }
+
+            // Copies count elements into arena memory
+            template <typename T> inline T *Copy(const T *src, size_t count)
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "VFrameArena::Copy requires trivially copyable types");
+                T *ptr = static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+                if (count > 0) std::memcpy(ptr, src, sizeof(T) * count);
+                return ptr;
+            }
+
+            Marker GetMarker() const { return Marker{m_CurrentBlock, m_Blocks.empty() ? 0 : m_Blocks[m_CurrentBlock].offset, m_Stats.usedBytes}; }
+            // Frees everything allocated after marker was taken
+            void Rewind(const Marker &marker);
+            // Frees everything, keeps the blocks
+            void Reset();
+
+            bool                    IsInitialized() const { return !m_Blocks.empty(); }
+            size_t                  GetBlockSize() const { return m_BlockSize; }
+            const VFrameArenaStats &GetStats() const { return m_Stats; }
+
+        private:
+            VLinearAllocator &AppendBlock(size_t minSize);
+
+            VE::Internal::Core::Container::TVector<VLinearAllocator> m_Blocks;
+            uint32_t                                                 m_CurrentBlock = 0;
+            size_t                                                   m_BlockSize    = 0;
+            EMemoryTag                                               m_Tag          = EMemoryTag::Core;
+            VFrameArenaStats                                         m_Stats;
+    };
+
+    // Rewinds the arena to the position it had on construction
+    class VScopedArenaMarker
+    {
+        public:
+            explicit VScopedArenaMarker(VFrameArena &arena) : m_Arena(arena), m_Marker(arena.GetMarker()) {}
+            ~VScopedArenaMarker() { m_Arena.Rewind(m_Marker); }
+
+            VScopedArenaMarker(const VScopedArenaMarker &)            = delete;
+            VScopedArenaMarker &operator=(const VScopedArenaMarker &) = delete;
+
+        private:
+            VFrameArena        &m_Arena;
+            VFrameArena::Marker m_Marker;
+    };
+
+    // std-style allocator adapter, so containers can take their storage from an arena.
+    // deallocate() is a no-op, memory comes back with the next Reset()/Rewind().
+    template <typename T> struct TFrameArenaAllocator
+    {
+            using value_type = T;
+
+            VFrameArena *arena = nullptr;
+
+            TFrameArenaAllocator() noexcept = default;
+            TFrameArenaAllocator(VFrameArena *arena) noexcept : arena(arena) {}
+            template <typename U> TFrameArenaAllocator(const TFrameArenaAllocator<U> &other) noexcept : arena(other.arena) {}
+
+            inline T *allocate(size_t count)
+            {
+                assert(arena != nullptr);
+                return static_cast<T *>(arena->Allocate(sizeof(T) * count, alignof(T)));
+            }
+            inline void deallocate(T *, size_t) noexcept {}
+
+            template <typename U> bool operator==(const TFrameArenaAllocator<U> &other) const noexcept { return arena == other.arena; }
+            template <typename U> bool operator!=(const TFrameArenaAllocator<U> &other) const noexcept { return arena != other.arena; }
+    };
+
+    class VFrameAllocator
+    {
+        public:
+            static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 3;
+
+            VFrameAllocator() = default;
+            ~VFrameAllocator() { Shutdown(); }
+
+            VFrameAllocator(const VFrameAllocator &)            = delete;
+            VFrameAllocator &operator=(const VFrameAllocator &) = delete;
+
+            // bufferCount: 2 = double buffered, 3 = triple buffered
+            void Initialize(size_t arenaSize, uint32_t bufferCount = 2, EMemoryTag tag = EMemoryTag::Core);
+            void Shutdown();
+
+            // Advances the ring and resets the arena that is about to be reused
+            void BeginFrame();
+
+            VFrameArena &GetCurrentArena() { return m_Arenas[m_CurrentArena]; }
+            VFrameArena &GetArena(uint32_t index)
+            {
+                assert(index < m_BufferCount);
+                return m_Arenas[index];
+            }
+
+            inline void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) { return GetCurrentArena().Allocate(size, alignment); }
+            template <typename T> inline T *Allocate(size_t count = 1) { return GetCurrentArena().template Allocate<T>(count); }
+            template <typename T> inline T *Copy(const T *src, size_t count) { return GetCurrentArena().Copy(src, count); }
+
+            uint32_t GetBufferCount() const { return m_BufferCount; }
+            uint64_t GetFrameIndex() const { return m_FrameIndex; }
+
+            // Stats summed over all arenas of the ring (highWaterMark is the max of the ring)
+            VFrameArenaStats GetStats() const;
+
+        private:
+            std::array<VFrameArena, MAX_FRAMES_IN_FLIGHT> m_Arenas;
+            uint32_t                                      m_BufferCount  = 0;
+            uint32_t                                      m_CurrentArena = 0;
+            uint64_t                                      m_FrameIndex   = 0;
+    };
+} // namespace VE::Internal::Core::Memory
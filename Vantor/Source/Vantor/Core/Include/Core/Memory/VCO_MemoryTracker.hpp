@@ -0,0 +1,247 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+// Memory telemetry per subsystem.
+//
+// Every allocation is accounted to an EMemoryTag. Counters are plain relaxed atomics, so tracking
+// is safe from any thread and costs a few atomic adds per allocation. Allocations reach the
+// tracker in three ways:
+//  - TTaggedAllocator<T, Tag>, a std-style allocator adapter for TVector, TSmallVector, the
+//    flat hash containers and the Core block allocators
+//  - VTrackedMemory, a handle for memory the engine does not allocate itself (stb_image pixels,
+//    GPU resources) that is resized as the owner changes and released with it
+//  - VMemoryTracker::TrackAllocation()/TrackFree() for everything else
+//
+// GPU bytes are reported separately from CPU bytes and are estimates (drivers pad and mip).
+// Define VANTOR_MEMORY_TRACKING to 0 to compile all tracking out.
+
+#ifndef VANTOR_MEMORY_TRACKING
+#define VANTOR_MEMORY_TRACKING 1
+#endif
+
+namespace VE::Internal::Core::Memory
+{
+    enum class EMemoryTag : uint8_t
+    {
+        Core,
+        Assets,
+        Geometry,
+        Textures,
+        Actors,
+        RenderPipeline,
+        Log,
+
+        Count
+    };
+
+    const char *MemoryTagToString(EMemoryTag tag);
+
+    struct VMemoryTagStats
+    {
+            size_t   liveBytes            = 0; // CPU bytes currently allocated
+            size_t   peakBytes            = 0; // highest liveBytes ever observed
+            size_t   gpuLiveBytes         = 0; // GPU bytes currently allocated
+            size_t   gpuPeakBytes         = 0;
+            uint64_t liveAllocations      = 0;
+            uint64_t totalAllocations     = 0; // since startup
+            size_t   frameAllocatedBytes  = 0; // CPU bytes allocated during the last completed frame
+            uint64_t frameAllocationCount = 0; // allocations during the last completed frame
+    };
+
+    namespace Detail
+    {
+        struct alignas(64) VMemoryTagCounters // one cache line per tag, tags are hit from different threads
+        {
+                std::atomic<size_t>   liveBytes{0};
+                std::atomic<size_t>   peakBytes{0};
+                std::atomic<size_t>   gpuLiveBytes{0};
+                std::atomic<size_t>   gpuPeakBytes{0};
+                std::atomic<uint64_t> liveAllocations{0};
+                std::atomic<uint64_t> totalAllocations{0};
+                std::atomic<size_t>   frameBytes{0};
+                std::atomic<uint64_t> frameAllocations{0};
+                std::atomic<size_t>   lastFrameBytes{0};
+                std::atomic<uint64_t> lastFrameAllocations{0};
+        };
+    } // namespace Detail
+
+    class VMemoryTracker
+    {
+        public:
+            static inline void TrackAllocation(EMemoryTag tag, size_t bytes)
+            {
+#if VANTOR_MEMORY_TRACKING
+                Counters &counters = s_Counters[static_cast<size_t>(tag)];
+                UpdatePeak(counters.peakBytes, counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+                counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+                counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+                counters.frameBytes.fetch_add(bytes, std::memory_order_relaxed);
+                counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+#else
+                (void) tag;
+                (void) bytes;
+#endif
+            }
+
+            static inline void TrackFree(EMemoryTag tag, size_t bytes)
+            {
+#if VANTOR_MEMORY_TRACKING
+                Counters &counters = s_Counters[static_cast<size_t>(tag)];
+                counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+                counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+#else
+                (void) tag;
+                (void) bytes;
+#endif
+            }
+
+            static inline void TrackGpuAllocation(EMemoryTag tag, size_t bytes)
+            {
+#if VANTOR_MEMORY_TRACKING
+                Counters &counters = s_Counters[static_cast<size_t>(tag)];
+                UpdatePeak(counters.gpuPeakBytes, counters.gpuLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+#else
+                (void) tag;
+                (void) bytes;
+#endif
+            }
+
+            static inline void TrackGpuFree(EMemoryTag tag, size_t bytes)
+            {
+#if VANTOR_MEMORY_TRACKING
+                s_Counters[static_cast<size_t>(tag)].gpuLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+#else
+                (void) tag;
+                (void) bytes;
+#endif
+            }
+
+            // Closes the current frame, its allocation counts become the frame* stats. Called by VEngine::Update().
+            static void BeginFrame();
+
+            static VMemoryTagStats GetStats(EMemoryTag tag);
+            static size_t          GetTotalLiveBytes();
+            static size_t          GetTotalGpuLiveBytes();
+
+            // {"frame": n, "tags": {"Core": {...}, ...}, "total": {...}}
+            static std::string ToJson();
+            static bool        DumpJson(const std::string &path);
+
+        private:
+            using Counters = Detail::VMemoryTagCounters;
+
+            static inline void UpdatePeak(std::atomic<size_t> &peak, size_t value)
+            {
+                size_t current = peak.load(std::memory_order_relaxed);
+                while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            static inline std::array<Counters, static_cast<size_t>(EMemoryTag::Count)> s_Counters{};
+            static inline std::atomic<uint64_t>                                           s_FrameIndex{0};
+    };
+
+    // Memory the engine does not allocate itself, accounted as long as this object lives
+    class VTrackedMemory
+    {
+        public:
+            explicit VTrackedMemory(EMemoryTag tag) : m_Tag(tag) {}
+            ~VTrackedMemory() { Set(0, 0); }
+
+            VTrackedMemory(const VTrackedMemory &)            = delete;
+            VTrackedMemory &operator=(const VTrackedMemory &) = delete;
+
+            // Replaces the accounted sizes
+            void Set(size_t cpuBytes, size_t gpuBytes)
+            {
+                SetCpu(cpuBytes);
+                SetGpu(gpuBytes);
+            }
+
+            void SetCpu(size_t bytes)
+            {
+                if (bytes == m_CpuBytes) return;
+                if (m_CpuBytes > 0) VMemoryTracker::TrackFree(m_Tag, m_CpuBytes);
+                if (bytes > 0) VMemoryTracker::TrackAllocation(m_Tag, bytes);
+                m_CpuBytes = bytes;
+            }
+
+            void SetGpu(size_t bytes)
+            {
+                if (bytes == m_GpuBytes) return;
+                if (m_GpuBytes > 0) VMemoryTracker::TrackGpuFree(m_Tag, m_GpuBytes);
+                if (bytes > 0) VMemoryTracker::TrackGpuAllocation(m_Tag, bytes);
+                m_GpuBytes = bytes;
+            }
+
+            size_t     GetCpuBytes() const { return m_CpuBytes; }
+            size_t     GetGpuBytes() const { return m_GpuBytes; }
+            EMemoryTag GetTag() const { return m_Tag; }
+
+        private:
+            EMemoryTag m_Tag;
+            size_t     m_CpuBytes = 0;
+            size_t     m_GpuBytes = 0;
+    };
+
+    // std-style allocator adapter that accounts everything allocated through A to Tag, e.g.
+    // TVector<VVertex, TTaggedAllocator<VVertex, EMemoryTag::Geometry>>
+    template <typename T, EMemoryTag Tag, typename A = std::allocator<T>> struct TTaggedAllocator
+    {
+            using UpstreamTraits = std::allocator_traits<A>;
+
+            using value_type                             = T;
+            using propagate_on_container_copy_assignment = typename UpstreamTraits::propagate_on_container_copy_assignment;
+            using propagate_on_container_move_assignment = typename UpstreamTraits::propagate_on_container_move_assignment;
+            using propagate_on_container_swap            = typename UpstreamTraits::propagate_on_container_swap;
+            using is_always_equal                        = typename UpstreamTraits::is_always_equal;
+
+            template <typename U> struct rebind
+            {
+                    using other = TTaggedAllocator<U, Tag, typename UpstreamTraits::template rebind_alloc<U>>;
+            };
+
+            static constexpr EMemoryTag TAG = Tag;
+
+            [[no_unique_address]] A upstream;
+
+            TTaggedAllocator() noexcept(std::is_nothrow_default_constructible_v<A>) = default;
+            TTaggedAllocator(const A &upstream) noexcept : upstream(upstream) {}
+            template <typename U, typename B> TTaggedAllocator(const TTaggedAllocator<U, Tag, B> &other) noexcept : upstream(other.upstream) {}
+
+            inline T *allocate(size_t count)
+            {
+                T *ptr = UpstreamTraits::allocate(upstream, count);
+                VMemoryTracker::TrackAllocation(Tag, count * sizeof(T));
+                return ptr;
+            }
+
+            inline void deallocate(T *ptr, size_t count) noexcept
+            {
+                VMemoryTracker::TrackFree(Tag, count * sizeof(T));
+                UpstreamTraits::deallocate(upstream, ptr, count);
+            }
+
+            TTaggedAllocator select_on_container_copy_construction() const { return TTaggedAllocator(UpstreamTraits::select_on_container_copy_construction(upstream)); }
+
+            template <typename U, typename B> bool operator==(const TTaggedAllocator<U, Tag, B> &other) const noexcept { return upstream == other.upstream; }
+            template <typename U, typename B> bool operator!=(const TTaggedAllocator<U, Tag, B> &other) const noexcept { return !(upstream == other.upstream); }
+    };
+} // namespace VE::Internal::Core::Memory
@@ -0,0 +1,119 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
+// Growable arena backed by reserved address space.
+//
+// Reserve() claims a large virtual range up front (mmap(PROT_NONE) / VirtualAlloc(MEM_RESERVE)),
+// which costs no physical memory. Pages are committed on demand in COMMIT_GRANULARITY steps as
+// the bump offset advances, so the arena never moves: the most recent allocation can always be
+// grown in place (Resize()/Reallocate()) without copying, which is what large transient buffers
+// with unknown final size (decoders, importers) want.
+//
+// Reset() rewinds the arena but keeps the pages committed for the next user, Decommit() hands
+// them back to the OS (madvise(MADV_DONTNEED) / MEM_DECOMMIT), e.g. after a load batch.
+// Committed bytes are accounted to the tag in the VMemoryTracker.
+//
+// Like VFrameArena it never runs destructors and is not thread safe, use one per thread.
+
+namespace VE::Internal::Core::Memory
+{
+    struct VVirtualArenaStats
+    {
+            size_t   reservedBytes      = 0; // address space owned by the arena
+            size_t   committedBytes     = 0; // pages currently backed by memory
+            size_t   usedBytes          = 0; // bump offset, including alignment padding
+            size_t   peakCommittedBytes = 0; // highest committedBytes ever observed
+            uint64_t inPlaceGrowCount   = 0; // Resize()/Reallocate() calls served without a copy
+            uint64_t copyGrowCount      = 0; // Reallocate() calls that had to move the data
+    };
+
+    class VVirtualArena
+    {
+        public:
+            static constexpr size_t COMMIT_GRANULARITY = 64 * 1024;
+
+            // Position inside the arena, used to rewind scoped allocations
+            struct Marker
+            {
+                    size_t offset = 0;
+                    size_t last   = 0;
+            };
+
+            VVirtualArena() = default;
+            explicit VVirtualArena(size_t reserveBytes, EMemoryTag tag = EMemoryTag::Core) { Reserve(reserveBytes, tag); }
+            ~VVirtualArena() { Release(); }
+
+            VVirtualArena(const VVirtualArena &)            = delete;
+            VVirtualArena &operator=(const VVirtualArena &) = delete;
+
+            // Reserves reserveBytes of address space, returns false if the OS refused
+            bool Reserve(size_t reserveBytes, EMemoryTag tag = EMemoryTag::Core);
+            // Unmaps the whole range, every pointer into the arena becomes invalid
+            void Release();
+
+            // Returns size bytes aligned to alignment (power of two), nullptr if the reservation is exhausted
+            void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+            template <typename T> inline T *Allocate(size_t count = 1)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "VVirtualArena never runs destructors");
+                return static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+            }
+
+            // Grows or shrinks the most recent allocation in place.
+            // Returns false if ptr is not the most recent allocation or the reservation is exhausted.
+            bool Resize(void *ptr, size_t newSize);
+
+            // Like realloc(): in place for the most recent allocation, otherwise allocates and copies
+            // min(oldSize, newSize) bytes. The old block is released with Free().
+            void *Reallocate(void *ptr, size_t oldSize, size_t newSize, size_t alignment = alignof(std::max_align_t));
+
+            // Pops ptr if it is the most recent allocation. Older blocks stay allocated until
+            // Reset()/Rewind(), their whole pages are purged so they stop counting towards the RSS.
+            void Free(void *ptr, size_t size);
+
+            Marker GetMarker() const { return Marker{m_Offset, m_LastAllocation}; }
+            // Frees everything allocated after marker was taken
+            void Rewind(const Marker &marker);
+            // Frees everything, the committed pages are kept
+            void Reset();
+            // Returns all committed pages above max(usedBytes, keepBytes) to the OS
+            void Decommit(size_t keepBytes = 0);
+
+            bool Owns(const void *ptr) const
+            {
+                const uint8_t *p = static_cast<const uint8_t *>(ptr);
+                return m_Base != nullptr && p >= m_Base && p < m_Base + m_Stats.reservedBytes;
+            }
+
+            bool                      IsReserved() const { return m_Base != nullptr; }
+            uint8_t                  *GetBase() const { return m_Base; }
+            const VVirtualArenaStats &GetStats() const { return m_Stats; }
+
+        private:
+            // Makes sure [0, end) is committed
+            bool Commit(size_t end);
+
+            uint8_t           *m_Base           = nullptr;
+            size_t             m_Offset         = 0;
+            size_t             m_LastAllocation = 0; // start of the most recent allocation
+            EMemoryTag         m_Tag            = EMemoryTag::Core;
+            VVirtualArenaStats m_Stats;
+    };
+} // namespace VE::Internal::Core::Memory
@@ -0,0 +1,351 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/Profiler/VCO_ProfilerTrace.hpp>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Hierarchical CPU profiler.
+//
+//     void VRenderPath3D::Render()
+//     {
+//         VE_PROFILE_SCOPE("VRenderPath3D::Render");
+//         ...
+//     }
+//
+// A zone costs two timestamps (rdtsc on x86, steady_clock elsewhere) pushed into a lock-free
+// buffer owned by the calling thread, nothing else happens on the instrumented thread.
+// VProfiler::BeginFrame(), called once per frame by VEngine::Update(), drains the buffers of
+// all threads and merges the zones of the finished frame into a tree per thread: repeated
+// calls of a zone under the same parent are summed up. The last GetHistorySize() frames are
+// kept for GetLastFrames() and the rolling min/avg/max/p99 of GetZoneStats().
+//
+// Counters track a value per frame next to the zones:
+//
+//     VE_PROFILE_COUNT("Draw Calls", 1);                            // summed, reset every frame
+//     VE_PROFILE_VALUE("Loaded Assets", assetManager->GetCount());  // last value set
+//
+// VProfiler::BeginCapture() records frames for a Chrome trace, see VCO_ProfilerTrace.hpp.
+//
+// Zone names must outlive the profiler (string literals). Define VANTOR_PROFILER to 0 to compile
+// all zones and counters out.
+
+#ifndef VANTOR_PROFILER
+#define VANTOR_PROFILER 1
+#endif
+
+#ifndef VANTOR_PROFILER_RDTSC
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VANTOR_PROFILER_RDTSC 1
+#else
+#define VANTOR_PROFILER_RDTSC 0
+#endif
+#endif
+
+namespace VE::Internal::Core::Profiler
+{
+    // Raw timestamp of a zone, converted to nanoseconds when the frame is collected
+    inline uint64_t GetProfilerTicks()
+    {
+#if VANTOR_PROFILER_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Zone instances of one frame, merged per parent and name
+    struct VProfileZoneSample
+    {
+            static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+            const char *name       = nullptr;
+            uint64_t    startNs    = 0; // first call, profiler time (see VProfiler::GetTimeNs())
+            uint64_t    durationNs = 0; // all calls of the frame
+            uint32_t    callCount  = 0;
+            uint32_t    parent     = NO_PARENT; // index into VProfileFrame::zones, parents come before their children
+            uint32_t    threadId   = 0;
+            uint16_t    depth      = 0;
+    };
+
+    struct VProfileFrame
+    {
+            uint64_t                                                   frameIndex = 0;
+            uint64_t                                                   startNs    = 0;
+            uint64_t                                                   durationNs = 0;
+            VE::Internal::Core::Container::TVector<VProfileZoneSample> zones;
+    };
+
+    // Rolling statistics of one zone over the frame history, per frame totals in milliseconds
+    struct VProfileZoneStats
+    {
+            std::string path;      // parent names and the zone name, separated by '/'
+            const char *name     = nullptr;
+            uint32_t    threadId = 0;
+            uint16_t    depth    = 0;
+            uint32_t    frames   = 0; // frames of the history the zone appeared in
+            double      avgCalls = 0.0;
+            double      minMs    = 0.0;
+            double      avgMs    = 0.0;
+            double      maxMs    = 0.0;
+            double      p99Ms    = 0.0;
+    };
+
+    enum class EProfileCounterMode : uint8_t
+    {
+        PerFrame, // Add() accumulates, reset to 0 when a frame begins
+        Value     // Set() replaces, kept across frames
+    };
+
+    // Handle of a named counter, valid for the lifetime of the program
+    class VProfileCounter
+    {
+        public:
+            VProfileCounter(std::string name, EProfileCounterMode mode) : m_Name(std::move(name)), m_Mode(mode) {}
+
+            void Add(int64_t delta) { m_Value.fetch_add(delta, std::memory_order_relaxed); }
+            void Set(int64_t value) { m_Value.store(value, std::memory_order_relaxed); }
+
+            const std::string  &GetName() const { return m_Name; }
+            EProfileCounterMode GetMode() const { return m_Mode; }
+            // Value of the last completed frame
+            int64_t GetLastFrameValue() const { return m_LastFrameValue.load(std::memory_order_relaxed); }
+
+            // Called by VProfiler::BeginFrame(), returns the value of the frame that ended
+            int64_t EndFrame()
+            {
+                const int64_t value = m_Mode == EProfileCounterMode::PerFrame ? m_Value.exchange(0, std::memory_order_relaxed) : m_Value.load(std::memory_order_relaxed);
+                m_LastFrameValue.store(value, std::memory_order_relaxed);
+                return value;
+            }
+
+        private:
+            std::string          m_Name;
+            EProfileCounterMode  m_Mode;
+            std::atomic<int64_t> m_Value{0};
+            std::atomic<int64_t> m_LastFrameValue{0};
+    };
+
+    namespace Detail
+    {
+        struct VProfileEvent
+        {
+                uint64_t    ticks;
+                const char *name; // nullptr ends the innermost zone
+        };
+
+        // Single producer (the owning thread) / single consumer (VProfiler::BeginFrame()) event ring
+        class VProfileEventBuffer
+        {
+            public:
+                // capacity must be a power of two
+                explicit VProfileEventBuffer(size_t capacity) : m_Mask(capacity - 1)
+                {
+                    assert(capacity >= 64 && (capacity & (capacity - 1)) == 0);
+                    m_Events.resize(capacity);
+                }
+
+                size_t GetCapacity() const { return m_Mask + 1; }
+
+                // ----- Producer -----
+
+                // Room for count more events
+                bool HasRoom(size_t count)
+                {
+                    const uint64_t head = m_Head.load(std::memory_order_relaxed);
+                    if (head - m_CachedTail + count <= GetCapacity()) return true;
+                    m_CachedTail = m_Tail.load(std::memory_order_acquire);
+                    return head - m_CachedTail + count <= GetCapacity();
+                }
+
+                // Only after HasRoom()
+                void Push(const VProfileEvent &event)
+                {
+                    const uint64_t head    = m_Head.load(std::memory_order_relaxed);
+                    m_Events[head & m_Mask] = event;
+                    m_Head.store(head + 1, std::memory_order_release);
+                }
+
+                // ----- Consumer -----
+
+                const VProfileEvent *Peek()
+                {
+                    const uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+                    if (tail == m_Head.load(std::memory_order_acquire)) return nullptr;
+                    return &m_Events[tail & m_Mask];
+                }
+
+                void Pop() { m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+            private:
+                VE::Internal::Core::Container::TVector<VProfileEvent> m_Events;
+                size_t                                                m_Mask;
+
+                alignas(64) std::atomic<uint64_t> m_Head{0};
+                uint64_t                          m_CachedTail = 0; // producer's copy of m_Tail
+                alignas(64) std::atomic<uint64_t> m_Tail{0};
+        };
+
+        struct VProfileThreadState
+        {
+                static constexpr size_t BUFFER_CAPACITY = 64 * 1024; // events, 1 MiB per profiled thread
+
+                VProfileEventBuffer   buffer{BUFFER_CAPACITY};
+                uint32_t              threadId  = 0;
+                uint32_t              openDepth = 0; // recorded zones that are still open, their end events are reserved
+                uint32_t              skipDepth = 0; // open zones that were dropped because the buffer was full
+                std::atomic<uint64_t> droppedZones{0};
+                std::atomic<bool>     retired{false}; // the thread exited
+        };
+
+        inline std::atomic<bool>                  g_ProfilerEnabled{true};
+        inline thread_local VProfileThreadState *t_ProfileState = nullptr;
+
+        // Creates the calling thread's state on first use, nullptr while the thread exits
+        VProfileThreadState *AcquireProfileState();
+
+        inline void BeginZone(const char *name)
+        {
+            VProfileThreadState *state = t_ProfileState != nullptr ? t_ProfileState : AcquireProfileState();
+            if (state == nullptr) return;
+
+            // The zone's end and the ends of all open zones must always fit
+            if (state->skipDepth == 0 && state->buffer.HasRoom(state->openDepth + 2))
+            {
+                state->buffer.Push({GetProfilerTicks(), name});
+                state->openDepth++;
+            }
+            else
+            {
+                state->skipDepth++;
+                state->droppedZones.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        inline void EndZone()
+        {
+            VProfileThreadState *state = t_ProfileState;
+            if (state == nullptr) return;
+
+            if (state->skipDepth > 0)
+            {
+                state->skipDepth--;
+                return;
+            }
+            state->buffer.Push({GetProfilerTicks(), nullptr});
+            state->openDepth--;
+        }
+    } // namespace Detail
+
+    class VProfiler
+    {
+        public:
+            // Disabled zones cost one relaxed load
+            static void SetEnabled(bool enabled) { Detail::g_ProfilerEnabled.store(enabled, std::memory_order_relaxed); }
+            static bool IsEnabled() { return Detail::g_ProfilerEnabled.load(std::memory_order_relaxed); }
+
+            // Names the calling thread in captures, "Thread <id>" otherwise
+            static void        SetThreadName(const std::string &name);
+            static std::string GetThreadName(uint32_t threadId);
+            // Id the calling thread's zones are reported with
+            static uint32_t GetCurrentThreadId();
+
+            // Closes the current frame and starts frameIndex. Called by VEngine::Update() on the main thread.
+            static void BeginFrame(uint64_t frameIndex);
+
+            // Number of completed frames kept, 240 by default
+            static void   SetHistorySize(size_t frames);
+            static size_t GetHistorySize();
+
+            // Up to count of the most recent completed frames, oldest first
+            static VE::Internal::Core::Container::TVector<VProfileFrame> GetLastFrames(size_t count);
+            // Statistics of every zone over the kept frames
+            static VE::Internal::Core::Container::TVector<VProfileZoneStats> GetZoneStats();
+            // Frame duration statistics over the kept frames, path is "Frame"
+            static VProfileZoneStats GetFrameStats();
+
+            // Zones dropped because a thread's buffer was full between two frames
+            static uint64_t GetDroppedZones();
+
+            // Profiler time in nanoseconds, the time base of VProfileFrame and VProfileZoneSample
+            static uint64_t GetTimeNs();
+
+            // Counter with this name, created with mode on first use. Cache the reference, the lookup locks.
+            static VProfileCounter &GetCounter(const char *name, EProfileCounterMode mode);
+
+            // Records the next frames frames (starting at the next BeginFrame()) and writes them to path as a
+            // Chrome trace. False if frames is 0 or a capture is already running.
+            static bool BeginCapture(uint32_t frames, const std::string &path);
+            // Starts a capture from VANTOR_PROFILE_CAPTURE / VANTOR_PROFILE_CAPTURE_FILE, false if not set
+            static bool BeginCaptureFromEnvironment();
+            // Writes the running capture with the frames recorded so far, used at shutdown
+            static void EndCapture();
+            static bool IsCapturing();
+    };
+
+    class VProfileScope
+    {
+        public:
+            explicit VProfileScope(const char *name)
+            {
+                if (VProfiler::IsEnabled())
+                {
+                    Detail::BeginZone(name);
+                    m_Active = true;
+                }
+            }
+
+            ~VProfileScope()
+            {
+                if (m_Active) Detail::EndZone();
+            }
+
+            VProfileScope(const VProfileScope &)            = delete;
+            VProfileScope &operator=(const VProfileScope &) = delete;
+
+        private:
+            bool m_Active = false;
+    };
+} // namespace VE::Internal::Core::Profiler
+
+#define VE_PROFILE_CONCAT_INNER(a, b) a##b
+#define VE_PROFILE_CONCAT(a, b)       VE_PROFILE_CONCAT_INNER(a, b)
+
+#if VANTOR_PROFILER
+#define VE_PROFILE_SCOPE(name) ::VE::Internal::Core::Profiler::VProfileScope VE_PROFILE_CONCAT(veProfileScope_, __LINE__)(name)
+#define VE_PROFILE_COUNTER_IMPL(name, mode, op, value)                                                                                 \
+    do                                                                                                                                 \
+    {                                                                                                                                  \
+        static ::VE::Internal::Core::Profiler::VProfileCounter &veProfileCounter =                                                     \
+            ::VE::Internal::Core::Profiler::VProfiler::GetCounter(name, ::VE::Internal::Core::Profiler::EProfileCounterMode::mode);    \
+        veProfileCounter.op(static_cast<int64_t>(value));                                                                              \
+    } while (0)
+#define VE_PROFILE_COUNT(name, delta) VE_PROFILE_COUNTER_IMPL(name, PerFrame, Add, delta)
+#define VE_PROFILE_VALUE(name, value) VE_PROFILE_COUNTER_IMPL(name, Value, Set, value)
+#else
+#define VE_PROFILE_SCOPE(name)        ((void) 0)
+#define VE_PROFILE_COUNT(name, delta) ((void) 0)
+#define VE_PROFILE_VALUE(name, value) ((void) 0)
+#endif
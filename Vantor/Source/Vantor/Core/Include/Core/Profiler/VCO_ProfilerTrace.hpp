@@ -0,0 +1,76 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <Core/Container/VCO_Vector.hpp>
+
+// Profiler captures in the Chrome Trace Event format, loadable by chrome://tracing and
+// https://ui.perfetto.dev.
+//
+// A capture keeps every zone instance of a range of frames with its real start and duration,
+// unlike the merged per frame trees of VProfiler::GetLastFrames(). Start one from code with
+// VProfiler::BeginCapture() or for headless runs by setting
+//
+//   VANTOR_PROFILE_CAPTURE=<frames>            number of frames to capture from startup
+//   VANTOR_PROFILE_CAPTURE_FILE=<path>         output file, "VantorProfile.json" by default
+//
+// The trace has one track per profiled thread (named by VProfiler::SetThreadName()), a "Frames"
+// track with one slice and a global marker per frame, and a counter track per profiler counter.
+
+namespace VE::Internal::Core::Profiler
+{
+    // All times are profiler time in nanoseconds (see VProfiler::GetTimeNs())
+    struct VProfileTraceZone
+    {
+            const char *name       = nullptr;
+            uint64_t    startNs    = 0;
+            uint64_t    durationNs = 0;
+            uint32_t    threadId   = 0;
+            uint16_t    depth      = 0;
+    };
+
+    struct VProfileTraceFrame
+    {
+            uint64_t frameIndex = 0;
+            uint64_t startNs    = 0;
+            uint64_t durationNs = 0;
+    };
+
+    // Value of a counter over one frame, sampled when the frame ended
+    struct VProfileTraceCounter
+    {
+            const char *name   = nullptr;
+            uint64_t    timeNs = 0; // start of the frame
+            int64_t     value  = 0;
+    };
+
+    struct VProfileTraceThread
+    {
+            uint32_t    threadId = 0;
+            std::string name;
+    };
+
+    struct VProfileCapture
+    {
+            VE::Internal::Core::Container::TVector<VProfileTraceZone>    zones;
+            VE::Internal::Core::Container::TVector<VProfileTraceFrame>   frames;
+            VE::Internal::Core::Container::TVector<VProfileTraceCounter> counters;
+            VE::Internal::Core::Container::TVector<VProfileTraceThread>  threads;
+            uint64_t                                                     droppedZones = 0; // zones lost to full buffers during the capture
+            double                                                       wallSeconds  = 0.0;
+    };
+
+    // Chrome Trace Event JSON ("JSON Object Format") of the capture
+    std::string ToChromeTraceJson(const VProfileCapture &capture);
+    bool        WriteChromeTrace(const VProfileCapture &capture, const std::string &path);
+} // namespace VE::Internal::Core::Profiler
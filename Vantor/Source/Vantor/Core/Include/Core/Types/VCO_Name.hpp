@@ -0,0 +1,103 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+// Interned string identifiers.
+//
+// A VName is a 32 bit index into a global, append-only string pool. Creating one hashes and
+// looks up the string once (shared lock, exclusive only for strings that are new), after that
+// copies, comparisons and hashing are plain integer operations. Strings are never removed from
+// the pool, so the string of a VName can always be read back and stays valid until exit.
+//
+// Ids are only stable for the lifetime of the process, never serialize them.
+//
+// Names used in hot paths should be created once, VE_NAME("uModel") does that per call site and
+// hashes the literal at compile time. Id 0 is the empty name (None).
+//
+// Define VANTOR_NAME_DEBUG_VIEW to 1 to additionally keep a pointer to the string in every VName,
+// so debuggers can show it without calling GetString() (doubles the size of a VName).
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#ifndef VANTOR_NAME_DEBUG_VIEW
+#define VANTOR_NAME_DEBUG_VIEW 0
+#endif
+
+namespace VE::Internal::Core::Types
+{
+    // 32 bit FNV-1a, usable at compile time
+    constexpr uint32_t HashFNV1a(std::string_view str) noexcept
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : str)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    class VName
+    {
+        public:
+            constexpr VName() noexcept = default;
+
+            VName(std::string_view str) : VName(str, HashFNV1a(str)) {}
+            VName(const char *str) : VName(std::string_view(str)) {}
+            VName(const std::string &str) : VName(std::string_view(str)) {}
+            // hash must be HashFNV1a(str), lets callers hash literals at compile time
+            VName(std::string_view str, uint32_t hash);
+
+            // Returns the name of str if it was interned before, None otherwise (never grows the pool)
+            static VName Find(std::string_view str);
+            // Number of interned strings, including None
+            static uint32_t GetPoolSize();
+
+            constexpr uint32_t GetId() const noexcept { return m_Id; }
+            constexpr bool     IsNone() const noexcept { return m_Id == 0; }
+            constexpr explicit operator bool() const noexcept { return m_Id != 0; }
+
+            // Reverse lookup, the returned string is null terminated and lives until exit
+            std::string_view GetString() const;
+            const char      *c_str() const { return GetString().data(); }
+            std::string      ToString() const { return std::string(GetString()); }
+            // HashFNV1a of the string
+            uint32_t GetHash() const;
+
+            // Orders by id, which is the interning order and not lexicographic
+            friend constexpr bool operator==(VName a, VName b) noexcept { return a.m_Id == b.m_Id; }
+            friend constexpr bool operator!=(VName a, VName b) noexcept { return a.m_Id != b.m_Id; }
+            friend constexpr bool operator<(VName a, VName b) noexcept { return a.m_Id < b.m_Id; }
+
+        private:
+            uint32_t m_Id = 0;
+#if VANTOR_NAME_DEBUG_VIEW
+            const char *m_Debug = "";
+#endif
+    };
+} // namespace VE::Internal::Core::Types
+
+template <> struct std::hash<VE::Internal::Core::Types::VName>
+{
+        // Ids are dense, TFlatHashMap spreads them itself
+        inline size_t operator()(VE::Internal::Core::Types::VName name) const noexcept { return name.GetId(); }
+};
+
+// Interns a string literal once per call site, the hash is computed at compile time
+#define VE_NAME(str)                                                                      \
+    ([]() -> const ::VE::Internal::Core::Types::VName & {                                \
+        static constexpr uint32_t hash = ::VE::Internal::Core::Types::HashFNV1a(str);    \
+        static const ::VE::Internal::Core::Types::VName name(str, hash);                 \
+        return name;                                                                      \
+    }())
@@ -8,16 +8,571 @@
  ****************************************************************************/
 
 #include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/BackLog/VCO_LogRing.hpp>
+#include <Core/BackLog/VCO_LogSinks.hpp>
 #include <Core/Container/VCO_Vector.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
 namespace VE::Internal::Core::Backlog
 {
+    namespace
+    {
+        constexpr size_t RING_CAPACITY         = 64 * 1024; // per logging thread
+        constexpr size_t MAX_RECORDS_PER_DRAIN = 4096;      // per ring and pass, so one chatty thread can't starve the others
+        constexpr auto   IDLE_WAIT             = std::chrono::milliseconds(10);
+
+        enum class ELogRecordKind : uint8_t
+        {
+            Text,     // source and text bytes
+            Formatted // VLogFormatRef, source bytes, binary VE_LOG arguments
+        };
+
+        // Payload of a VLogRing record, followed by the kind specific data
+        struct VLogRecordHeader
+        {
+                uint64_t       timestamp;
+                uint32_t       dataLength; // text or argument bytes
+                uint16_t       sourceLength;
+                ELogLevel      level;
+                ELogRecordKind kind;
+        };
+
+        // Format string of a VE_LOG record, a literal that lives until exit
+        struct VLogFormatRef
+        {
+                const char *data;
+                uint64_t    size;
+        };
+
+        struct VThreadRing
+        {
+                VLogRing          ring{RING_CAPACITY};
+                uint32_t          threadId = 0;
+                std::atomic<bool> retired{false}; // set when the owning thread exits, the ring is dropped once drained
+        };
+
+        uint64_t Now() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+        void DecodeRecord(const uint8_t *payload, VLogEntry &entry)
+        {
+            VLogRecordHeader header;
+            std::memcpy(&header, payload, sizeof(VLogRecordHeader));
+            payload += sizeof(VLogRecordHeader);
+
+            entry.level     = header.level;
+            entry.timestamp = header.timestamp;
+
+            if (header.kind == ELogRecordKind::Text)
+            {
+                const char *chars = reinterpret_cast<const char *>(payload);
+                entry.source.assign(chars, header.sourceLength);
+                entry.text.assign(chars + header.sourceLength, header.dataLength);
+                entry.format = std::string_view();
+                entry.args.clear();
+                return;
+            }
+
+            VLogFormatRef format;
+            std::memcpy(&format, payload, sizeof(VLogFormatRef));
+            payload += sizeof(VLogFormatRef);
+            entry.source.assign(reinterpret_cast<const char *>(payload), header.sourceLength);
+            entry.format = std::string_view(format.data, format.size);
+            entry.args.assign(reinterpret_cast<const char *>(payload + header.sourceLength), header.dataLength);
+            Detail::FormatLogArgs(entry.text, entry.format, payload + header.sourceLength, header.dataLength);
+        }
+
+        void FormatLine(std::string &line, const VLogEntry &entry)
+        {
+            line.clear();
+            line.append("[").append(LogLevelToString(entry.level)).append("] [").append(entry.source).append("] ").append(entry.text);
+        }
+
+        class VLogger
+        {
+            public:
+                VLogger()
+                {
+                    m_ConsoleSink = std::make_shared<VConsoleLogSink>();
+                    m_MemorySink  = std::make_shared<VMemoryLogSink>();
+                    m_Sinks.push_back(m_ConsoleSink);
+                    m_Sinks.push_back(m_MemorySink);
+
+                    m_Running.store(true, std::memory_order_release);
+                    m_Thread = std::thread([this]() { Run(); });
+                    std::atexit([]() { ::VE::Internal::Core::Backlog::Shutdown(); });
+                }
+
+                bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+                bool IsLoggerThread() const { return std::this_thread::get_id() == m_ThreadId.load(std::memory_order_relaxed); }
+
+                std::shared_ptr<VThreadRing> CreateRing()
+                {
+                    auto ring      = std::make_shared<VThreadRing>();
+                    ring->threadId = m_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+                    std::lock_guard<std::mutex> lock(m_RingMutex);
+                    m_Rings.push_back(ring);
+                    return ring;
+                }
+
+                // Wakes the logger thread if it is idle, costs nothing while it is busy
+                void Wake(bool force = false)
+                {
+                    if (!force && !m_Sleeping.load(std::memory_order_relaxed)) return;
+                    {
+                        std::lock_guard<std::mutex> lock(m_WakeMutex);
+                        m_WakePending = true;
+                    }
+                    m_WakeCv.notify_one();
+                }
+
+                void Flush()
+                {
+                    if (!IsRunning() || IsLoggerThread()) return;
+
+                    const uint64_t ticket = m_FlushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+                    Wake(true);
+
+                    std::unique_lock<std::mutex> lock(m_WakeMutex);
+                    m_FlushCv.wait(lock, [&]() { return m_FlushCompleted >= ticket || !IsRunning(); });
+                }
+
+                void Shutdown()
+                {
+                    if (!m_Running.exchange(false, std::memory_order_acq_rel)) return;
+                    Wake(true);
+                    if (m_Thread.joinable()) m_Thread.join();
+
+                    // Pick up whatever raced with the shutdown, from now on Log() writes synchronously
+                    Drain();
+                    {
+                        std::lock_guard<std::mutex> lock(m_WakeMutex);
+                        m_FlushCompleted = m_FlushRequested.load(std::memory_order_acquire);
+                    }
+                    m_FlushCv.notify_all();
+                }
+
+                void WriteSynchronous(const VLogEntry &entry)
+                {
+                    std::lock_guard<std::mutex> lock(m_SinkMutex);
+                    FormatLine(m_SyncLine, entry);
+                    for (auto &sink : m_Sinks)
+                    {
+                        sink->Write(entry, m_SyncLine);
+                        sink->Flush();
+                    }
+                    m_Stats.recordsWritten.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void AddSink(std::shared_ptr<ILogSink> sink)
+                {
+                    std::lock_guard<std::mutex> lock(m_SinkMutex);
+                    m_Sinks.push_back(std::move(sink));
+                }
+
+                void RemoveSink(const std::shared_ptr<ILogSink> &sink)
+                {
+                    std::lock_guard<std::mutex> lock(m_SinkMutex);
+                    auto it = std::find(m_Sinks.begin(), m_Sinks.end(), sink);
+                    if (it != m_Sinks.end()) m_Sinks.erase(it);
+                }
+
+                std::shared_ptr<VConsoleLogSink> GetConsoleSink() const { return m_ConsoleSink; }
+                std::shared_ptr<VMemoryLogSink>  GetMemorySink() const { return m_MemorySink; }
+
+                VLoggerStats GetStats()
+                {
+                    VLoggerStats stats;
+                    stats.recordsWritten = m_Stats.recordsWritten.load(std::memory_order_relaxed);
+                    stats.producerStalls = m_Stats.producerStalls.load(std::memory_order_relaxed);
+                    stats.recordsDropped = m_Stats.recordsDropped.load(std::memory_order_relaxed);
+
+                    std::lock_guard<std::mutex> lock(m_RingMutex);
+                    stats.threadCount = static_cast<uint32_t>(m_Rings.size());
+                    return stats;
+                }
+
+                void CountStall() { m_Stats.producerStalls.fetch_add(1, std::memory_order_relaxed); }
+                void CountDrop() { m_Stats.recordsDropped.fetch_add(1, std::memory_order_relaxed); }
+
+            private:
+                void Run()
+                {
+                    m_ThreadId.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+                    while (true)
+                    {
+                        // Everything logged before a Flush() request is visible once the request is
+                        const uint64_t flushRequest = m_FlushRequested.load(std::memory_order_acquire);
+                        const bool     running      = IsRunning();
+                        const size_t   written      = Drain();
+
+                        {
+                            std::lock_guard<std::mutex> lock(m_WakeMutex);
+                            if (m_FlushCompleted < flushRequest) m_FlushCompleted = flushRequest;
+                        }
+                        m_FlushCv.notify_all();
+
+                        if (!running) break;
+                        if (written == 0)
+                        {
+                            std::unique_lock<std::mutex> lock(m_WakeMutex);
+                            m_Sleeping.store(true, std::memory_order_relaxed);
+                            m_WakeCv.wait_for(lock, IDLE_WAIT, [&]() { return m_WakePending; });
+                            m_WakePending = false;
+                            m_Sleeping.store(false, std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                // Moves all pending records of all rings to the sinks, returns the number of records
+                size_t Drain()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_RingMutex);
+                        m_DrainRings.clear();
+                        for (auto &ring : m_Rings)
+                        {
+                            m_DrainRings.push_back(ring);
+                        }
+                    }
+
+                    size_t count = 0;
+                    bool   dropRetired = false;
+                    for (auto &threadRing : m_DrainRings)
+                    {
+                        const bool retired = threadRing->retired.load(std::memory_order_acquire);
+
+                        size_t         payloadSize;
+                        const uint8_t *payload;
+                        for (size_t n = 0; n < MAX_RECORDS_PER_DRAIN && (payload = threadRing->ring.Peek(payloadSize)) != nullptr; ++n)
+                        {
+                            if (count == m_Batch.size()) m_Batch.emplace_back();
+                            VLogEntry &entry = m_Batch[count++];
+                            DecodeRecord(payload, entry);
+                            entry.threadId = threadRing->threadId;
+
+                            threadRing->ring.Pop();
+                        }
+
+                        dropRetired |= retired && threadRing->ring.IsEmpty();
+                    }
+
+                    if (dropRetired)
+                    {
+                        std::lock_guard<std::mutex> lock(m_RingMutex);
+                        for (size_t i = 0; i < m_Rings.size();)
+                        {
+                            if (m_Rings[i]->retired.load(std::memory_order_acquire) && m_Rings[i]->ring.IsEmpty())
+                            {
+                                m_Rings.erase(&m_Rings[i]);
+                            }
+                            else
+                            {
+                                ++i;
+                            }
+                        }
+                    }
+                    m_DrainRings.clear();
+
+                    if (count == 0) return 0;
+
+                    // Rings are per thread, merge them back into a single timeline
+                    m_Order.resize(count);
+                    for (uint32_t i = 0; i < count; ++i)
+                    {
+                        m_Order[i] = i;
+                    }
+                    std::stable_sort(m_Order.begin(), m_Order.end(), [this](uint32_t a, uint32_t b) { return m_Batch[a].timestamp < m_Batch[b].timestamp; });
+
+                    std::lock_guard<std::mutex> lock(m_SinkMutex);
+                    for (uint32_t index : m_Order)
+                    {
+                        FormatLine(m_Line, m_Batch[index]);
+                        for (auto &sink : m_Sinks)
+                        {
+                            sink->Write(m_Batch[index], m_Line);
+                        }
+                    }
+                    for (auto &sink : m_Sinks)
+                    {
+                        sink->Flush();
+                    }
+
+                    m_Stats.recordsWritten.fetch_add(count, std::memory_order_relaxed);
+                    return count;
+                }
 
-    std::mutex            logMutex;
-    VE::Internal::Core::Container::TVector<VLogEntry> logEntries;
+                using RingVector = VE::Internal::Core::Container::TVector<std::shared_ptr<VThreadRing>>;
 
-    // Convert ELogLevel to String
-    std::string ELogLevelToString(ELogLevel level)
+                std::mutex                      m_RingMutex; // ring registration only, never taken by Log() after a thread's first call
+                RingVector                      m_Rings;
+                std::atomic<uint32_t>           m_NextThreadId{1};
+
+                std::mutex                                                    m_SinkMutex;
+                VE::Internal::Core::Container::TVector<std::shared_ptr<ILogSink>> m_Sinks;
+                std::shared_ptr<VConsoleLogSink>                              m_ConsoleSink;
+                std::shared_ptr<VMemoryLogSink>                               m_MemorySink;
+
+                // Logger thread state, reused between passes so draining doesn't allocate in steady state
+                RingVector                                         m_DrainRings;
+                VMemoryLogSink::EntryVector                        m_Batch;
+                VE::Internal::Core::Container::TVector<uint32_t>   m_Order;
+                std::string                                        m_Line;
+                std::string                                        m_SyncLine;
+
+                std::thread                  m_Thread;
+                std::atomic<std::thread::id> m_ThreadId{};
+                std::atomic<bool>            m_Running{false};
+                std::atomic<bool>            m_Sleeping{false};
+                std::mutex                   m_WakeMutex;
+                std::condition_variable      m_WakeCv;
+                std::condition_variable      m_FlushCv;
+                bool                         m_WakePending = false;
+                std::atomic<uint64_t>        m_FlushRequested{0};
+                uint64_t                     m_FlushCompleted = 0;
+
+                struct
+                {
+                        std::atomic<uint64_t> recordsWritten{0};
+                        std::atomic<uint64_t> producerStalls{0};
+                        std::atomic<uint64_t> recordsDropped{0};
+                } m_Stats;
+        };
+
+        // Leaked on purpose, Log() has to keep working while other statics are destroyed
+        VLogger &GetLogger()
+        {
+            static VLogger *logger = new VLogger();
+            return *logger;
+        }
+
+        // Trivially destructible, so they stay usable while the thread tears down its thread_locals
+        thread_local VThreadRing *t_Ring         = nullptr;
+        thread_local bool         t_RingReleased = false;
+
+        struct VThreadRingOwner
+        {
+                std::shared_ptr<VThreadRing> ring;
+
+                ~VThreadRingOwner()
+                {
+                    if (ring) ring->retired.store(true, std::memory_order_release);
+                    t_Ring         = nullptr;
+                    t_RingReleased = true;
+                }
+        };
+
+        VThreadRing *AcquireRing(VLogger &logger)
+        {
+            if (t_Ring == nullptr && !t_RingReleased)
+            {
+                thread_local VThreadRingOwner owner;
+                owner.ring = logger.CreateRing();
+                t_Ring     = owner.ring.get();
+            }
+            return t_Ring;
+        }
+
+        // Record between BeginRecord() and CommitRecord() of this thread
+        thread_local VThreadRing *t_PendingRing     = nullptr;
+        thread_local uint8_t     *t_PendingSync     = nullptr;
+        thread_local uint32_t     t_PendingThreadId = 0;
+
+        // Room for a payloadSize record in the calling thread's ring. If the logger is stopped, the
+        // thread is exiting or the record is larger than a ring can hold, the record goes to the heap
+        // and CommitRecord() writes it synchronously. nullptr = drop the record.
+        uint8_t *BeginRecord(size_t payloadSize)
+        {
+            VLogger     &logger = GetLogger();
+            VThreadRing *ring   = logger.IsRunning() ? AcquireRing(logger) : nullptr;
+
+            if (ring != nullptr && payloadSize <= ring->ring.GetMaxPayload())
+            {
+                uint8_t *payload = ring->ring.Reserve(payloadSize);
+                if (payload == nullptr)
+                {
+                    if (logger.IsLoggerThread())
+                    {
+                        // Nobody else would ever make room
+                        logger.CountDrop();
+                        return nullptr;
+                    }
+
+                    logger.CountStall();
+                    while ((payload = ring->ring.Reserve(payloadSize)) == nullptr && logger.IsRunning())
+                    {
+                        logger.Wake(true);
+                        std::this_thread::yield();
+                    }
+                }
+
+                if (payload != nullptr)
+                {
+                    t_PendingRing = ring;
+                    return payload;
+                }
+            }
+
+            t_PendingSync     = new uint8_t[payloadSize];
+            t_PendingThreadId = ring != nullptr ? ring->threadId : 0;
+            return t_PendingSync;
+        }
+
+        void CommitRecord()
+        {
+            VLogger &logger = GetLogger();
+            if (t_PendingRing != nullptr)
+            {
+                t_PendingRing->ring.Commit();
+                t_PendingRing = nullptr;
+                logger.Wake();
+                return;
+            }
+
+            VLogEntry entry;
+            DecodeRecord(t_PendingSync, entry);
+            entry.threadId = t_PendingThreadId;
+            logger.WriteSynchronous(entry);
+
+            delete[] t_PendingSync;
+            t_PendingSync = nullptr;
+        }
+
+        void WriteRecordHeader(uint8_t *payload, ELogLevel level, ELogRecordKind kind, size_t sourceLength, size_t dataLength)
+        {
+            const VLogRecordHeader header{Now(), static_cast<uint32_t>(dataLength), static_cast<uint16_t>(sourceLength), level, kind};
+            std::memcpy(payload, &header, sizeof(VLogRecordHeader));
+        }
+
+        // Appends the argument at arg to out, returns the next argument
+        const uint8_t *AppendLogArg(std::string &out, const uint8_t *arg, const uint8_t *end)
+        {
+            if (arg >= end)
+            {
+                out.append("{?}");
+                return arg;
+            }
+
+            const ELogArgType type = static_cast<ELogArgType>(*arg++);
+            char              buffer[32];
+            std::to_chars_result result{buffer, std::errc()};
+
+            switch (type)
+            {
+                case ELogArgType::Bool:
+                    out.append(*arg != 0 ? "true" : "false");
+                    return arg + 1;
+                case ELogArgType::Char:
+                    out.push_back(static_cast<char>(*arg));
+                    return arg + 1;
+                case ELogArgType::String:
+                {
+                    uint32_t length;
+                    std::memcpy(&length, arg, sizeof(uint32_t));
+                    out.append(reinterpret_cast<const char *>(arg + sizeof(uint32_t)), length);
+                    return arg + sizeof(uint32_t) + length;
+                }
+                case ELogArgType::Int64:
+                {
+                    int64_t value;
+                    std::memcpy(&value, arg, 8);
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                    break;
+                }
+                case ELogArgType::UInt64:
+                {
+                    uint64_t value;
+                    std::memcpy(&value, arg, 8);
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                    break;
+                }
+                case ELogArgType::Double:
+                {
+                    double value;
+                    std::memcpy(&value, arg, 8);
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                    break;
+                }
+                case ELogArgType::Float:
+                {
+                    float value;
+                    std::memcpy(&value, arg, 4);
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                    out.append(buffer, result.ptr);
+                    return arg + 4;
+                }
+                case ELogArgType::Pointer:
+                {
+                    uint64_t value;
+                    std::memcpy(&value, arg, 8);
+                    out.append("0x");
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value, 16);
+                    break;
+                }
+                default:
+                    out.append("{?}");
+                    return end;
+            }
+
+            out.append(buffer, result.ptr);
+            return arg + 8;
+        }
+    } // namespace
+
+    namespace Detail
+    {
+        uint8_t *BeginFormattedRecord(ELogLevel level, std::string_view source, std::string_view fmt, size_t argBytes)
+        {
+            source = source.substr(0, std::min<size_t>(source.size(), UINT16_MAX));
+
+            uint8_t *payload = BeginRecord(sizeof(VLogRecordHeader) + sizeof(VLogFormatRef) + source.size() + argBytes);
+            if (payload == nullptr) return nullptr;
+
+            const VLogFormatRef format{fmt.data(), fmt.size()};
+            WriteRecordHeader(payload, level, ELogRecordKind::Formatted, source.size(), argBytes);
+            payload += sizeof(VLogRecordHeader);
+            std::memcpy(payload, &format, sizeof(VLogFormatRef));
+            payload += sizeof(VLogFormatRef);
+            std::memcpy(payload, source.data(), source.size());
+            return payload + source.size();
+        }
+
+        void CommitFormattedRecord() { CommitRecord(); }
+
+        void FormatLogArgs(std::string &out, std::string_view fmt, const uint8_t *args, size_t argBytes)
+        {
+            out.clear();
+            const uint8_t *end = args + argBytes;
+            for (size_t i = 0; i < fmt.size(); ++i)
+            {
+                const char next = i + 1 < fmt.size() ? fmt[i + 1] : '\0';
+                if (fmt[i] == '{' && next == '}')
+                {
+                    args = AppendLogArg(out, args, end);
+                    ++i;
+                }
+                else
+                {
+                    // "{{" and "}}" are escaped braces, the format was validated at compile time
+                    out.push_back(fmt[i]);
+                    if ((fmt[i] == '{' || fmt[i] == '}') && next == fmt[i]) ++i;
+                }
+            }
+        }
+    } // namespace Detail
+
+    const char *LogLevelToString(ELogLevel level)
     {
         switch (level)
         {
@@ -34,35 +589,31 @@ namespace VE::Internal::Core::Backlog
     }
 
     // Logging function
-    void Log(const std::string &source, const std::string &msg, ELogLevel level)
+    void Log(std::string_view source, std::string_view msg, ELogLevel level)
     {
-        std::lock_guard<std::mutex> lock(logMutex);
+        source = source.substr(0, std::min<size_t>(source.size(), UINT16_MAX));
 
-        VLogEntry entry = {source, msg, level};
-        logEntries.push_back(entry);
+        uint8_t *payload = BeginRecord(sizeof(VLogRecordHeader) + source.size() + msg.size());
+        if (payload == nullptr) return;
 
-        // Print to console
-        std::cout << "[" << ELogLevelToString(level) << "] [" << source << "] " << msg << std::endl;
+        WriteRecordHeader(payload, level, ELogRecordKind::Text, source.size(), msg.size());
+        std::memcpy(payload + sizeof(VLogRecordHeader), source.data(), source.size());
+        std::memcpy(payload + sizeof(VLogRecordHeader) + source.size(), msg.data(), msg.size());
+        CommitRecord();
     }
 
-    // // Save Logs to File
-    // // TODO_PLATFORM_SWITCH: Get it working with Nintendo Switch File Saving
-    // void SaveLogs(const std::string &filename)
-    // {
-    //     std::lock_guard<std::mutex> lock(logMutex);
-    //     std::ofstream               logFile(filename, std::ios::app);
-
-    //     if (!logFile)
-    //     {
-    //         Log("Backlog", "Failed to open log file", ELogLevel::ERR);
-    //         return;
-    //     }
-
-    //     for (const auto &entry : logEntries)
-    //     {
-    //         logFile << "[" << ELogLevelToString(entry.level) << "::" << entry.source << "] " << entry.text << std::endl;
-    //     }
-    //     logFile.close();
-    // }
-
-} // namespace VE::Internal::Backlog
\ No newline at end of file
+    void Flush() { GetLogger().Flush(); }
+    void Shutdown() { GetLogger().Shutdown(); }
+
+    void AddSink(std::shared_ptr<ILogSink> sink)
+    {
+        if (sink) GetLogger().AddSink(std::move(sink));
+    }
+    void RemoveSink(const std::shared_ptr<ILogSink> &sink) { GetLogger().RemoveSink(sink); }
+
+    std::shared_ptr<VConsoleLogSink> GetConsoleSink() { return GetLogger().GetConsoleSink(); }
+    std::shared_ptr<VMemoryLogSink>  GetMemorySink() { return GetLogger().GetMemorySink(); }
+
+    VLoggerStats GetLoggerStats() { return GetLogger().GetStats(); }
+
+} // namespace VE::Internal::Core::Backlog
@@ -0,0 +1,707 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/BackLog/VCO_BinaryLog.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace VE::Internal::Core::Backlog
+{
+    namespace
+    {
+        constexpr size_t MAX_BUFFERED_BYTES = 1024 * 1024; // written before the next Flush() if a batch gets this large
+
+        using ByteVector = VE::Internal::Core::Container::TVector<uint8_t>;
+
+        inline uint64_t ZigZagEncode(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+        inline int64_t  ZigZagDecode(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+        inline void PutByte(ByteVector &out, uint8_t value) { out.push_back(value); }
+
+        inline void PutBytes(ByteVector &out, const void *data, size_t size)
+        {
+            const size_t offset = out.size();
+            out.resize(offset + size);
+            if (size != 0) std::memcpy(out.data() + offset, data, size);
+        }
+
+        inline void PutVarint(ByteVector &out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        inline void PutString(ByteVector &out, std::string_view str)
+        {
+            PutVarint(out, str.size());
+            PutBytes(out, str.data(), str.size());
+        }
+
+        // Same as PutVarint(), for table keys
+        inline void AppendVarint(std::string &out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(static_cast<char>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<char>(value));
+        }
+
+        inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+        // Appends the template of str to key, every literal piece as varint length + characters, and the
+        // numbers between the pieces to numbers. Runs of up to 19 digits without a leading zero are
+        // numbers (they fit a uint64_t and print back the same), everything else is literal text.
+        void AppendStringTemplate(std::string &key, VE::Internal::Core::Container::TVector<uint64_t> &numbers, std::string_view str)
+        {
+            size_t pieceStart = 0;
+            for (size_t i = 0; i < str.size();)
+            {
+                if (!IsDigit(str[i]))
+                {
+                    ++i;
+                    continue;
+                }
+
+                size_t end = i;
+                while (end < str.size() && IsDigit(str[end]))
+                {
+                    ++end;
+                }
+                if (end - i <= 19 && (end - i == 1 || str[i] != '0'))
+                {
+                    uint64_t value = 0;
+                    std::from_chars(str.data() + i, str.data() + end, value);
+                    numbers.push_back(value);
+
+                    AppendVarint(key, i - pieceStart);
+                    key.append(str.substr(pieceStart, i - pieceStart));
+                    pieceStart = end;
+                }
+                i = end;
+            }
+            AppendVarint(key, str.size() - pieceStart);
+            key.append(str.substr(pieceStart));
+        }
+
+        // Next argument in the ring encoding, the arguments were written by EncodeLogArg() and are well formed
+        const uint8_t *SkipLogArg(const uint8_t *arg, const uint8_t *end)
+        {
+            switch (static_cast<ELogArgType>(*arg))
+            {
+                case ELogArgType::Bool:
+                case ELogArgType::Char:
+                    return arg + 2;
+                case ELogArgType::String:
+                {
+                    uint32_t length;
+                    std::memcpy(&length, arg + 1, sizeof(uint32_t));
+                    return arg + 1 + sizeof(uint32_t) + length;
+                }
+                case ELogArgType::Int64:
+                case ELogArgType::UInt64:
+                case ELogArgType::Double:
+                case ELogArgType::Pointer:
+                    return arg + 9;
+                case ELogArgType::Float:
+                    return arg + 5;
+            }
+            return end;
+        }
+
+        // Characters of the String argument at arg
+        std::string_view GetLogArgString(const uint8_t *arg)
+        {
+            uint32_t length;
+            std::memcpy(&length, arg + 1, sizeof(uint32_t));
+            return std::string_view(reinterpret_cast<const char *>(arg + 1 + sizeof(uint32_t)), length);
+        }
+
+        uint64_t SteadyNow() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+        uint64_t SystemNow() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()); }
+    } // namespace
+
+    // ----------------- VBinaryLogSink -----------------
+
+    bool AddBinaryLogSinkFromEnvironment()
+    {
+        const char *path = std::getenv("VANTOR_LOG_BINARY");
+        if (path == nullptr || path[0] == '\0') return false;
+
+        auto sink = std::make_shared<VBinaryLogSink>(path);
+        if (!sink->IsOpen())
+        {
+            VE_LOG(WARNING, "Backlog", "Could not open the binary log {} (VANTOR_LOG_BINARY)", path);
+            return false;
+        }
+
+        AddSink(sink);
+        VE_LOG(INFO, "Backlog", "Writing a binary log to {}", path);
+        return true;
+    }
+
+    VBinaryLogSink::VBinaryLogSink(const std::string &path, size_t syncInterval, uint32_t tickNs)
+        : m_SyncInterval(std::max<size_t>(syncInterval, 256)), m_TickNs(std::max<uint32_t>(tickNs, 1))
+    {
+        m_File.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!m_File.is_open()) return;
+
+        VBinaryLogFileHeader header{};
+        std::memcpy(header.magic, BINARY_LOG_MAGIC, sizeof(header.magic));
+        header.version    = BINARY_LOG_VERSION;
+        header.tickNs     = m_TickNs;
+        header.systemTime = SystemNow();
+        header.steadyTime = SteadyNow();
+        PutBytes(m_Buffer, &header, sizeof(header));
+        Flush();
+    }
+
+    VBinaryLogSink::~VBinaryLogSink() { Flush(); }
+
+    void VBinaryLogSink::Write(const VLogEntry &entry, std::string_view line)
+    {
+        if (!m_File.is_open()) return;
+
+        const uint64_t tick = entry.timestamp / m_TickNs;
+        if (m_NeedsSync || GetBytesWritten() - m_BlockStart >= m_SyncInterval) WriteSync(tick);
+
+        // Definitions go to m_Buffer as they come up, the record itself is collected in m_Record and follows them
+        m_Record.clear();
+        const uint32_t sourceId = InternSource(entry.source);
+        uint32_t       formatId = 0;
+
+        if (entry.format.empty() && entry.args.empty())
+        {
+            EncodeString(entry.text);
+        }
+        else
+        {
+            const uint8_t *begin = reinterpret_cast<const uint8_t *>(entry.args.data());
+            const uint8_t *end   = begin + entry.args.size();
+
+            // The argument types are stored once with the format string
+            m_Types.clear();
+            for (const uint8_t *arg = begin; arg < end; arg = SkipLogArg(arg, end))
+            {
+                m_Types.push_back(static_cast<char>(*arg));
+            }
+            formatId = InternFormat(entry.format, m_Types) + 1;
+
+            // Re-encode the ring arguments (VCO_Log.hpp) without their type tags
+            for (const uint8_t *arg = begin; arg < end;)
+            {
+                const ELogArgType type = static_cast<ELogArgType>(*arg++);
+                switch (type)
+                {
+                    case ELogArgType::Bool:
+                    case ELogArgType::Char:
+                        PutByte(m_Record, *arg++);
+                        break;
+                    case ELogArgType::Int64:
+                    {
+                        int64_t value;
+                        std::memcpy(&value, arg, 8);
+                        PutVarint(m_Record, ZigZagEncode(value));
+                        arg += 8;
+                        break;
+                    }
+                    case ELogArgType::UInt64:
+                    case ELogArgType::Pointer:
+                    {
+                        uint64_t value;
+                        std::memcpy(&value, arg, 8);
+                        PutVarint(m_Record, value);
+                        arg += 8;
+                        break;
+                    }
+                    case ELogArgType::Double:
+                        PutBytes(m_Record, arg, 8);
+                        arg += 8;
+                        break;
+                    case ELogArgType::Float:
+                        PutBytes(m_Record, arg, 4);
+                        arg += 4;
+                        break;
+                    case ELogArgType::String:
+                    {
+                        const std::string_view str = GetLogArgString(arg - 1);
+                        EncodeString(str);
+                        arg += sizeof(uint32_t) + str.size();
+                        break;
+                    }
+                    default:
+                        arg = end;
+                        break;
+                }
+            }
+        }
+
+        const uint32_t siteId = InternSite(entry.level, sourceId, formatId);
+        if (m_NeedsThread || entry.threadId != m_LastThread)
+        {
+            PutByte(m_Buffer, static_cast<uint8_t>(EBinaryLogTag::Thread));
+            PutVarint(m_Buffer, entry.threadId);
+            m_LastThread  = entry.threadId;
+            m_NeedsThread = false;
+        }
+
+        PutVarint(m_Buffer, siteId + BINARY_LOG_FIRST_SITE);
+        PutVarint(m_Buffer, ZigZagEncode(static_cast<int64_t>(tick - m_LastTick)));
+        PutBytes(m_Buffer, m_Record.data(), m_Record.size());
+        m_LastTick = tick;
+        m_TextBytes += line.size() + 1;
+
+        if (m_Buffer.size() >= MAX_BUFFERED_BYTES) Flush();
+    }
+
+    void VBinaryLogSink::Flush()
+    {
+        if (!m_File.is_open() || m_Buffer.empty()) return;
+
+        m_File.write(reinterpret_cast<const char *>(m_Buffer.data()), static_cast<std::streamsize>(m_Buffer.size()));
+        m_File.flush();
+        m_BytesWritten += m_Buffer.size();
+        m_Buffer.clear();
+    }
+
+    uint32_t VBinaryLogSink::InternSource(std::string_view source)
+    {
+        auto [it, inserted] = m_Sources.try_emplace(source, static_cast<uint32_t>(m_Sources.size()));
+        if (inserted)
+        {
+            PutByte(m_Buffer, static_cast<uint8_t>(EBinaryLogTag::Source));
+            PutVarint(m_Buffer, it->second);
+            PutString(m_Buffer, source);
+        }
+        return it->second;
+    }
+
+    uint32_t VBinaryLogSink::InternFormat(std::string_view format, std::string_view types)
+    {
+        // The same format string may be logged with different argument types
+        m_Key.clear();
+        AppendVarint(m_Key, types.size());
+        m_Key.append(types).append(format);
+
+        auto [it, inserted] = m_Formats.try_emplace(m_Key, static_cast<uint32_t>(m_Formats.size()));
+        if (inserted)
+        {
+            PutByte(m_Buffer, static_cast<uint8_t>(EBinaryLogTag::Format));
+            PutVarint(m_Buffer, it->second);
+            PutString(m_Buffer, format);
+            PutString(m_Buffer, types);
+        }
+        return it->second;
+    }
+
+    uint32_t VBinaryLogSink::InternTemplate(std::string_view key, size_t pieceCount)
+    {
+        auto [it, inserted] = m_Templates.try_emplace(key, UNDEFINED_TEMPLATE);
+        if (it->second == UNDEFINED_TEMPLATE)
+        {
+            it->second = m_TemplateCount++;
+            PutByte(m_Buffer, static_cast<uint8_t>(EBinaryLogTag::Template));
+            PutVarint(m_Buffer, it->second);
+            PutVarint(m_Buffer, pieceCount);
+            PutBytes(m_Buffer, key.data(), key.size()); // the key already is the pieces' encoding
+        }
+        return it->second;
+    }
+
+    uint32_t VBinaryLogSink::InternSite(ELogLevel level, uint32_t sourceId, uint32_t formatId)
+    {
+        // Tables are reset every block, so the ids stay far below 2^24
+        const uint64_t key = (static_cast<uint64_t>(formatId) << 32) | (static_cast<uint64_t>(sourceId) << 8) | static_cast<uint8_t>(level);
+
+        auto [it, inserted] = m_Sites.try_emplace(key, static_cast<uint32_t>(m_Sites.size()));
+        if (inserted)
+        {
+            PutByte(m_Buffer, static_cast<uint8_t>(EBinaryLogTag::Site));
+            PutVarint(m_Buffer, it->second);
+            PutByte(m_Buffer, static_cast<uint8_t>(level));
+            PutVarint(m_Buffer, sourceId);
+            PutVarint(m_Buffer, formatId);
+        }
+        return it->second;
+    }
+
+    void VBinaryLogSink::EncodeString(std::string_view str)
+    {
+        const size_t firstNumber = m_Numbers.size();
+        m_Key.clear();
+        AppendStringTemplate(m_Key, m_Numbers, str);
+
+        const auto   known     = m_Templates.find(m_Key);
+        const size_t separator = str.find_last_of("/\\");
+        if (known != m_Templates.end() && known->second != UNDEFINED_TEMPLATE)
+        {
+            PutVarint(m_Record, static_cast<uint64_t>(known->second) << 1);
+        }
+        else if (separator == std::string_view::npos || known != m_Templates.end())
+        {
+            // Paths get an id of their own the second time their template comes up
+            PutVarint(m_Record, static_cast<uint64_t>(InternTemplate(m_Key, m_Numbers.size() - firstNumber + 1)) << 1);
+        }
+        else
+        {
+            // First time: a directory and a file name template, files in the same directory share the first one
+            m_Templates.try_emplace(m_Key, UNDEFINED_TEMPLATE);
+            m_Numbers.resize(firstNumber);
+
+            m_Key.clear();
+            AppendStringTemplate(m_Key, m_Numbers, str.substr(0, separator + 1));
+            const uint32_t directoryId = InternTemplate(m_Key, m_Numbers.size() - firstNumber + 1);
+
+            const size_t nameNumber = m_Numbers.size();
+            m_Key.clear();
+            AppendStringTemplate(m_Key, m_Numbers, str.substr(separator + 1));
+            const uint32_t nameId = InternTemplate(m_Key, m_Numbers.size() - nameNumber + 1);
+
+            PutVarint(m_Record, (static_cast<uint64_t>(nameId) << 1) | 1);
+            PutVarint(m_Record, directoryId);
+        }
+
+        for (size_t i = firstNumber; i < m_Numbers.size(); ++i)
+        {
+            PutVarint(m_Record, m_Numbers[i]);
+        }
+        m_Numbers.resize(firstNumber);
+    }
+
+    void VBinaryLogSink::WriteSync(uint64_t tick)
+    {
+        m_BlockStart = GetBytesWritten();
+        PutBytes(m_Buffer, BINARY_LOG_SYNC, sizeof(BINARY_LOG_SYNC));
+        PutVarint(m_Buffer, tick);
+
+        m_Sources.clear();
+        m_Formats.clear();
+        m_Templates.clear();
+        m_Sites.clear();
+        m_TemplateCount = 0;
+        m_LastTick      = tick;
+        m_NeedsSync     = false;
+        m_NeedsThread   = true;
+    }
+
+    // ----------------- VBinaryLogReader -----------------
+
+    struct VBinaryLogReader::VByteReader
+    {
+            const uint8_t *cursor;
+            const uint8_t *end;
+
+            bool Byte(uint8_t &value)
+            {
+                if (cursor >= end) return false;
+                value = *cursor++;
+                return true;
+            }
+
+            bool Varint(uint64_t &value)
+            {
+                value = 0;
+                for (uint32_t shift = 0; shift < 64; shift += 7)
+                {
+                    uint8_t byte;
+                    if (!Byte(byte)) return false;
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) return true;
+                }
+                return false;
+            }
+
+            bool Bytes(size_t size, const uint8_t *&data)
+            {
+                if (static_cast<size_t>(end - cursor) < size) return false;
+                data = cursor;
+                cursor += size;
+                return true;
+            }
+
+            bool String(std::string_view &str)
+            {
+                uint64_t       length;
+                const uint8_t *data;
+                if (!Varint(length) || length > static_cast<uint64_t>(end - cursor) || !Bytes(static_cast<size_t>(length), data)) return false;
+                str = std::string_view(reinterpret_cast<const char *>(data), static_cast<size_t>(length));
+                return true;
+            }
+    };
+
+    bool VBinaryLogReader::Open(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        const std::streamoff size = file.tellg();
+        if (size < static_cast<std::streamoff>(sizeof(VBinaryLogFileHeader))) return false;
+
+        m_Data.resize(static_cast<size_t>(size));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char *>(m_Data.data()), size)) return false;
+
+        std::memcpy(&m_Header, m_Data.data(), sizeof(VBinaryLogFileHeader));
+        if (std::memcmp(m_Header.magic, BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC)) != 0 || m_Header.version != BINARY_LOG_VERSION || m_Header.tickNs == 0) return false;
+
+        m_Offset  = sizeof(VBinaryLogFileHeader);
+        m_InBlock = false;
+        m_Stats   = VBinaryLogReaderStats();
+        return true;
+    }
+
+    bool VBinaryLogReader::Next(VLogEntry &entry)
+    {
+        while (m_Offset < m_Data.size())
+        {
+            const uint8_t *start    = m_Data.data() + m_Offset;
+            const uint8_t *cursor   = start;
+            bool           produced = false;
+
+            if (!ReadRecord(cursor, entry, produced))
+            {
+                // Corrupted or truncated, the block is lost up to the next sync marker
+                SkipToSync(start + 1);
+                m_Stats.skippedBytes += static_cast<uint64_t>(m_Data.data() + m_Offset - start);
+                continue;
+            }
+
+            m_Offset = static_cast<size_t>(cursor - m_Data.data());
+            if (produced)
+            {
+                m_Stats.records++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool VBinaryLogReader::ReadRecord(const uint8_t *&cursor, VLogEntry &entry, bool &produced)
+    {
+        VByteReader reader{cursor, m_Data.data() + m_Data.size()};
+
+        if (static_cast<size_t>(reader.end - reader.cursor) >= sizeof(BINARY_LOG_SYNC) && std::memcmp(reader.cursor, BINARY_LOG_SYNC, sizeof(BINARY_LOG_SYNC)) == 0)
+        {
+            reader.cursor += sizeof(BINARY_LOG_SYNC);
+            if (!reader.Varint(m_LastTick)) return false;
+
+            m_Sources.clear();
+            m_Formats.clear();
+            m_Pieces.clear();
+            m_Templates.clear();
+            m_Sites.clear();
+            m_ThreadId = 0;
+            m_InBlock  = true;
+            m_Stats.syncMarkers++;
+            cursor = reader.cursor;
+            return true;
+        }
+
+        // Nothing before the first sync marker of a block can be resolved
+        if (!m_InBlock || reader.cursor >= reader.end) return false;
+
+        if (*reader.cursor < BINARY_LOG_FIRST_SITE)
+        {
+            if (!ReadDefinition(static_cast<EBinaryLogTag>(*reader.cursor++), reader)) return false;
+            cursor = reader.cursor;
+            return true;
+        }
+
+        uint64_t site, delta;
+        if (!reader.Varint(site) || site - BINARY_LOG_FIRST_SITE >= m_Sites.size() || !reader.Varint(delta)) return false;
+        const VSite &record = m_Sites[site - BINARY_LOG_FIRST_SITE];
+
+        m_LastTick += static_cast<uint64_t>(ZigZagDecode(delta));
+        entry.level     = record.level;
+        entry.threadId  = m_ThreadId;
+        entry.timestamp = m_LastTick * m_Header.tickNs;
+        entry.source.assign(m_Sources[record.sourceId]);
+        entry.args.clear();
+
+        if (record.formatId == 0)
+        {
+            entry.format = std::string_view();
+            if (!ReadString(reader, entry.text)) return false;
+        }
+        else
+        {
+            // Back to the ring encoding, so the text is formatted exactly like the live log
+            const VFormat &format = m_Formats[record.formatId - 1];
+            entry.format          = format.text;
+            for (const char type : format.types)
+            {
+                entry.args.push_back(type);
+                switch (static_cast<ELogArgType>(type))
+                {
+                    case ELogArgType::Bool:
+                    case ELogArgType::Char:
+                    {
+                        uint8_t value;
+                        if (!reader.Byte(value)) return false;
+                        entry.args.push_back(static_cast<char>(value));
+                        break;
+                    }
+                    case ELogArgType::Int64:
+                    {
+                        uint64_t encoded;
+                        if (!reader.Varint(encoded)) return false;
+                        const int64_t value = ZigZagDecode(encoded);
+                        entry.args.append(reinterpret_cast<const char *>(&value), 8);
+                        break;
+                    }
+                    case ELogArgType::UInt64:
+                    case ELogArgType::Pointer:
+                    {
+                        uint64_t value;
+                        if (!reader.Varint(value)) return false;
+                        entry.args.append(reinterpret_cast<const char *>(&value), 8);
+                        break;
+                    }
+                    case ELogArgType::Double:
+                    case ELogArgType::Float:
+                    {
+                        const size_t   size = static_cast<ELogArgType>(type) == ELogArgType::Double ? 8 : 4;
+                        const uint8_t *value;
+                        if (!reader.Bytes(size, value)) return false;
+                        entry.args.append(reinterpret_cast<const char *>(value), size);
+                        break;
+                    }
+                    case ELogArgType::String:
+                    {
+                        if (!ReadString(reader, m_String)) return false;
+                        const uint32_t length = static_cast<uint32_t>(m_String.size());
+                        entry.args.append(reinterpret_cast<const char *>(&length), sizeof(uint32_t));
+                        entry.args.append(m_String);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+
+            Detail::FormatLogArgs(entry.text, entry.format, reinterpret_cast<const uint8_t *>(entry.args.data()), entry.args.size());
+        }
+
+        produced = true;
+        cursor   = reader.cursor;
+        return true;
+    }
+
+    bool VBinaryLogReader::ReadDefinition(EBinaryLogTag tag, VByteReader &reader)
+    {
+        uint64_t id = 0;
+        if (tag != EBinaryLogTag::Thread && !reader.Varint(id)) return false;
+
+        switch (tag)
+        {
+            case EBinaryLogTag::Source:
+            {
+                std::string_view source;
+                if (id != m_Sources.size() || !reader.String(source)) return false;
+                m_Sources.push_back(source);
+                return true;
+            }
+            case EBinaryLogTag::Format:
+            {
+                VFormat format;
+                if (id != m_Formats.size() || !reader.String(format.text) || !reader.String(format.types)) return false;
+                for (const char type : format.types)
+                {
+                    if (static_cast<uint8_t>(type) > static_cast<uint8_t>(ELogArgType::Float)) return false;
+                }
+                m_Formats.push_back(format);
+                return true;
+            }
+            case EBinaryLogTag::Template:
+            {
+                uint64_t pieceCount;
+                // Every piece takes at least its length byte
+                if (id != m_Templates.size() || !reader.Varint(pieceCount) || pieceCount == 0 || pieceCount > static_cast<uint64_t>(reader.end - reader.cursor)) return false;
+
+                const VTemplate strTemplate{static_cast<uint32_t>(m_Pieces.size()), static_cast<uint32_t>(pieceCount)};
+                for (uint64_t i = 0; i < pieceCount; ++i)
+                {
+                    std::string_view piece;
+                    if (!reader.String(piece)) return false;
+                    m_Pieces.push_back(piece);
+                }
+                m_Templates.push_back(strTemplate);
+                return true;
+            }
+            case EBinaryLogTag::Site:
+            {
+                uint8_t  level;
+                uint64_t sourceId, formatId;
+                if (id != m_Sites.size() || !reader.Byte(level) || !reader.Varint(sourceId) || !reader.Varint(formatId)) return false;
+                if (level > static_cast<uint8_t>(ELogLevel::ERR) || sourceId >= m_Sources.size() || formatId > m_Formats.size()) return false;
+                m_Sites.push_back(VSite{static_cast<ELogLevel>(level), static_cast<uint32_t>(sourceId), static_cast<uint32_t>(formatId)});
+                return true;
+            }
+            case EBinaryLogTag::Thread:
+            {
+                uint64_t threadId;
+                if (!reader.Varint(threadId)) return false;
+                m_ThreadId = static_cast<uint32_t>(threadId);
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool VBinaryLogReader::ReadString(VByteReader &reader, std::string &out)
+    {
+        out.clear();
+        uint64_t value;
+        if (!reader.Varint(value)) return false;
+        if ((value & 1) == 0) return AppendTemplate(reader, value >> 1, out);
+
+        uint64_t directoryId;
+        return reader.Varint(directoryId) && AppendTemplate(reader, directoryId, out) && AppendTemplate(reader, value >> 1, out);
+    }
+
+    bool VBinaryLogReader::AppendTemplate(VByteReader &reader, uint64_t templateId, std::string &out)
+    {
+        if (templateId >= m_Templates.size()) return false;
+
+        const VTemplate &strTemplate = m_Templates[templateId];
+        for (uint32_t i = 0; i < strTemplate.pieceCount; ++i)
+        {
+            out.append(m_Pieces[strTemplate.firstPiece + i]);
+            if (i + 1 == strTemplate.pieceCount) break;
+
+            // A number goes between every two pieces
+            uint64_t number;
+            if (!reader.Varint(number)) return false;
+            char                       digits[24];
+            const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), number);
+            out.append(digits, result.ptr);
+        }
+        return true;
+    }
+
+    void VBinaryLogReader::SkipToSync(const uint8_t *from)
+    {
+        const uint8_t *end = m_Data.data() + m_Data.size();
+        const uint8_t *it  = std::search(from, end, std::begin(BINARY_LOG_SYNC), std::end(BINARY_LOG_SYNC));
+        m_Offset           = static_cast<size_t>(it - m_Data.data());
+        m_InBlock          = false;
+    }
+} // namespace VE::Internal::Core::Backlog
\ No newline at end of file
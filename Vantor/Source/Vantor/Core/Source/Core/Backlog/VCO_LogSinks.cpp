@@ -0,0 +1,148 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/BackLog/VCO_LogSinks.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+namespace VE::Internal::Core::Backlog
+{
+    // ----------------- VConsoleLogSink -----------------
+
+    void VConsoleLogSink::Write(const VLogEntry &, std::string_view line)
+    {
+        std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+        std::cout.put('\n');
+    }
+
+    void VConsoleLogSink::Flush() { std::cout.flush(); }
+
+    // ----------------- VFileLogSink -----------------
+
+    VFileLogSink::VFileLogSink(const std::string &path, size_t maxBytes) : m_Path(path), m_MaxBytes(maxBytes)
+    {
+        m_File.open(m_Path, std::ios::out | std::ios::app);
+        if (m_File.is_open())
+        {
+            m_File.seekp(0, std::ios::end);
+            m_Written = static_cast<size_t>(std::max<std::streamoff>(m_File.tellp(), 0));
+        }
+    }
+
+    void VFileLogSink::Write(const VLogEntry &, std::string_view line)
+    {
+        if (!m_File.is_open()) return;
+
+        m_File.write(line.data(), static_cast<std::streamsize>(line.size()));
+        m_File.put('\n');
+        m_Written += line.size() + 1;
+
+        if (m_MaxBytes != 0 && m_Written >= m_MaxBytes) Rotate();
+    }
+
+    void VFileLogSink::Flush()
+    {
+        if (m_File.is_open()) m_File.flush();
+    }
+
+    void VFileLogSink::Rotate()
+    {
+        m_File.close();
+        const std::string backup = m_Path + ".1";
+        std::remove(backup.c_str());
+        std::rename(m_Path.c_str(), backup.c_str());
+        m_File.open(m_Path, std::ios::out | std::ios::trunc);
+        m_Written = 0;
+    }
+
+    // ----------------- VMemoryLogSink -----------------
+
+    VMemoryLogSink::VMemoryLogSink(size_t capacity) : m_Capacity(std::max<size_t>(capacity, 1)) { m_Entries.reserve(m_Capacity); }
+
+    void VMemoryLogSink::Write(const VLogEntry &entry, std::string_view)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        VLogEntry *slot;
+        if (m_Entries.size() < m_Capacity)
+        {
+            slot = &m_Entries.emplace_back();
+        }
+        else
+        {
+            // Overwrite the oldest entry, reusing its string buffers
+            slot    = &m_Entries[m_First];
+            m_First = (m_First + 1) % m_Entries.size();
+            m_Evicted++;
+        }
+
+        // The binary arguments are left out, text is all the panel needs
+        slot->source.assign(entry.source);
+        slot->text.assign(entry.text);
+        slot->level     = entry.level;
+        slot->timestamp = entry.timestamp;
+        slot->threadId  = entry.threadId;
+        slot->format    = entry.format;
+    }
+
+    VMemoryLogSink::EntryVector VMemoryLogSink::Snapshot() const
+    {
+        EntryVector result;
+        ForEach([&result](const VLogEntry &entry) { result.push_back(entry); });
+        return result;
+    }
+
+    void VMemoryLogSink::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Entries.clear();
+        m_First = 0;
+    }
+
+    void VMemoryLogSink::SetCapacity(size_t capacity)
+    {
+        capacity = std::max<size_t>(capacity, 1);
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Linearize oldest to newest and keep the newest entries that fit
+        EntryVector  ordered;
+        const size_t keep = std::min(capacity, m_Entries.size());
+        ordered.reserve(capacity);
+        for (size_t i = m_Entries.size() - keep; i < m_Entries.size(); ++i)
+        {
+            ordered.push_back(std::move(m_Entries[(m_First + i) % m_Entries.size()]));
+        }
+        m_Evicted += m_Entries.size() - keep;
+
+        m_Entries  = std::move(ordered);
+        m_First    = 0;
+        m_Capacity = capacity;
+    }
+
+    size_t VMemoryLogSink::GetCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Capacity;
+    }
+
+    size_t VMemoryLogSink::GetSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Entries.size();
+    }
+
+    uint64_t VMemoryLogSink::GetEvictedCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Evicted;
+    }
+} // namespace VE::Internal::Core::Backlog
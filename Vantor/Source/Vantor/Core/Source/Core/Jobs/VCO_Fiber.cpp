@@ -0,0 +1,216 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Jobs/VCO_Fiber.hpp>
+
+#include <cassert>
+#include <cstring>
+
+#if VANTOR_JOBS_FIBERS
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if VANTOR_JOBS_FIBERS_NATIVE
+
+// void VantorSwitchFiber(void **fromStackPointer, void *toStackPointer)
+//
+// Pushes the callee saved registers on the current stack, stores the stack pointer in
+// *fromStackPointer, loads toStackPointer and pops the registers saved there. A new fiber's stack
+// is prepared so that the final return lands in VantorStartFiber with entry and arg in callee
+// saved registers.
+#if defined(__x86_64__)
+asm(R"(
+    .text
+    .p2align 4
+    .type VantorSwitchFiber, @function
+VantorSwitchFiber:
+    pushq %rbp
+    pushq %rbx
+    pushq %r12
+    pushq %r13
+    pushq %r14
+    pushq %r15
+    subq $8, %rsp
+    stmxcsr (%rsp)
+    fnstcw 4(%rsp)
+    movq %rsp, (%rdi)
+    movq %rsi, %rsp
+    ldmxcsr (%rsp)
+    fldcw 4(%rsp)
+    addq $8, %rsp
+    popq %r15
+    popq %r14
+    popq %r13
+    popq %r12
+    popq %rbx
+    popq %rbp
+    ret
+    .size VantorSwitchFiber, .-VantorSwitchFiber
+
+    .p2align 4
+    .type VantorStartFiber, @function
+VantorStartFiber:
+    movq %r12, %rdi
+    callq *%r13
+    ud2
+    .size VantorStartFiber, .-VantorStartFiber
+)");
+#elif defined(__aarch64__)
+asm(R"(
+    .text
+    .p2align 4
+    .type VantorSwitchFiber, %function
+VantorSwitchFiber:
+    sub sp, sp, #160
+    stp x19, x20, [sp, #0]
+    stp x21, x22, [sp, #16]
+    stp x23, x24, [sp, #32]
+    stp x25, x26, [sp, #48]
+    stp x27, x28, [sp, #64]
+    stp x29, x30, [sp, #80]
+    stp d8, d9, [sp, #96]
+    stp d10, d11, [sp, #112]
+    stp d12, d13, [sp, #128]
+    stp d14, d15, [sp, #144]
+    mov x2, sp
+    str x2, [x0]
+    mov sp, x1
+    ldp x19, x20, [sp, #0]
+    ldp x21, x22, [sp, #16]
+    ldp x23, x24, [sp, #32]
+    ldp x25, x26, [sp, #48]
+    ldp x27, x28, [sp, #64]
+    ldp x29, x30, [sp, #80]
+    ldp d8, d9, [sp, #96]
+    ldp d10, d11, [sp, #112]
+    ldp d12, d13, [sp, #128]
+    ldp d14, d15, [sp, #144]
+    add sp, sp, #160
+    ret
+    .size VantorSwitchFiber, .-VantorSwitchFiber
+
+    .p2align 4
+    .type VantorStartFiber, %function
+VantorStartFiber:
+    mov x0, x19
+    blr x20
+    brk #0
+    .size VantorStartFiber, .-VantorStartFiber
+)");
+#endif
+
+extern "C" void VantorSwitchFiber(void **fromStackPointer, void *toStackPointer);
+extern "C" void VantorStartFiber();
+
+#endif // VANTOR_JOBS_FIBERS_NATIVE
+
+namespace VE::Internal::Core::Jobs
+{
+#if VANTOR_JOBS_FIBERS_NATIVE
+
+    void MakeFiberContext(VFiberContext &context, void *stack, size_t stackSize, void (*entry)(void *), void *arg)
+    {
+        // The stack top must be 16 byte aligned when VantorStartFiber is entered
+        const uintptr_t top   = (reinterpret_cast<uintptr_t>(stack) + stackSize) & ~uintptr_t(15);
+        uint64_t       *frame = nullptr;
+
+#if defined(__x86_64__)
+        // control words, r15, r14, r13 (entry), r12 (arg), rbx, rbp, return address
+        frame    = reinterpret_cast<uint64_t *>(top) - 8;
+        frame[0] = 0x1F80ull | (0x037Full << 32); // MXCSR and x87 control word defaults
+        frame[1] = 0;
+        frame[2] = 0;
+        frame[3] = reinterpret_cast<uint64_t>(entry);
+        frame[4] = reinterpret_cast<uint64_t>(arg);
+        frame[5] = 0;
+        frame[6] = 0;
+        frame[7] = reinterpret_cast<uint64_t>(&VantorStartFiber);
+#elif defined(__aarch64__)
+        // x19 (arg), x20 (entry), x21..x28, x29 (frame pointer), x30 (return address), d8..d15
+        frame = reinterpret_cast<uint64_t *>(top) - 20;
+        std::memset(frame, 0, 20 * sizeof(uint64_t));
+        frame[0]  = reinterpret_cast<uint64_t>(arg);
+        frame[1]  = reinterpret_cast<uint64_t>(entry);
+        frame[11] = reinterpret_cast<uint64_t>(&VantorStartFiber);
+#endif
+        context.stackPointer = frame;
+    }
+
+    void SwitchFiberContext(VFiberContext &from, VFiberContext &to) { VantorSwitchFiber(&from.stackPointer, to.stackPointer); }
+
+#elif VANTOR_JOBS_FIBERS
+
+    namespace
+    {
+        // makecontext() only passes int arguments, the pointers are split in halves
+        void StartFiber(unsigned entryLow, unsigned entryHigh, unsigned argLow, unsigned argHigh)
+        {
+            const auto entry = reinterpret_cast<void (*)(void *)>((static_cast<uintptr_t>(entryHigh) << 32) | entryLow);
+            void      *arg   = reinterpret_cast<void *>((static_cast<uintptr_t>(argHigh) << 32) | argLow);
+            entry(arg);
+        }
+    } // namespace
+
+    void MakeFiberContext(VFiberContext &context, void *stack, size_t stackSize, void (*entry)(void *), void *arg)
+    {
+        getcontext(&context.context);
+        context.context.uc_stack.ss_sp   = stack;
+        context.context.uc_stack.ss_size = stackSize;
+        context.context.uc_link          = nullptr;
+
+        const auto entryBits = reinterpret_cast<uintptr_t>(entry);
+        const auto argBits   = reinterpret_cast<uintptr_t>(arg);
+        makecontext(&context.context, reinterpret_cast<void (*)()>(&StartFiber), 4, static_cast<unsigned>(entryBits), static_cast<unsigned>(uint64_t(entryBits) >> 32),
+                    static_cast<unsigned>(argBits), static_cast<unsigned>(uint64_t(argBits) >> 32));
+    }
+
+    void SwitchFiberContext(VFiberContext &from, VFiberContext &to) { swapcontext(&from.context, &to.context); }
+
+#else
+
+    void MakeFiberContext(VFiberContext &, void *, size_t, void (*)(void *), void *) { assert(false && "Fibers are not supported on this platform"); }
+    void SwitchFiberContext(VFiberContext &, VFiberContext &) { assert(false && "Fibers are not supported on this platform"); }
+
+#endif
+
+    VFiberStackPool::~VFiberStackPool()
+    {
+#if VANTOR_JOBS_FIBERS
+        if (m_Base != nullptr) munmap(m_Base, m_Reserved);
+#endif
+    }
+
+    bool VFiberStackPool::Initialize(uint32_t stackCount, size_t stackSize)
+    {
+#if VANTOR_JOBS_FIBERS
+        assert(m_Base == nullptr);
+
+        m_PageSize  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        m_StackSize = (stackSize + m_PageSize - 1) / m_PageSize * m_PageSize;
+        m_Reserved  = static_cast<size_t>(stackCount) * (m_StackSize + m_PageSize);
+
+        void *base = mmap(nullptr, m_Reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) return false;
+        m_Base       = static_cast<uint8_t *>(base);
+        m_StackCount = stackCount;
+
+        // Pages are only committed when a stack first grows into them
+        for (uint32_t i = 0; i < stackCount; ++i)
+        {
+            mprotect(static_cast<uint8_t *>(GetStack(i)) - m_PageSize, m_PageSize, PROT_NONE);
+        }
+        return true;
+#else
+        (void) stackCount;
+        (void) stackSize;
+        return false;
+#endif
+    }
+} // namespace VE::Internal::Core::Jobs
@@ -0,0 +1,531 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Jobs/VCO_JobSystem.hpp>
+
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace VE::Internal::Core::Jobs
+{
+    namespace
+    {
+        constexpr uint32_t IDLE_SPIN_COUNT = 256; // FindJob() attempts before a worker sleeps
+
+        inline void CpuRelax()
+        {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+
+        inline uint32_t NextRandom(uint32_t &state)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        void LockCounter(std::atomic<bool> &locked)
+        {
+            while (locked.exchange(true, std::memory_order_acquire))
+            {
+                while (locked.load(std::memory_order_relaxed))
+                {
+                    CpuRelax();
+                }
+            }
+        }
+
+        void UnlockCounter(std::atomic<bool> &locked) { locked.store(false, std::memory_order_release); }
+    } // namespace
+
+    VJobSystem::VWorkerContext *VJobSystem::GetContext()
+    {
+        thread_local VWorkerContext context;
+        return &context;
+    }
+
+    VJobSystem::VJobSystem(const VJobSystemDesc &desc)
+    {
+        uint32_t workerCount = desc.workerCount;
+        if (workerCount == AUTO_WORKER_COUNT)
+        {
+            const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount                    = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        m_Deques.reserve(workerCount + 1);
+        for (uint32_t i = 0; i <= workerCount; ++i)
+        {
+            m_Deques.push_back(std::make_unique<TWorkStealingDeque<Detail::VJob *>>());
+        }
+
+        VWorkerContext *context = GetContext();
+        context->system         = this;
+        context->index          = 0;
+        context->random         = 0x9E3779B9u;
+
+#if VANTOR_JOBS_FIBERS
+        // Only workers run fibers, each one needs a fiber for its loop and there must be one more to switch to
+        const uint32_t fiberCount = std::max(desc.fiberCount, workerCount + 1);
+        if (desc.useFibers && workerCount > 0 && m_FiberStacks.Initialize(fiberCount, desc.fiberStackSize))
+        {
+            m_Fibers.resize(fiberCount);
+            for (uint32_t i = 0; i < fiberCount; ++i)
+            {
+                m_Fibers[i].stack    = m_FiberStacks.GetStack(i);
+                m_Fibers[i].system   = this;
+                m_Fibers[i].nextFree = m_FreeFibers;
+                m_FreeFibers         = &m_Fibers[i];
+            }
+            m_ThreadFibers.resize(workerCount);
+        }
+#endif
+        if (desc.useFibers && !IsUsingFibers())
+        {
+            VE_LOG(WARNING, "Jobs", "Fibers are not available, waiting jobs run other jobs instead");
+        }
+
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 1; i <= workerCount; ++i)
+        {
+            m_Workers.emplace_back([this, i] { WorkerMain(i); });
+        }
+    }
+
+    VJobSystem::~VJobSystem()
+    {
+        m_Stop.store(true, std::memory_order_seq_cst);
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeEpoch++;
+        }
+        m_SleepCondition.notify_all();
+
+        // Workers leave once they find nothing more to run, this thread helps with its own deque
+        while (RunPendingJob())
+        {
+        }
+        for (std::thread &worker : m_Workers)
+        {
+            worker.join();
+        }
+        while (RunPendingJob())
+        {
+        }
+
+        VWorkerContext *context = GetContext();
+        if (context->system == this) *context = VWorkerContext();
+    }
+
+    void VJobSystem::Wait(VJobCounter &counter)
+    {
+        VWorkerContext *context = GetContext();
+        if (context->system == this && context->currentFiber != nullptr)
+        {
+            while (!counter.IsDone())
+            {
+                Detail::VFiber *fiber = context->currentFiber;
+                Detail::VFiber *fresh = AcquireFiber();
+                if (fresh == nullptr) break;
+
+                // The fresh fiber parks this one on the counter, it continues here once the counter is done (maybe on another thread)
+                SwitchToFiber(fiber, fresh, Detail::EFiberHandoff::Park, &counter);
+                context = fiber->thread;
+            }
+        }
+
+        // No fibers or the pool ran dry: run other jobs until the counter is done
+        uint32_t idle = 0;
+        while (!counter.IsDone())
+        {
+            Detail::VJob *job = FindJob(context->system == this ? context : nullptr, false);
+            if (job != nullptr)
+            {
+                Execute(job);
+                idle = 0;
+            }
+            else if (++idle < IDLE_SPIN_COUNT)
+            {
+                CpuRelax();
+            }
+            else
+            {
+                // The remaining jobs run on other threads
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    bool VJobSystem::RunPendingJob()
+    {
+        VWorkerContext *context = GetContext();
+        Detail::VJob   *job     = FindJob(context->system == this ? context : nullptr, false);
+        if (job == nullptr) return false;
+        Execute(job);
+        return true;
+    }
+
+    void VJobSystem::Submit(Detail::VJob *job)
+    {
+        VWorkerContext *context = GetContext();
+        if (job->fiber != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(m_ReadyMutex);
+            m_ReadyFibers.push_back(job);
+            m_ReadyCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (context->system == this)
+        {
+            m_Deques[context->index]->Push(job);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_InjectedMutex);
+            m_Injected.push_back(job);
+            m_InjectedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        WakeWorkers();
+    }
+
+    void VJobSystem::SubmitAfter(VJobCounter &dependency, Detail::VJob *job)
+    {
+        for (;;)
+        {
+            LockCounter(dependency.m_Locked);
+            const int32_t value = dependency.m_Value.load(std::memory_order_acquire);
+            if (value < 0)
+            {
+                // The last job of the dependency is collecting the waiting list right now
+                UnlockCounter(dependency.m_Locked);
+                CpuRelax();
+                continue;
+            }
+            if (value > 0)
+            {
+                job->next             = dependency.m_Waiting;
+                dependency.m_Waiting = job;
+                UnlockCounter(dependency.m_Locked);
+                return;
+            }
+            UnlockCounter(dependency.m_Locked);
+            Submit(job);
+            return;
+        }
+    }
+
+    void VJobSystem::Execute(Detail::VJob *job)
+    {
+        if (job->fiber != nullptr)
+        {
+            Detail::VFiber *fiber = job->fiber;
+            m_JobAllocator.free(job);
+            m_PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            ResumeFiber(fiber);
+            return;
+        }
+
+        job->invoke(*job);
+        job->destroy(*job);
+
+        VJobCounter *counter = job->counter;
+        m_JobAllocator.free(job);
+
+        if (counter != nullptr) ReleaseCounter(*counter);
+        m_PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void VJobSystem::ReleaseCounter(VJobCounter &counter)
+    {
+        int32_t value = counter.m_Value.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (value > 1)
+            {
+                if (counter.m_Value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) return;
+                continue;
+            }
+            // Last job: block RunAfter() and waiters (a negative value is not done) until the waiting jobs are taken
+            if (counter.m_Value.compare_exchange_weak(value, VJobCounter::RELEASING, std::memory_order_acq_rel, std::memory_order_relaxed)) break;
+        }
+
+        LockCounter(counter.m_Locked);
+        Detail::VJob *waiting = counter.m_Waiting;
+        counter.m_Waiting     = nullptr;
+        UnlockCounter(counter.m_Locked);
+
+        // Jobs started with the counter in the meantime are kept, after this the counter may be destroyed
+        counter.m_Value.fetch_sub(VJobCounter::RELEASING, std::memory_order_acq_rel);
+
+        while (waiting != nullptr)
+        {
+            Detail::VJob *next = waiting->next;
+            waiting->next      = nullptr;
+            Submit(waiting);
+            waiting = next;
+        }
+    }
+
+    Detail::VJob *VJobSystem::FindJob(VWorkerContext *context, bool resumeFibers)
+    {
+        Detail::VJob *job = nullptr;
+
+        // Parked fibers first, they hold stacks and finish work that was already started
+        if (resumeFibers && m_ReadyCount.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_ReadyMutex);
+            if (!m_ReadyFibers.empty())
+            {
+                job = m_ReadyFibers.front();
+                m_ReadyFibers.pop_front();
+                m_ReadyCount.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        if (context != nullptr && m_Deques[context->index]->Pop(job)) return job;
+
+        if (m_InjectedCount.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_InjectedMutex);
+            if (!m_Injected.empty())
+            {
+                job = m_Injected.front();
+                m_Injected.pop_front();
+                m_InjectedCount.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        // Steal, starting at a random victim so thieves spread over the deques
+        thread_local uint32_t externalRandom = 0x2545F491u;
+        const uint32_t        dequeCount     = static_cast<uint32_t>(m_Deques.size());
+        const uint32_t        start          = NextRandom(context != nullptr ? context->random : externalRandom) % dequeCount;
+        for (uint32_t i = 0; i < dequeCount; ++i)
+        {
+            const uint32_t victim = (start + i) % dequeCount;
+            if (context != nullptr && victim == context->index) continue;
+            if (m_Deques[victim]->Steal(job)) return job;
+        }
+        return nullptr;
+    }
+
+    bool VJobSystem::HasQueuedJobs() const
+    {
+        if (m_InjectedCount.load(std::memory_order_relaxed) > 0 || m_ReadyCount.load(std::memory_order_relaxed) > 0) return true;
+        for (const auto &deque : m_Deques)
+        {
+            if (!deque->IsEmpty()) return true;
+        }
+        return false;
+    }
+
+    void VJobSystem::WakeWorkers()
+    {
+        // Pairs with the fence in Sleep(): either the worker sees the new job or this sees the worker
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_SleepingWorkers.load(std::memory_order_relaxed) == 0) return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeEpoch++;
+        }
+        m_SleepCondition.notify_one();
+    }
+
+    void VJobSystem::Sleep()
+    {
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        const uint64_t               epoch = m_WakeEpoch;
+        m_SleepingWorkers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!HasQueuedJobs() && !m_Stop.load(std::memory_order_relaxed))
+        {
+            m_SleepCondition.wait(lock, [&] { return m_WakeEpoch != epoch || m_Stop.load(std::memory_order_relaxed); });
+        }
+        m_SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    bool VJobSystem::RunWhenIdle(void (*fn)())
+    {
+        VWorkerContext *context = GetContext();
+        if (context->system == nullptr || context->index == 0) return false;
+
+        if (std::find(context->idleCallbacks.begin(), context->idleCallbacks.end(), fn) == context->idleCallbacks.end())
+        {
+            context->idleCallbacks.push_back(fn);
+        }
+        return true;
+    }
+
+    void VJobSystem::RunIdleCallbacks(VWorkerContext *context)
+    {
+        // A callback may register itself again
+        VE::Internal::Core::Container::TVector<void (*)()> callbacks;
+        std::swap(callbacks, context->idleCallbacks);
+        for (void (*callback)() : callbacks)
+        {
+            callback();
+        }
+    }
+
+    void VJobSystem::WorkerMain(uint32_t index)
+    {
+        VWorkerContext *context = GetContext();
+        context->system         = this;
+        context->index          = index;
+        context->random         = 0x9E3779B9u * (index + 1);
+
+        VE::Internal::Core::Profiler::VProfiler::SetThreadName("Job Worker " + std::to_string(index));
+
+        if (IsUsingFibers())
+        {
+            // The loop runs on pool fibers and switches back to this stack when the worker stops
+            Detail::VFiber *threadFiber = &m_ThreadFibers[index - 1];
+            threadFiber->system         = this;
+            threadFiber->thread         = context;
+            SwitchToFiber(threadFiber, AcquireFiber(), Detail::EFiberHandoff::None);
+        }
+        else
+        {
+            WorkerLoop(nullptr);
+        }
+
+        m_JobAllocator.flush_thread_cache();
+        *GetContext() = VWorkerContext();
+    }
+
+    void VJobSystem::WorkerLoop(Detail::VFiber *fiber)
+    {
+        uint32_t idle = 0;
+        for (;;)
+        {
+            // The fiber's thread changes whenever it was parked inside a job
+            VWorkerContext *context = fiber != nullptr ? fiber->thread : GetContext();
+            if (Detail::VJob *job = FindJob(context, fiber != nullptr))
+            {
+                Execute(job);
+                idle = 0;
+                continue;
+            }
+
+            if (m_Stop.load(std::memory_order_acquire) && !HasQueuedJobs())
+            {
+                RunIdleCallbacks(context);
+                break;
+            }
+
+            if (++idle < IDLE_SPIN_COUNT)
+            {
+                CpuRelax();
+                continue;
+            }
+            RunIdleCallbacks(context);
+            Sleep();
+            idle = 0;
+        }
+
+        if (fiber != nullptr)
+        {
+            SwitchToFiber(fiber, &m_ThreadFibers[fiber->thread->index - 1], Detail::EFiberHandoff::Release);
+        }
+    }
+
+    Detail::VFiber *VJobSystem::AcquireFiber()
+    {
+        Detail::VFiber *fiber;
+        {
+            std::lock_guard<std::mutex> lock(m_FiberMutex);
+            fiber = m_FreeFibers;
+            if (fiber == nullptr) return nullptr;
+            m_FreeFibers = fiber->nextFree;
+        }
+
+        // Released fibers were abandoned somewhere in their loop, they always start over
+        fiber->nextFree = nullptr;
+        MakeFiberContext(fiber->context, fiber->stack, m_FiberStacks.GetStackSize(), &VJobSystem::FiberEntry, fiber);
+        return fiber;
+    }
+
+    void VJobSystem::ReleaseFiber(Detail::VFiber *fiber)
+    {
+        std::lock_guard<std::mutex> lock(m_FiberMutex);
+        fiber->nextFree = m_FreeFibers;
+        m_FreeFibers    = fiber;
+    }
+
+    void VJobSystem::SwitchToFiber(Detail::VFiber *from, Detail::VFiber *to, Detail::EFiberHandoff handoff, VJobCounter *counter)
+    {
+        VWorkerContext *context = from->thread;
+        context->handoff        = handoff;
+        context->handoffFiber   = from;
+        context->handoffCounter = counter;
+        context->currentFiber   = to->stack != nullptr ? to : nullptr; // thread fibers run no jobs
+        to->thread              = context;
+
+        SwitchFiberContext(from->context, to->context);
+
+        // Back on this fiber: from->thread is whichever thread switched here, thread_locals read
+        // before the switch may belong to another thread now
+        FinishHandoff(from->thread);
+    }
+
+    void VJobSystem::FinishHandoff(VWorkerContext *context)
+    {
+        // Runs on the fiber switched to, once the previous one no longer uses its stack
+        switch (context->handoff)
+        {
+            case Detail::EFiberHandoff::None:
+                break;
+            case Detail::EFiberHandoff::Release:
+                ReleaseFiber(context->handoffFiber);
+                break;
+            case Detail::EFiberHandoff::Park:
+            {
+                Detail::VJob *resume = m_JobAllocator.allocate();
+                resume->fiber        = context->handoffFiber;
+                m_PendingJobs.fetch_add(1, std::memory_order_relaxed);
+                m_ParkedFibers.fetch_add(1, std::memory_order_relaxed);
+                SubmitAfter(*context->handoffCounter, resume);
+                break;
+            }
+        }
+        context->handoff        = Detail::EFiberHandoff::None;
+        context->handoffFiber   = nullptr;
+        context->handoffCounter = nullptr;
+    }
+
+    void VJobSystem::ResumeFiber(Detail::VFiber *fiber)
+    {
+        // Only reached from WorkerLoop() between jobs, the running fiber holds nothing and goes back to the pool
+        VWorkerContext *context = GetContext();
+        SwitchToFiber(context->currentFiber, fiber, Detail::EFiberHandoff::Release);
+    }
+
+    void VJobSystem::FiberEntry(void *fiber)
+    {
+        Detail::VFiber *self = static_cast<Detail::VFiber *>(fiber);
+        self->system->FinishHandoff(self->thread);
+        self->system->WorkerLoop(self);
+    }
+} // namespace VE::Internal::Core::Jobs
@@ -0,0 +1,159 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Jobs/VCO_Task.hpp>
+
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/Memory/VCO_ConcurrentAllocator.hpp>
+
+#include <fstream>
+#include <new>
+
+namespace VE::Internal::Core::Jobs
+{
+    namespace
+    {
+        template <size_t Size> struct alignas(16) VTaskFrameBlock
+        {
+                unsigned char bytes[Size];
+        };
+
+        // Frames are freed on whatever thread the task finished on, which the block allocator allows
+        template <size_t Size> Memory::VConcurrentBlockAllocator<VTaskFrameBlock<Size>, 64> &GetFramePool()
+        {
+            // Leaked, a task may still finish while static destructors run
+            static auto *pool = new Memory::VConcurrentBlockAllocator<VTaskFrameBlock<Size>, 64>();
+            return *pool;
+        }
+    } // namespace
+
+    void *Detail::AllocateTaskFrame(size_t size)
+    {
+        if (size <= 128) return GetFramePool<128>().allocate();
+        if (size <= 256) return GetFramePool<256>().allocate();
+        if (size <= 512) return GetFramePool<512>().allocate();
+        if (size <= 1024) return GetFramePool<1024>().allocate();
+        if (size <= MAX_POOLED_TASK_FRAME) return GetFramePool<MAX_POOLED_TASK_FRAME>().allocate();
+        return ::operator new(size);
+    }
+
+    void Detail::FreeTaskFrame(void *frame, size_t size)
+    {
+        if (size <= 128) GetFramePool<128>().free(static_cast<VTaskFrameBlock<128> *>(frame));
+        else if (size <= 256) GetFramePool<256>().free(static_cast<VTaskFrameBlock<256> *>(frame));
+        else if (size <= 512) GetFramePool<512>().free(static_cast<VTaskFrameBlock<512> *>(frame));
+        else if (size <= 1024) GetFramePool<1024>().free(static_cast<VTaskFrameBlock<1024> *>(frame));
+        else if (size <= MAX_POOLED_TASK_FRAME) GetFramePool<MAX_POOLED_TASK_FRAME>().free(static_cast<VTaskFrameBlock<MAX_POOLED_TASK_FRAME> *>(frame));
+        else ::operator delete(frame);
+    }
+
+    VTaskScheduler::VTaskScheduler(VJobSystem &jobs) : m_Jobs(jobs), m_MainThread(std::this_thread::get_id()) {}
+
+    VTaskScheduler::~VTaskScheduler()
+    {
+        for (VTask<> &task : m_Spawned)
+        {
+            task.Cancel();
+        }
+
+        // Suspended tasks continue once more to see the cancellation, tasks waiting for a frame get it right away
+        while (!m_Spawned.empty())
+        {
+            BeginFrame();
+            if (!m_Jobs.RunPendingJob()) std::this_thread::yield();
+        }
+    }
+
+    void VTaskScheduler::BeginFrame()
+    {
+        assert(IsMainThread());
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_MainQueue.insert(m_MainQueue.end(), m_NextFrameQueue.begin(), m_NextFrameQueue.end());
+            m_NextFrameQueue.clear();
+        }
+        RunMainThreadWork();
+    }
+
+    void VTaskScheduler::RunMainThreadWork()
+    {
+        assert(IsMainThread());
+
+        // Local, a resumed task may Wait() and get here again while this batch is still being resumed
+        std::vector<std::coroutine_handle<>> running;
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                if (m_MainQueue.empty()) break;
+                running.swap(m_MainQueue);
+            }
+
+            for (std::coroutine_handle<> handle : running)
+            {
+                handle.resume();
+            }
+            running.clear();
+        }
+
+        // Reap finished spawned tasks, nobody is left to see their result
+        for (size_t i = 0; i < m_Spawned.size();)
+        {
+            if (!m_Spawned[i].IsDone())
+            {
+                ++i;
+                continue;
+            }
+
+            try
+            {
+                m_Spawned[i].GetResult();
+            }
+            catch (const VTaskCancelled &)
+            {
+            }
+            catch (const std::exception &e)
+            {
+                VE_LOG(ERR, "Tasks", "Spawned task failed: {}", e.what());
+            }
+
+            m_Spawned[i] = std::move(m_Spawned.back());
+            m_Spawned.pop_back();
+        }
+    }
+
+    void VTaskScheduler::Spawn(VTask<> task)
+    {
+        assert(IsMainThread());
+        if (!task.IsStarted()) task.Start();
+        m_Spawned.push_back(std::move(task));
+    }
+
+    VTask<std::optional<std::string>> VTaskScheduler::ReadFile(std::string path)
+    {
+        co_await Schedule();
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) co_return std::nullopt;
+
+        const std::streamoff size = file.tellg();
+        if (size < 0) co_return std::nullopt;
+
+        std::string bytes(static_cast<size_t>(size), '\0');
+        file.seekg(0);
+        if (!file.read(bytes.data(), size)) co_return std::nullopt;
+        co_return bytes;
+    }
+
+    void VTaskScheduler::Post(std::coroutine_handle<> handle, bool nextFrame)
+    {
+        std::lock_guard<std::mutex> lock(m_QueueMutex);
+        (nextFrame ? m_NextFrameQueue : m_MainQueue).push_back(handle);
+    }
+} // namespace VE::Internal::Core::Jobs
@@ -0,0 +1,167 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Memory/VCO_FrameAllocator.hpp>
+
+#include <Math/VMA_Common.hpp>
+
+#include <algorithm>
+
+namespace VE::Internal::Core::Memory
+{
+    // ----------------- VFrameArena -----------------
+
+    void VFrameArena::Initialize(size_t blockSize, EMemoryTag tag)
+    {
+        Shutdown();
+        m_Tag       = tag;
+        m_BlockSize = VE::Math::align(std::max<size_t>(blockSize, BLOCK_ALIGNMENT), BLOCK_ALIGNMENT);
+        AppendBlock(m_BlockSize);
+        m_Stats.overflowCount = 0;
+    }
+
+    void VFrameArena::Shutdown()
+    {
+        for (auto &block : m_Blocks)
+        {
+            VMemoryTracker::TrackFree(m_Tag, block.capacity);
+            ::operator delete(block.data, std::align_val_t(BLOCK_ALIGNMENT));
+        }
+        m_Blocks.clear();
+        m_CurrentBlock = 0;
+        m_BlockSize    = 0;
+        m_Stats        = {};
+    }
+
+    VLinearAllocator &VFrameArena::AppendBlock(size_t minSize)
+    {
+        const size_t size = VE::Math::align(std::max(minSize, m_BlockSize), BLOCK_ALIGNMENT);
+
+        VLinearAllocator &block = m_Blocks.emplace_back();
+        block.init(::operator new(size, std::align_val_t(BLOCK_ALIGNMENT)), size);
+        VMemoryTracker::TrackAllocation(m_Tag, size);
+
+        m_Stats.reservedBytes += size;
+        m_Stats.blockCount = static_cast<uint32_t>(m_Blocks.size());
+        return block;
+    }
+
+    void *VFrameArena::Allocate(size_t size, size_t alignment)
+    {
+        assert(IsInitialized() && "VFrameArena::Allocate() called before Initialize()");
+
+        VLinearAllocator &current   = m_Blocks[m_CurrentBlock];
+        size_t            oldOffset = current.offset;
+        uint8_t          *ptr       = current.allocate(size, alignment);
+
+        if (ptr == nullptr)
+        {
+            // Spill into the next chained block, reusing one from an earlier frame if it is large enough
+            const size_t required = size + alignment;
+            uint32_t     next     = m_CurrentBlock + 1;
+            while (next < m_Blocks.size() && m_Blocks[next].capacity < required)
+            {
+                ++next;
+            }
+            if (next >= m_Blocks.size())
+            {
+                AppendBlock(required);
+                next = static_cast<uint32_t>(m_Blocks.size() - 1);
+            }
+            m_Stats.overflowCount++;
+
+            // Skipped blocks are simply left empty for this frame
+            m_CurrentBlock = next;
+            m_Blocks[next].reset();
+            oldOffset = 0;
+            ptr       = m_Blocks[next].allocate(size, alignment);
+            assert(ptr != nullptr);
+        }
+
+        m_Stats.usedBytes += m_Blocks[m_CurrentBlock].offset - oldOffset;
+        m_Stats.highWaterMark = std::max(m_Stats.highWaterMark, m_Stats.usedBytes);
+        m_Stats.allocationCount++;
+        return ptr;
+    }
+
+    void VFrameArena::Rewind(const Marker &marker)
+    {
+        if (!IsInitialized()) return;
+        assert(marker.block <= m_CurrentBlock);
+
+        for (uint32_t i = marker.block + 1; i <= m_CurrentBlock; ++i)
+        {
+            m_Blocks[i].reset();
+        }
+        m_CurrentBlock                = marker.block;
+        m_Blocks[marker.block].offset = marker.offset;
+        m_Stats.usedBytes             = marker.used;
+    }
+
+    void VFrameArena::Reset()
+    {
+        for (auto &block : m_Blocks)
+        {
+            block.reset();
+        }
+        m_CurrentBlock          = 0;
+        m_Stats.usedBytes       = 0;
+        m_Stats.allocationCount = 0;
+    }
+
+    // ----------------- VFrameAllocator -----------------
+
+    void VFrameAllocator::Initialize(size_t arenaSize, uint32_t bufferCount, EMemoryTag tag)
+    {
+        assert(bufferCount >= 1 && bufferCount <= MAX_FRAMES_IN_FLIGHT);
+        m_BufferCount  = std::clamp<uint32_t>(bufferCount, 1u, MAX_FRAMES_IN_FLIGHT);
+        m_CurrentArena = 0;
+        m_FrameIndex   = 0;
+        for (uint32_t i = 0; i < m_BufferCount; ++i)
+        {
+            m_Arenas[i].Initialize(arenaSize, tag);
+        }
+    }
+
+    void VFrameAllocator::Shutdown()
+    {
+        for (auto &arena : m_Arenas)
+        {
+            arena.Shutdown();
+        }
+        m_BufferCount = 0;
+    }
+
+    void VFrameAllocator::BeginFrame()
+    {
+        if (m_BufferCount == 0) return;
+
+        m_FrameIndex++;
+        m_CurrentArena = static_cast<uint32_t>(m_FrameIndex % m_BufferCount);
+
+        // Everything in this arena was allocated bufferCount frames ago and is no longer in flight
+        m_Arenas[m_CurrentArena].Reset();
+    }
+
+    VFrameArenaStats VFrameAllocator::GetStats() const
+    {
+        VFrameArenaStats total;
+        for (uint32_t i = 0; i < m_BufferCount; ++i)
+        {
+            const VFrameArenaStats &stats = m_Arenas[i].GetStats();
+            total.reservedBytes += stats.reservedBytes;
+            total.usedBytes += stats.usedBytes;
+            total.highWaterMark = std::max(total.highWaterMark, stats.highWaterMark);
+            total.blockCount += stats.blockCount;
+            total.overflowCount += stats.overflowCount;
+            total.allocationCount += stats.allocationCount;
+        }
+        return total;
+    }
+} // namespace VE::Internal::Core::Memory
@@ -0,0 +1,131 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace VE::Internal::Core::Memory
+{
+    const char *MemoryTagToString(EMemoryTag tag)
+    {
+        switch (tag)
+        {
+            case EMemoryTag::Core:
+                return "Core";
+            case EMemoryTag::Assets:
+                return "Assets";
+            case EMemoryTag::Geometry:
+                return "Geometry";
+            case EMemoryTag::Textures:
+                return "Textures";
+            case EMemoryTag::Actors:
+                return "Actors";
+            case EMemoryTag::RenderPipeline:
+                return "RenderPipeline";
+            case EMemoryTag::Log:
+                return "Log";
+            default:
+                return "Unknown";
+        }
+    }
+
+    void VMemoryTracker::BeginFrame()
+    {
+        for (Counters &counters : s_Counters)
+        {
+            counters.lastFrameBytes.store(counters.frameBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            counters.lastFrameAllocations.store(counters.frameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        s_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    VMemoryTagStats VMemoryTracker::GetStats(EMemoryTag tag)
+    {
+        const Counters &counters = s_Counters[static_cast<size_t>(tag)];
+
+        VMemoryTagStats stats;
+        stats.liveBytes            = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes            = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.gpuLiveBytes         = counters.gpuLiveBytes.load(std::memory_order_relaxed);
+        stats.gpuPeakBytes         = counters.gpuPeakBytes.load(std::memory_order_relaxed);
+        stats.liveAllocations      = counters.liveAllocations.load(std::memory_order_relaxed);
+        stats.totalAllocations     = counters.totalAllocations.load(std::memory_order_relaxed);
+        stats.frameAllocatedBytes  = counters.lastFrameBytes.load(std::memory_order_relaxed);
+        stats.frameAllocationCount = counters.lastFrameAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    size_t VMemoryTracker::GetTotalLiveBytes()
+    {
+        size_t total = 0;
+        for (const Counters &counters : s_Counters)
+        {
+            total += counters.liveBytes.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    size_t VMemoryTracker::GetTotalGpuLiveBytes()
+    {
+        size_t total = 0;
+        for (const Counters &counters : s_Counters)
+        {
+            total += counters.gpuLiveBytes.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    static void WriteStats(std::ostringstream &out, const VMemoryTagStats &stats)
+    {
+        out << "{\"liveBytes\": " << stats.liveBytes << ", \"peakBytes\": " << stats.peakBytes << ", \"gpuLiveBytes\": " << stats.gpuLiveBytes
+            << ", \"gpuPeakBytes\": " << stats.gpuPeakBytes << ", \"liveAllocations\": " << stats.liveAllocations
+            << ", \"totalAllocations\": " << stats.totalAllocations << ", \"frameAllocatedBytes\": " << stats.frameAllocatedBytes
+            << ", \"frameAllocationCount\": " << stats.frameAllocationCount << "}";
+    }
+
+    std::string VMemoryTracker::ToJson()
+    {
+        std::ostringstream out;
+        out << "{\n  \"frame\": " << s_FrameIndex.load(std::memory_order_relaxed) << ",\n  \"tags\": {\n";
+
+        // Peaks of different tags are not simultaneous, the total peaks are an upper bound
+        VMemoryTagStats total;
+        for (size_t i = 0; i < static_cast<size_t>(EMemoryTag::Count); ++i)
+        {
+            const VMemoryTagStats stats = GetStats(static_cast<EMemoryTag>(i));
+            out << "    \"" << MemoryTagToString(static_cast<EMemoryTag>(i)) << "\": ";
+            WriteStats(out, stats);
+            out << (i + 1 < static_cast<size_t>(EMemoryTag::Count) ? ",\n" : "\n");
+
+            total.liveBytes += stats.liveBytes;
+            total.peakBytes += stats.peakBytes;
+            total.gpuLiveBytes += stats.gpuLiveBytes;
+            total.gpuPeakBytes += stats.gpuPeakBytes;
+            total.liveAllocations += stats.liveAllocations;
+            total.totalAllocations += stats.totalAllocations;
+            total.frameAllocatedBytes += stats.frameAllocatedBytes;
+            total.frameAllocationCount += stats.frameAllocationCount;
+        }
+
+        out << "  },\n  \"total\": ";
+        WriteStats(out, total);
+        out << "\n}\n";
+        return out.str();
+    }
+
+    bool VMemoryTracker::DumpJson(const std::string &path)
+    {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file << ToJson();
+        return file.good();
+    }
+} // namespace VE::Internal::Core::Memory
@@ -0,0 +1,209 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Memory/VCO_VirtualArena.hpp>
+
+#include <Math/VMA_Common.hpp>
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace VE::Internal::Core::Memory
+{
+    // ----------------- Platform -----------------
+
+    static void *ReserveAddressSpace(size_t size)
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        void *ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+    }
+
+    static void ReleaseAddressSpace(void *ptr, size_t size)
+    {
+#if defined(_WIN32)
+        (void) size;
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, size);
+#endif
+    }
+
+    static bool CommitPages(void *ptr, size_t size)
+    {
+#if defined(_WIN32)
+        return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+        return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+    }
+
+    static void DecommitPages(void *ptr, size_t size)
+    {
+#if defined(_WIN32)
+        VirtualFree(ptr, size, MEM_DECOMMIT);
+#else
+        madvise(ptr, size, MADV_DONTNEED);
+        mprotect(ptr, size, PROT_NONE);
+#endif
+    }
+
+    // Drops the contents of committed pages but keeps them accessible
+    static void PurgePages(void *ptr, size_t size)
+    {
+#if defined(_WIN32)
+        VirtualAlloc(ptr, size, MEM_RESET, PAGE_READWRITE);
+#else
+        madvise(ptr, size, MADV_DONTNEED);
+#endif
+    }
+
+    // ----------------- VVirtualArena -----------------
+
+    bool VVirtualArena::Reserve(size_t reserveBytes, EMemoryTag tag)
+    {
+        Release();
+
+        const size_t size = VE::Math::align(std::max<size_t>(reserveBytes, COMMIT_GRANULARITY), COMMIT_GRANULARITY);
+        m_Base            = static_cast<uint8_t *>(ReserveAddressSpace(size));
+        if (m_Base == nullptr) return false;
+
+        m_Tag                 = tag;
+        m_Stats.reservedBytes = size;
+        return true;
+    }
+
+    void VVirtualArena::Release()
+    {
+        if (m_Base == nullptr) return;
+
+        if (m_Stats.committedBytes > 0) VMemoryTracker::TrackFree(m_Tag, m_Stats.committedBytes);
+        ReleaseAddressSpace(m_Base, m_Stats.reservedBytes);
+
+        m_Base           = nullptr;
+        m_Offset         = 0;
+        m_LastAllocation = 0;
+        m_Stats          = {};
+    }
+
+    bool VVirtualArena::Commit(size_t end)
+    {
+        if (end <= m_Stats.committedBytes) return true;
+        if (end > m_Stats.reservedBytes) return false;
+
+        const size_t newCommitted = std::min(VE::Math::align(end, COMMIT_GRANULARITY), m_Stats.reservedBytes);
+        if (!CommitPages(m_Base + m_Stats.committedBytes, newCommitted - m_Stats.committedBytes)) return false;
+
+        VMemoryTracker::TrackAllocation(m_Tag, newCommitted - m_Stats.committedBytes);
+        m_Stats.committedBytes     = newCommitted;
+        m_Stats.peakCommittedBytes = std::max(m_Stats.peakCommittedBytes, newCommitted);
+        return true;
+    }
+
+    void *VVirtualArena::Allocate(size_t size, size_t alignment)
+    {
+        assert(IsReserved() && "VVirtualArena::Allocate() called before Reserve()");
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+        // The base is page aligned, so aligning the offset aligns the address
+        const size_t start = VE::Math::align(m_Offset, alignment);
+        if (start < m_Offset || size > m_Stats.reservedBytes - std::min(start, m_Stats.reservedBytes)) return nullptr;
+        if (!Commit(start + size)) return nullptr;
+
+        m_LastAllocation  = start;
+        m_Offset          = start + size;
+        m_Stats.usedBytes = m_Offset;
+        return m_Base + start;
+    }
+
+    bool VVirtualArena::Resize(void *ptr, size_t newSize)
+    {
+        if (ptr != m_Base + m_LastAllocation || m_Offset == 0) return false;
+        if (newSize > m_Stats.reservedBytes - m_LastAllocation || !Commit(m_LastAllocation + newSize)) return false;
+
+        m_Offset          = m_LastAllocation + newSize;
+        m_Stats.usedBytes = m_Offset;
+        m_Stats.inPlaceGrowCount++;
+        return true;
+    }
+
+    void *VVirtualArena::Reallocate(void *ptr, size_t oldSize, size_t newSize, size_t alignment)
+    {
+        if (ptr == nullptr) return Allocate(newSize, alignment);
+        if (Resize(ptr, newSize)) return ptr;
+
+        void *newPtr = Allocate(newSize, alignment);
+        if (newPtr == nullptr) return nullptr;
+
+        std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+        Free(ptr, oldSize);
+        m_Stats.copyGrowCount++;
+        return newPtr;
+    }
+
+    void VVirtualArena::Free(void *ptr, size_t size)
+    {
+        if (ptr == nullptr) return;
+        assert(Owns(ptr));
+
+        uint8_t *p = static_cast<uint8_t *>(ptr);
+        if (p == m_Base + m_LastAllocation && m_Offset != 0)
+        {
+            m_Offset          = m_LastAllocation;
+            m_Stats.usedBytes = m_Offset;
+            return;
+        }
+
+        // Can't be reused before the next Reset(), but its pages don't have to stay resident
+        const size_t first = VE::Math::align(static_cast<size_t>(p - m_Base), COMMIT_GRANULARITY);
+        const size_t last  = (static_cast<size_t>(p - m_Base) + size) & ~(COMMIT_GRANULARITY - 1);
+        if (last > first) PurgePages(m_Base + first, last - first);
+    }
+
+    void VVirtualArena::Rewind(const Marker &marker)
+    {
+        assert(marker.offset <= m_Offset);
+        m_Offset          = marker.offset;
+        m_LastAllocation  = marker.last;
+        m_Stats.usedBytes = m_Offset;
+    }
+
+    void VVirtualArena::Reset()
+    {
+        m_Offset          = 0;
+        m_LastAllocation  = 0;
+        m_Stats.usedBytes = 0;
+    }
+
+    void VVirtualArena::Decommit(size_t keepBytes)
+    {
+        if (m_Base == nullptr) return;
+
+        const size_t keep = std::min(VE::Math::align(std::max(m_Offset, keepBytes), COMMIT_GRANULARITY), m_Stats.reservedBytes);
+        if (keep >= m_Stats.committedBytes) return;
+
+        DecommitPages(m_Base + keep, m_Stats.committedBytes - keep);
+        VMemoryTracker::TrackFree(m_Tag, m_Stats.committedBytes - keep);
+        m_Stats.committedBytes = keep;
+    }
+} // namespace VE::Internal::Core::Memory
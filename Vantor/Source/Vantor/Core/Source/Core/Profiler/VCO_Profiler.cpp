@@ -0,0 +1,666 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/Container/VCO_FlatHashMap.hpp>
+#include <Core/VCO_Timer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace VE::Internal::Core::Profiler
+{
+    namespace
+    {
+        using VE::Internal::Core::Container::TVector;
+        using Detail::VProfileEvent;
+        using Detail::VProfileThreadState;
+
+        constexpr size_t   DEFAULT_HISTORY_SIZE = 240;
+        constexpr uint32_t NO_NODE              = VProfileZoneSample::NO_PARENT;
+        constexpr uint64_t MIN_CALIBRATION_NS   = 1000000; // 1 ms
+        constexpr char     DEFAULT_CAPTURE_FILE[] = "VantorProfile.json";
+
+        uint64_t SteadyNs() { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()); }
+
+        bool SameName(const char *a, const char *b) { return a == b || std::strcmp(a, b) == 0; }
+
+        struct VOpenZone
+        {
+                const char *name;
+                uint32_t    node;         // in the current frame, NO_NODE before the first frame
+                uint64_t    segmentStart; // ticks, the zone start or the frame start if it began earlier
+                uint64_t    startTicks;   // the zone start
+        };
+
+        // Consumer side of one profiled thread
+        struct VThreadCollector
+        {
+                std::shared_ptr<VProfileThreadState> state;
+                TVector<VOpenZone>                   stack;
+                uint32_t                             firstRoot = NO_NODE; // first top level zone of the current frame
+        };
+
+        // Tree links of the current frame, parallel to its zones
+        struct VNodeLinks
+        {
+                uint32_t firstChild  = NO_NODE;
+                uint32_t nextSibling = NO_NODE;
+        };
+
+        // A capture that is finished and waits to be written outside the lock
+        struct VFinishedCapture
+        {
+                VProfileCapture capture;
+                std::string     path;
+        };
+
+        class VProfilerState
+        {
+            public:
+                VProfilerState()
+                {
+                    m_EpochTicks = GetProfilerTicks();
+                    m_EpochNs    = SteadyNs();
+#if VANTOR_PROFILER_RDTSC
+                    // Rough initial tick rate, refined every frame as the measured interval grows
+                    while (SteadyNs() - m_EpochNs < MIN_CALIBRATION_NS)
+                    {
+                    }
+                    Calibrate();
+#endif
+                    m_FrameStartTicks = GetProfilerTicks();
+                    m_History.reserve(m_HistorySize);
+                }
+
+                std::shared_ptr<VProfileThreadState> CreateThreadState()
+                {
+                    auto collector   = std::make_shared<VThreadCollector>();
+                    collector->state = std::make_shared<VProfileThreadState>();
+
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    collector->state->threadId = m_NextThreadId++;
+                    m_Threads.push_back(collector);
+                    return collector->state;
+                }
+
+                void SetThreadName(uint32_t threadId, const std::string &name)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_ThreadNames.insert_or_assign(threadId, name);
+                }
+
+                std::string GetThreadName(uint32_t threadId)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    auto                        it = m_ThreadNames.find(threadId);
+                    return it != m_ThreadNames.end() ? it->second : "Thread " + std::to_string(threadId);
+                }
+
+                uint64_t TicksToNs(uint64_t ticks) const
+                {
+                    if (ticks <= m_EpochTicks) return 0;
+                    return static_cast<uint64_t>(static_cast<double>(ticks - m_EpochTicks) * m_NsPerTick.load(std::memory_order_relaxed));
+                }
+
+                uint64_t DeltaNs(uint64_t from, uint64_t to) const
+                {
+                    if (to <= from) return 0;
+                    return static_cast<uint64_t>(static_cast<double>(to - from) * m_NsPerTick.load(std::memory_order_relaxed));
+                }
+
+                // True if a capture finished with this frame
+                bool BeginFrame(uint64_t frameIndex, VFinishedCapture &finished)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+
+                    const uint64_t boundary = GetProfilerTicks();
+                    Calibrate();
+
+                    for (auto &thread : m_Threads)
+                    {
+                        Drain(*thread, boundary);
+                    }
+
+                    // Counters are sampled even before the first frame so per frame ones start at 0
+                    for (auto &counter : m_Counters)
+                    {
+                        const int64_t value = counter->EndFrame();
+                        if (m_Capturing && m_Recording) m_Capture.counters.push_back({counter->GetName().c_str(), TicksToNs(m_FrameStartTicks), value});
+                    }
+
+                    bool captured = false;
+                    if (m_Capturing && m_Recording)
+                    {
+                        m_Capture.frames.push_back({m_Current.frameIndex, TicksToNs(m_FrameStartTicks), DeltaNs(m_FrameStartTicks, boundary)});
+                        if (m_Capture.frames.size() >= m_CaptureFrames)
+                        {
+                            FinishCapture(boundary, finished);
+                            captured = true;
+                        }
+                    }
+
+                    if (m_Recording)
+                    {
+                        // Zones still open are cut at the boundary and continue in the next frame
+                        for (auto &thread : m_Threads)
+                        {
+                            for (VOpenZone &open : thread->stack)
+                            {
+                                VProfileZoneSample &zone = m_Current.zones[open.node];
+                                zone.durationNs += DeltaNs(open.segmentStart, boundary);
+                                zone.callCount++;
+                            }
+                        }
+
+                        m_Current.durationNs = DeltaNs(m_FrameStartTicks, boundary);
+                        PushHistory();
+                    }
+
+                    RemoveExitedThreads();
+
+                    if (m_CapturePending)
+                    {
+                        m_CapturePending    = false;
+                        m_Capturing         = true;
+                        m_CaptureStartTicks = boundary;
+                        m_CaptureDropped    = CountDroppedZones();
+                        m_CaptureTimer.record();
+                    }
+
+                    m_Recording          = true;
+                    m_FrameStartTicks    = boundary;
+                    m_Current.frameIndex = frameIndex;
+                    m_Current.startNs    = TicksToNs(boundary);
+                    m_Current.durationNs = 0;
+                    m_Current.zones.clear();
+                    m_Links.clear();
+
+                    for (auto &thread : m_Threads)
+                    {
+                        thread->firstRoot = NO_NODE;
+                        for (size_t i = 0; i < thread->stack.size(); ++i)
+                        {
+                            VOpenZone     &open   = thread->stack[i];
+                            const uint32_t parent = i == 0 ? NO_NODE : thread->stack[i - 1].node;
+                            open.node             = GetOrCreateNode(*thread, parent, open.name, boundary, static_cast<uint16_t>(i));
+                            open.segmentStart     = boundary;
+                        }
+                    }
+                    return captured;
+                }
+
+                VProfileCounter &GetCounter(const char *name, EProfileCounterMode mode)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    for (auto &counter : m_Counters)
+                    {
+                        if (counter->GetName() == name) return *counter;
+                    }
+                    return *m_Counters.emplace_back(std::make_unique<VProfileCounter>(name, mode));
+                }
+
+                bool BeginCapture(uint32_t frames, const std::string &path)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    if (frames == 0 || m_CapturePending || m_Capturing) return false;
+
+                    m_CapturePending = true;
+                    m_CaptureFrames  = frames;
+                    m_CapturePath    = path;
+                    m_Capture        = VProfileCapture();
+                    return true;
+                }
+
+                bool IsCapturing()
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    return m_CapturePending || m_Capturing;
+                }
+
+                // Ends the running capture now, the current frame is included up to this point
+                bool EndCapture(VFinishedCapture &finished)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_CapturePending = false;
+                    if (!m_Capturing) return false;
+
+                    const uint64_t now = GetProfilerTicks();
+                    for (auto &thread : m_Threads)
+                    {
+                        Drain(*thread, now);
+                    }
+                    m_Capture.frames.push_back({m_Current.frameIndex, TicksToNs(m_FrameStartTicks), DeltaNs(m_FrameStartTicks, now)});
+                    FinishCapture(now, finished);
+                    return true;
+                }
+
+                void SetHistorySize(size_t frames)
+                {
+                    frames = std::max<size_t>(frames, 1);
+
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    TVector<VProfileFrame> ordered;
+                    const size_t           keep = std::min(frames, m_History.size());
+                    ordered.reserve(frames);
+                    for (size_t i = m_History.size() - keep; i < m_History.size(); ++i)
+                    {
+                        ordered.push_back(std::move(HistoryAt(i)));
+                    }
+                    m_History     = std::move(ordered);
+                    m_HistoryNext = 0;
+                    m_HistorySize = frames;
+                }
+
+                size_t GetHistorySize()
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    return m_HistorySize;
+                }
+
+                TVector<VProfileFrame> GetLastFrames(size_t count)
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    count = std::min(count, m_History.size());
+
+                    TVector<VProfileFrame> frames;
+                    frames.reserve(count);
+                    for (size_t i = m_History.size() - count; i < m_History.size(); ++i)
+                    {
+                        frames.push_back(HistoryAt(i));
+                    }
+                    return frames;
+                }
+
+                TVector<VProfileZoneStats> GetZoneStats()
+                {
+                    struct VAccumulator
+                    {
+                            VProfileZoneStats stats;
+                            TVector<double>   samples;
+                            uint64_t          calls = 0;
+                    };
+
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+
+                    TVector<VAccumulator>                                           accumulators;
+                    VE::Internal::Core::Container::TFlatHashMap<std::string, uint32_t> lookup;
+                    TVector<std::string>                                            paths;
+                    std::string                                                     key;
+
+                    for (size_t f = 0; f < m_History.size(); ++f)
+                    {
+                        const VProfileFrame &frame = HistoryAt(f);
+                        paths.resize(frame.zones.size());
+
+                        for (size_t i = 0; i < frame.zones.size(); ++i)
+                        {
+                            const VProfileZoneSample &zone = frame.zones[i];
+                            paths[i].assign(zone.parent == NO_NODE ? std::string() : paths[zone.parent] + "/");
+                            paths[i].append(zone.name);
+
+                            key.assign(std::to_string(zone.threadId)).append(":").append(paths[i]);
+                            auto [it, inserted] = lookup.try_emplace(key, static_cast<uint32_t>(accumulators.size()));
+                            if (inserted)
+                            {
+                                VAccumulator &accumulator  = accumulators.emplace_back();
+                                accumulator.stats.path     = paths[i];
+                                accumulator.stats.name     = zone.name;
+                                accumulator.stats.threadId = zone.threadId;
+                                accumulator.stats.depth    = zone.depth;
+                            }
+
+                            VAccumulator &accumulator = accumulators[it->second];
+                            accumulator.samples.push_back(static_cast<double>(zone.durationNs) * 1e-6);
+                            accumulator.calls += zone.callCount;
+                        }
+                    }
+
+                    TVector<VProfileZoneStats> result;
+                    result.reserve(accumulators.size());
+                    for (VAccumulator &accumulator : accumulators)
+                    {
+                        Summarize(accumulator.stats, accumulator.samples);
+                        accumulator.stats.avgCalls = static_cast<double>(accumulator.calls) / static_cast<double>(accumulator.samples.size());
+                        result.push_back(std::move(accumulator.stats));
+                    }
+                    return result;
+                }
+
+                VProfileZoneStats GetFrameStats()
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+
+                    VProfileZoneStats stats;
+                    stats.path = "Frame";
+                    stats.name = "Frame";
+
+                    TVector<double> samples;
+                    samples.reserve(m_History.size());
+                    for (size_t f = 0; f < m_History.size(); ++f)
+                    {
+                        samples.push_back(static_cast<double>(HistoryAt(f).durationNs) * 1e-6);
+                    }
+                    Summarize(stats, samples);
+                    stats.avgCalls = samples.empty() ? 0.0 : 1.0;
+                    return stats;
+                }
+
+                uint64_t GetDroppedZones()
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    return CountDroppedZones();
+                }
+
+            private:
+                uint64_t CountDroppedZones() const
+                {
+                    uint64_t dropped = m_ExitedDroppedZones;
+                    for (auto &thread : m_Threads)
+                    {
+                        dropped += thread->state->droppedZones.load(std::memory_order_relaxed);
+                    }
+                    return dropped;
+                }
+
+                void CaptureZone(const VThreadCollector &thread, const VOpenZone &open, uint16_t depth, uint64_t endTicks)
+                {
+                    const uint64_t start = std::max(open.startTicks, m_CaptureStartTicks);
+                    m_Capture.zones.push_back({open.name, TicksToNs(start), DeltaNs(start, endTicks), thread.state->threadId, depth});
+                }
+
+                // Zones still open are cut at endTicks, the capture is moved to finished
+                void FinishCapture(uint64_t endTicks, VFinishedCapture &finished)
+                {
+                    VE::Internal::Core::Container::TFlatHashMap<uint32_t, bool> seen;
+                    for (auto &thread : m_Threads)
+                    {
+                        for (size_t i = 0; i < thread->stack.size(); ++i)
+                        {
+                            CaptureZone(*thread, thread->stack[i], static_cast<uint16_t>(i), endTicks);
+                        }
+                    }
+                    for (const VProfileTraceZone &zone : m_Capture.zones)
+                    {
+                        if (!seen.try_emplace(zone.threadId, true).second) continue;
+                        auto it = m_ThreadNames.find(zone.threadId);
+                        m_Capture.threads.push_back({zone.threadId, it != m_ThreadNames.end() ? it->second : "Thread " + std::to_string(zone.threadId)});
+                    }
+                    std::sort(m_Capture.threads.begin(), m_Capture.threads.end(), [](const VProfileTraceThread &a, const VProfileTraceThread &b) { return a.threadId < b.threadId; });
+
+                    m_Capture.droppedZones = CountDroppedZones() - m_CaptureDropped;
+                    m_Capture.wallSeconds  = m_CaptureTimer.elapsed_seconds();
+
+                    finished.capture = std::move(m_Capture);
+                    finished.path    = std::move(m_CapturePath);
+                    m_Capture        = VProfileCapture();
+                    m_Capturing      = false;
+                }
+
+                // Refines the tick rate from the time since startup
+                void Calibrate()
+                {
+#if VANTOR_PROFILER_RDTSC
+                    const uint64_t ticks = GetProfilerTicks();
+                    const uint64_t ns    = SteadyNs();
+                    if (ticks > m_EpochTicks && ns - m_EpochNs >= MIN_CALIBRATION_NS)
+                    {
+                        m_NsPerTick.store(static_cast<double>(ns - m_EpochNs) / static_cast<double>(ticks - m_EpochTicks), std::memory_order_relaxed);
+                    }
+#endif
+                }
+
+                // Processes the thread's events up to boundary, later ones belong to the next frame
+                void Drain(VThreadCollector &thread, uint64_t boundary)
+                {
+                    const VProfileEvent *event;
+                    while ((event = thread.state->buffer.Peek()) != nullptr && event->ticks <= boundary)
+                    {
+                        if (event->name != nullptr)
+                        {
+                            const uint32_t parent = thread.stack.empty() ? NO_NODE : thread.stack.back().node;
+                            const uint32_t node   = m_Recording ? GetOrCreateNode(thread, parent, event->name, event->ticks, static_cast<uint16_t>(thread.stack.size())) : NO_NODE;
+                            thread.stack.push_back({event->name, node, event->ticks, event->ticks});
+                        }
+                        else if (!thread.stack.empty())
+                        {
+                            const VOpenZone open = thread.stack.back();
+                            thread.stack.pop_back();
+                            if (m_Capturing) CaptureZone(thread, open, static_cast<uint16_t>(thread.stack.size()), event->ticks);
+                            if (open.node != NO_NODE)
+                            {
+                                VProfileZoneSample &zone = m_Current.zones[open.node];
+                                zone.durationNs += DeltaNs(open.segmentStart, event->ticks);
+                                zone.callCount++;
+                            }
+                        }
+                        thread.state->buffer.Pop();
+                    }
+                }
+
+                // Zone name below parent in the current frame, created on first use
+                uint32_t GetOrCreateNode(VThreadCollector &thread, uint32_t parent, const char *name, uint64_t startTicks, uint16_t depth)
+                {
+                    const uint32_t first = parent == NO_NODE ? thread.firstRoot : m_Links[parent].firstChild;
+                    for (uint32_t node = first; node != NO_NODE; node = m_Links[node].nextSibling)
+                    {
+                        if (SameName(m_Current.zones[node].name, name)) return node;
+                    }
+
+                    const uint32_t      node = static_cast<uint32_t>(m_Current.zones.size());
+                    VProfileZoneSample &zone = m_Current.zones.emplace_back();
+                    zone.name                = name;
+                    zone.startNs             = TicksToNs(startTicks);
+                    zone.parent              = parent;
+                    zone.threadId            = thread.state->threadId;
+                    zone.depth               = depth;
+
+                    VNodeLinks &links = m_Links.emplace_back();
+                    links.nextSibling = first;
+                    if (parent == NO_NODE) thread.firstRoot = node;
+                    else m_Links[parent].firstChild = node;
+                    return node;
+                }
+
+                void RemoveExitedThreads()
+                {
+                    for (size_t i = 0; i < m_Threads.size();)
+                    {
+                        VProfileThreadState &state = *m_Threads[i]->state;
+                        if (state.retired.load(std::memory_order_acquire) && state.buffer.Peek() == nullptr)
+                        {
+                            m_ExitedDroppedZones += state.droppedZones.load(std::memory_order_relaxed);
+                            m_Threads.erase(&m_Threads[i]);
+                        }
+                        else
+                        {
+                            ++i;
+                        }
+                    }
+                }
+
+                void PushHistory()
+                {
+                    if (m_History.size() < m_HistorySize)
+                    {
+                        m_History.push_back(std::move(m_Current));
+                        m_Current = VProfileFrame();
+                        return;
+                    }
+
+                    // Swap with the oldest frame to reuse its zone storage
+                    std::swap(m_History[m_HistoryNext], m_Current);
+                    m_HistoryNext = (m_HistoryNext + 1) % m_History.size();
+                }
+
+                // i-th kept frame, oldest first
+                VProfileFrame &HistoryAt(size_t i) { return m_History[(m_HistoryNext + i) % m_History.size()]; }
+
+                static void Summarize(VProfileZoneStats &stats, TVector<double> &samples)
+                {
+                    stats.frames = static_cast<uint32_t>(samples.size());
+                    if (samples.empty()) return;
+
+                    std::sort(samples.begin(), samples.end());
+                    double sum = 0.0;
+                    for (double sample : samples)
+                    {
+                        sum += sample;
+                    }
+                    stats.minMs = samples.front();
+                    stats.maxMs = samples.back();
+                    stats.avgMs = sum / static_cast<double>(samples.size());
+
+                    const size_t rank = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(samples.size())));
+                    stats.p99Ms       = samples[std::max<size_t>(rank, 1) - 1];
+                }
+
+                std::mutex                                 m_Mutex;
+                TVector<std::shared_ptr<VThreadCollector>> m_Threads;
+                uint32_t                                   m_NextThreadId       = 1;
+                VE::Internal::Core::Container::TFlatHashMap<uint32_t, std::string> m_ThreadNames; // kept after the threads exit
+                uint64_t                                   m_ExitedDroppedZones = 0;
+
+                uint64_t            m_EpochTicks = 0;
+                uint64_t            m_EpochNs    = 0;
+                std::atomic<double> m_NsPerTick{1.0};
+
+                bool                   m_Recording       = false; // false until the first BeginFrame()
+                uint64_t               m_FrameStartTicks = 0;
+                VProfileFrame          m_Current;
+                TVector<VNodeLinks>    m_Links;
+                TVector<VProfileFrame> m_History; // ring once full
+                size_t                 m_HistoryNext = 0;
+                size_t                 m_HistorySize = DEFAULT_HISTORY_SIZE;
+
+                TVector<std::unique_ptr<VProfileCounter>> m_Counters; // never removed, handles stay valid
+
+                bool            m_CapturePending    = false; // starts with the next frame
+                bool            m_Capturing         = false;
+                uint32_t        m_CaptureFrames     = 0;
+                uint64_t        m_CaptureStartTicks = 0;
+                uint64_t        m_CaptureDropped    = 0; // dropped zones when the capture started
+                std::string     m_CapturePath;
+                VProfileCapture m_Capture;
+                VTimer          m_CaptureTimer;
+        };
+
+        // Leaked on purpose, zones may still end while statics are destroyed
+        VProfilerState &GetState()
+        {
+            static VProfilerState *state = new VProfilerState();
+            return *state;
+        }
+
+        thread_local bool t_ProfileStateReleased = false;
+
+        struct VProfileStateOwner
+        {
+                std::shared_ptr<VProfileThreadState> state;
+
+                ~VProfileStateOwner()
+                {
+                    if (state) state->retired.store(true, std::memory_order_release);
+                    Detail::t_ProfileState = nullptr;
+                    t_ProfileStateReleased = true;
+                }
+        };
+    } // namespace
+
+    namespace Detail
+    {
+        VProfileThreadState *AcquireProfileState()
+        {
+            if (t_ProfileState == nullptr && !t_ProfileStateReleased)
+            {
+                thread_local VProfileStateOwner owner;
+                owner.state    = GetState().CreateThreadState();
+                t_ProfileState = owner.state.get();
+            }
+            return t_ProfileState;
+        }
+    } // namespace Detail
+
+    void VProfiler::SetThreadName(const std::string &name)
+    {
+        if (Detail::VProfileThreadState *state = Detail::AcquireProfileState()) GetState().SetThreadName(state->threadId, name);
+    }
+
+    std::string VProfiler::GetThreadName(uint32_t threadId) { return GetState().GetThreadName(threadId); }
+
+    uint32_t VProfiler::GetCurrentThreadId()
+    {
+        Detail::VProfileThreadState *state = Detail::AcquireProfileState();
+        return state != nullptr ? state->threadId : 0;
+    }
+
+    namespace
+    {
+        void WriteCapture(const VFinishedCapture &finished)
+        {
+            VTimer timer;
+            if (!WriteChromeTrace(finished.capture, finished.path))
+            {
+                VE_LOG(ERR, "Profiler", "Failed to write the profiler capture to {}", finished.path);
+                return;
+            }
+            VE_LOG(INFO, "Profiler", "Wrote {} frames ({} zones) to {} in {} ms", finished.capture.frames.size(), finished.capture.zones.size(), finished.path,
+                   timer.elapsed_milliseconds());
+        }
+    } // namespace
+
+    void VProfiler::BeginFrame(uint64_t frameIndex)
+    {
+        VFinishedCapture finished;
+        if (GetState().BeginFrame(frameIndex, finished)) WriteCapture(finished);
+    }
+
+    void   VProfiler::SetHistorySize(size_t frames) { GetState().SetHistorySize(frames); }
+    size_t VProfiler::GetHistorySize() { return GetState().GetHistorySize(); }
+
+    VE::Internal::Core::Container::TVector<VProfileFrame>     VProfiler::GetLastFrames(size_t count) { return GetState().GetLastFrames(count); }
+    VE::Internal::Core::Container::TVector<VProfileZoneStats> VProfiler::GetZoneStats() { return GetState().GetZoneStats(); }
+    VProfileZoneStats                                         VProfiler::GetFrameStats() { return GetState().GetFrameStats(); }
+
+    uint64_t VProfiler::GetDroppedZones() { return GetState().GetDroppedZones(); }
+    uint64_t VProfiler::GetTimeNs() { return GetState().TicksToNs(GetProfilerTicks()); }
+
+    VProfileCounter &VProfiler::GetCounter(const char *name, EProfileCounterMode mode) { return GetState().GetCounter(name, mode); }
+
+    bool VProfiler::BeginCapture(uint32_t frames, const std::string &path) { return GetState().BeginCapture(frames, path); }
+
+    bool VProfiler::BeginCaptureFromEnvironment()
+    {
+        const char *frames = std::getenv("VANTOR_PROFILE_CAPTURE");
+        if (frames == nullptr) return false;
+
+        const long count = std::strtol(frames, nullptr, 10);
+        if (count <= 0)
+        {
+            VE_LOG(WARNING, "Profiler", "VANTOR_PROFILE_CAPTURE must be a frame count, got \"{}\"", frames);
+            return false;
+        }
+
+        const char *path = std::getenv("VANTOR_PROFILE_CAPTURE_FILE");
+        return BeginCapture(static_cast<uint32_t>(count), path != nullptr && path[0] != '\0' ? path : DEFAULT_CAPTURE_FILE);
+    }
+
+    void VProfiler::EndCapture()
+    {
+        VFinishedCapture finished;
+        if (GetState().EndCapture(finished)) WriteCapture(finished);
+    }
+
+    bool VProfiler::IsCapturing() { return GetState().IsCapturing(); }
+} // namespace VE::Internal::Core::Profiler
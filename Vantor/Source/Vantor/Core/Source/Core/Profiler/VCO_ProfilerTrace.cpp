@@ -0,0 +1,156 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Profiler/VCO_ProfilerTrace.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string_view>
+
+namespace VE::Internal::Core::Profiler
+{
+    namespace
+    {
+        constexpr uint32_t TRACE_PID       = 1;
+        constexpr uint32_t FRAME_TRACK_TID = 0; // profiler thread ids start at 1
+
+        void AppendJsonString(std::string &out, std::string_view str)
+        {
+            out.push_back('"');
+            for (const char c : str)
+            {
+                switch (c)
+                {
+                    case '"':
+                        out.append("\\\"");
+                        break;
+                    case '\\':
+                        out.append("\\\\");
+                        break;
+                    case '\n':
+                        out.append("\\n");
+                        break;
+                    case '\t':
+                        out.append("\\t");
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20)
+                        {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                            out.append(escaped);
+                        }
+                        else
+                        {
+                            out.push_back(c);
+                        }
+                        break;
+                }
+            }
+            out.push_back('"');
+        }
+
+        // Trace timestamps are microseconds, the fraction keeps the nanoseconds
+        void AppendMicroseconds(std::string &out, uint64_t ns)
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%llu.%03u", static_cast<unsigned long long>(ns / 1000), static_cast<unsigned>(ns % 1000));
+            out.append(buffer);
+        }
+
+        void AppendThreadMetadata(std::string &out, uint32_t tid, std::string_view name, int sortIndex)
+        {
+            char buffer[96];
+            std::snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":", TRACE_PID, tid);
+            out.append(buffer);
+            AppendJsonString(out, name);
+            std::snprintf(buffer, sizeof(buffer), "}},\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"sort_index\":%d}},\n", TRACE_PID, tid,
+                          sortIndex);
+            out.append(buffer);
+        }
+
+        void AppendSlice(std::string &out, std::string_view name, const char *category, uint32_t tid, uint64_t startNs, uint64_t durationNs)
+        {
+            char buffer[96];
+            out.append("{\"name\":");
+            AppendJsonString(out, name);
+            std::snprintf(buffer, sizeof(buffer), ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":", category, TRACE_PID, tid);
+            out.append(buffer);
+            AppendMicroseconds(out, startNs);
+            out.append(",\"dur\":");
+            AppendMicroseconds(out, durationNs);
+            out.append("},\n");
+        }
+    } // namespace
+
+    std::string ToChromeTraceJson(const VProfileCapture &capture)
+    {
+        std::string out;
+        out.reserve(256 + capture.zones.size() * 112 + capture.frames.size() * 224 + capture.counters.size() * 96);
+        out.append("{\"traceEvents\":[\n");
+
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer), "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"Vantor Engine\"}},\n", TRACE_PID);
+        out.append(buffer);
+
+        AppendThreadMetadata(out, FRAME_TRACK_TID, "Frames", -1);
+        for (const VProfileTraceThread &thread : capture.threads)
+        {
+            AppendThreadMetadata(out, thread.threadId, thread.name, static_cast<int>(thread.threadId));
+        }
+
+        std::string frameName;
+        for (const VProfileTraceFrame &frame : capture.frames)
+        {
+            frameName.assign("Frame ").append(std::to_string(frame.frameIndex));
+            AppendSlice(out, frameName, "frame", FRAME_TRACK_TID, frame.startNs, frame.durationNs);
+
+            // Global instant event, drawn as a line across all tracks
+            out.append("{\"name\":");
+            AppendJsonString(out, frameName);
+            std::snprintf(buffer, sizeof(buffer), ",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":%u,\"tid\":%u,\"ts\":", TRACE_PID, FRAME_TRACK_TID);
+            out.append(buffer);
+            AppendMicroseconds(out, frame.startNs);
+            out.append("},\n");
+        }
+
+        for (const VProfileTraceZone &zone : capture.zones)
+        {
+            AppendSlice(out, zone.name, "zone", zone.threadId, zone.startNs, zone.durationNs);
+        }
+
+        for (const VProfileTraceCounter &counter : capture.counters)
+        {
+            out.append("{\"name\":");
+            AppendJsonString(out, counter.name);
+            std::snprintf(buffer, sizeof(buffer), ",\"ph\":\"C\",\"pid\":%u,\"ts\":", TRACE_PID);
+            out.append(buffer);
+            AppendMicroseconds(out, counter.timeNs);
+            std::snprintf(buffer, sizeof(buffer), ",\"args\":{\"value\":%lld}},\n", static_cast<long long>(counter.value));
+            out.append(buffer);
+        }
+
+        // The last event is followed by ",\n"
+        if (out.ends_with(",\n")) out.resize(out.size() - 2);
+
+        std::snprintf(buffer, sizeof(buffer), "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"frames\":%zu,\"zones\":%zu,\"droppedZones\":%llu,\"wallSeconds\":%.6f}}\n",
+                      capture.frames.size(), capture.zones.size(), static_cast<unsigned long long>(capture.droppedZones), capture.wallSeconds);
+        out.append(buffer);
+        return out;
+    }
+
+    bool WriteChromeTrace(const VProfileCapture &capture, const std::string &path)
+    {
+        std::ofstream file(path, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open()) return false;
+        const std::string json = ToChromeTraceJson(capture);
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        return file.good();
+    }
+} // namespace VE::Internal::Core::Profiler
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <Core/Types/VCO_Name.hpp>
+
+#include <Core/Container/VCO_FlatHashMap.hpp>
+#include <Core/Container/VCO_Vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace VE::Internal::Core::Types
+{
+    namespace
+    {
+        struct VNameEntry
+        {
+                const char *str    = "";
+                uint32_t    length = 0;
+                uint32_t    hash   = HashFNV1a("");
+        };
+
+        // The lookup table reuses the FNV hash, so literals hashed at compile time are never hashed again
+        struct VNameStringHash
+        {
+                inline size_t operator()(std::string_view str) const noexcept { return HashFNV1a(str); }
+        };
+
+        class VNamePool
+        {
+            public:
+                // Entries live in fixed blocks that never move, so GetEntry() needs no lock
+                static constexpr uint32_t ENTRIES_PER_BLOCK = 4096;
+                static constexpr uint32_t MAX_BLOCKS        = 4096; // ~16M names
+                static constexpr size_t   CHUNK_SIZE        = 64 * 1024;
+
+                VNamePool()
+                {
+                    m_Blocks[0].store(new VNameEntry[ENTRIES_PER_BLOCK], std::memory_order_relaxed);
+                    m_Count.store(1, std::memory_order_relaxed); // id 0 is None
+                }
+
+                uint32_t Find(std::string_view str, uint32_t hash)
+                {
+                    std::shared_lock lock(m_Mutex);
+                    auto             it = m_Lookup.find(str, hash);
+                    return it != m_Lookup.end() ? it->second : 0;
+                }
+
+                uint32_t Intern(std::string_view str, uint32_t hash)
+                {
+                    if (str.empty()) return 0;
+                    if (uint32_t id = Find(str, hash)) return id;
+
+                    std::unique_lock lock(m_Mutex);
+                    // another thread may have added it between the two locks
+                    auto it = m_Lookup.find(str, hash);
+                    if (it != m_Lookup.end()) return it->second;
+
+                    const uint32_t id    = m_Count.load(std::memory_order_relaxed);
+                    const uint32_t block = id / ENTRIES_PER_BLOCK;
+                    assert(block < MAX_BLOCKS && "VName pool exhausted");
+                    if (m_Blocks[block].load(std::memory_order_relaxed) == nullptr)
+                    {
+                        m_Blocks[block].store(new VNameEntry[ENTRIES_PER_BLOCK], std::memory_order_release);
+                    }
+
+                    const char *copy  = CopyString(str);
+                    VNameEntry &entry = m_Blocks[block].load(std::memory_order_relaxed)[id % ENTRIES_PER_BLOCK];
+                    entry.str         = copy;
+                    entry.length      = static_cast<uint32_t>(str.size());
+                    entry.hash        = hash;
+                    m_Count.store(id + 1, std::memory_order_release);
+
+                    m_Lookup.try_emplace_hashed(hash, std::string_view(copy, str.size()), id);
+                    return id;
+                }
+
+                const VNameEntry &GetEntry(uint32_t id) const
+                {
+                    assert(id < m_Count.load(std::memory_order_acquire) && "Invalid VName id");
+                    return m_Blocks[id / ENTRIES_PER_BLOCK].load(std::memory_order_acquire)[id % ENTRIES_PER_BLOCK];
+                }
+
+                uint32_t GetCount() const { return m_Count.load(std::memory_order_acquire); }
+
+            private:
+                // Strings are packed into chunks that are never freed, long strings get their own chunk
+                const char *CopyString(std::string_view str)
+                {
+                    const size_t size = str.size() + 1;
+                    if (size > m_ChunkLeft)
+                    {
+                        const size_t chunkSize = std::max(size, CHUNK_SIZE);
+                        m_Chunks.emplace_back(new char[chunkSize]);
+                        m_ChunkCursor = m_Chunks.back().get();
+                        m_ChunkLeft   = chunkSize;
+                    }
+
+                    char *copy = m_ChunkCursor;
+                    std::memcpy(copy, str.data(), str.size());
+                    copy[str.size()] = '\0';
+                    m_ChunkCursor += size;
+                    m_ChunkLeft -= size;
+                    return copy;
+                }
+
+                std::shared_mutex                                                                         m_Mutex;
+                VE::Internal::Core::Container::TFlatHashMap<std::string_view, uint32_t, VNameStringHash> m_Lookup;
+                std::array<std::atomic<VNameEntry *>, MAX_BLOCKS>                                         m_Blocks{};
+                std::atomic<uint32_t>                                                                     m_Count{0};
+                VE::Internal::Core::Container::TVector<std::unique_ptr<char[]>>                           m_Chunks;
+                char                                                                                     *m_ChunkCursor = nullptr;
+                size_t                                                                                    m_ChunkLeft   = 0;
+        };
+
+        // Intentionally leaked: names held by other statics must stay readable during shutdown
+        VNamePool &GetPool()
+        {
+            static VNamePool *pool = new VNamePool();
+            return *pool;
+        }
+    } // namespace
+
+    VName::VName(std::string_view str, uint32_t hash)
+    {
+        assert(hash == HashFNV1a(str));
+        m_Id = GetPool().Intern(str, hash);
+#if VANTOR_NAME_DEBUG_VIEW
+        m_Debug = c_str();
+#endif
+    }
+
+    VName VName::Find(std::string_view str)
+    {
+        VName name;
+        name.m_Id = GetPool().Find(str, HashFNV1a(str));
+#if VANTOR_NAME_DEBUG_VIEW
+        name.m_Debug = name.c_str();
+#endif
+        return name;
+    }
+
+    uint32_t VName::GetPoolSize() { return GetPool().GetCount(); }
+
+    std::string_view VName::GetString() const
+    {
+        const VNameEntry &entry = GetPool().GetEntry(m_Id);
+        return std::string_view(entry.str, entry.length);
+    }
+
+    uint32_t VName::GetHash() const { return GetPool().GetEntry(m_Id).hash; }
+} // namespace VE::Internal::Core::Types
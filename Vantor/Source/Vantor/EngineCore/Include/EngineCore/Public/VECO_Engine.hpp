@@ -10,6 +10,7 @@
 #pragma once
 
 #include <memory>
+#include <cstdint>
 
 namespace VE::Internal::RHI {
     class IRHIDevice;
@@ -23,7 +24,18 @@ namespace VE::Internal::AssetManager {
     class VAssetManager;
 }
 
+namespace VE::Internal::Core::Memory {
+    class VFrameAllocator;
+}
+
+namespace VE::Internal::Core::Jobs {
+    class VJobSystem;
+    class VTaskScheduler;
+}
+
 namespace VE {
+
+    class VFrameLoop;
     
     class VEngine {
     public:
@@ -38,13 +50,36 @@ namespace VE {
         VE::Internal::RHI::IRHIDevice* GetDevice() const { return m_Device.get(); }
         VE::Internal::InputDevice::VInputManager* GetInputMngr() const { return m_InputManager.get(); }
         VE::Internal::AssetManager::VAssetManager* GetAssetMngr() const { return m_AssetManager.get(); }
+        // Per-frame scratch memory, everything allocated from it is valid for FRAME_BUFFER_COUNT frames
+        VE::Internal::Core::Memory::VFrameAllocator* GetFrameAllocator() const { return m_FrameAllocator.get(); }
+        // Worker pool for parallel engine and game work, created before all other subsystems
+        VE::Internal::Core::Jobs::VJobSystem* GetJobSystem() const { return m_JobSystem.get(); }
+        // Fixed step frame loop, Update() is its first PreUpdate hook. Run it or call Update() from an own loop.
+        VFrameLoop* GetFrameLoop() const { return m_FrameLoop.get(); }
+        // Coroutine tasks on the job system, the main thread part runs at the start of Update()
+        VE::Internal::Core::Jobs::VTaskScheduler* GetTaskScheduler() const { return m_TaskScheduler.get(); }
+
+        // Number of Update() calls since Initialize()
+        uint64_t GetFrameCount() const { return m_FrameCount; }
+
+        static constexpr size_t   FRAME_ARENA_SIZE   = 4u * 1024u * 1024u; // 4 MiB per buffered frame
+        static constexpr uint32_t FRAME_BUFFER_COUNT = 2;
 
         // TODO: Get Subsystems
     private:
+        // Frame counters of the profiler that are not counted where they happen
+        void PublishProfilerCounters();
+
         std::shared_ptr<Internal::RHI::IRHIDevice> m_Device = nullptr;
 
         std::shared_ptr<Internal::InputDevice::VInputManager> m_InputManager = nullptr;
         std::shared_ptr<Internal::AssetManager::VAssetManager> m_AssetManager = nullptr;
+        std::shared_ptr<Internal::Core::Memory::VFrameAllocator> m_FrameAllocator = nullptr;
+        std::shared_ptr<Internal::Core::Jobs::VJobSystem> m_JobSystem = nullptr;
+        std::shared_ptr<Internal::Core::Jobs::VTaskScheduler> m_TaskScheduler = nullptr;
+        std::shared_ptr<VFrameLoop> m_FrameLoop = nullptr;
+
+        uint64_t m_FrameCount = 0;
     };
 
     inline VEngine* GEngine() {
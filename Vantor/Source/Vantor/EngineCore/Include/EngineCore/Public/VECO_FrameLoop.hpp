@@ -0,0 +1,123 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <Core/Container/VCO_Vector.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+// Engine frame loop with a fixed simulation step and a variable render rate.
+//
+// Every frame runs the hooks of each phase in order:
+//
+//     PreUpdate   once, e.g. input and window events
+//     Update      once per fixed tick, zero or more times, with VFrameTime::fixedDeltaSeconds
+//     PostUpdate  once, after the last tick of the frame
+//     Render      once, interpolating between the last two ticks with VFrameTime::alpha
+//
+// The wall clock time of each frame is added to an accumulator, and a tick runs for every fixed step
+// it holds. At most maxTicksPerFrame ticks run per frame, time beyond that is dropped so a slow frame
+// can not make the next one slower. With a target frame rate the loop sleeps until shortly before
+// the next frame is due and spins for the rest, since sleeping alone overshoots by up to a scheduler
+// quantum.
+//
+// Nothing here needs a window or a device. With lockstep set every frame runs exactly one tick
+// without looking at the clock, which is how headless runs measure simulation throughput.
+
+namespace VE {
+
+    enum class EFramePhase : uint8_t {
+        PreUpdate = 0,
+        Update,     // fixed step
+        PostUpdate,
+        Render,
+        Count
+    };
+
+    struct VFrameTime {
+        double   deltaSeconds         = 0.0; // wall clock time of the last frame, clamped to maxDeltaSeconds
+        double   smoothedDeltaSeconds = 0.0; // exponential moving average of deltaSeconds, for display and effects
+        double   fixedDeltaSeconds    = 0.0;
+        double   alpha                = 0.0; // fraction of a tick the accumulator holds, 0 at the previous tick and 1 at the last
+        double   simulationSeconds    = 0.0; // tickIndex * fixedDeltaSeconds
+        uint64_t frameIndex           = 0;
+        uint64_t tickIndex            = 0;   // ticks run so far, during Update the index of the running tick
+        uint32_t ticksThisFrame       = 0;
+    };
+
+    struct VFrameLoopDesc {
+        double   fixedTimestep    = 1.0 / 60.0;
+        uint32_t maxTicksPerFrame = 8;
+        double   maxDeltaSeconds  = 0.25;  // longer frames (breakpoints, loading hitches) count as this long
+        double   targetFrameRate  = 0.0;   // frames per second, 0 renders as fast as possible
+        double   spinSeconds      = 0.002; // pacing spins instead of sleeping for the last part of a frame
+        double   smoothing        = 0.1;   // weight of the newest frame in smoothedDeltaSeconds
+        bool     lockstep         = false; // one tick per frame regardless of the clock
+    };
+
+    class VFrameLoop {
+    public:
+        using VHook       = std::function<void(const VFrameTime&)>;
+        using VHookHandle = uint32_t;
+
+        static constexpr VHookHandle INVALID_HOOK = 0;
+
+        explicit VFrameLoop(const VFrameLoopDesc& desc = VFrameLoopDesc());
+
+        // Hooks of a phase run by ascending order, equal orders in the order they were added.
+        // Adding and removing is allowed from inside a hook, it takes effect with the next phase.
+        VHookHandle AddHook(EFramePhase phase, VHook hook, int32_t order = 0);
+        void RemoveHook(VHookHandle handle);
+
+        // Runs one frame of all phases, then waits for the target frame rate
+        void RunFrame();
+        // Runs frames until keepRunning returns false or RequestStop() is called
+        void Run(const std::function<bool()>& keepRunning = nullptr);
+        void RequestStop() { m_StopRequested = true; }
+        bool IsStopRequested() const { return m_StopRequested; }
+
+        const VFrameTime& GetTime() const { return m_Time; }
+        const VFrameLoopDesc& GetDesc() const { return m_Desc; }
+        void SetTargetFrameRate(double framesPerSecond) { m_Desc.targetFrameRate = framesPerSecond; }
+        // Accumulated time dropped by the maxTicksPerFrame limit
+        double GetDroppedSeconds() const { return m_DroppedSeconds; }
+
+    private:
+        using VClock = std::chrono::steady_clock;
+
+        struct VHookEntry {
+            VHook       hook;
+            VHookHandle handle = INVALID_HOOK;
+            int32_t     order  = 0;
+        };
+
+        void RunPhase(EFramePhase phase);
+        void ApplyPendingHooks();
+        void WaitForNextFrame();
+
+        VFrameLoopDesc m_Desc;
+        VFrameTime     m_Time;
+
+        VE::Internal::Core::Container::TVector<VHookEntry> m_Hooks[static_cast<size_t>(EFramePhase::Count)];
+        VE::Internal::Core::Container::TVector<std::pair<EFramePhase, VHookEntry>> m_AddedHooks;
+        VE::Internal::Core::Container::TVector<VHookHandle> m_RemovedHooks;
+        VHookHandle m_NextHandle = 1;
+
+        VClock::time_point m_LastFrameStart{};
+        VClock::time_point m_NextFrameDue{};
+        bool   m_Started        = false;
+        bool   m_InPhase        = false; // hooks added or removed meanwhile wait in m_AddedHooks/m_RemovedHooks
+        bool   m_StopRequested  = false;
+        double m_Accumulator    = 0.0;
+        double m_DroppedSeconds = 0.0;
+    };
+}
@@ -8,6 +8,7 @@
  ****************************************************************************/
 
 #include <EngineCore/Public/VECO_Engine.hpp>
+#include <EngineCore/Public/VECO_FrameLoop.hpp>
 
 #include <RHI/Interface/VRHI_Device.hpp>
 #include <RHI/VRHI_Coordinator.hpp>
@@ -16,6 +17,15 @@
 
 #include <AssetManager/Manager/VAM_AssetManager.hpp>
 
+#include <Core/BackLog/VCO_BinaryLog.hpp>
+#include <Core/Jobs/VCO_JobSystem.hpp>
+#include <Core/Jobs/VCO_Task.hpp>
+#include <Core/Memory/VCO_FrameAllocator.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <cstdint>
+
 namespace VE {
 
     VEngine::VEngine() {
@@ -27,10 +37,24 @@ namespace VE {
     }
 
     void VEngine::Initialize() {
+        // First, so the binary log also gets everything logged during start up
+        VE::Internal::Core::Backlog::AddBinaryLogSinkFromEnvironment();
+        VE::Internal::Core::Profiler::VProfiler::SetThreadName("Main");
+        VE::Internal::Core::Profiler::VProfiler::BeginCaptureFromEnvironment();
+
+        m_JobSystem = std::make_shared<VE::Internal::Core::Jobs::VJobSystem>();
+        m_TaskScheduler = std::make_shared<VE::Internal::Core::Jobs::VTaskScheduler>(*m_JobSystem);
+
         // TODO: Make Render API Choice automatically
         m_Device = VE::Internal::RHI::VRDCoordinator::Instance().CreateDevice(VE::Internal::RHI::EGraphicsAPI::OPENGL);
         m_InputManager = std::make_shared<VE::Internal::InputDevice::VInputManager>();
         m_AssetManager = std::make_shared<VE::Internal::AssetManager::VAssetManager>();
+        m_FrameAllocator = std::make_shared<VE::Internal::Core::Memory::VFrameAllocator>();
+        m_FrameAllocator->Initialize(FRAME_ARENA_SIZE, FRAME_BUFFER_COUNT, VE::Internal::Core::Memory::EMemoryTag::RenderPipeline);
+        m_FrameCount = 0;
+
+        m_FrameLoop = std::make_shared<VFrameLoop>();
+        m_FrameLoop->AddHook(EFramePhase::PreUpdate, [this](const VFrameTime&) { Update(); }, INT32_MIN);
 
         // TODO: Initialize subsystems here
         m_Device->Initialize();
@@ -38,12 +62,51 @@ namespace VE {
     }
 
     void VEngine::Update() {
+        m_FrameCount++;
+
+        // Closes the previous frame's memory stats, published as its counters before the profiler ends it
+        VE::Internal::Core::Memory::VMemoryTracker::BeginFrame();
+        PublishProfilerCounters();
+
+        VE::Internal::Core::Profiler::VProfiler::BeginFrame(m_FrameCount);
+        VE_PROFILE_SCOPE("VEngine::Update");
+
+        m_FrameAllocator->BeginFrame();
+        m_Device->BeginFrame(m_FrameCount);
+
         m_InputManager->Update();
+
+        // Tasks waiting for this frame or for the main thread, e.g. GPU uploads of async asset loads
+        m_TaskScheduler->BeginFrame();
+    }
+
+    void VEngine::PublishProfilerCounters() {
+        uint64_t allocations = 0;
+        for (size_t i = 0; i < static_cast<size_t>(VE::Internal::Core::Memory::EMemoryTag::Count); ++i) {
+            allocations += VE::Internal::Core::Memory::VMemoryTracker::GetStats(static_cast<VE::Internal::Core::Memory::EMemoryTag>(i)).frameAllocationCount;
+        }
+
+        VE_PROFILE_VALUE("Allocations", allocations);
+        VE_PROFILE_VALUE("Live Memory (bytes)", VE::Internal::Core::Memory::VMemoryTracker::GetTotalLiveBytes());
+        VE_PROFILE_VALUE("Loaded Assets", m_AssetManager->GetLoadedAssetCount());
     }
 
     void VEngine::Shutdown() {
+        // Writes a capture that is still running, e.g. VANTOR_PROFILE_CAPTURE with more frames than were run
+        VE::Internal::Core::Profiler::VProfiler::EndCapture();
+
+        m_FrameLoop.reset();
+
+        // Cancels spawned tasks while the subsystems they use are still there
+        m_TaskScheduler.reset();
+
         m_Device->Shutdown();
 
         m_AssetManager->Shutdown();
+
+        m_FrameAllocator->Shutdown();
+
+        // Last, so subsystems can still wait for their jobs while shutting down
+        m_JobSystem.reset();
     }
 }
\ No newline at end of file
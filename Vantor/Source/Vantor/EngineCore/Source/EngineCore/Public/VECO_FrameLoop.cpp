@@ -0,0 +1,173 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <EngineCore/Public/VECO_FrameLoop.hpp>
+
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <utility>
+
+namespace VE {
+
+    VFrameLoop::VFrameLoop(const VFrameLoopDesc& desc) : m_Desc(desc) {
+        m_Desc.fixedTimestep    = std::max(m_Desc.fixedTimestep, 1.0e-6);
+        m_Desc.maxTicksPerFrame = std::max(m_Desc.maxTicksPerFrame, 1u);
+        m_Time.fixedDeltaSeconds = m_Desc.fixedTimestep;
+    }
+
+    VFrameLoop::VHookHandle VFrameLoop::AddHook(EFramePhase phase, VHook hook, int32_t order) {
+        VHookEntry entry;
+        entry.hook   = std::move(hook);
+        entry.handle = m_NextHandle++;
+        entry.order  = order;
+
+        const VHookHandle handle = entry.handle;
+        m_AddedHooks.emplace_back(phase, std::move(entry));
+        if (!m_InPhase) ApplyPendingHooks();
+        return handle;
+    }
+
+    void VFrameLoop::RemoveHook(VHookHandle handle) {
+        if (handle == INVALID_HOOK) return;
+        m_RemovedHooks.push_back(handle);
+        if (!m_InPhase) ApplyPendingHooks();
+    }
+
+    void VFrameLoop::ApplyPendingHooks() {
+        for (VHookHandle handle : m_RemovedHooks) {
+            for (auto& hooks : m_Hooks) {
+                for (VHookEntry* it = hooks.begin(); it != hooks.end(); ++it) {
+                    if (it->handle == handle) {
+                        hooks.erase(it);
+                        break;
+                    }
+                }
+            }
+            // Also hooks that were added and removed within the same phase
+            for (auto* it = m_AddedHooks.begin(); it != m_AddedHooks.end(); ++it) {
+                if (it->second.handle == handle) {
+                    m_AddedHooks.erase(it);
+                    break;
+                }
+            }
+        }
+        m_RemovedHooks.clear();
+
+        // Sorted by order, a new hook goes behind those with the same order
+        for (auto& [phase, entry] : m_AddedHooks) {
+            auto& hooks = m_Hooks[static_cast<size_t>(phase)];
+            hooks.push_back(std::move(entry));
+            for (size_t i = hooks.size() - 1; i > 0 && hooks[i - 1].order > hooks[i].order; --i) {
+                std::swap(hooks[i - 1], hooks[i]);
+            }
+        }
+        m_AddedHooks.clear();
+    }
+
+    void VFrameLoop::RunPhase(EFramePhase phase) {
+        m_InPhase = true;
+        const auto& hooks = m_Hooks[static_cast<size_t>(phase)];
+        for (size_t i = 0; i < hooks.size(); ++i) {
+            hooks[i].hook(m_Time);
+        }
+        m_InPhase = false;
+
+        if (!m_AddedHooks.empty() || !m_RemovedHooks.empty()) ApplyPendingHooks();
+    }
+
+    void VFrameLoop::RunFrame() {
+        const VClock::time_point frameStart = VClock::now();
+        if (!m_Started) {
+            // The first frame has no previous one to measure, it runs a single tick
+            m_Started        = true;
+            m_LastFrameStart = frameStart - std::chrono::duration_cast<VClock::duration>(std::chrono::duration<double>(m_Desc.fixedTimestep));
+            m_NextFrameDue   = frameStart;
+        }
+
+        double delta = std::chrono::duration<double>(frameStart - m_LastFrameStart).count();
+        m_LastFrameStart = frameStart;
+        delta = std::min(delta, m_Desc.maxDeltaSeconds);
+
+        m_Time.deltaSeconds         = delta;
+        m_Time.smoothedDeltaSeconds = m_Time.frameIndex == 0 ? delta : m_Time.smoothedDeltaSeconds + (delta - m_Time.smoothedDeltaSeconds) * m_Desc.smoothing;
+        m_Time.fixedDeltaSeconds    = m_Desc.fixedTimestep;
+
+        // No profiler zone around PreUpdate, VEngine::Update() begins the profiler frame in it
+        RunPhase(EFramePhase::PreUpdate);
+
+        uint32_t ticks = 1;
+        if (!m_Desc.lockstep) {
+            m_Accumulator += delta;
+            ticks = static_cast<uint32_t>(std::min(m_Accumulator / m_Desc.fixedTimestep, static_cast<double>(m_Desc.maxTicksPerFrame)));
+            m_Accumulator -= ticks * m_Desc.fixedTimestep;
+
+            // Falling behind: drop what the ticks of this frame could not catch up with
+            if (ticks == m_Desc.maxTicksPerFrame && m_Accumulator >= m_Desc.fixedTimestep) {
+                const double keep = std::fmod(m_Accumulator, m_Desc.fixedTimestep);
+                m_DroppedSeconds += m_Accumulator - keep;
+                m_Accumulator     = keep;
+            }
+        }
+
+        m_Time.ticksThisFrame = ticks;
+        for (uint32_t tick = 0; tick < ticks; ++tick) {
+            VE_PROFILE_SCOPE("VFrameLoop::Update");
+            RunPhase(EFramePhase::Update);
+            m_Time.tickIndex++;
+            m_Time.simulationSeconds = static_cast<double>(m_Time.tickIndex) * m_Desc.fixedTimestep;
+        }
+        VE_PROFILE_VALUE("Fixed Ticks", ticks);
+
+        m_Time.alpha = m_Desc.lockstep ? 1.0 : m_Accumulator / m_Desc.fixedTimestep;
+        {
+            VE_PROFILE_SCOPE("VFrameLoop::PostUpdate");
+            RunPhase(EFramePhase::PostUpdate);
+        }
+        {
+            VE_PROFILE_SCOPE("VFrameLoop::Render");
+            RunPhase(EFramePhase::Render);
+        }
+
+        m_Time.frameIndex++;
+        WaitForNextFrame();
+    }
+
+    void VFrameLoop::Run(const std::function<bool()>& keepRunning) {
+        m_StopRequested = false;
+        while (!m_StopRequested && (!keepRunning || keepRunning())) {
+            RunFrame();
+        }
+    }
+
+    void VFrameLoop::WaitForNextFrame() {
+        if (m_Desc.targetFrameRate <= 0.0) return;
+        VE_PROFILE_SCOPE("VFrameLoop::WaitForNextFrame");
+
+        const auto period = std::chrono::duration_cast<VClock::duration>(std::chrono::duration<double>(1.0 / m_Desc.targetFrameRate));
+        const auto spin   = std::chrono::duration_cast<VClock::duration>(std::chrono::duration<double>(m_Desc.spinSeconds));
+
+        // Frames are due on a fixed grid, unless this one is a whole period late
+        m_NextFrameDue += period;
+        VClock::time_point now = VClock::now();
+        if (now > m_NextFrameDue + period) {
+            m_NextFrameDue = now;
+            return;
+        }
+
+        if (m_NextFrameDue - now > spin) {
+            std::this_thread::sleep_for(m_NextFrameDue - now - spin);
+        }
+        while (VClock::now() < m_NextFrameDue) {
+            std::this_thread::yield();
+        }
+    }
+}
@@ -19,6 +19,7 @@
 
 #include <Math/Linear/VMA_Vector.hpp>
 #include <Core/Container/VCO_Vector.hpp>
+#include <Core/Memory/VCO_MemoryTracker.hpp>
 
 namespace VE::Internal::RHI {
     class IRHIMesh;
@@ -36,9 +37,13 @@ namespace VE::Graphics {
         VE::Math::VVector3 Bitangent;
     };
 
+    // CPU side geometry is accounted to EMemoryTag::Geometry
+    template <typename T>
+    using TGeometryVector = VE::Internal::Core::Container::TVector<T, VE::Internal::Core::Memory::TTaggedAllocator<T, VE::Internal::Core::Memory::EMemoryTag::Geometry>>;
+
     struct VMesh {
-        VE::Internal::Core::Container::TVector<VVertex> vertices;
-        VE::Internal::Core::Container::TVector<uint32_t> indices;
+        TGeometryVector<VVertex> vertices;
+        TGeometryVector<uint32_t> indices;
         std::shared_ptr<VE::Internal::RHI::IRHIMesh> rhiMesh;
         std::string name;
     };
@@ -68,6 +73,10 @@ namespace VE::Graphics {
             const std::string& GetPath() const { return m_FilePath; }
             bool IsLoaded() const { return m_IsLoaded; }
 
+            // Bytes held by the meshes on the CPU and in GPU buffers
+            size_t GetCpuMemoryUsage() const;
+            size_t GetGpuMemoryUsage() const;
+
         private:
             VE::Internal::Core::Container::TVector<VMesh> m_Meshes;
             std::string m_FilePath;
@@ -77,6 +86,7 @@ namespace VE::Graphics {
             Assimp::Importer m_Importer;
 
             // Assimp processing
+            size_t CountMeshInstances(const aiNode* node);
             void ProcessNode(aiNode* node, const aiScene* scene);
             VMesh ProcessMesh(aiMesh* mesh, const aiScene* scene);
             void LoadMaterialTextures(aiMaterial* mat, aiTextureType type, const std::string& typeName);
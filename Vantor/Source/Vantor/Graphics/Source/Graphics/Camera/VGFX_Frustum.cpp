@@ -10,12 +10,16 @@
 #include <Graphics/Public/Camera/VGFX_Camera.hpp>
 #include <Graphics/Public/Camera/VGFX_Frustum.hpp>
 
+#include <Math/VMA_Common.hpp>
+#include <Math/VMA_Functions.hpp>
+
 namespace VE::Graphics
 {
 
     void VCameraFrustum::Update(ACamera *camera)
     {
-        float tan        = 2.0 * std::tan(camera->FOV * 0.5); // TODO: Write own Tan func
+        // FOV is in degrees, like everywhere else on the camera
+        float tan        = 2.0f * VE::Math::Tan(VE::Math::DegToRad(camera->FOV * 0.5f));
         float nearHeight = tan * camera->Near;
         float nearWidth  = nearHeight * camera->Aspect;
         float farHeight  = tan * camera->Far;
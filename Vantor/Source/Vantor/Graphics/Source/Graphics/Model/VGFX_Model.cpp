@@ -10,8 +10,8 @@
 #include <Graphics/Public/Model/VGFX_Model.hpp>
 #include <RHI/Interface/VRHI_Device.hpp>
 #include <RHI/Interface/VRHI_Mesh.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
-#include <iostream>
 #include <filesystem>
 
 namespace VE::Graphics {
@@ -43,19 +43,22 @@ namespace VE::Graphics {
         const aiScene* scene = m_Importer.ReadFile(path, flags);
         
         if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-            std::cerr << "VModel::LoadFromFile() - ERROR::ASSIMP::" << m_Importer.GetErrorString() << std::endl;
+            VE_LOG(ERR, "Graphics", "VModel::LoadFromFile() - ERROR::ASSIMP::{}", m_Importer.GetErrorString());
             return false;
         }
 
         // Clear any existing meshes
         m_Meshes.clear();
+        m_Meshes.reserve(CountMeshInstances(scene->mRootNode));
 
         // Process the scene
         ProcessNode(scene->mRootNode, scene);
+
+        // Everything was copied into m_Meshes, don't keep Assimp's copy of the geometry alive with the model
+        m_Importer.FreeScene();
         
         m_IsLoaded = true;
-        std::cout << "VModel::LoadFromFile() - Successfully loaded model: " << path 
-                  << " with " << m_Meshes.size() << " meshes" << std::endl;
+        VE_LOG(INFO, "Graphics", "VModel::LoadFromFile() - Successfully loaded model: {} with {} meshes", path, m_Meshes.size());
         
         return true;
     }
@@ -80,26 +83,29 @@ namespace VE::Graphics {
         const aiScene* scene = m_Importer.ReadFileFromMemory(data, size, flags, format.c_str());
         
         if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-            std::cerr << "VModel::LoadFromMemory() - ERROR::ASSIMP::" << m_Importer.GetErrorString() << std::endl;
+            VE_LOG(ERR, "Graphics", "VModel::LoadFromMemory() - ERROR::ASSIMP::{}", m_Importer.GetErrorString());
             return false;
         }
 
         // Clear any existing meshes
         m_Meshes.clear();
+        m_Meshes.reserve(CountMeshInstances(scene->mRootNode));
 
         // Process the scene
         ProcessNode(scene->mRootNode, scene);
+
+        // Everything was copied into m_Meshes, don't keep Assimp's copy of the geometry alive with the model
+        m_Importer.FreeScene();
         
         m_IsLoaded = true;
-        std::cout << "VModel::LoadFromMemory() - Successfully loaded model from memory with " 
-                  << m_Meshes.size() << " meshes" << std::endl;
+        VE_LOG(INFO, "Graphics", "VModel::LoadFromMemory() - Successfully loaded model from memory with {} meshes", m_Meshes.size());
         
         return true;
     }
 
     bool VModel::CreateGPUResources(VE::Internal::RHI::IRHIDevice* device) {
         if (!device) {
-            std::cerr << "VModel::CreateGPUResources() - Device is null" << std::endl;
+            VE_LOG(ERR, "Graphics", "VModel::CreateGPUResources() - Device is null");
             return false;
         }
 
@@ -158,7 +164,7 @@ namespace VE::Graphics {
             );
 
             if (!mesh.rhiMesh) {
-                std::cerr << "VModel::CreateGPUResources() - Failed to create GPU mesh: " << mesh.name << std::endl;
+                VE_LOG(ERR, "Graphics", "VModel::CreateGPUResources() - Failed to create GPU mesh: {}", mesh.name);
                 success = false;
             }
         }
@@ -184,7 +190,7 @@ namespace VE::Graphics {
 
     void VModel::Draw(uint32_t meshIndex) const {
         if (meshIndex >= m_Meshes.size()) {
-            std::cerr << "VModel::Draw() - Invalid mesh index: " << meshIndex << std::endl;
+            VE_LOG(ERR, "Graphics", "VModel::Draw() - Invalid mesh index: {}", meshIndex);
             return;
         }
 
@@ -203,6 +209,33 @@ namespace VE::Graphics {
         return m_Meshes[index];
     }
 
+    size_t VModel::GetCpuMemoryUsage() const {
+        size_t bytes = 0;
+        for (const auto& mesh : m_Meshes) {
+            bytes += mesh.vertices.capacity() * sizeof(VVertex) + mesh.indices.capacity() * sizeof(uint32_t);
+        }
+        return bytes;
+    }
+
+    size_t VModel::GetGpuMemoryUsage() const {
+        // Meshes may be suballocated from a shared GPU heap, so count what they use and not the buffer sizes
+        size_t bytes = 0;
+        for (const auto& mesh : m_Meshes) {
+            if (mesh.rhiMesh) {
+                bytes += size_t(mesh.rhiMesh->GetVertexCount()) * sizeof(VVertex) + size_t(mesh.rhiMesh->GetIndexCount()) * sizeof(uint32_t);
+            }
+        }
+        return bytes;
+    }
+
+    size_t VModel::CountMeshInstances(const aiNode* node) {
+        size_t count = node->mNumMeshes;
+        for (uint32_t i = 0; i < node->mNumChildren; i++) {
+            count += CountMeshInstances(node->mChildren[i]);
+        }
+        return count;
+    }
+
     void VModel::ProcessNode(aiNode* node, const aiScene* scene) {
         // Process all the node's meshes
         for (uint32_t i = 0; i < node->mNumMeshes; i++) {
@@ -220,9 +253,13 @@ namespace VE::Graphics {
         VMesh vMesh;
         vMesh.name = mesh->mName.C_Str();
 
+        // Size the buffers once up front, VVertex and uint32_t are relocated with memcpy if they still have to grow
+        vMesh.vertices.reserve(mesh->mNumVertices);
+        vMesh.indices.reserve(size_t(mesh->mNumFaces) * 3); // faces are triangulated on import
+
         // Process vertices
         for (uint32_t i = 0; i < mesh->mNumVertices; i++) {
-            VVertex vertex;
+            VVertex vertex{};
 
             // Position
             vertex.Position = AssimpVec3ToVE(mesh->mVertices[i]);
@@ -248,12 +285,12 @@ namespace VE::Graphics {
                 vertex.Bitangent = AssimpVec3ToVE(mesh->mBitangents[i]);
             }
 
-            vMesh.vertices.push_back(vertex);
+            vMesh.vertices.emplace_back(vertex);
         }
 
         // Process indices
         for (uint32_t i = 0; i < mesh->mNumFaces; i++) {
-            aiFace face = mesh->mFaces[i];
+            const aiFace& face = mesh->mFaces[i];
             for (uint32_t j = 0; j < face.mNumIndices; j++) {
                 vMesh.indices.push_back(face.mIndices[j]);
             }
@@ -281,8 +318,7 @@ namespace VE::Graphics {
             std::string texturePath = m_Directory + "/" + std::string(str.C_Str());
             
             // For now, just log the texture path
-            std::cout << "VModel::LoadMaterialTextures() - Found texture: " << texturePath 
-                      << " (type: " << typeName << ")" << std::endl;
+            VE_LOG(INFO, "Graphics", "VModel::LoadMaterialTextures() - Found texture: {} (type: {})", texturePath, typeName);
         }
     }
 
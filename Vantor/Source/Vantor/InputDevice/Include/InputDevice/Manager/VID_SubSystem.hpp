@@ -11,9 +11,11 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include <Core/Container/VCO_FlatHashMap.hpp>
+#include <Core/Types/VCO_Name.hpp>
+
 #include <InputDevice/Public/VID_IDevice.hpp>
 
 
@@ -24,24 +26,24 @@ namespace VE::Internal::InputDevice
         public:
             void AddDevice(std::shared_ptr<VE::Input::VInputDevice> device);
 
-            // Map a named action to physical input
-            void MapAction(const std::string &actionName, const VE::Input::VInputButton &button);
+            // Map a named action to physical input (action names are interned, queries are integer lookups)
+            void MapAction(VE::Internal::Core::Types::VName actionName, const VE::Input::VInputButton &button);
 
             // Update all devices
             void Update();
 
             // Is Action or single Input at this moment pressed
-            bool IsActionPressed(const std::string &actionName) const;
+            bool IsActionPressed(VE::Internal::Core::Types::VName actionName) const;
             bool IsPressed(const int &key, const VE::Input::EInputDeviceType &deviceType) const;
 
             // Was the Action or single Input pressed this frame
-            bool WasActionPressed(const std::string &actionName) const;
+            bool WasActionPressed(VE::Internal::Core::Types::VName actionName) const;
             bool WasPressed(const int &key, const VE::Input::EInputDeviceType &deviceType) const;
 
-            float GetActionAxis(const std::string &actionName) const;
+            float GetActionAxis(VE::Internal::Core::Types::VName actionName) const;
 
             std::vector<std::shared_ptr<VE::Input::VInputDevice>> devices;
 
-            std::unordered_map<std::string, std::vector<VE::Input::VInputButton>> actionMap;
+            VE::Internal::Core::Container::TFlatHashMap<VE::Internal::Core::Types::VName, std::vector<VE::Input::VInputButton>> actionMap;
     };
 } // namespace VE::Input
\ No newline at end of file
@@ -13,7 +13,7 @@ namespace VE::Internal::InputDevice
 {
     void VInputManager::AddDevice(std::shared_ptr<VE::Input::VInputDevice> device) { devices.push_back(device); }
 
-    void VInputManager::MapAction(const std::string &actionName, const VE::Input::VInputButton &button) { actionMap[actionName].push_back(button); }
+    void VInputManager::MapAction(VE::Internal::Core::Types::VName actionName, const VE::Input::VInputButton &button) { actionMap[actionName].push_back(button); }
 
     void VInputManager::Update()
     {
@@ -21,7 +21,7 @@ namespace VE::Internal::InputDevice
             device->Update();
     }
 
-    bool VInputManager::IsActionPressed(const std::string &actionName) const
+    bool VInputManager::IsActionPressed(VE::Internal::Core::Types::VName actionName) const
     {
         auto it = actionMap.find(actionName);
         if (it == actionMap.end()) return false;
@@ -50,7 +50,7 @@ namespace VE::Internal::InputDevice
         return false;
     }
 
-    bool VInputManager::WasActionPressed(const std::string &actionName) const
+    bool VInputManager::WasActionPressed(VE::Internal::Core::Types::VName actionName) const
     {
         auto it = actionMap.find(actionName);
         if (it == actionMap.end()) return false;
@@ -79,7 +79,7 @@ namespace VE::Internal::InputDevice
         return false;
     }
 
-    float VInputManager::GetActionAxis(const std::string &actionName) const
+    float VInputManager::GetActionAxis(VE::Internal::Core::Types::VName actionName) const
     {
         auto it = actionMap.find(actionName);
         if (it == actionMap.end()) return 0.f;
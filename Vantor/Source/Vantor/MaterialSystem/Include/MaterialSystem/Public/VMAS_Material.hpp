@@ -9,9 +9,9 @@
 
 #pragma once
 
-#include <map>
-
+#include <Core/Container/VCO_FlatHashMap.hpp>
 #include <Core/Types/VCO_Color.hpp>
+#include <Core/Types/VCO_Name.hpp>
 
 #include <RHI/Interface/VRHI_Shader.hpp>
 #include <RHI/Interface/VRHI_Texture.hpp>
@@ -40,12 +40,16 @@ namespace VE
         MaterialCustom       // TODO
     };
 
+    // Uniforms are keyed by interned names, so the render passes can hand them to the shader without any string work
+    using VUniformMap        = VE::Internal::Core::Container::TFlatHashMap<VE::Internal::Core::Types::VName, VUniformValue>;
+    using VSamplerUniformMap = VE::Internal::Core::Container::TFlatHashMap<VE::Internal::Core::Types::VName, VUniformValueSampler>;
+
     class VMaterial
     {
         private:
-            VE::Internal::RHI::IRHIShader              *m_Shader; // Base Shader program
-            std::map<std::string, VUniformValue>        m_Uniforms;
-            std::map<std::string, VUniformValueSampler> m_SamplerUniforms;
+            VE::Internal::RHI::IRHIShader *m_Shader; // Base Shader program
+            VUniformMap                    m_Uniforms;
+            VSamplerUniformMap             m_SamplerUniforms;
 
         public:
             EMaterialType              Type      = EMaterialType::MaterialDefault;
@@ -74,23 +78,23 @@ namespace VE
             bool IsDefaultMaterial() {return Type == EMaterialType::MaterialDefault; }
             bool IsPBRMaterial() {return Type == EMaterialType::MaterialPBR; }
 
-            void SetBool(std::string name, bool value);
-            void SetInt(std::string name, int value);
-            void SetFloat(std::string name, float value);
-            void SetTexture(std::string                     name,
-                            VE::Internal::RHI::IRHITexture *value,
-                            unsigned int                    unit   = 0,
-                            EUniformType                   target = EUniformType::UniformTypeSAMPLER2D, ESamplerType type = ESamplerType::SamplerDiffuse);
-
-            void SetVector(std::string name, VE::Math::VVector2 value);
-            void SetVector(std::string name, VE::Math::VVector3 value);
-            void SetVector(std::string name, VE::Math::VVector4 value);
-            void SetMatrix(std::string name, VE::Math::VMat2 value);
-            void SetMatrix(std::string name, VE::Math::VMat3 value);
-            void SetMatrix(std::string name, VE::Math::VMat4 value);
+            void SetBool(VE::Internal::Core::Types::VName name, bool value);
+            void SetInt(VE::Internal::Core::Types::VName name, int value);
+            void SetFloat(VE::Internal::Core::Types::VName name, float value);
+            void SetTexture(VE::Internal::Core::Types::VName name,
+                            VE::Internal::RHI::IRHITexture  *value,
+                            unsigned int                     unit   = 0,
+                            EUniformType                     target = EUniformType::UniformTypeSAMPLER2D, ESamplerType type = ESamplerType::SamplerDiffuse);
+
+            void SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector2 value);
+            void SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector3 value);
+            void SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector4 value);
+            void SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat2 value);
+            void SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat3 value);
+            void SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat4 value);
 
             // TODO: make the names SetVector3, etc.
-            std::map<std::string, VUniformValue>        *GetUniforms();
-            std::map<std::string, VUniformValueSampler> *GetSamplerUniforms();
+            VUniformMap        *GetUniforms();
+            VSamplerUniformMap *GetSamplerUniforms();
     };
 } // namespace VE
\ No newline at end of file
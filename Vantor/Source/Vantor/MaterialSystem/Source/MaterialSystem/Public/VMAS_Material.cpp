@@ -35,31 +35,35 @@ namespace VE
         return copy;
     }
 
-    void VMaterial::SetBool(std::string name, bool value)
+    void VMaterial::SetBool(VE::Internal::Core::Types::VName name, bool value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeBOOL;
-        m_Uniforms[name].Bool = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeBOOL;
+        uniform.Bool = value;
     }
 
-    void VMaterial::SetInt(std::string name, int value)
+    void VMaterial::SetInt(VE::Internal::Core::Types::VName name, int value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeINT;
-        m_Uniforms[name].Int  = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeINT;
+        uniform.Int  = value;
     }
 
-    void VMaterial::SetFloat(std::string name, float value)
+    void VMaterial::SetFloat(VE::Internal::Core::Types::VName name, float value)
     {
-        m_Uniforms[name].Type  = EUniformType::UniformTypeFLOAT;
-        m_Uniforms[name].Float = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type  = EUniformType::UniformTypeFLOAT;
+        uniform.Float = value;
     }
 
-    void VMaterial::SetTexture(std::string name, VE::Internal::RHI::IRHITexture *value, unsigned int unit, EUniformType target, ESamplerType type)
+    void VMaterial::SetTexture(VE::Internal::Core::Types::VName name, VE::Internal::RHI::IRHITexture *value, unsigned int unit, EUniformType target, ESamplerType type)
     {
-        m_SamplerUniforms[name].Unit    = unit;
-        m_SamplerUniforms[name].Texture = value;
+        VUniformValueSampler &sampler = m_SamplerUniforms[name];
+        sampler.Unit    = unit;
+        sampler.Texture = value;
 
-        m_SamplerUniforms[name].Type = target;
-        m_SamplerUniforms[name].SType = type;
+        sampler.Type  = target;
+        sampler.SType = type;
 
         if (m_Shader)
         {
@@ -68,43 +72,49 @@ namespace VE
         }
     }
 
-    void VMaterial::SetVector(std::string name, VE::Math::VVector2 value)
+    void VMaterial::SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector2 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeVEC2;
-        m_Uniforms[name].Vec2 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeVEC2;
+        uniform.Vec2 = value;
     }
 
-    void VMaterial::SetVector(std::string name, VE::Math::VVector3 value)
+    void VMaterial::SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector3 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeVEC3;
-        m_Uniforms[name].Vec3 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeVEC3;
+        uniform.Vec3 = value;
     }
 
-    void VMaterial::SetVector(std::string name, VE::Math::VVector4 value)
+    void VMaterial::SetVector(VE::Internal::Core::Types::VName name, VE::Math::VVector4 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeVEC4;
-        m_Uniforms[name].Vec4 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeVEC4;
+        uniform.Vec4 = value;
     }
 
-    void VMaterial::SetMatrix(std::string name, VE::Math::VMat2 value)
+    void VMaterial::SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat2 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeMAT2;
-        m_Uniforms[name].Mat2 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeMAT2;
+        uniform.Mat2 = value;
     }
 
-    void VMaterial::SetMatrix(std::string name, VE::Math::VMat3 value)
+    void VMaterial::SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat3 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeMAT3;
-        m_Uniforms[name].Mat3 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeMAT3;
+        uniform.Mat3 = value;
     }
 
-    void VMaterial::SetMatrix(std::string name, VE::Math::VMat4 value)
+    void VMaterial::SetMatrix(VE::Internal::Core::Types::VName name, VE::Math::VMat4 value)
     {
-        m_Uniforms[name].Type = EUniformType::UniformTypeMAT4;
-        m_Uniforms[name].Mat4 = value;
+        VUniformValue &uniform = m_Uniforms[name];
+        uniform.Type = EUniformType::UniformTypeMAT4;
+        uniform.Mat4 = value;
     }
 
-    std::map<std::string, VUniformValue> *VMaterial::GetUniforms() { return &m_Uniforms; }
+    VUniformMap *VMaterial::GetUniforms() { return &m_Uniforms; }
 
-    std::map<std::string, VUniformValueSampler> *VMaterial::GetSamplerUniforms() { return &m_SamplerUniforms; }
+    VSamplerUniformMap *VMaterial::GetSamplerUniforms() { return &m_SamplerUniforms; }
 } // namespace VE
\ No newline at end of file
@@ -11,17 +11,299 @@
 
 #include <array>
 #include <cassert>
+#include <cstddef>
+#include <type_traits>
 
+#include "../VMA_Functions.hpp"
+#include "../VMA_Simd.hpp"
 #include "VMA_Vector.hpp"
 
 namespace VE::Math
 {
+    // ----------------- VMat4 kernels -----------------
+    // Templates over the VFloat4 backend (VMA_Simd.hpp), VMat4 uses Detail::VFloat4. Matrices are 16 floats,
+    // 16 byte aligned, laid out as in VMat4: row r is m[r * 4] .. m[r * 4 + 3], translation in row 3.
+    namespace Detail
+    {
+        // out = a * b, each output row is a linear combination of the rows of b. out may alias a or b.
+        template <typename V> inline void MatrixMultiply(const float *a, const float *b, float *out) noexcept
+        {
+#if defined(VANTOR_MATH_AVX2)
+            if constexpr (std::is_same_v<V, VFloat4Sse>)
+            {
+                // Two output rows per 256 bit register, same operations per lane as the 4 wide loop.
+                // Unaligned loads, VMat4 only guarantees 16 bytes
+                const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 0));
+                const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 4));
+                const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 8));
+                const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 12));
+
+                const __m256 a01 = _mm256_loadu_ps(a);
+                const __m256 a23 = _mm256_loadu_ps(a + 8);
+
+                __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+                __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+                r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0x55), b1, r01);
+                r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0x55), b1, r23);
+                r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xAA), b2, r01);
+                r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xAA), b2, r23);
+                r01        = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xFF), b3, r01);
+                r23        = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xFF), b3, r23);
+
+                _mm256_storeu_ps(out, r01);
+                _mm256_storeu_ps(out + 8, r23);
+                return;
+            }
+#endif
+            const V b0 = V::Load(b + 0);
+            const V b1 = V::Load(b + 4);
+            const V b2 = V::Load(b + 8);
+            const V b3 = V::Load(b + 12);
+
+            V rows[4];
+            for (int row = 0; row < 4; ++row)
+            {
+                const V ar = V::Load(a + row * 4);
+                V       r  = V::Mul(V::template SplatLane<0>(ar), b0);
+                r          = V::MulAdd(V::template SplatLane<1>(ar), b1, r);
+                r          = V::MulAdd(V::template SplatLane<2>(ar), b2, r);
+                r          = V::MulAdd(V::template SplatLane<3>(ar), b3, r);
+                rows[row]  = r;
+            }
+            for (int row = 0; row < 4; ++row)
+            {
+                V::Store(out + row * 4, rows[row]);
+            }
+        }
+
+        template <typename V> inline void Transpose4(V &r0, V &r1, V &r2, V &r3) noexcept
+        {
+            const V t0 = V::template Shuffle<0, 1, 0, 1>(r0, r1);
+            const V t1 = V::template Shuffle<2, 3, 2, 3>(r0, r1);
+            const V t2 = V::template Shuffle<0, 1, 0, 1>(r2, r3);
+            const V t3 = V::template Shuffle<2, 3, 2, 3>(r2, r3);
+            r0         = V::template Shuffle<0, 2, 0, 2>(t0, t2);
+            r1         = V::template Shuffle<1, 3, 1, 3>(t0, t2);
+            r2         = V::template Shuffle<0, 2, 0, 2>(t1, t3);
+            r3         = V::template Shuffle<1, 3, 1, 3>(t1, t3);
+        }
+
+        template <typename V> inline void MatrixTranspose(const float *m, float *out) noexcept
+        {
+            V r0 = V::Load(m), r1 = V::Load(m + 4), r2 = V::Load(m + 8), r3 = V::Load(m + 12);
+            Transpose4(r0, r1, r2, r3);
+            V::Store(out, r0);
+            V::Store(out + 4, r1);
+            V::Store(out + 8, r2);
+            V::Store(out + 12, r3);
+        }
+
+        // 2x2 blocks packed as (m00 m01 m10 m11)
+        template <typename V> inline V Mat2Mul(V a, V b) noexcept
+        {
+            return V::Add(V::Mul(a, V::template Swizzle<0, 3, 0, 3>(b)), V::Mul(V::template Swizzle<1, 0, 3, 2>(a), V::template Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // adj(a) * b
+        template <typename V> inline V Mat2AdjMul(V a, V b) noexcept
+        {
+            return V::Sub(V::Mul(V::template Swizzle<3, 3, 0, 0>(a), b), V::Mul(V::template Swizzle<1, 1, 2, 2>(a), V::template Swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // a * adj(b)
+        template <typename V> inline V Mat2MulAdj(V a, V b) noexcept
+        {
+            return V::Sub(V::Mul(a, V::template Swizzle<3, 0, 3, 0>(b)), V::Mul(V::template Swizzle<1, 0, 3, 2>(a), V::template Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // General inverse through 2x2 blocks (the blockwise inversion formula with adjugates instead of
+        // inverses, so no block has to be invertible on its own). Returns the determinant, a singular
+        // matrix gives a non finite result.
+        template <typename V> inline float MatrixInverse(const float *m, float *out) noexcept
+        {
+            const V r0 = V::Load(m), r1 = V::Load(m + 4), r2 = V::Load(m + 8), r3 = V::Load(m + 12);
+
+            const V A = V::template Shuffle<0, 1, 0, 1>(r0, r1);
+            const V B = V::template Shuffle<2, 3, 2, 3>(r0, r1);
+            const V C = V::template Shuffle<0, 1, 0, 1>(r2, r3);
+            const V D = V::template Shuffle<2, 3, 2, 3>(r2, r3);
+
+            // (|A| |B| |C| |D|)
+            const V detSub = V::Sub(V::Mul(V::template Shuffle<0, 2, 0, 2>(r0, r2), V::template Shuffle<1, 3, 1, 3>(r1, r3)),
+                                    V::Mul(V::template Shuffle<1, 3, 1, 3>(r0, r2), V::template Shuffle<0, 2, 0, 2>(r1, r3)));
+            const V detA   = V::template SplatLane<0>(detSub);
+            const V detB   = V::template SplatLane<1>(detSub);
+            const V detC   = V::template SplatLane<2>(detSub);
+            const V detD   = V::template SplatLane<3>(detSub);
+
+            const V D_C = Mat2AdjMul(D, C);
+            const V A_B = Mat2AdjMul(A, B);
+
+            // Adjugates of the blocks of the inverse, scaled by |M|
+            V X_ = V::Sub(V::Mul(detD, A), Mat2Mul(B, D_C));
+            V W_ = V::Sub(V::Mul(detA, D), Mat2Mul(C, A_B));
+            V Y_ = V::Sub(V::Mul(detB, C), Mat2MulAdj(D, A_B));
+            V Z_ = V::Sub(V::Mul(detC, B), Mat2MulAdj(A, D_C));
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            V tr = V::Mul(A_B, V::template Swizzle<0, 2, 1, 3>(D_C));
+            tr   = V::Add(tr, V::template Swizzle<1, 0, 3, 2>(tr));
+            tr   = V::Add(tr, V::template Swizzle<2, 3, 0, 1>(tr));
+
+            const V detM  = V::Sub(V::Add(V::Mul(detA, detD), V::Mul(detB, detC)), tr);
+            const V rDetM = V::Div(V::Set(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+            X_ = V::Mul(X_, rDetM);
+            Y_ = V::Mul(Y_, rDetM);
+            Z_ = V::Mul(Z_, rDetM);
+            W_ = V::Mul(W_, rDetM);
+
+            // Adjugate of each block and the store layout in one shuffle
+            V::Store(out, V::template Shuffle<3, 1, 3, 1>(X_, Y_));
+            V::Store(out + 4, V::template Shuffle<2, 0, 2, 0>(X_, Y_));
+            V::Store(out + 8, V::template Shuffle<3, 1, 3, 1>(Z_, W_));
+            V::Store(out + 12, V::template Shuffle<2, 0, 2, 0>(Z_, W_));
+
+            return V::template GetLane<0>(detM);
+        }
+
+        template <typename V> inline V Cross3(V a, V b) noexcept
+        {
+            return V::Sub(V::Mul(V::template Swizzle<1, 2, 0, 3>(a), V::template Swizzle<2, 0, 1, 3>(b)),
+                          V::Mul(V::template Swizzle<2, 0, 1, 3>(a), V::template Swizzle<1, 2, 0, 3>(b)));
+        }
+
+        // Inverse of an affine matrix (last column 0 0 0 1): inverts the upper 3x3 with cross products,
+        // which also handles scale and shear, and transforms the negated translation. Returns the
+        // determinant of the 3x3.
+        template <typename V> inline float MatrixInverseAffine(const float *m, float *out) noexcept
+        {
+            const V r0 = V::Load(m), r1 = V::Load(m + 4), r2 = V::Load(m + 8), t = V::Load(m + 12);
+
+            V c0 = Cross3(r1, r2);
+            V c1 = Cross3(r2, r0);
+            V c2 = Cross3(r0, r1);
+
+            // det = r0 . (r1 x r2), the w lanes are 0
+            V det = V::Mul(r0, c0);
+            det   = V::Add(det, V::template Swizzle<1, 0, 3, 2>(det));
+            det   = V::Add(det, V::template Swizzle<2, 3, 0, 1>(det));
+
+            // The inverse's rows are the columns of (c0 c1 c2), divided by det
+            V c3 = V::Zero();
+            Transpose4(c0, c1, c2, c3);
+            const V rDet = V::Div(V::Splat(1.0f), det);
+            c0           = V::Mul(c0, rDet);
+            c1           = V::Mul(c1, rDet);
+            c2           = V::Mul(c2, rDet);
+
+            // -t * inverse(3x3)
+            V it = V::Mul(V::template SplatLane<0>(t), c0);
+            it   = V::MulAdd(V::template SplatLane<1>(t), c1, it);
+            it   = V::MulAdd(V::template SplatLane<2>(t), c2, it);
+            it   = V::Sub(V::Zero(), it);
+
+            V::Store(out, c0);
+            V::Store(out + 4, c1);
+            V::Store(out + 8, c2);
+            V::Store(out + 12, V::template SetLane<3>(it, 1.0f));
+
+            return V::template GetLane<0>(det);
+        }
+
+        // (x y z 1) * m without the perspective divide
+        template <typename V> inline VVector3 MatrixTransformPoint(const float *m, const VVector3 &p) noexcept
+        {
+            V r = V::MulAdd(V::Splat(p.x), V::Load(m), V::Load(m + 12));
+            r   = V::MulAdd(V::Splat(p.y), V::Load(m + 4), r);
+            r   = V::MulAdd(V::Splat(p.z), V::Load(m + 8), r);
+            return VVector3(V::template GetLane<0>(r), V::template GetLane<1>(r), V::template GetLane<2>(r));
+        }
+
+        // (x y z 0) * m
+        template <typename V> inline VVector3 MatrixTransformVector(const float *m, const VVector3 &v) noexcept
+        {
+            V r = V::Mul(V::Splat(v.x), V::Load(m));
+            r   = V::MulAdd(V::Splat(v.y), V::Load(m + 4), r);
+            r   = V::MulAdd(V::Splat(v.z), V::Load(m + 8), r);
+            return VVector3(V::template GetLane<0>(r), V::template GetLane<1>(r), V::template GetLane<2>(r));
+        }
+
+        // V::Width packed points to x, y and z registers, four per group: the 12 floats of a group are
+        // transposed so lane k holds point k of the group
+        template <typename V> inline void LoadPointGroups(const VVector3 *points, V &x, V &y, V &z) noexcept
+        {
+            static_assert(sizeof(VVector3) == 3 * sizeof(float), "Point groups read VVector3 arrays as packed floats");
+
+            const float *src = &points->x;
+            const V      v0  = LoadGroupsU<V>(src, 12);     // x0 y0 z0 x1
+            const V      v1  = LoadGroupsU<V>(src + 4, 12); // y1 z1 x2 y2
+            const V      v2  = LoadGroupsU<V>(src + 8, 12); // z2 x3 y3 z3
+
+            x = V::template Shuffle<0, 3, 0, 2>(v0, V::template Shuffle<2, 2, 1, 1>(v1, v2));
+            y = V::template Shuffle<0, 2, 0, 2>(V::template Shuffle<1, 1, 0, 0>(v0, v1), V::template Shuffle<3, 3, 2, 2>(v1, v2));
+            z = V::template Shuffle<0, 2, 0, 2>(V::template Shuffle<2, 2, 1, 1>(v0, v1), V::template Swizzle<0, 0, 3, 3>(v2));
+        }
+
+        template <typename V> inline void StorePointGroups(VVector3 *points, V x, V y, V z) noexcept
+        {
+            float *dst = &points->x;
+            StoreGroupsU<V>(dst, 12, V::template Shuffle<0, 2, 0, 2>(V::template Shuffle<0, 0, 0, 0>(x, y), V::template Shuffle<0, 0, 1, 1>(z, x)));
+            StoreGroupsU<V>(dst + 4, 12, V::template Shuffle<0, 2, 0, 2>(V::template Shuffle<1, 1, 1, 1>(y, z), V::template Shuffle<2, 2, 2, 2>(x, y)));
+            StoreGroupsU<V>(dst + 8, 12, V::template Shuffle<0, 2, 0, 2>(V::template Shuffle<2, 2, 3, 3>(z, x), V::template Shuffle<3, 3, 3, 3>(y, z)));
+        }
+
+        // V::Width points per step, transformed with one multiply-add per matrix element. Returns how many
+        // points it handled, a multiple of V::Width.
+        template <typename V> inline size_t MatrixTransformPointGroups(const float *m, const VVector3 *in, VVector3 *out, size_t count) noexcept
+        {
+            const V m0 = V::Splat(m[0]), m1 = V::Splat(m[1]), m2 = V::Splat(m[2]);
+            const V m4 = V::Splat(m[4]), m5 = V::Splat(m[5]), m6 = V::Splat(m[6]);
+            const V m8 = V::Splat(m[8]), m9 = V::Splat(m[9]), m10 = V::Splat(m[10]);
+            const V m12 = V::Splat(m[12]), m13 = V::Splat(m[13]), m14 = V::Splat(m[14]);
+
+            size_t i = 0;
+            for (; i + V::Width <= count; i += V::Width)
+            {
+                V x, y, z;
+                LoadPointGroups(&in[i], x, y, z);
+
+                // Same order as MatrixTransformPoint: translation, then x, y and z
+                V ox = V::MulAdd(x, m0, m12), oy = V::MulAdd(x, m1, m13), oz = V::MulAdd(x, m2, m14);
+                ox   = V::MulAdd(y, m4, ox);
+                oy   = V::MulAdd(y, m5, oy);
+                oz   = V::MulAdd(y, m6, oz);
+                ox   = V::MulAdd(z, m8, ox);
+                oy   = V::MulAdd(z, m9, oy);
+                oz   = V::MulAdd(z, m10, oz);
+
+                StorePointGroups(&out[i], ox, oy, oz);
+            }
+            return i;
+        }
+
+        // MatrixTransformPoint over count points, eight at a time with AVX2, then four, then one by one.
+        // in and out may be the same array.
+        template <typename V> inline void MatrixTransformPoints(const float *m, const VVector3 *in, VVector3 *out, size_t count) noexcept
+        {
+            size_t i = 0;
+#if defined(VANTOR_MATH_AVX2)
+            if constexpr (std::is_same_v<V, VFloat4Sse>) i = MatrixTransformPointGroups<VFloat8Avx>(m, in, out, count);
+#endif
+            i += MatrixTransformPointGroups<V>(m, in + i, out + i, count - i);
+            for (; i < count; ++i)
+            {
+                out[i] = MatrixTransformPoint<V>(m, in[i]);
+            }
+        }
+    } // namespace Detail
 
     // ----------------- VMat4 -----------------
     struct VMat4
     {
 
-            std::array<float, 16> m{};
+            // 16 byte aligned so the kernels can use aligned loads
+            alignas(16) std::array<float, 16> m{};
 
             // Identity matrix
             static constexpr VMat4 Identity() noexcept
@@ -34,27 +316,73 @@ namespace VE::Math
                 return mat;
             }
 
-            // Multiply two matrices
-            VMat4 operator*(const VMat4 &rhs) const noexcept
+            // Multiply two matrices, a * b applies a first. In constant expressions with plain multiplies
+            // and adds in the kernel's order, the result can differ in the last bit from a fused build.
+            constexpr VMat4 operator*(const VMat4 &rhs) const noexcept
             {
-                VMat4 result{};
-                for (int row = 0; row < 4; ++row)
+                VMat4 result;
+                if (std::is_constant_evaluated())
                 {
-                    for (int col = 0; col < 4; ++col)
+                    for (int row = 0; row < 4; ++row)
                     {
-                        float sum = 0.f;
-                        for (int i = 0; i < 4; ++i)
+                        for (int col = 0; col < 4; ++col)
                         {
-                            sum += m[row * 4 + i] * rhs.m[i * 4 + col];
+                            float sum = m[row * 4] * rhs.m[col];
+                            for (int i = 1; i < 4; ++i) sum = m[row * 4 + i] * rhs.m[i * 4 + col] + sum;
+                            result.m[row * 4 + col] = sum;
                         }
-                        result.m[row * 4 + col] = sum;
                     }
+                    return result;
                 }
+                Detail::MatrixMultiply<Detail::VFloat4>(m.data(), rhs.m.data(), result.m.data());
                 return result;
             }
 
+            VMat4 &operator*=(const VMat4 &rhs) noexcept
+            {
+                Detail::MatrixMultiply<Detail::VFloat4>(m.data(), rhs.m.data(), m.data());
+                return *this;
+            }
+
+            VMat4 Transposed() const noexcept
+            {
+                VMat4 result;
+                Detail::MatrixTranspose<Detail::VFloat4>(m.data(), result.m.data());
+                return result;
+            }
+
+            // General inverse. A singular matrix gives non finite elements, the determinant is written to
+            // determinant if given.
+            VMat4 Inverse(float *determinant = nullptr) const noexcept
+            {
+                VMat4       result;
+                const float det = Detail::MatrixInverse<Detail::VFloat4>(m.data(), result.m.data());
+                if (determinant) *determinant = det;
+                return result;
+            }
+
+            // Inverse of a matrix whose last column is (0 0 0 1), any mix of translation, rotation, scale
+            // and shear. Cheaper than Inverse(), wrong for projections.
+            VMat4 InverseAffine() const noexcept
+            {
+                assert(m[3] == 0.f && m[7] == 0.f && m[11] == 0.f && m[15] == 1.f);
+                VMat4 result;
+                Detail::MatrixInverseAffine<Detail::VFloat4>(m.data(), result.m.data());
+                return result;
+            }
+
+            // Point with w = 1, no perspective divide
+            VVector3 TransformPoint(const VVector3 &point) const noexcept { return Detail::MatrixTransformPoint<Detail::VFloat4>(m.data(), point); }
+            // Direction with w = 0, translation does not apply
+            VVector3 TransformVector(const VVector3 &vector) const noexcept { return Detail::MatrixTransformVector<Detail::VFloat4>(m.data(), vector); }
+            // TransformPoint() over count points, in and out may be the same array
+            void TransformPoints(const VVector3 *in, VVector3 *out, size_t count) const noexcept
+            {
+                Detail::MatrixTransformPoints<Detail::VFloat4>(m.data(), in, out, count);
+            }
+
             // Create translation matrix
-            static VMat4 Translate(const VVector3 &translation) noexcept
+            static constexpr VMat4 Translate(const VVector3 &translation) noexcept
             {
                 VMat4 mat = Identity();
                 mat.m[12] = translation.x;
@@ -64,11 +392,11 @@ namespace VE::Math
             }
 
             // Create rotation matrix around Y (yaw)
-            static VMat4 RotationYaw(float degrees) noexcept
+            static constexpr VMat4 RotationYaw(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 VMat4 mat = Identity();
                 mat.m[0]  = c;
@@ -79,11 +407,11 @@ namespace VE::Math
             }
 
             // Create rotation matrix around X (pitch)
-            static VMat4 RotationPitch(float degrees) noexcept
+            static constexpr VMat4 RotationPitch(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 VMat4 mat = Identity();
                 mat.m[5]  = c;
@@ -94,10 +422,10 @@ namespace VE::Math
             }
 
             // Combine yaw + pitch rotations (yaw first)
-            static VMat4 RotationYawPitch(float yawDegrees, float pitchDegrees) noexcept { return RotationYaw(yawDegrees) * RotationPitch(pitchDegrees); }
+            static constexpr VMat4 RotationYawPitch(float yawDegrees, float pitchDegrees) noexcept { return RotationYaw(yawDegrees) * RotationPitch(pitchDegrees); }
 
             // Create lookAt matrix (right-handed)
-            static VMat4 LookAt(const VVector3 &eye, const VVector3 &center, const VVector3 &up) noexcept
+            static constexpr VMat4 LookAt(const VVector3 &eye, const VVector3 &center, const VVector3 &up) noexcept
             {
                 VVector3 f = (center - eye).Normalized();
                 VVector3 s = f.Cross(up).Normalized();
@@ -120,10 +448,10 @@ namespace VE::Math
                 return mat;
             }
 
-            static VMat4 Perspective(float fovDegrees, float aspectRatio, float nearPlane, float farPlane) noexcept
+            static constexpr VMat4 Perspective(float fovDegrees, float aspectRatio, float nearPlane, float farPlane) noexcept
             {
                 float fovRad = fovDegrees * 3.14159265358979323846f / 180.f;
-                float f      = 1.f / std::tan(fovRad / 2.f);
+                float f      = 1.f / Tan(fovRad / 2.f);
 
                 VMat4 mat{};
                 mat.m[0]  = f / aspectRatio;                                 // scale X
@@ -136,7 +464,7 @@ namespace VE::Math
                 return mat;
             }
 
-            static VMat4 Scale(const VVector3 &scale) noexcept
+            static constexpr VMat4 Scale(const VVector3 &scale) noexcept
             {
                 VMat4 mat = Identity();
                 mat.m[0]  = scale.x;
@@ -145,7 +473,7 @@ namespace VE::Math
                 return mat;
             }
 
-            static VMat4 Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) noexcept
+            static constexpr VMat4 Orthographic(float left, float right, float bottom, float top, float nearPlane, float farPlane) noexcept
             {
                 VMat4 mat{};
 
@@ -188,7 +516,7 @@ namespace VE::Math
             }
 
             // Multiply two matrices
-            VMat3 operator*(const VMat3 &rhs) const noexcept
+            constexpr VMat3 operator*(const VMat3 &rhs) const noexcept
             {
                 VMat3 result{};
                 for (int row = 0; row < 3; ++row)
@@ -207,17 +535,17 @@ namespace VE::Math
             }
 
             // Multiply matrix by vector
-            VVector3 operator*(const VVector3 &v) const noexcept
+            constexpr VVector3 operator*(const VVector3 &v) const noexcept
             {
                 return VVector3{m[0] * v.x + m[1] * v.y + m[2] * v.z, m[3] * v.x + m[4] * v.y + m[5] * v.z, m[6] * v.x + m[7] * v.y + m[8] * v.z};
             }
 
             // Create rotation matrix around X axis (degrees)
-            static VMat3 RotationX(float degrees) noexcept
+            static constexpr VMat3 RotationX(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 VMat3 mat = Identity();
                 mat.m[4]  = c;
                 mat.m[5]  = -s;
@@ -227,11 +555,11 @@ namespace VE::Math
             }
 
             // Create rotation matrix around Y axis (degrees)
-            static VMat3 RotationY(float degrees) noexcept
+            static constexpr VMat3 RotationY(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 VMat3 mat = Identity();
                 mat.m[0]  = c;
                 mat.m[2]  = s;
@@ -241,11 +569,11 @@ namespace VE::Math
             }
 
             // Create rotation matrix around Z axis (degrees)
-            static VMat3 RotationZ(float degrees) noexcept
+            static constexpr VMat3 RotationZ(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
                 VMat3 mat = Identity();
                 mat.m[0]  = c;
                 mat.m[1]  = -s;
@@ -255,7 +583,7 @@ namespace VE::Math
             }
 
             // Create a LookAt rotation matrix (only rotation, no translation)
-            static VMat3 LookAt(const VVector3 &eye, const VVector3 &center, const VVector3 &up) noexcept
+            static constexpr VMat3 LookAt(const VVector3 &eye, const VVector3 &center, const VVector3 &up) noexcept
             {
                 VVector3 f = (center - eye).Normalized();
                 VVector3 s = f.Cross(up).Normalized();
@@ -277,7 +605,7 @@ namespace VE::Math
             }
 
             // Transpose the matrix
-            VMat3 Transpose() const noexcept
+            constexpr VMat3 Transpose() const noexcept
             {
                 VMat3 result{};
                 for (int row = 0; row < 3; ++row)
@@ -313,7 +641,7 @@ namespace VE::Math
             }
 
             // Multiply two 2x2 matrices
-            VMat2 operator*(const VMat2 &rhs) const noexcept
+            constexpr VMat2 operator*(const VMat2 &rhs) const noexcept
             {
                 VMat2 result{};
                 result.m[0] = m[0] * rhs.m[0] + m[2] * rhs.m[1];
@@ -324,10 +652,10 @@ namespace VE::Math
             }
 
             // Multiply by a vector (2D)
-            VVector2 operator*(const VVector2 &vec) const noexcept { return {m[0] * vec.x + m[2] * vec.y, m[1] * vec.x + m[3] * vec.y}; }
+            constexpr VVector2 operator*(const VVector2 &vec) const noexcept { return {m[0] * vec.x + m[2] * vec.y, m[1] * vec.x + m[3] * vec.y}; }
 
             // Transpose the matrix
-            VMat2 Transposed() const noexcept
+            constexpr VMat2 Transposed() const noexcept
             {
                 VMat2 result{};
                 result.m[0] = m[0];
@@ -341,11 +669,11 @@ namespace VE::Math
             constexpr float Determinant() const noexcept { return m[0] * m[3] - m[2] * m[1]; }
 
             // Create a rotation matrix (in degrees)
-            static VMat2 Rotation(float degrees) noexcept
+            static constexpr VMat2 Rotation(float degrees) noexcept
             {
                 float rad = degrees * 3.14159265358979323846f / 180.f;
-                float c   = std::cos(rad);
-                float s   = std::sin(rad);
+                float c   = Cos(rad);
+                float s   = Sin(rad);
 
                 VMat2 mat{};
                 mat.m[0] = c;
@@ -356,7 +684,7 @@ namespace VE::Math
             }
 
             // Create a scaling matrix
-            static VMat2 Scale(float scaleX, float scaleY) noexcept
+            static constexpr VMat2 Scale(float scaleX, float scaleY) noexcept
             {
                 VMat2 mat{};
                 mat.m[0] = scaleX;
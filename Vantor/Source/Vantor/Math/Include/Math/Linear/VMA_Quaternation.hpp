@@ -9,71 +9,293 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 
 #include "../VMA_Common.hpp"
+#include "../VMA_Functions.hpp"
+#include "../VMA_Simd.hpp"
 #include "VMA_Matrix.hpp"
 #include "VMA_Vector.hpp"
-#include <cmath>
 
 namespace VE::Math
 {
+    // ----------------- Quaternion kernels -----------------
+    // Templates over the VFloat4 backend (VMA_Simd.hpp). The packed kernels hold one quaternion as
+    // (x y z w) in a VFloat4 and back the VQuaternion members. The lane kernels work on V::Width
+    // quaternions at once, one register per component, and back the batch functions further down.
+    // Both forms perform the same operations per component, so batch results are bit identical to
+    // the members'. Negations are multiplications by -1, which are exact.
+    namespace Detail
+    {
+        // Dot product in all four lanes, summed as (xx + yy) + (zz + ww)
+        template <typename V> inline V QuaternionDot(V a, V b) noexcept
+        {
+            V d = V::Mul(a, b);
+            d   = V::Add(d, V::template Swizzle<1, 0, 3, 2>(d));
+            return V::Add(d, V::template Swizzle<2, 3, 0, 1>(d));
+        }
+
+        // a * b: w * b plus the x, y and z terms with their signs
+        template <typename V> inline V QuaternionMultiply(V a, V b) noexcept
+        {
+            V r = V::Mul(V::template SplatLane<3>(a), b);
+            r   = V::MulAdd(V::template SplatLane<0>(a), V::Mul(V::template Swizzle<3, 2, 1, 0>(b), V::Set(1.0f, -1.0f, 1.0f, -1.0f)), r);
+            r   = V::MulAdd(V::template SplatLane<1>(a), V::Mul(V::template Swizzle<2, 3, 0, 1>(b), V::Set(1.0f, 1.0f, -1.0f, -1.0f)), r);
+            return V::MulAdd(V::template SplatLane<2>(a), V::Mul(V::template Swizzle<1, 0, 3, 2>(b), V::Set(-1.0f, 1.0f, 1.0f, -1.0f)), r);
+        }
+
+        template <typename V> inline V QuaternionConjugate(V q) noexcept { return V::Mul(q, V::Set(-1.0f, -1.0f, -1.0f, 1.0f)); }
+
+        template <typename V> inline V QuaternionNormalize(V q) noexcept { return V::Div(q, V::Sqrt(QuaternionDot(q, q))); }
+
+        // q * v * q^-1 as v + (w t + u x t) / |q|^2 with t = 2 (u x v), u the vector part of q. For unit
+        // quaternions the division is by 1, other ones still rotate without scaling. v has w = 0.
+        template <typename V> inline V QuaternionRotate(V q, V v) noexcept
+        {
+            const V t = V::Mul(V::Splat(2.0f), Cross3(q, v));
+            const V c = Cross3(q, t);
+            return V::Add(v, V::Div(V::MulAdd(V::template SplatLane<3>(q), t, c), QuaternionDot(q, q)));
+        }
+
+        // Normalized a + t (b - a), b negated if needed so the shorter arc is taken
+        template <typename V> inline V QuaternionNlerp(V a, V b, float t) noexcept
+        {
+            const V sign = V::CopySign(V::Splat(1.0f), QuaternionDot(a, b));
+            const V bs   = V::Mul(b, sign);
+            return QuaternionNormalize(V::MulAdd(V::Splat(t), V::Sub(bs, a), a));
+        }
+
+        // Slerp without trigonometry (D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP"):
+        // sin(t a) / sin(a) is a polynomial in t and cos(a) - 1, evaluated with SlerpTerms terms, the last
+        // one scaled by 1.9 to make up for the cut off series. Max error of the coefficients is 2.1e-7 for
+        // all t in [0, 1], so there is no small angle special case: at cos(a) = 1 it is exactly lerp.
+        constexpr int SlerpTerms = 14;
+
+        // u[i] = 1 / (i (2i + 1)) and v[i] = i / (2i + 1), index 0 unused
+        inline constexpr std::array<std::array<float, SlerpTerms + 1>, 2> SlerpUV = [] {
+            std::array<std::array<float, SlerpTerms + 1>, 2> uv{};
+            for (int i = 1; i <= SlerpTerms; ++i)
+            {
+                const double correction = i == SlerpTerms ? 1.9 : 1.0;
+                uv[0][i]                = static_cast<float>(correction / (i * (2.0 * i + 1.0)));
+                uv[1][i]                = static_cast<float>(correction * i / (2.0 * i + 1.0));
+            }
+            return uv;
+        }();
+
+        // Coefficient lane by lane for s = t (of b) or s = 1 - t (of a), xm1 = cos(a) - 1
+        template <typename V> inline V SlerpCoefficients(V s, V xm1) noexcept
+        {
+            const V s2  = V::Mul(s, s);
+            const V one = V::Splat(1.0f);
+
+            V h = V::Add(one, V::Mul(V::MulAdd(V::Splat(SlerpUV[0][SlerpTerms]), s2, V::Splat(-SlerpUV[1][SlerpTerms])), xm1));
+            for (int i = SlerpTerms - 1; i >= 1; --i)
+            {
+                h = V::MulAdd(V::Mul(V::MulAdd(V::Splat(SlerpUV[0][i]), s2, V::Splat(-SlerpUV[1][i])), xm1), h, one);
+            }
+            return V::Mul(s, h);
+        }
+
+        // Both coefficients from one evaluation, t in lanes 0 and 2 and 1 - t in lanes 1 and 3
+        template <typename V> inline V QuaternionSlerp(V a, V b, float t) noexcept
+        {
+            const V dot  = QuaternionDot(a, b);
+            const V sign = V::CopySign(V::Splat(1.0f), dot);
+            const V xm1  = V::Sub(V::Mul(dot, sign), V::Splat(1.0f));
+
+            const float d = 1.0f - t;
+            const V     c = SlerpCoefficients(V::Set(t, d, t, d), xm1);
+            return V::MulAdd(V::Mul(b, sign), V::template SplatLane<0>(c), V::Mul(a, V::template SplatLane<1>(c)));
+        }
+
+        // V::Width quaternions, one register per component
+        template <typename V> struct VQuaternionLanes
+        {
+                V x, y, z, w;
+        };
+
+        template <typename V> inline V QuaternionDot(const VQuaternionLanes<V> &a, const VQuaternionLanes<V> &b) noexcept
+        {
+            return V::Add(V::Add(V::Mul(a.x, b.x), V::Mul(a.y, b.y)), V::Add(V::Mul(a.z, b.z), V::Mul(a.w, b.w)));
+        }
+
+        template <typename V> inline VQuaternionLanes<V> QuaternionMultiply(const VQuaternionLanes<V> &a, const VQuaternionLanes<V> &b) noexcept
+        {
+            const V minus = V::Splat(-1.0f);
+            const V nx = V::Mul(b.x, minus), ny = V::Mul(b.y, minus), nz = V::Mul(b.z, minus);
+
+            // Same terms and order as the packed kernel, lane by lane
+            return {V::MulAdd(a.z, ny, V::MulAdd(a.y, b.z, V::MulAdd(a.x, b.w, V::Mul(a.w, b.x)))),
+                    V::MulAdd(a.z, b.x, V::MulAdd(a.y, b.w, V::MulAdd(a.x, nz, V::Mul(a.w, b.y)))),
+                    V::MulAdd(a.z, b.w, V::MulAdd(a.y, nx, V::MulAdd(a.x, b.y, V::Mul(a.w, b.z)))),
+                    V::MulAdd(a.z, nz, V::MulAdd(a.y, ny, V::MulAdd(a.x, nx, V::Mul(a.w, b.w))))};
+        }
+
+        template <typename V> inline VQuaternionLanes<V> QuaternionConjugate(const VQuaternionLanes<V> &q) noexcept
+        {
+            const V minus = V::Splat(-1.0f);
+            return {V::Mul(q.x, minus), V::Mul(q.y, minus), V::Mul(q.z, minus), q.w};
+        }
+
+        template <typename V> inline VQuaternionLanes<V> QuaternionNormalize(const VQuaternionLanes<V> &q) noexcept
+        {
+            const V length = V::Sqrt(QuaternionDot(q, q));
+            return {V::Div(q.x, length), V::Div(q.y, length), V::Div(q.z, length), V::Div(q.w, length)};
+        }
+
+        // Cross3() lane by lane
+        template <typename V> inline void Cross3(V ax, V ay, V az, V bx, V by, V bz, V &x, V &y, V &z) noexcept
+        {
+            x = V::Sub(V::Mul(ay, bz), V::Mul(az, by));
+            y = V::Sub(V::Mul(az, bx), V::Mul(ax, bz));
+            z = V::Sub(V::Mul(ax, by), V::Mul(ay, bx));
+        }
+
+        template <typename V> inline void QuaternionRotate(const VQuaternionLanes<V> &q, V &x, V &y, V &z) noexcept
+        {
+            const V two = V::Splat(2.0f);
+            V       tx, ty, tz, cx, cy, cz;
+            Cross3(q.x, q.y, q.z, x, y, z, tx, ty, tz);
+            tx = V::Mul(two, tx);
+            ty = V::Mul(two, ty);
+            tz = V::Mul(two, tz);
+            Cross3(q.x, q.y, q.z, tx, ty, tz, cx, cy, cz);
+
+            const V n = QuaternionDot(q, q);
+            x         = V::Add(x, V::Div(V::MulAdd(q.w, tx, cx), n));
+            y         = V::Add(y, V::Div(V::MulAdd(q.w, ty, cy), n));
+            z         = V::Add(z, V::Div(V::MulAdd(q.w, tz, cz), n));
+        }
+
+        template <typename V> inline VQuaternionLanes<V> QuaternionNlerp(const VQuaternionLanes<V> &a, const VQuaternionLanes<V> &b, V t) noexcept
+        {
+            const V sign = V::CopySign(V::Splat(1.0f), QuaternionDot(a, b));
+            return QuaternionNormalize(VQuaternionLanes<V>{V::MulAdd(t, V::Sub(V::Mul(b.x, sign), a.x), a.x), V::MulAdd(t, V::Sub(V::Mul(b.y, sign), a.y), a.y),
+                                                           V::MulAdd(t, V::Sub(V::Mul(b.z, sign), a.z), a.z), V::MulAdd(t, V::Sub(V::Mul(b.w, sign), a.w), a.w)});
+        }
+
+        template <typename V> inline VQuaternionLanes<V> QuaternionSlerp(const VQuaternionLanes<V> &a, const VQuaternionLanes<V> &b, V t) noexcept
+        {
+            const V dot  = QuaternionDot(a, b);
+            const V sign = V::CopySign(V::Splat(1.0f), dot);
+            const V xm1  = V::Sub(V::Mul(dot, sign), V::Splat(1.0f));
+            const V cb   = SlerpCoefficients(t, xm1);
+            const V ca   = SlerpCoefficients(V::Sub(V::Splat(1.0f), t), xm1);
+            return {V::MulAdd(V::Mul(b.x, sign), cb, V::Mul(a.x, ca)), V::MulAdd(V::Mul(b.y, sign), cb, V::Mul(a.y, ca)),
+                    V::MulAdd(V::Mul(b.z, sign), cb, V::Mul(a.z, ca)), V::MulAdd(V::Mul(b.w, sign), cb, V::Mul(a.w, ca))};
+        }
+
+        // Rotation matrix elements, r[row][column], same operations as VQuaternion::ToMat3()
+        template <typename V> inline void QuaternionToRotation(const VQuaternionLanes<V> &q, V (&r)[3][3]) noexcept
+        {
+            const V one = V::Splat(1.0f);
+            const V two = V::Splat(2.0f);
+
+            const V xx = V::Mul(q.x, q.x), yy = V::Mul(q.y, q.y), zz = V::Mul(q.z, q.z);
+            const V xy = V::Mul(q.x, q.y), xz = V::Mul(q.x, q.z), yz = V::Mul(q.y, q.z);
+            const V wx = V::Mul(q.w, q.x), wy = V::Mul(q.w, q.y), wz = V::Mul(q.w, q.z);
+
+            r[0][0] = V::Sub(one, V::Mul(two, V::Add(yy, zz)));
+            r[0][1] = V::Mul(two, V::Sub(xy, wz));
+            r[0][2] = V::Mul(two, V::Add(xz, wy));
+            r[1][0] = V::Mul(two, V::Add(xy, wz));
+            r[1][1] = V::Sub(one, V::Mul(two, V::Add(xx, zz)));
+            r[1][2] = V::Mul(two, V::Sub(yz, wx));
+            r[2][0] = V::Mul(two, V::Sub(xz, wy));
+            r[2][1] = V::Mul(two, V::Add(yz, wx));
+            r[2][2] = V::Sub(one, V::Mul(two, V::Add(xx, yy)));
+        }
+
+        // Quaternion of a pure rotation matrix (Shepperd's method) without branches: the largest of
+        // 4w^2, 4x^2, 4y^2 and 4z^2 is taken from the diagonal, that component from its square root and
+        // the other three from the off diagonal sums and differences divided by it.
+        template <typename V> inline VQuaternionLanes<V> QuaternionFromRotation(const V (&m)[3][3]) noexcept
+        {
+            const V one = V::Splat(1.0f);
+
+            const V pw = V::Add(V::Add(V::Add(one, m[0][0]), m[1][1]), m[2][2]);
+            const V px = V::Sub(V::Sub(V::Add(one, m[0][0]), m[1][1]), m[2][2]);
+            const V py = V::Sub(V::Add(V::Sub(one, m[0][0]), m[1][1]), m[2][2]);
+            const V pz = V::Add(V::Sub(V::Sub(one, m[0][0]), m[1][1]), m[2][2]);
+
+            const V caseX = V::Greater(px, pw);
+            V       best  = V::Select(caseX, px, pw);
+            const V caseY = V::Greater(py, best);
+            best          = V::Select(caseY, py, best);
+            const V caseZ = V::Greater(pz, best);
+            best          = V::Select(caseZ, pz, best);
+
+            const V s   = V::Mul(V::Splat(2.0f), V::Sqrt(best));
+            const V big = V::Mul(V::Splat(0.25f), s);
+            const V rcp = V::Div(one, s);
+
+            const V a = V::Mul(V::Sub(m[2][1], m[1][2]), rcp);
+            const V b = V::Mul(V::Sub(m[0][2], m[2][0]), rcp);
+            const V c = V::Mul(V::Sub(m[1][0], m[0][1]), rcp);
+            const V d = V::Mul(V::Add(m[0][1], m[1][0]), rcp);
+            const V e = V::Mul(V::Add(m[0][2], m[2][0]), rcp);
+            const V f = V::Mul(V::Add(m[1][2], m[2][1]), rcp);
+
+            return {V::Select(caseZ, e, V::Select(caseY, d, V::Select(caseX, big, a))), V::Select(caseZ, f, V::Select(caseY, big, V::Select(caseX, d, b))),
+                    V::Select(caseZ, big, V::Select(caseY, f, V::Select(caseX, e, c))), V::Select(caseZ, c, V::Select(caseY, b, V::Select(caseX, a, big)))};
+        }
+    } // namespace Detail
+
     struct VQuaternion
     {
             float x = 0, y = 0, z = 0, w = 1;
 
-            VQuaternion(float x_, float y_, float z_, float w_) noexcept : x(x_), y(y_), z(z_), w(w_) {}
+            // Identity
+            constexpr VQuaternion() noexcept = default;
+            constexpr VQuaternion(float x_, float y_, float z_, float w_) noexcept : x(x_), y(y_), z(z_), w(w_) {}
 
             // Identity quaternion
-            static VQuaternion Identity() noexcept { return VQuaternion{0, 0, 0, 1}; }
+            static constexpr VQuaternion Identity() noexcept { return VQuaternion{0, 0, 0, 1}; }
 
             // Constructor from axis-angle (degrees)
-            static VQuaternion FromAxisAngle(const VVector3 &axis, float degrees) noexcept
+            static constexpr VQuaternion FromAxisAngle(const VVector3 &axis, float degrees) noexcept
             {
                 float    rad  = degrees * VPI / 180.f;
                 float    half = rad * 0.5f;
-                float    sinH = std::sin(half);
+                float    sinH = Sin(half);
                 VVector3 n    = axis.Normalized();
-                return VQuaternion{n.x * sinH, n.y * sinH, n.z * sinH, std::cos(half)};
+                return VQuaternion{n.x * sinH, n.y * sinH, n.z * sinH, Cos(half)};
             }
 
+            float Dot(const VQuaternion &rhs) const noexcept { return Detail::VFloat4::GetLane<0>(Detail::QuaternionDot(Packed(), rhs.Packed())); }
+
             // Normalize
-            VQuaternion Normalized() const noexcept
-            {
-                float mag = std::sqrt(x * x + y * y + z * z + w * w);
-                return VQuaternion{x / mag, y / mag, z / mag, w / mag};
-            }
+            VQuaternion Normalized() const noexcept { return FromPacked(Detail::QuaternionNormalize(Packed())); }
 
             // Conjugate
-            VQuaternion Conjugated() const noexcept { return VQuaternion{-x, -y, -z, w}; }
+            VQuaternion Conjugated() const noexcept { return FromPacked(Detail::QuaternionConjugate(Packed())); }
 
             // Inverse
             VQuaternion Inverted() const noexcept
             {
-                float normSq = x * x + y * y + z * z + w * w;
-                return Conjugated() * (1.0f / normSq);
+                const Detail::VFloat4 q = Packed();
+                return FromPacked(Detail::VFloat4::Div(Detail::QuaternionConjugate(q), Detail::QuaternionDot(q, q)));
             }
 
-            // Quaternion multiplication
-            VQuaternion operator*(const VQuaternion &rhs) const noexcept
-            {
-                return VQuaternion{w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y, w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
-                                   w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w, w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z};
-            }
+            // Quaternion multiplication, applies rhs first
+            VQuaternion operator*(const VQuaternion &rhs) const noexcept { return FromPacked(Detail::QuaternionMultiply(Packed(), rhs.Packed())); }
 
             // Scale quaternion
-            VQuaternion operator*(float scalar) const noexcept { return VQuaternion{x * scalar, y * scalar, z * scalar, w * scalar}; }
+            constexpr VQuaternion operator*(float scalar) const noexcept { return VQuaternion{x * scalar, y * scalar, z * scalar, w * scalar}; }
 
-            // Apply quaternion rotation to a vector
+            // Apply quaternion rotation to a vector, same as q * v * q^-1
             VVector3 Rotate(const VVector3 &v) const noexcept
             {
-                VQuaternion qv{v.x, v.y, v.z, 0};
-                VQuaternion result = (*this) * qv * Inverted();
-                return {result.x, result.y, result.z};
+                using V   = Detail::VFloat4;
+                const V r = Detail::QuaternionRotate(Packed(), V::Set(v.x, v.y, v.z, 0.0f));
+                return {V::GetLane<0>(r), V::GetLane<1>(r), V::GetLane<2>(r)};
             }
 
             // Convert to 3x3 matrix
-            VMat3 ToMat3() const noexcept
+            constexpr VMat3 ToMat3() const noexcept
             {
                 float xx = x * x, yy = y * y, zz = z * z;
                 float xy = x * y, xz = x * z, yz = y * z;
@@ -95,7 +317,7 @@ namespace VE::Math
             }
 
             // Convert to 4x4 matrix
-            VMat4 ToMat4() const noexcept
+            constexpr VMat4 ToMat4() const noexcept
             {
                 VMat3 rot = ToMat3();
                 VMat4 mat = VMat4::Identity();
@@ -115,19 +337,30 @@ namespace VE::Math
                 return mat;
             }
 
+            // Inverse of ToMat3()/ToMat4(), the matrix has to be a pure rotation (no scale). Returns q or -q,
+            // both describe the same rotation.
+            static VQuaternion FromMat3(const VMat3 &mat) noexcept
+            {
+                return FromRotation(mat.m[0], mat.m[1], mat.m[2], mat.m[3], mat.m[4], mat.m[5], mat.m[6], mat.m[7], mat.m[8]);
+            }
+            static VQuaternion FromMat4(const VMat4 &mat) noexcept
+            {
+                return FromRotation(mat.m[0], mat.m[1], mat.m[2], mat.m[4], mat.m[5], mat.m[6], mat.m[8], mat.m[9], mat.m[10]);
+            }
+
             // Construct from Euler angles (in degrees): Vpitch (X), yaw (Y), roll (Z)
-            static VQuaternion FromEulerAngles(const VVector3 &eulerDegrees) noexcept
+            static constexpr VQuaternion FromEulerAngles(const VVector3 &eulerDegrees) noexcept
             {
                 float Vpitch = eulerDegrees.x * VPI / 180.0f;
                 float yaw   = eulerDegrees.y * VPI / 180.0f;
                 float roll  = eulerDegrees.z * VPI / 180.0f;
 
-                float cy = std::cos(yaw * 0.5f);
-                float sy = std::sin(yaw * 0.5f);
-                float cp = std::cos(Vpitch * 0.5f);
-                float sp = std::sin(Vpitch * 0.5f);
-                float cr = std::cos(roll * 0.5f);
-                float sr = std::sin(roll * 0.5f);
+                float cy = Cos(yaw * 0.5f);
+                float sy = Sin(yaw * 0.5f);
+                float cp = Cos(Vpitch * 0.5f);
+                float sp = Sin(Vpitch * 0.5f);
+                float cr = Cos(roll * 0.5f);
+                float sr = Sin(roll * 0.5f);
 
                 VQuaternion q(0, 0, 0, 0);
                 q.w = cr * cp * cy + sr * sp * sy;
@@ -137,47 +370,211 @@ namespace VE::Math
                 return q;
             }
 
-            // Spherical linear interpolation
-            VQuaternion Slerp(const VQuaternion& other, float t) const noexcept
+            // Normalized linear interpolation along the shorter arc. Cheaper than Slerp(), the angular
+            // speed is not constant.
+            VQuaternion Nlerp(const VQuaternion &other, float t) const noexcept { return FromPacked(Detail::QuaternionNlerp(Packed(), other.Packed(), t)); }
+
+            // Spherical linear interpolation along the shorter arc, for unit quaternions. Polynomial instead
+            // of acos and sin (see Detail::SlerpCoefficients), within 2.1e-7 of the exact coefficients.
+            VQuaternion Slerp(const VQuaternion &other, float t) const noexcept { return FromPacked(Detail::QuaternionSlerp(Packed(), other.Packed(), t)); }
+
+        private:
+            Detail::VFloat4 Packed() const noexcept { return Detail::VFloat4::LoadU(&x); }
+
+            static VQuaternion FromPacked(Detail::VFloat4 q) noexcept
             {
-                // Compute the cosine of the angle between the two vectors
-                float dot = x * other.x + y * other.y + z * other.z + w * other.w;
-                
-                // If the dot product is negative, slerp won't take the shorter path
-                // So negate one quaternion to correct this
-                VQuaternion q2 = other;
-                if (dot < 0.0f) {
-                    q2 = VQuaternion(-other.x, -other.y, -other.z, -other.w);
-                    dot = -dot;
-                }
-                
-                // If the quaternions are very close, use linear interpolation
-                if (dot > 0.9995f) {
-                    VQuaternion result(
-                        x + t * (q2.x - x),
-                        y + t * (q2.y - y),
-                        z + t * (q2.z - z),
-                        w + t * (q2.w - w)
-                    );
-                    return result.Normalized();
-                }
-                
-                // Calculate the angle between the quaternions
-                float theta_0 = std::acos(std::abs(dot));
-                float theta = theta_0 * t;
-                float sin_theta = std::sin(theta);
-                float sin_theta_0 = std::sin(theta_0);
-                
-                float s0 = std::cos(theta) - dot * sin_theta / sin_theta_0;
-                float s1 = sin_theta / sin_theta_0;
-                
-                return VQuaternion(
-                    s0 * x + s1 * q2.x,
-                    s0 * y + s1 * q2.y,
-                    s0 * z + s1 * q2.z,
-                    s0 * w + s1 * q2.w
-                );
+                VQuaternion result;
+                Detail::VFloat4::StoreU(&result.x, q);
+                return result;
             }
 
+            static VQuaternion FromRotation(float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22) noexcept
+            {
+                using V         = Detail::VFloat4;
+                const V m[3][3] = {{V::Splat(m00), V::Splat(m01), V::Splat(m02)}, {V::Splat(m10), V::Splat(m11), V::Splat(m12)}, {V::Splat(m20), V::Splat(m21), V::Splat(m22)}};
+                const Detail::VQuaternionLanes<V> q = Detail::QuaternionFromRotation(m);
+                return VQuaternion{V::GetLane<0>(q.x), V::GetLane<0>(q.y), V::GetLane<0>(q.z), V::GetLane<0>(q.w)};
+            }
     };
-} // namespace VE::Internal::Math
\ No newline at end of file
+
+    static_assert(sizeof(VQuaternion) == 4 * sizeof(float), "Quaternion kernels read VQuaternion as packed (x y z w)");
+
+    namespace Detail
+    {
+        // V::Width packed quaternions to lanes and back, four per group transposed like a matrix
+        template <typename V> inline VQuaternionLanes<V> LoadQuaternionGroups(const VQuaternion *q) noexcept
+        {
+            VQuaternionLanes<V> r{LoadGroupsU<V>(&q[0].x, 16), LoadGroupsU<V>(&q[1].x, 16), LoadGroupsU<V>(&q[2].x, 16), LoadGroupsU<V>(&q[3].x, 16)};
+            Transpose4(r.x, r.y, r.z, r.w);
+            return r;
+        }
+
+        template <typename V> inline void StoreQuaternionGroups(VQuaternion *q, VQuaternionLanes<V> r) noexcept
+        {
+            Transpose4(r.x, r.y, r.z, r.w);
+            StoreGroupsU<V>(&q[0].x, 16, r.x);
+            StoreGroupsU<V>(&q[1].x, 16, r.y);
+            StoreGroupsU<V>(&q[2].x, 16, r.z);
+            StoreGroupsU<V>(&q[3].x, 16, r.w);
+        }
+
+        // Batch versions, the rest that does not fill a group goes through the packed kernels
+        template <typename V> inline void MultiplyQuaternions(const VQuaternion *a, const VQuaternion *b, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                StoreQuaternionGroups(&out[first], QuaternionMultiply(LoadQuaternionGroups<W>(&a[first]), LoadQuaternionGroups<W>(&b[first])));
+            });
+            for (; i < count; ++i) V::StoreU(&out[i].x, QuaternionMultiply(V::LoadU(&a[i].x), V::LoadU(&b[i].x)));
+        }
+
+        template <typename V> inline void ConjugateQuaternions(const VQuaternion *q, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                StoreQuaternionGroups(&out[first], QuaternionConjugate(LoadQuaternionGroups<W>(&q[first])));
+            });
+            for (; i < count; ++i) V::StoreU(&out[i].x, QuaternionConjugate(V::LoadU(&q[i].x)));
+        }
+
+        template <typename V> inline void NormalizeQuaternions(const VQuaternion *q, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                StoreQuaternionGroups(&out[first], QuaternionNormalize(LoadQuaternionGroups<W>(&q[first])));
+            });
+            for (; i < count; ++i) V::StoreU(&out[i].x, QuaternionNormalize(V::LoadU(&q[i].x)));
+        }
+
+        template <typename V> inline void RotateVectors(const VQuaternion *q, const VVector3 *v, VVector3 *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                W x, y, z;
+                LoadPointGroups(&v[first], x, y, z);
+                QuaternionRotate(LoadQuaternionGroups<W>(&q[first]), x, y, z);
+                StorePointGroups(&out[first], x, y, z);
+            });
+            for (; i < count; ++i)
+            {
+                const V r = QuaternionRotate(V::LoadU(&q[i].x), V::Set(v[i].x, v[i].y, v[i].z, 0.0f));
+                out[i]    = VVector3(V::template GetLane<0>(r), V::template GetLane<1>(r), V::template GetLane<2>(r));
+            }
+        }
+
+        template <typename V> inline void NlerpQuaternions(const VQuaternion *a, const VQuaternion *b, float t, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                StoreQuaternionGroups(&out[first], QuaternionNlerp(LoadQuaternionGroups<W>(&a[first]), LoadQuaternionGroups<W>(&b[first]), W::Splat(t)));
+            });
+            for (; i < count; ++i) V::StoreU(&out[i].x, QuaternionNlerp(V::LoadU(&a[i].x), V::LoadU(&b[i].x), t));
+        }
+
+        template <typename V> inline void SlerpQuaternions(const VQuaternion *a, const VQuaternion *b, float t, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                StoreQuaternionGroups(&out[first], QuaternionSlerp(LoadQuaternionGroups<W>(&a[first]), LoadQuaternionGroups<W>(&b[first]), W::Splat(t)));
+            });
+            for (; i < count; ++i) V::StoreU(&out[i].x, QuaternionSlerp(V::LoadU(&a[i].x), V::LoadU(&b[i].x), t));
+        }
+
+        template <typename V> inline void QuaternionsToMatrices(const VQuaternion *q, VMat4 *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                W r[3][3];
+                QuaternionToRotation(LoadQuaternionGroups<W>(&q[first]), r);
+
+                // After the transposes rows[k][row] holds that row of matrix k of each group
+                const W zero = W::Zero();
+                W       rows[4][4];
+                for (int row = 0; row < 3; ++row)
+                {
+                    W c0 = r[row][0], c1 = r[row][1], c2 = r[row][2], c3 = zero;
+                    Transpose4(c0, c1, c2, c3);
+                    rows[0][row] = c0;
+                    rows[1][row] = c1;
+                    rows[2][row] = c2;
+                    rows[3][row] = c3;
+                }
+                W t0 = zero, t1 = zero, t2 = zero, t3 = W::Splat(1.0f);
+                Transpose4(t0, t1, t2, t3);
+                rows[0][3] = t0;
+                rows[1][3] = t1;
+                rows[2][3] = t2;
+                rows[3][3] = t3;
+
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    float *dst = out[first + k].m.data();
+                    for (size_t row = 0; row < 4; ++row) StoreGroups<W>(dst + row * 4, 64, rows[k][row]);
+                }
+            });
+            for (; i < count; ++i) out[i] = q[i].ToMat4();
+        }
+
+        template <typename V> inline void QuaternionsFromMatrices(const VMat4 *m, VQuaternion *out, size_t count) noexcept
+        {
+            size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+
+                // Row r of four matrices transposed to its elements, one register per column
+                W r[3][3];
+                for (int row = 0; row < 3; ++row)
+                {
+                    W c0 = LoadGroupsU<W>(m[first].m.data() + row * 4, 64), c1 = LoadGroupsU<W>(m[first + 1].m.data() + row * 4, 64);
+                    W c2 = LoadGroupsU<W>(m[first + 2].m.data() + row * 4, 64), c3 = LoadGroupsU<W>(m[first + 3].m.data() + row * 4, 64);
+                    Transpose4(c0, c1, c2, c3);
+                    r[row][0] = c0;
+                    r[row][1] = c1;
+                    r[row][2] = c2;
+                }
+                StoreQuaternionGroups(&out[first], QuaternionFromRotation(r));
+            });
+            for (; i < count; ++i) out[i] = VQuaternion::FromMat4(m[i]);
+        }
+    } // namespace Detail
+
+    // ----------------- Quaternion batches -----------------
+    // Element wise over arrays, V::Width quaternions per step (eight with AVX2). Results are bit identical
+    // to the VQuaternion members. out may be the same array as an input.
+
+    // out[i] = a[i] * b[i]
+    inline void MultiplyQuaternions(const VQuaternion *a, const VQuaternion *b, VQuaternion *out, size_t count) noexcept
+    {
+        Detail::MultiplyQuaternions<Detail::VFloat4>(a, b, out, count);
+    }
+
+    inline void ConjugateQuaternions(const VQuaternion *q, VQuaternion *out, size_t count) noexcept { Detail::ConjugateQuaternions<Detail::VFloat4>(q, out, count); }
+
+    inline void NormalizeQuaternions(const VQuaternion *q, VQuaternion *out, size_t count) noexcept { Detail::NormalizeQuaternions<Detail::VFloat4>(q, out, count); }
+
+    // out[i] = q[i].Rotate(v[i])
+    inline void RotateVectors(const VQuaternion *q, const VVector3 *v, VVector3 *out, size_t count) noexcept
+    {
+        Detail::RotateVectors<Detail::VFloat4>(q, v, out, count);
+    }
+
+    // out[i] = a[i].Nlerp(b[i], t), one weight for all, e.g. blending two poses
+    inline void NlerpQuaternions(const VQuaternion *a, const VQuaternion *b, float t, VQuaternion *out, size_t count) noexcept
+    {
+        Detail::NlerpQuaternions<Detail::VFloat4>(a, b, t, out, count);
+    }
+
+    // out[i] = a[i].Slerp(b[i], t)
+    inline void SlerpQuaternions(const VQuaternion *a, const VQuaternion *b, float t, VQuaternion *out, size_t count) noexcept
+    {
+        Detail::SlerpQuaternions<Detail::VFloat4>(a, b, t, out, count);
+    }
+
+    // out[i] = q[i].ToMat4()
+    inline void QuaternionsToMatrices(const VQuaternion *q, VMat4 *out, size_t count) noexcept { Detail::QuaternionsToMatrices<Detail::VFloat4>(q, out, count); }
+
+    // out[i] = VQuaternion::FromMat4(m[i])
+    inline void QuaternionsFromMatrices(const VMat4 *m, VQuaternion *out, size_t count) noexcept
+    {
+        Detail::QuaternionsFromMatrices<Detail::VFloat4>(m, out, count);
+    }
+} // namespace VE::Math
@@ -0,0 +1,216 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../VMA_Simd.hpp"
+#include "VMA_Matrix.hpp"
+#include "VMA_Quaternation.hpp"
+#include "VMA_Vector.hpp"
+
+namespace VE::Math
+{
+    // ----------------- Transform composition -----------------
+
+    // Matrix of a position, rotation and scale: scales in local space, rotates and then translates.
+    // Same result as building Scale(), ToMat4() and multiplying them, without the two full matrices.
+    inline VMat4 ComposeTransform(const VVector3 &position, const VQuaternion &rotation, const VVector3 &scale) noexcept
+    {
+        const float xx = rotation.x * rotation.x, yy = rotation.y * rotation.y, zz = rotation.z * rotation.z;
+        const float xy = rotation.x * rotation.y, xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+        const float wx = rotation.w * rotation.x, wy = rotation.w * rotation.y, wz = rotation.w * rotation.z;
+
+        // Rotation as in VQuaternion::ToMat3, column c scaled by scale c
+        VMat4 result;
+        result.m[0]  = (1.0f - 2.0f * (yy + zz)) * scale.x;
+        result.m[1]  = (2.0f * (xy - wz)) * scale.y;
+        result.m[2]  = (2.0f * (xz + wy)) * scale.z;
+        result.m[4]  = (2.0f * (xy + wz)) * scale.x;
+        result.m[5]  = (1.0f - 2.0f * (xx + zz)) * scale.y;
+        result.m[6]  = (2.0f * (yz - wx)) * scale.z;
+        result.m[8]  = (2.0f * (xz - wy)) * scale.x;
+        result.m[9]  = (2.0f * (yz + wx)) * scale.y;
+        result.m[10] = (1.0f - 2.0f * (xx + yy)) * scale.z;
+        result.m[12] = position.x;
+        result.m[13] = position.y;
+        result.m[14] = position.z;
+        result.m[15] = 1.0f;
+        return result;
+    }
+
+    // Transforms of many entities as structure of arrays, one array per component, so the matrices can be
+    // built V::Width entities at a time. Entries with a parent are composed with it (the parent's world
+    // matrix applied after the local one), parents have to come before their children.
+    struct VTransformSoA
+    {
+            std::vector<float> positionX, positionY, positionZ;
+            std::vector<float> rotationX, rotationY, rotationZ, rotationW;
+            std::vector<float> scaleX, scaleY, scaleZ;
+
+            // Index of the parent entry, lower than the entry's own, or -1 for roots
+            std::vector<int32_t> parent;
+
+            size_t Size() const noexcept { return parent.size(); }
+
+            void Reserve(size_t count)
+            {
+                for (std::vector<float> *stream : Streams()) stream->reserve(count);
+                parent.reserve(count);
+            }
+
+            void Clear() noexcept
+            {
+                for (std::vector<float> *stream : Streams()) stream->clear();
+                parent.clear();
+            }
+
+            // Returns the index of the new entry
+            size_t Add(const VVector3 &position, const VQuaternion &rotation, const VVector3 &scale, int32_t parentIndex = -1)
+            {
+                assert(parentIndex < static_cast<int64_t>(Size()) && "Parents have to be added before their children");
+                for (std::vector<float> *stream : Streams()) stream->emplace_back();
+                parent.push_back(parentIndex);
+
+                const size_t index = Size() - 1;
+                Set(index, position, rotation, scale);
+                return index;
+            }
+
+            void Set(size_t index, const VVector3 &position, const VQuaternion &rotation, const VVector3 &scale) noexcept
+            {
+                positionX[index] = position.x;
+                positionY[index] = position.y;
+                positionZ[index] = position.z;
+                rotationX[index] = rotation.x;
+                rotationY[index] = rotation.y;
+                rotationZ[index] = rotation.z;
+                rotationW[index] = rotation.w;
+                scaleX[index]    = scale.x;
+                scaleY[index]    = scale.y;
+                scaleZ[index]    = scale.z;
+            }
+
+            // ComposeTransform() of the entries in [begin, end), without parents. Ranges can be built on
+            // different threads.
+            void ComputeLocalMatrices(VMat4 *out, size_t begin, size_t end) const noexcept;
+            void ComputeLocalMatrices(VMat4 *out) const noexcept { ComputeLocalMatrices(out, 0, Size()); }
+
+            // World matrices of all entries, out[i] = local(i) * out[parent[i]]. One pass over the entries
+            // in blocks, each block's local matrices are composed while they are still in cache.
+            void ComputeWorldMatrices(VMat4 *out) const noexcept;
+
+        private:
+            std::array<std::vector<float> *, 10> Streams() noexcept
+            {
+                return {&positionX, &positionY, &positionZ, &rotationX, &rotationY, &rotationZ, &rotationW, &scaleX, &scaleY, &scaleZ};
+            }
+    };
+
+    namespace Detail
+    {
+        // ComposeTransform() for V::Width entities per step, four per 128 bit group: every matrix element is
+        // computed for all entities at once, each group of four matrices is transposed into rows on the way
+        // out. Returns how many entities it handled, a multiple of V::Width.
+        template <typename V> inline size_t ComposeTransformGroups(const VTransformSoA &t, VMat4 *out, size_t begin, size_t end) noexcept
+        {
+            const V one  = V::Splat(1.0f);
+            const V zero = V::Zero();
+
+            size_t i = begin;
+            for (; i + V::Width <= end; i += V::Width)
+            {
+                V r[3][3];
+                QuaternionToRotation(VQuaternionLanes<V>{V::LoadU(&t.rotationX[i]), V::LoadU(&t.rotationY[i]), V::LoadU(&t.rotationZ[i]), V::LoadU(&t.rotationW[i])}, r);
+                const V sx = V::LoadU(&t.scaleX[i]), sy = V::LoadU(&t.scaleY[i]), sz = V::LoadU(&t.scaleZ[i]);
+
+                // Same operations as ComposeTransform(), element by element
+                V r00 = V::Mul(r[0][0], sx);
+                V r01 = V::Mul(r[0][1], sy);
+                V r02 = V::Mul(r[0][2], sz);
+                V r03 = zero;
+                V r10 = V::Mul(r[1][0], sx);
+                V r11 = V::Mul(r[1][1], sy);
+                V r12 = V::Mul(r[1][2], sz);
+                V r13 = zero;
+                V r20 = V::Mul(r[2][0], sx);
+                V r21 = V::Mul(r[2][1], sy);
+                V r22 = V::Mul(r[2][2], sz);
+                V r23 = zero;
+                V r30 = V::LoadU(&t.positionX[i]), r31 = V::LoadU(&t.positionY[i]), r32 = V::LoadU(&t.positionZ[i]);
+                V r33 = one;
+
+                // After the transposes rXk holds row X of entity k of each group
+                Transpose4(r00, r01, r02, r03);
+                Transpose4(r10, r11, r12, r13);
+                Transpose4(r20, r21, r22, r23);
+                Transpose4(r30, r31, r32, r33);
+
+                const V rows[4][4] = {{r00, r10, r20, r30}, {r01, r11, r21, r31}, {r02, r12, r22, r32}, {r03, r13, r23, r33}};
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    float *dst = out[i + k].m.data();
+                    for (size_t row = 0; row < 4; ++row)
+                    {
+                        StoreGroups<V>(dst + row * 4, 64, rows[k][row]);
+                    }
+                }
+            }
+            return i;
+        }
+
+        template <typename V> inline void ComposeTransforms(const VTransformSoA &t, VMat4 *out, size_t begin, size_t end) noexcept
+        {
+            size_t i = begin;
+#if defined(VANTOR_MATH_AVX2)
+            if constexpr (std::is_same_v<V, VFloat4Sse>) i = ComposeTransformGroups<VFloat8Avx>(t, out, i, end);
+#endif
+            i = ComposeTransformGroups<V>(t, out, i, end);
+            for (; i < end; ++i)
+            {
+                out[i] = ComposeTransform(VVector3(t.positionX[i], t.positionY[i], t.positionZ[i]),
+                                          VQuaternion(t.rotationX[i], t.rotationY[i], t.rotationZ[i], t.rotationW[i]), VVector3(t.scaleX[i], t.scaleY[i], t.scaleZ[i]));
+            }
+        }
+    } // namespace Detail
+
+    inline void VTransformSoA::ComputeLocalMatrices(VMat4 *out, size_t begin, size_t end) const noexcept
+    {
+        assert(begin <= end && end <= Size());
+        Detail::ComposeTransforms<Detail::VFloat4>(*this, out, begin, end);
+    }
+
+    inline void VTransformSoA::ComputeWorldMatrices(VMat4 *out) const noexcept
+    {
+        // 256 matrices are 16 KB, the block stays in L1 between the two loops
+        constexpr size_t blockSize = 256;
+
+        const size_t count = Size();
+        for (size_t begin = 0; begin < count; begin += blockSize)
+        {
+            const size_t end = std::min(begin + blockSize, count);
+            Detail::ComposeTransforms<Detail::VFloat4>(*this, out, begin, end);
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                const int32_t p = parent[i];
+                if (p < 0) continue;
+                assert(static_cast<size_t>(p) < i && "Parents have to come before their children");
+                Detail::MatrixMultiply<Detail::VFloat4>(out[i].m.data(), out[p].m.data(), out[i].m.data());
+            }
+        }
+    }
+} // namespace VE::Math
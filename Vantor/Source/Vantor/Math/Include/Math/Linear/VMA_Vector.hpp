@@ -13,6 +13,8 @@
 #include <cassert>
 #include <cmath>
 
+#include "../VMA_Functions.hpp"
+
 namespace VE::Math
 {
 
@@ -31,25 +33,25 @@ namespace VE::Math
             constexpr VVector2 operator*(float scalar) const noexcept { return {x * scalar, y * scalar}; }
             constexpr VVector2 operator/(float scalar) const noexcept { return {x / scalar, y / scalar}; }
 
-            VVector2 &operator+=(const VVector2 &rhs) noexcept
+            constexpr VVector2 &operator+=(const VVector2 &rhs) noexcept
             {
                 x += rhs.x;
                 y += rhs.y;
                 return *this;
             }
-            VVector2 &operator-=(const VVector2 &rhs) noexcept
+            constexpr VVector2 &operator-=(const VVector2 &rhs) noexcept
             {
                 x -= rhs.x;
                 y -= rhs.y;
                 return *this;
             }
-            VVector2 &operator*=(float scalar) noexcept
+            constexpr VVector2 &operator*=(float scalar) noexcept
             {
                 x *= scalar;
                 y *= scalar;
                 return *this;
             }
-            VVector2 &operator/=(float scalar) noexcept
+            constexpr VVector2 &operator/=(float scalar) noexcept
             {
                 x /= scalar;
                 y /= scalar;
@@ -58,16 +60,16 @@ namespace VE::Math
 
             // Utilities
             constexpr float Dot(const VVector2 &rhs) const noexcept { return x * rhs.x + y * rhs.y; }
-            float           length() const noexcept { return std::sqrt(x * x + y * y); }
-            float           lengthSquared() const noexcept { return x * x + y * y; }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y; }
 
-            VVector2 Normalized() const noexcept
+            constexpr VVector2 Normalized() const noexcept
             {
                 float len = length();
                 return len > 0 ? (*this) / len : VVector2{};
             }
 
-            void Normalize() noexcept
+            constexpr void Normalize() noexcept
             {
                 float len = length();
                 if (len > 0)
@@ -82,7 +84,7 @@ namespace VE::Math
     };
 
     // Scalar * vector operator
-    inline VVector2 operator*(float scalar, const VVector2 &vec) noexcept { return vec * scalar; }
+    constexpr VVector2 operator*(float scalar, const VVector2 &vec) noexcept { return vec * scalar; }
 
     // ----------------- VVector3 -----------------
     struct VVector3
@@ -97,28 +99,28 @@ namespace VE::Math
             constexpr VVector3 operator*(float scalar) const noexcept { return {x * scalar, y * scalar, z * scalar}; }
             constexpr VVector3 operator/(float scalar) const noexcept { return {x / scalar, y / scalar, z / scalar}; }
 
-            VVector3 &operator+=(const VVector3 &rhs) noexcept
+            constexpr VVector3 &operator+=(const VVector3 &rhs) noexcept
             {
                 x += rhs.x;
                 y += rhs.y;
                 z += rhs.z;
                 return *this;
             }
-            VVector3 &operator-=(const VVector3 &rhs) noexcept
+            constexpr VVector3 &operator-=(const VVector3 &rhs) noexcept
             {
                 x -= rhs.x;
                 y -= rhs.y;
                 z -= rhs.z;
                 return *this;
             }
-            VVector3 &operator*=(float scalar) noexcept
+            constexpr VVector3 &operator*=(float scalar) noexcept
             {
                 x *= scalar;
                 y *= scalar;
                 z *= scalar;
                 return *this;
             }
-            VVector3 &operator/=(float scalar) noexcept
+            constexpr VVector3 &operator/=(float scalar) noexcept
             {
                 x /= scalar;
                 y /= scalar;
@@ -128,18 +130,18 @@ namespace VE::Math
 
             constexpr float Dot(const VVector3 &rhs) const noexcept { return x * rhs.x + y * rhs.y + z * rhs.z; }
 
-            VVector3 Cross(const VVector3 &rhs) const noexcept { return {y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x}; }
+            constexpr VVector3 Cross(const VVector3 &rhs) const noexcept { return {y * rhs.z - z * rhs.y, z * rhs.x - x * rhs.z, x * rhs.y - y * rhs.x}; }
 
-            float length() const noexcept { return std::sqrt(x * x + y * y + z * z); }
-            float lengthSquared() const noexcept { return x * x + y * y + z * z; }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y + z * z); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y + z * z; }
 
-            VVector3 Normalized() const noexcept
+            constexpr VVector3 Normalized() const noexcept
             {
                 float len = length();
                 return len > 0 ? (*this) / len : VVector3{};
             }
 
-            void Normalize() noexcept
+            constexpr void Normalize() noexcept
             {
                 float len = length();
                 if (len > 0)
@@ -154,7 +156,7 @@ namespace VE::Math
             float                 *Data() noexcept { return &x; }
     };
 
-    inline VVector3 operator*(float scalar, const VVector3 &vec) noexcept { return vec * scalar; }
+    constexpr VVector3 operator*(float scalar, const VVector3 &vec) noexcept { return vec * scalar; }
 
     // ----------------- VVector4 -----------------
     struct VVector4
@@ -169,7 +171,7 @@ namespace VE::Math
             constexpr VVector4 operator*(float scalar) const noexcept { return {x * scalar, y * scalar, z * scalar, w * scalar}; }
             constexpr VVector4 operator/(float scalar) const noexcept { return {x / scalar, y / scalar, z / scalar, w / scalar}; }
 
-            VVector4 &operator+=(const VVector4 &rhs) noexcept
+            constexpr VVector4 &operator+=(const VVector4 &rhs) noexcept
             {
                 x += rhs.x;
                 y += rhs.y;
@@ -177,7 +179,7 @@ namespace VE::Math
                 w += rhs.w;
                 return *this;
             }
-            VVector4 &operator-=(const VVector4 &rhs) noexcept
+            constexpr VVector4 &operator-=(const VVector4 &rhs) noexcept
             {
                 x -= rhs.x;
                 y -= rhs.y;
@@ -185,7 +187,7 @@ namespace VE::Math
                 w -= rhs.w;
                 return *this;
             }
-            VVector4 &operator*=(float scalar) noexcept
+            constexpr VVector4 &operator*=(float scalar) noexcept
             {
                 x *= scalar;
                 y *= scalar;
@@ -193,7 +195,7 @@ namespace VE::Math
                 w *= scalar;
                 return *this;
             }
-            VVector4 &operator/=(float scalar) noexcept
+            constexpr VVector4 &operator/=(float scalar) noexcept
             {
                 x /= scalar;
                 y /= scalar;
@@ -204,16 +206,16 @@ namespace VE::Math
 
             constexpr float Dot(const VVector4 &rhs) const noexcept { return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w; }
 
-            float length() const noexcept { return std::sqrt(x * x + y * y + z * z + w * w); }
-            float lengthSquared() const noexcept { return x * x + y * y + z * z + w * w; }
+            constexpr float length() const noexcept { return Sqrt(x * x + y * y + z * z + w * w); }
+            constexpr float lengthSquared() const noexcept { return x * x + y * y + z * z + w * w; }
 
-            VVector4 Normalized() const noexcept
+            constexpr VVector4 Normalized() const noexcept
             {
                 float len = length();
                 return len > 0 ? (*this) / len : VVector4{};
             }
 
-            void Normalize() noexcept
+            constexpr void Normalize() noexcept
             {
                 float len = length();
                 if (len > 0)
@@ -229,7 +231,7 @@ namespace VE::Math
             float                 *Data() noexcept { return &x; }
     };
 
-    inline VVector4 operator*(float scalar, const VVector4 &vec) noexcept { return vec * scalar; }
+    constexpr VVector4 operator*(float scalar, const VVector4 &vec) noexcept { return vec * scalar; }
 
     // Clamp scalar
     inline float Clamp(float value, float minVal, float maxVal) noexcept { return std::fmax(minVal, std::fmin(maxVal, value)); }
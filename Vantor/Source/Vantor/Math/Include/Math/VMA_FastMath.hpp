@@ -0,0 +1,332 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "VMA_Simd.hpp"
+
+// Approximate rsqrt, exp, log, pow, atan2 and sincos in three accuracy tiers, for code that can trade
+// precision for speed (lighting, particles, camera smoothing). Each comes as a scalar function and as a
+// batch over arrays; both run the same kernel, the scalar one on a single lane, so a value is the same
+// whether it was computed alone or in a batch.
+//
+//     VAccuracy::Exact   the C library (1 / sqrt for rsqrt), the batch versions call it lane by lane
+//     VAccuracy::Medium  about 1e-5
+//     VAccuracy::Low     about 1e-3
+//
+// Errors of Medium and Low, measured by VantorMathBenchmark --suite fastmath over the domains below:
+//
+//                 Medium    Low       error     domain
+//     RSqrt       7.6e-7    6.5e-4    relative  positive normal floats, 0 and subnormals give wrong finite results
+//     Exp         2.9e-6    1.0e-4    relative  normal results; subnormal ones are within 4e-44, 0 below -104,
+//                                               inf above 88.72
+//     Log         1.2e-7    7.7e-6    relative  absolute where |log x| < 1; x > 0 including subnormals, log(0) =
+//                                               -inf, negative x NaN
+//     Pow         6.6e-6    1.6e-4    relative  exp(y log x) for x > 0, measured for x in [2^-10, 2^10], |y| <= 8;
+//                                               the error grows with |y log x|
+//     Atan2       1.9e-6    6.1e-4    absolute  finite arguments, atan2(0, 0) = 0
+//     SinCos      6.3e-7    1.5e-4    absolute  |x| <= 8192, beyond that the reduction loses accuracy
+//
+// The approximate tiers do not handle NaN or infinite arguments beyond what the table says. The batches
+// are where the speed is; one at a time, RSqrt, Atan2 and SinCos are still faster than the C library, while
+// Exp, Log and Pow are not faster than a table driven libm (glibc).
+
+namespace VE::Math
+{
+    enum class VAccuracy : uint8_t
+    {
+        Exact,
+        Medium,
+        Low
+    };
+
+    struct VSinCos
+    {
+            float sin;
+            float cos;
+    };
+
+    namespace Detail
+    {
+        template <typename V> inline V SplatBits(uint32_t bits) noexcept { return V::Splat(std::bit_cast<float>(bits)); }
+        template <typename V> inline V Abs(V a) noexcept { return V::CopySign(a, V::Zero()); }
+
+        // c[0] + c[1] x + c[2] x^2 + ...
+        template <typename V, size_t N> inline V Polynomial(V x, const float (&c)[N]) noexcept
+        {
+            V result = V::Splat(c[N - 1]);
+            for (size_t i = N - 1; i-- > 0;) result = V::MulAdd(result, x, V::Splat(c[i]));
+            return result;
+        }
+
+        // The C library lane by lane, for the Exact tier of the batch versions
+        template <typename V, typename F> inline V PerLane(V a, F f) noexcept
+        {
+            float lanes[V::Width];
+            V::StoreU(lanes, a);
+            for (float &lane : lanes) lane = f(lane);
+            return V::LoadU(lanes);
+        }
+
+        template <typename V, typename F> inline V PerLane(V a, V b, F f) noexcept
+        {
+            float lanesA[V::Width], lanesB[V::Width];
+            V::StoreU(lanesA, a);
+            V::StoreU(lanesB, b);
+            for (size_t i = 0; i < V::Width; ++i) lanesA[i] = f(lanesA[i], lanesB[i]);
+            return V::LoadU(lanesA);
+        }
+
+        // Adding 1.5 * 2^23 rounds |x| < 2^22 to an integer and leaves it in the low mantissa bits
+        constexpr float RoundingShift = 12582912.0f;
+
+        // 2^n for integral n in [-126, 127]: n + 127 moves from the low mantissa bits into the exponent field
+        template <typename V> inline V Exp2Integer(V n) noexcept { return V::template ShiftLeftBits<23>(V::Add(n, V::Splat(RoundingShift + 127.0f))); }
+
+        // ln 2 in two parts, the first with 9 significant bits so n * first is exact for |n| < 2^15
+        constexpr float Ln2High = 0.693359375f;
+        constexpr float Ln2Low  = -2.12194440e-4f;
+
+        // Minimax polynomials (fitted for these tiers, maximum error in the comment), exp and cos with the constant
+        // term held at 1 so e^0 and cos 0 stay exact. Exp: e^r for |r| <= ln2 / 2, relative. Log: 2 atanh(s) / s
+        // in s^2 for |s| <= 3 - 2 sqrt 2, relative. Atan: atan(a) / a in a^2 for a in [0, 1], absolute. Sin, Cos:
+        // sin(r) / r and cos(r) in r^2 for |r| <= pi / 4, absolute.
+        constexpr float ExpMedium[]  = {1.0f, 9.999668365e-01f, 5.000301365e-01f, 1.678747334e-01f, 4.151384732e-02f};                                  // 2.8e-6
+        constexpr float ExpLow[]     = {1.0f, 1.000195841e+00f, 5.041303779e-01f, 1.651797552e-01f};                                                    // 1.0e-4
+        constexpr float LogMedium[]  = {2.000000237e+00f, 6.665222539e-01f, 4.129632680e-01f};                                                          // 1.2e-7
+        constexpr float LogLow[]     = {1.999955510e+00f, 6.786789068e-01f};                                                                            // 2.2e-5
+        constexpr float AtanMedium[] = {9.999772191e-01f, -3.326228280e-01f, 1.935403761e-01f, -1.164264813e-01f, 5.264735033e-02f, -1.171913520e-02f}; // 1.7e-6
+        constexpr float AtanLow[]    = {9.953579549e-01f, -2.886902361e-01f, 7.933903904e-02f};                                                         // 6.1e-4
+        constexpr float SinMedium[]  = {9.999949976e-01f, -1.666016199e-01f, 8.121557959e-03f};                                                         // 5.6e-7
+        constexpr float SinLow[]     = {9.990314235e-01f, -1.603440178e-01f};                                                                           // 1.5e-4
+        constexpr float CosMedium[]  = {1.0f, -4.999989478e-01f, 4.165629458e-02f, -1.359782312e-03f};                                                  // 3.2e-8
+        constexpr float CosLow[]     = {1.0f, -4.997763071e-01f, 4.048893595e-02f};                                                                     // 1.2e-5
+
+        template <VAccuracy A, typename V> inline V RSqrt(V x) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact) return V::Div(V::Splat(1.0f), V::Sqrt(x));
+
+            // Halving the exponent through the bits, then one Newton step with tuned constants (Moroz et al. 2018)
+            V y = V::SubBits(SplatBits<V>(0x5F1FFFF9u), V::template ShiftRightBits<1>(x));
+            y   = V::Mul(V::Mul(y, V::Splat(0.703952253f)), V::Sub(V::Splat(2.38924456f), V::Mul(V::Mul(x, y), y)));
+            if constexpr (A == VAccuracy::Medium) y = V::Mul(y, V::MulAdd(V::Mul(V::Mul(x, y), y), V::Splat(-0.5f), V::Splat(1.5f)));
+            return y;
+        }
+
+        template <VAccuracy A, typename V> inline V Exp(V x) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact) return PerLane(x, [](float v) { return std::exp(v); });
+
+            // Beyond the clamp the result is 0 or inf anyway, NaN passes through
+            x = V::Select(V::Greater(x, V::Splat(89.5f)), V::Splat(89.5f), x);
+            x = V::Select(V::Greater(V::Splat(-104.0f), x), V::Splat(-104.0f), x);
+
+            // x = n ln2 + r, e^x = 2^n e^r
+            const V shifted = V::MulAdd(x, V::Splat(1.44269504f), V::Splat(RoundingShift));
+            const V n       = V::Sub(shifted, V::Splat(RoundingShift));
+            V       r       = V::MulAdd(n, V::Splat(-Ln2High), x);
+            r               = V::MulAdd(n, V::Splat(-Ln2Low), r);
+            const V p       = A == VAccuracy::Medium ? Polynomial(r, ExpMedium) : Polynomial(r, ExpLow);
+
+            // 2^n in two halves, each stays normal for n in [-150, 129], so subnormal results round once
+            const V half = V::Sub(V::MulAdd(n, V::Splat(0.5f), V::Splat(RoundingShift)), V::Splat(RoundingShift));
+            return V::Mul(V::Mul(p, Exp2Integer(half)), Exp2Integer(V::Sub(n, half)));
+        }
+
+        template <VAccuracy A, typename V> inline V Log(V x) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact) return PerLane(x, [](float v) { return std::log(v); });
+
+            // A subnormal's mantissa bits under the exponent of 1 make 1 + x 2^126, so subtracting 1 scales it into
+            // the normal range without arithmetic on the subnormal itself (microcoded and slow on many CPUs)
+            const V subnormal = V::Greater(V::Splat(std::numeric_limits<float>::min()), x);
+            const V scaled    = V::Select(subnormal, V::Sub(V::Or(x, V::Splat(1.0f)), V::Splat(1.0f)), x);
+
+            // x = 2^e m with m in [sqrt(1/2), sqrt(2))
+            V       e     = V::Sub(V::Or(V::template ShiftRightBits<23>(scaled), SplatBits<V>(0x4B000000u)), V::Splat(8388608.0f + 127.0f));
+            e             = V::Sub(e, V::And(subnormal, V::Splat(126.0f)));
+            V       m     = V::Or(V::And(scaled, SplatBits<V>(0x007FFFFFu)), V::Splat(1.0f));
+            const V large = V::Greater(m, V::Splat(1.41421356f));
+            m             = V::Select(large, V::Mul(m, V::Splat(0.5f)), m);
+            e             = V::Add(e, V::And(large, V::Splat(1.0f)));
+
+            // log m = 2 atanh(s), s = (m - 1) / (m + 1)
+            const V f      = V::Sub(m, V::Splat(1.0f));
+            const V s      = V::Div(f, V::Add(f, V::Splat(2.0f)));
+            const V s2     = V::Mul(s, s);
+            const V logM   = V::Mul(s, A == VAccuracy::Medium ? Polynomial(s2, LogMedium) : Polynomial(s2, LogLow));
+            V       result = V::MulAdd(e, V::Splat(Ln2High), V::MulAdd(e, V::Splat(Ln2Low), logM));
+
+            // +inf stays, 0 and -0 give -inf and NaN stays NaN (x ORed into the bits of -inf), negatives NaN
+            result = V::Select(V::Greater(x, V::Splat(std::numeric_limits<float>::max())), x, result);
+            result = V::Select(V::Greater(x, V::Zero()), result, V::Or(x, SplatBits<V>(0xFF800000u)));
+            return V::Select(V::Greater(V::Zero(), x), V::Splat(std::numeric_limits<float>::quiet_NaN()), result);
+        }
+
+        template <VAccuracy A, typename V> inline V Pow(V x, V y) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact) return PerLane(x, y, [](float a, float b) { return std::pow(a, b); });
+            return Exp<A>(V::Mul(y, Log<A>(x)));
+        }
+
+        template <VAccuracy A, typename V> inline V Atan2(V y, V x) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact) return PerLane(y, x, [](float a, float b) { return std::atan2(a, b); });
+
+            // atan of the smaller over the larger magnitude, in [0, pi / 4], then mirrored into the right octant
+            const V ax    = Abs(x);
+            const V ay    = Abs(y);
+            const V steep = V::Greater(ay, ax);
+            const V low   = V::Select(steep, ax, ay);
+            const V high  = V::Select(steep, ay, ax);
+            const V a     = V::Select(V::Greater(high, V::Zero()), V::Div(low, high), V::Zero());
+            V       angle = V::Mul(a, A == VAccuracy::Medium ? Polynomial(V::Mul(a, a), AtanMedium) : Polynomial(V::Mul(a, a), AtanLow));
+            angle         = V::Select(steep, V::Sub(V::Splat(1.57079633f), angle), angle);
+            angle         = V::Select(V::Greater(V::Zero(), x), V::Sub(V::Splat(3.14159265f), angle), angle);
+            return V::CopySign(angle, y);
+        }
+
+        // pi / 2 in three parts with trailing zero bits, n * each is exact for |n| < 2^13 (|x| <= 8192)
+        constexpr float PiOver2A = 1.5703125f;
+        constexpr float PiOver2B = 4.83751296997070312500e-04f;
+        constexpr float PiOver2C = 7.54978995489188216e-08f;
+
+        template <VAccuracy A, typename V> inline void SinCos(V x, V &sin, V &cos) noexcept
+        {
+            if constexpr (A == VAccuracy::Exact)
+            {
+                sin = PerLane(x, [](float v) { return std::sin(v); });
+                cos = PerLane(x, [](float v) { return std::cos(v); });
+                return;
+            }
+
+            // x = n pi / 2 + r with |r| <= pi / 4, the quadrant n mod 4 is in the low bits of shifted
+            const V shifted = V::MulAdd(x, V::Splat(0.636619772f), V::Splat(RoundingShift));
+            const V n       = V::Sub(shifted, V::Splat(RoundingShift));
+            V       r       = V::MulAdd(n, V::Splat(-PiOver2A), x);
+            r               = V::MulAdd(n, V::Splat(-PiOver2B), r);
+            r               = V::MulAdd(n, V::Splat(-PiOver2C), r);
+
+            const V r2 = V::Mul(r, r);
+            const V s  = V::Mul(r, A == VAccuracy::Medium ? Polynomial(r2, SinMedium) : Polynomial(r2, SinLow));
+            const V c  = A == VAccuracy::Medium ? Polynomial(r2, CosMedium) : Polynomial(r2, CosLow);
+
+            // Odd quadrants swap sin and cos (0 - 1 sets every bit of the mask), sin is negative in quadrants 2
+            // and 3, cos in 1 and 2: bit 1 of n and of n + 1 moved into the sign bit
+            const V odd = V::SubBits(V::Zero(), V::And(shifted, SplatBits<V>(1u)));
+            sin         = V::Xor(V::Select(odd, c, s), V::template ShiftLeftBits<30>(V::And(shifted, SplatBits<V>(2u))));
+            cos         = V::Xor(V::Select(odd, s, c), V::template ShiftLeftBits<30>(V::And(V::Add(shifted, V::Splat(1.0f)), SplatBits<V>(2u))));
+        }
+
+        // Batches: full groups through ForEachGroup, the rest padded into one more group of V
+        template <typename V, typename Kernel> inline void ForEachFloat(const float *a, const float *b, float *out, float *out2, size_t count, Kernel kernel) noexcept
+        {
+            const size_t i = ForEachGroup<V>(count, [&](auto lanes, size_t first) {
+                using W = decltype(lanes);
+                kernel(W::LoadU(&a[first]), b ? W::LoadU(&b[first]) : W::Zero(), &out[first], out2 ? &out2[first] : nullptr);
+            });
+            if (i == count) return;
+
+            float tailA[V::Width] = {}, tailB[V::Width] = {}, tailOut[V::Width] = {}, tailOut2[V::Width] = {};
+            for (size_t k = i; k < count; ++k)
+            {
+                tailA[k - i] = a[k];
+                if (b) tailB[k - i] = b[k];
+            }
+            kernel(V::LoadU(tailA), V::LoadU(tailB), tailOut, tailOut2);
+            for (size_t k = i; k < count; ++k)
+            {
+                out[k] = tailOut[k - i];
+                if (out2) out2[k] = tailOut2[k - i];
+            }
+        }
+    } // namespace Detail
+
+    // Scalar versions
+    template <VAccuracy A = VAccuracy::Medium> inline float FastRSqrt(float x) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return 1.0f / std::sqrt(x);
+        return Detail::VFloat4::GetLane<0>(Detail::RSqrt<A>(Detail::VFloat4::Splat(x)));
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline float FastExp(float x) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return std::exp(x);
+        return Detail::VFloat4::GetLane<0>(Detail::Exp<A>(Detail::VFloat4::Splat(x)));
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline float FastLog(float x) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return std::log(x);
+        return Detail::VFloat4::GetLane<0>(Detail::Log<A>(Detail::VFloat4::Splat(x)));
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline float FastPow(float x, float y) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return std::pow(x, y);
+        return Detail::VFloat4::GetLane<0>(Detail::Pow<A>(Detail::VFloat4::Splat(x), Detail::VFloat4::Splat(y)));
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline float FastAtan2(float y, float x) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return std::atan2(y, x);
+        return Detail::VFloat4::GetLane<0>(Detail::Atan2<A>(Detail::VFloat4::Splat(y), Detail::VFloat4::Splat(x)));
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline VSinCos FastSinCos(float x) noexcept
+    {
+        if constexpr (A == VAccuracy::Exact) return {std::sin(x), std::cos(x)};
+        Detail::VFloat4 sin, cos;
+        Detail::SinCos<A>(Detail::VFloat4::Splat(x), sin, cos);
+        return {Detail::VFloat4::GetLane<0>(sin), Detail::VFloat4::GetLane<0>(cos)};
+    }
+
+    // Batch versions, out[i] = Fast*(x[i]); out may be the input array
+    template <VAccuracy A = VAccuracy::Medium> inline void FastRSqrt(const float *x, float *out, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(x, nullptr, out, nullptr, count, [](auto a, auto, float *o, float *) { decltype(a)::StoreU(o, Detail::RSqrt<A>(a)); });
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline void FastExp(const float *x, float *out, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(x, nullptr, out, nullptr, count, [](auto a, auto, float *o, float *) { decltype(a)::StoreU(o, Detail::Exp<A>(a)); });
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline void FastLog(const float *x, float *out, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(x, nullptr, out, nullptr, count, [](auto a, auto, float *o, float *) { decltype(a)::StoreU(o, Detail::Log<A>(a)); });
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline void FastPow(const float *x, const float *y, float *out, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(x, y, out, nullptr, count, [](auto a, auto b, float *o, float *) { decltype(a)::StoreU(o, Detail::Pow<A>(a, b)); });
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline void FastAtan2(const float *y, const float *x, float *out, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(y, x, out, nullptr, count, [](auto a, auto b, float *o, float *) { decltype(a)::StoreU(o, Detail::Atan2<A>(a, b)); });
+    }
+
+    template <VAccuracy A = VAccuracy::Medium> inline void FastSinCos(const float *x, float *sin, float *cos, size_t count) noexcept
+    {
+        Detail::ForEachFloat<Detail::VFloat4>(x, nullptr, sin, cos, count, [](auto a, auto, float *s, float *c) {
+            using W = decltype(a);
+            W sinLanes, cosLanes;
+            Detail::SinCos<A>(a, sinLanes, cosLanes);
+            W::StoreU(s, sinLanes);
+            W::StoreU(c, cosLanes);
+        });
+    }
+} // namespace VE::Math
@@ -0,0 +1,197 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "VMA_Simd.hpp"
+
+// Sin, Cos, Tan, Sqrt and RSqrt usable in constant expressions, so matrices and tables built from angles
+// can be computed at compile time. In a constant expression the constexpr implementation below is used,
+// at run time the caller picks per call:
+//
+//     VPrecision::Exact  the C library (and 1 / std::sqrt for RSqrt), results as before
+//     VPrecision::Fast   Sin, Cos and Tan: the constexpr implementation, the same result as at compile time
+//                        Sqrt: std::sqrt, the hardware instruction is exact and faster than any iteration
+//                        RSqrt: the hardware estimate refined with one Newton step where there is one
+//
+// Error bounds of the constexpr implementation, measured against the correctly rounded result (see
+// VantorMathBenchmark --suite functions):
+//
+//     Sin, Cos, Tan  at most 1 ulp for |x| <= 1e6, arguments are reduced in double precision. Beyond
+//                    that the reduction loses accuracy, beyond 1e18 and for infinities the result is NaN.
+//     Sqrt           correctly rounded, the same result as std::sqrt
+//     RSqrt          correctly rounded on every float in [1, 4), which covers all mantissas and both
+//                    exponent parities
+//
+// VPrecision::Fast RSqrt is within 3e-7 relative on SSE (2.72e-7 measured). NEON refines its estimate with
+// two steps instead of one, without SIMD it is the constexpr implementation.
+
+namespace VE::Math
+{
+    enum class VPrecision : uint8_t
+    {
+        Exact,
+        Fast
+    };
+
+    namespace Detail
+    {
+        // pi / 2 in two parts, the first with 33 significant bits so k * first is exact for k < 2^20
+        constexpr double PiOver2High = 1.57079632673412561417e+00;
+        constexpr double PiOver2Low  = 6.07710050650619224932e-11;
+        constexpr double TwoOverPi   = 6.36619772367581382433e-01;
+
+        // x = quadrant * pi / 2 + r with |r| <= pi / 4
+        struct VReducedAngle
+        {
+                double r;
+                int    quadrant;
+        };
+
+        constexpr VReducedAngle ReduceAngle(double x) noexcept
+        {
+            const double scaled = x * TwoOverPi;
+            if (scaled > -0x1p51 && scaled < 0x1p51)
+            {
+                // Adding 1.5 * 2^52 rounds to the nearest integer and leaves it in the low mantissa bits
+                const double shifted = scaled + 0x1.8p52;
+                const double kd      = shifted - 0x1.8p52;
+                return {(x - kd * PiOver2High) - kd * PiOver2Low, static_cast<int>(std::bit_cast<uint64_t>(shifted) & 3)};
+            }
+            const int64_t k  = static_cast<int64_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+            const double  kd = static_cast<double>(k);
+            return {(x - kd * PiOver2High) - kd * PiOver2Low, static_cast<int>(k & 3)};
+        }
+
+        // Taylor polynomials on [-pi/4, pi/4] in double precision, truncation error below 3e-9 (sin, degree 9)
+        // and 2e-10 (cos, degree 10) relative, well under half a float ulp
+        constexpr double SinPolynomial(double r) noexcept
+        {
+            const double r2 = r * r;
+            return r + r * r2 * (-1.0 / 6.0 + r2 * (1.0 / 120.0 + r2 * (-1.0 / 5040.0 + r2 * (1.0 / 362880.0))));
+        }
+
+        constexpr double CosPolynomial(double r) noexcept
+        {
+            const double r2 = r * r;
+            return 1.0 + r2 * (-0.5 + r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0 + r2 * (1.0 / 40320.0 + r2 * (-1.0 / 3628800.0)))));
+        }
+
+        // sin changes sign in quadrants 2 and 3
+        constexpr double QuadrantSign[4] = {1.0, 1.0, -1.0, -1.0};
+
+        constexpr bool TrigInRange(float x) noexcept { return x > -1e18f && x < 1e18f; }
+
+        constexpr float ConstexprSin(float x) noexcept
+        {
+            if (!TrigInRange(x)) return std::numeric_limits<float>::quiet_NaN();
+            // Both polynomials and a sign table instead of branches, the quadrant of random angles is unpredictable
+            const VReducedAngle a        = ReduceAngle(x);
+            const double        terms[2] = {SinPolynomial(a.r), CosPolynomial(a.r)};
+            return static_cast<float>(QuadrantSign[a.quadrant] * terms[a.quadrant & 1]);
+        }
+
+        constexpr float ConstexprCos(float x) noexcept
+        {
+            if (!TrigInRange(x)) return std::numeric_limits<float>::quiet_NaN();
+            const VReducedAngle a        = ReduceAngle(x);
+            const double        terms[2] = {CosPolynomial(a.r), SinPolynomial(a.r)};
+            return static_cast<float>(QuadrantSign[(a.quadrant + 1) & 3] * terms[a.quadrant & 1]);
+        }
+
+        constexpr float ConstexprTan(float x) noexcept
+        {
+            if (!TrigInRange(x)) return std::numeric_limits<float>::quiet_NaN();
+            const VReducedAngle a = ReduceAngle(x);
+            const double        terms[2] = {SinPolynomial(a.r), CosPolynomial(a.r)};
+            const int           odd      = a.quadrant & 1;
+            return static_cast<float>(QuadrantSign[odd * 2] * terms[odd] / terms[odd ^ 1]);
+        }
+
+        // Square root of a positive normal double by Newton's method from an exponent halving estimate
+        // (within 4%), four steps reach full double precision. Rounding that to float is correctly rounded.
+        constexpr double NewtonSqrt(double x) noexcept
+        {
+            double y = std::bit_cast<double>((std::bit_cast<uint64_t>(x) >> 1) + 0x1FF7A3BEA91D9B1Bull);
+            for (int i = 0; i < 4; ++i) y = 0.5 * (y + x / y);
+            return y;
+        }
+
+        constexpr float ConstexprSqrt(float x) noexcept
+        {
+            // NaN, negative, zero (keeps the sign of -0) and infinity as std::sqrt
+            if (!(x >= 0.0f)) return std::numeric_limits<float>::quiet_NaN();
+            if (x == 0.0f || x == std::numeric_limits<float>::infinity()) return x;
+            return static_cast<float>(NewtonSqrt(x));
+        }
+
+        constexpr float ConstexprRSqrt(float x) noexcept
+        {
+            if (!(x >= 0.0f)) return std::numeric_limits<float>::quiet_NaN();
+            if (x == 0.0f) return std::bit_cast<uint32_t>(x) >> 31 ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+            if (x == std::numeric_limits<float>::infinity()) return 0.0f;
+            return static_cast<float>(1.0 / NewtonSqrt(x));
+        }
+
+        inline float EstimateRSqrt(float x) noexcept
+        {
+#if defined(VANTOR_MATH_SSE)
+            // 12 bit estimate, y (1.5 - 0.5 x y^2) doubles the bits
+            const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+            return y * (1.5f - 0.5f * x * y * y);
+#elif defined(VANTOR_MATH_NEON)
+            float32x2_t y = vrsqrte_f32(vdup_n_f32(x));
+            y             = vmul_f32(y, vrsqrts_f32(vmul_f32(vdup_n_f32(x), y), y));
+            y             = vmul_f32(y, vrsqrts_f32(vmul_f32(vdup_n_f32(x), y), y));
+            return vget_lane_f32(y, 0);
+#else
+            return ConstexprRSqrt(x);
+#endif
+        }
+    } // namespace Detail
+
+    // Radians
+    constexpr float Sin(float x, VPrecision precision = VPrecision::Exact) noexcept
+    {
+        if (std::is_constant_evaluated() || precision == VPrecision::Fast) return Detail::ConstexprSin(x);
+        return std::sin(x);
+    }
+
+    constexpr float Cos(float x, VPrecision precision = VPrecision::Exact) noexcept
+    {
+        if (std::is_constant_evaluated() || precision == VPrecision::Fast) return Detail::ConstexprCos(x);
+        return std::cos(x);
+    }
+
+    constexpr float Tan(float x, VPrecision precision = VPrecision::Exact) noexcept
+    {
+        if (std::is_constant_evaluated() || precision == VPrecision::Fast) return Detail::ConstexprTan(x);
+        return std::tan(x);
+    }
+
+    constexpr float Sqrt(float x, VPrecision = VPrecision::Exact) noexcept
+    {
+        if (std::is_constant_evaluated()) return Detail::ConstexprSqrt(x);
+        return std::sqrt(x);
+    }
+
+    // 1 / sqrt(x)
+    constexpr float RSqrt(float x, VPrecision precision = VPrecision::Exact) noexcept
+    {
+        if (std::is_constant_evaluated()) return Detail::ConstexprRSqrt(x);
+        if (precision == VPrecision::Fast) return Detail::EstimateRSqrt(x);
+        return 1.0f / std::sqrt(x);
+    }
+} // namespace VE::Math
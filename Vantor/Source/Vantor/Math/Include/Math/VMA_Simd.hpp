@@ -0,0 +1,399 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// 4-wide float vectors for the math kernels, one type per instruction set:
+//
+//     VFloat4Sse     SSE2 (every x86-64 CPU), SSE4.1 lane inserts and AVX2/FMA fused multiply-add if compiled for them
+//     VFloat4Neon    AArch64 NEON, always fused
+//     VFloat4Scalar  plain floats, the reference every other backend is checked against
+//
+// VFloat4 is the best one the compiler targets, chosen at compile time. Define VANTOR_MATH_FORCE_SCALAR
+// to use the scalar one everywhere. With AVX2, VFloat8Avx runs batch kernels on two groups of four lanes.
+//
+// Kernels are written once against this interface (templates over the vector type), so every backend
+// performs the same operations in the same order. MulAdd() is fused whenever the target has FMA, the
+// scalar backend then uses std::fma too, which keeps results bit identical across backends as long as the
+// compiler does not contract a * b + c on its own (GCC does by default, -ffp-contract=off stops it).
+// Division and square root are the exact IEEE operations, never approximations.
+
+#if !defined(VANTOR_MATH_FORCE_SCALAR)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define VANTOR_MATH_SSE 1
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define VANTOR_MATH_SSE41 1
+#endif
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define VANTOR_MATH_AVX2 1
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define VANTOR_MATH_NEON 1
+#endif
+#endif
+
+#if !defined(VANTOR_MATH_FORCE_SCALAR) && (defined(__FMA__) || defined(VANTOR_MATH_AVX2) || defined(VANTOR_MATH_NEON))
+#define VANTOR_MATH_FMA 1
+#endif
+
+namespace VE::Math::Detail
+{
+    struct VFloat4Scalar
+    {
+            float v[4];
+
+            static constexpr size_t Width = 4;
+
+            static VFloat4Scalar Load(const float *p) noexcept { return {{p[0], p[1], p[2], p[3]}}; }
+            static VFloat4Scalar LoadU(const float *p) noexcept { return Load(p); }
+            static void          Store(float *p, VFloat4Scalar a) noexcept
+            {
+                p[0] = a.v[0];
+                p[1] = a.v[1];
+                p[2] = a.v[2];
+                p[3] = a.v[3];
+            }
+            static void StoreU(float *p, VFloat4Scalar a) noexcept { Store(p, a); }
+
+            static VFloat4Scalar Set(float x, float y, float z, float w) noexcept { return {{x, y, z, w}}; }
+            static VFloat4Scalar Splat(float s) noexcept { return {{s, s, s, s}}; }
+            static VFloat4Scalar Zero() noexcept { return Splat(0.0f); }
+
+            static VFloat4Scalar Add(VFloat4Scalar a, VFloat4Scalar b) noexcept { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+            static VFloat4Scalar Sub(VFloat4Scalar a, VFloat4Scalar b) noexcept { return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}}; }
+            static VFloat4Scalar Mul(VFloat4Scalar a, VFloat4Scalar b) noexcept { return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; }
+            static VFloat4Scalar Div(VFloat4Scalar a, VFloat4Scalar b) noexcept { return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}}; }
+
+            // a * b + c
+            static VFloat4Scalar MulAdd(VFloat4Scalar a, VFloat4Scalar b, VFloat4Scalar c) noexcept
+            {
+#if defined(VANTOR_MATH_FMA)
+                return {{std::fma(a.v[0], b.v[0], c.v[0]), std::fma(a.v[1], b.v[1], c.v[1]), std::fma(a.v[2], b.v[2], c.v[2]), std::fma(a.v[3], b.v[3], c.v[3])}};
+#else
+                return Add(Mul(a, b), c);
+#endif
+            }
+
+            static VFloat4Scalar Sqrt(VFloat4Scalar a) noexcept { return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}}; }
+
+            // Magnitude of a with the sign of b
+            static VFloat4Scalar CopySign(VFloat4Scalar a, VFloat4Scalar b) noexcept
+            {
+                return {{std::copysign(a.v[0], b.v[0]), std::copysign(a.v[1], b.v[1]), std::copysign(a.v[2], b.v[2]), std::copysign(a.v[3], b.v[3])}};
+            }
+
+            // Masks have all bits of a lane set where the comparison holds, like the SIMD compares
+            static VFloat4Scalar Greater(VFloat4Scalar a, VFloat4Scalar b) noexcept
+            {
+                VFloat4Scalar mask;
+                for (int i = 0; i < 4; ++i) mask.v[i] = std::bit_cast<float>(a.v[i] > b.v[i] ? ~0u : 0u);
+                return mask;
+            }
+
+            // Lanes of a where mask is set, of b elsewhere
+            static VFloat4Scalar Select(VFloat4Scalar mask, VFloat4Scalar a, VFloat4Scalar b) noexcept
+            {
+                VFloat4Scalar result;
+                for (int i = 0; i < 4; ++i) result.v[i] = std::bit_cast<uint32_t>(mask.v[i]) != 0 ? a.v[i] : b.v[i];
+                return result;
+            }
+
+            // Bitwise operations on the lanes, and integer ones on their bits read as 32 bit integers
+            static VFloat4Scalar And(VFloat4Scalar a, VFloat4Scalar b) noexcept { return Bitwise(a, b, [](uint32_t x, uint32_t y) { return x & y; }); }
+            static VFloat4Scalar Or(VFloat4Scalar a, VFloat4Scalar b) noexcept { return Bitwise(a, b, [](uint32_t x, uint32_t y) { return x | y; }); }
+            static VFloat4Scalar Xor(VFloat4Scalar a, VFloat4Scalar b) noexcept { return Bitwise(a, b, [](uint32_t x, uint32_t y) { return x ^ y; }); }
+            static VFloat4Scalar SubBits(VFloat4Scalar a, VFloat4Scalar b) noexcept { return Bitwise(a, b, [](uint32_t x, uint32_t y) { return x - y; }); }
+            template <int N> static VFloat4Scalar ShiftLeftBits(VFloat4Scalar a) noexcept { return Bitwise(a, a, [](uint32_t x, uint32_t) { return x << N; }); }
+            template <int N> static VFloat4Scalar ShiftRightBits(VFloat4Scalar a) noexcept { return Bitwise(a, a, [](uint32_t x, uint32_t) { return x >> N; }); }
+
+            // Lanes A and B of a, then lanes C and D of b
+            template <int A, int B, int C, int D> static VFloat4Scalar Shuffle(VFloat4Scalar a, VFloat4Scalar b) noexcept { return {{a.v[A], a.v[B], b.v[C], b.v[D]}}; }
+            template <int A, int B, int C, int D> static VFloat4Scalar Swizzle(VFloat4Scalar a) noexcept { return {{a.v[A], a.v[B], a.v[C], a.v[D]}}; }
+            template <int I> static VFloat4Scalar                      SplatLane(VFloat4Scalar a) noexcept { return Splat(a.v[I]); }
+
+            template <int I> static float GetLane(VFloat4Scalar a) noexcept { return a.v[I]; }
+            template <int I> static VFloat4Scalar SetLane(VFloat4Scalar a, float s) noexcept
+            {
+                a.v[I] = s;
+                return a;
+            }
+
+        private:
+            template <typename Op> static VFloat4Scalar Bitwise(VFloat4Scalar a, VFloat4Scalar b, Op op) noexcept
+            {
+                VFloat4Scalar result;
+                for (int i = 0; i < 4; ++i) result.v[i] = std::bit_cast<float>(op(std::bit_cast<uint32_t>(a.v[i]), std::bit_cast<uint32_t>(b.v[i])));
+                return result;
+            }
+    };
+
+#if defined(VANTOR_MATH_SSE)
+    struct VFloat4Sse
+    {
+            __m128 v;
+
+            static constexpr size_t Width = 4;
+
+            static VFloat4Sse Load(const float *p) noexcept { return {_mm_load_ps(p)}; }
+            static VFloat4Sse LoadU(const float *p) noexcept { return {_mm_loadu_ps(p)}; }
+            static void       Store(float *p, VFloat4Sse a) noexcept { _mm_store_ps(p, a.v); }
+            static void       StoreU(float *p, VFloat4Sse a) noexcept { _mm_storeu_ps(p, a.v); }
+
+            static VFloat4Sse Set(float x, float y, float z, float w) noexcept { return {_mm_setr_ps(x, y, z, w)}; }
+            static VFloat4Sse Splat(float s) noexcept { return {_mm_set1_ps(s)}; }
+            static VFloat4Sse Zero() noexcept { return {_mm_setzero_ps()}; }
+
+            static VFloat4Sse Add(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_add_ps(a.v, b.v)}; }
+            static VFloat4Sse Sub(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_sub_ps(a.v, b.v)}; }
+            static VFloat4Sse Mul(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_mul_ps(a.v, b.v)}; }
+            static VFloat4Sse Div(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_div_ps(a.v, b.v)}; }
+
+            static VFloat4Sse MulAdd(VFloat4Sse a, VFloat4Sse b, VFloat4Sse c) noexcept
+            {
+#if defined(VANTOR_MATH_FMA)
+                return {_mm_fmadd_ps(a.v, b.v, c.v)};
+#else
+                return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+#endif
+            }
+
+            static VFloat4Sse Sqrt(VFloat4Sse a) noexcept { return {_mm_sqrt_ps(a.v)}; }
+            static VFloat4Sse CopySign(VFloat4Sse a, VFloat4Sse b) noexcept
+            {
+                const __m128 sign = _mm_set1_ps(-0.0f);
+                return {_mm_or_ps(_mm_andnot_ps(sign, a.v), _mm_and_ps(sign, b.v))};
+            }
+            static VFloat4Sse Greater(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_cmpgt_ps(a.v, b.v)}; }
+            static VFloat4Sse Select(VFloat4Sse mask, VFloat4Sse a, VFloat4Sse b) noexcept
+            {
+#if defined(VANTOR_MATH_SSE41)
+                return {_mm_blendv_ps(b.v, a.v, mask.v)};
+#else
+                return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+#endif
+            }
+
+            static VFloat4Sse And(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_and_ps(a.v, b.v)}; }
+            static VFloat4Sse Or(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_or_ps(a.v, b.v)}; }
+            static VFloat4Sse Xor(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_xor_ps(a.v, b.v)}; }
+            static VFloat4Sse SubBits(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_castsi128_ps(_mm_sub_epi32(_mm_castps_si128(a.v), _mm_castps_si128(b.v)))}; }
+            template <int N> static VFloat4Sse ShiftLeftBits(VFloat4Sse a) noexcept { return {_mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(a.v), N))}; }
+            template <int N> static VFloat4Sse ShiftRightBits(VFloat4Sse a) noexcept { return {_mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(a.v), N))}; }
+
+            template <int A, int B, int C, int D> static VFloat4Sse Shuffle(VFloat4Sse a, VFloat4Sse b) noexcept { return {_mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(D, C, B, A))}; }
+            template <int A, int B, int C, int D> static VFloat4Sse Swizzle(VFloat4Sse a) noexcept { return Shuffle<A, B, C, D>(a, a); }
+            template <int I> static VFloat4Sse                      SplatLane(VFloat4Sse a) noexcept { return Shuffle<I, I, I, I>(a, a); }
+
+            template <int I> static float GetLane(VFloat4Sse a) noexcept { return _mm_cvtss_f32(SplatLane<I>(a).v); }
+            template <int I> static VFloat4Sse SetLane(VFloat4Sse a, float s) noexcept
+            {
+#if defined(VANTOR_MATH_SSE41)
+                return {_mm_insert_ps(a.v, _mm_set_ss(s), I << 4)};
+#else
+                alignas(16) float lanes[4];
+                _mm_store_ps(lanes, a.v);
+                lanes[I] = s;
+                return {_mm_load_ps(lanes)};
+#endif
+            }
+    };
+#endif
+
+#if defined(VANTOR_MATH_NEON)
+    struct VFloat4Neon
+    {
+            float32x4_t v;
+
+            static constexpr size_t Width = 4;
+
+            static VFloat4Neon Load(const float *p) noexcept { return {vld1q_f32(p)}; }
+            static VFloat4Neon LoadU(const float *p) noexcept { return {vld1q_f32(p)}; }
+            static void        Store(float *p, VFloat4Neon a) noexcept { vst1q_f32(p, a.v); }
+            static void        StoreU(float *p, VFloat4Neon a) noexcept { vst1q_f32(p, a.v); }
+
+            static VFloat4Neon Set(float x, float y, float z, float w) noexcept
+            {
+                const float lanes[4] = {x, y, z, w};
+                return {vld1q_f32(lanes)};
+            }
+            static VFloat4Neon Splat(float s) noexcept { return {vdupq_n_f32(s)}; }
+            static VFloat4Neon Zero() noexcept { return {vdupq_n_f32(0.0f)}; }
+
+            static VFloat4Neon Add(VFloat4Neon a, VFloat4Neon b) noexcept { return {vaddq_f32(a.v, b.v)}; }
+            static VFloat4Neon Sub(VFloat4Neon a, VFloat4Neon b) noexcept { return {vsubq_f32(a.v, b.v)}; }
+            static VFloat4Neon Mul(VFloat4Neon a, VFloat4Neon b) noexcept { return {vmulq_f32(a.v, b.v)}; }
+            static VFloat4Neon Div(VFloat4Neon a, VFloat4Neon b) noexcept { return {vdivq_f32(a.v, b.v)}; }
+            static VFloat4Neon MulAdd(VFloat4Neon a, VFloat4Neon b, VFloat4Neon c) noexcept { return {vfmaq_f32(c.v, a.v, b.v)}; }
+
+            static VFloat4Neon Sqrt(VFloat4Neon a) noexcept { return {vsqrtq_f32(a.v)}; }
+            static VFloat4Neon CopySign(VFloat4Neon a, VFloat4Neon b) noexcept { return {vbslq_f32(vdupq_n_u32(0x80000000u), b.v, a.v)}; }
+            static VFloat4Neon Greater(VFloat4Neon a, VFloat4Neon b) noexcept { return {vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v))}; }
+            static VFloat4Neon Select(VFloat4Neon mask, VFloat4Neon a, VFloat4Neon b) noexcept { return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)}; }
+
+            static VFloat4Neon And(VFloat4Neon a, VFloat4Neon b) noexcept { return Bits(vandq_u32(Bits(a), Bits(b))); }
+            static VFloat4Neon Or(VFloat4Neon a, VFloat4Neon b) noexcept { return Bits(vorrq_u32(Bits(a), Bits(b))); }
+            static VFloat4Neon Xor(VFloat4Neon a, VFloat4Neon b) noexcept { return Bits(veorq_u32(Bits(a), Bits(b))); }
+            static VFloat4Neon SubBits(VFloat4Neon a, VFloat4Neon b) noexcept { return Bits(vsubq_u32(Bits(a), Bits(b))); }
+            template <int N> static VFloat4Neon ShiftLeftBits(VFloat4Neon a) noexcept { return Bits(vshlq_n_u32(Bits(a), N)); }
+            template <int N> static VFloat4Neon ShiftRightBits(VFloat4Neon a) noexcept { return Bits(vshrq_n_u32(Bits(a), N)); }
+
+            template <int A, int B, int C, int D> static VFloat4Neon Shuffle(VFloat4Neon a, VFloat4Neon b) noexcept
+            {
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12)
+                return {__builtin_shufflevector(a.v, b.v, A, B, C + 4, D + 4)};
+#else
+                float32x4_t r = vdupq_n_f32(vgetq_lane_f32(a.v, A));
+                r             = vsetq_lane_f32(vgetq_lane_f32(a.v, B), r, 1);
+                r             = vsetq_lane_f32(vgetq_lane_f32(b.v, C), r, 2);
+                r             = vsetq_lane_f32(vgetq_lane_f32(b.v, D), r, 3);
+                return {r};
+#endif
+            }
+            template <int A, int B, int C, int D> static VFloat4Neon Swizzle(VFloat4Neon a) noexcept { return Shuffle<A, B, C, D>(a, a); }
+            template <int I> static VFloat4Neon                      SplatLane(VFloat4Neon a) noexcept { return {vdupq_laneq_f32(a.v, I)}; }
+
+            template <int I> static float GetLane(VFloat4Neon a) noexcept { return vgetq_lane_f32(a.v, I); }
+            template <int I> static VFloat4Neon SetLane(VFloat4Neon a, float s) noexcept { return {vsetq_lane_f32(s, a.v, I)}; }
+
+        private:
+            static uint32x4_t  Bits(VFloat4Neon a) noexcept { return vreinterpretq_u32_f32(a.v); }
+            static VFloat4Neon Bits(uint32x4_t a) noexcept { return {vreinterpretq_f32_u32(a)}; }
+    };
+#endif
+
+#if defined(VANTOR_MATH_AVX2)
+    // Two groups of four lanes, one per 128 bit half. Shuffles and swizzles work within each half exactly like
+    // VFloat4Sse's, so a kernel written for 4 lanes handles two groups per step unchanged. The group loads and
+    // stores take both halves' addresses.
+    struct VFloat8Avx
+    {
+            __m256 v;
+
+            static constexpr size_t Width = 8;
+
+            static VFloat8Avx LoadU(const float *p) noexcept { return {_mm256_loadu_ps(p)}; }
+            static void       StoreU(float *p, VFloat8Avx a) noexcept { _mm256_storeu_ps(p, a.v); }
+
+            static VFloat8Avx LoadU2(const float *low, const float *high) noexcept { return {_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1)}; }
+            static void       Store2(float *low, float *high, VFloat8Avx a) noexcept
+            {
+                _mm_store_ps(low, _mm256_castps256_ps128(a.v));
+                _mm_store_ps(high, _mm256_extractf128_ps(a.v, 1));
+            }
+            static void StoreU2(float *low, float *high, VFloat8Avx a) noexcept
+            {
+                _mm_storeu_ps(low, _mm256_castps256_ps128(a.v));
+                _mm_storeu_ps(high, _mm256_extractf128_ps(a.v, 1));
+            }
+
+            static VFloat8Avx Splat(float s) noexcept { return {_mm256_set1_ps(s)}; }
+            static VFloat8Avx Zero() noexcept { return {_mm256_setzero_ps()}; }
+
+            static VFloat8Avx Add(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_add_ps(a.v, b.v)}; }
+            static VFloat8Avx Sub(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_sub_ps(a.v, b.v)}; }
+            static VFloat8Avx Mul(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_mul_ps(a.v, b.v)}; }
+            static VFloat8Avx Div(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_div_ps(a.v, b.v)}; }
+            static VFloat8Avx MulAdd(VFloat8Avx a, VFloat8Avx b, VFloat8Avx c) noexcept { return {_mm256_fmadd_ps(a.v, b.v, c.v)}; }
+
+            static VFloat8Avx Sqrt(VFloat8Avx a) noexcept { return {_mm256_sqrt_ps(a.v)}; }
+            static VFloat8Avx CopySign(VFloat8Avx a, VFloat8Avx b) noexcept
+            {
+                const __m256 sign = _mm256_set1_ps(-0.0f);
+                return {_mm256_or_ps(_mm256_andnot_ps(sign, a.v), _mm256_and_ps(sign, b.v))};
+            }
+            static VFloat8Avx Greater(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+            static VFloat8Avx Select(VFloat8Avx mask, VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_blendv_ps(b.v, a.v, mask.v)}; }
+
+            static VFloat8Avx And(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_and_ps(a.v, b.v)}; }
+            static VFloat8Avx Or(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_or_ps(a.v, b.v)}; }
+            static VFloat8Avx Xor(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_xor_ps(a.v, b.v)}; }
+            static VFloat8Avx SubBits(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_castsi256_ps(_mm256_sub_epi32(_mm256_castps_si256(a.v), _mm256_castps_si256(b.v)))}; }
+            template <int N> static VFloat8Avx ShiftLeftBits(VFloat8Avx a) noexcept { return {_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(a.v), N))}; }
+            template <int N> static VFloat8Avx ShiftRightBits(VFloat8Avx a) noexcept { return {_mm256_castsi256_ps(_mm256_srli_epi32(_mm256_castps_si256(a.v), N))}; }
+
+            template <int A, int B, int C, int D> static VFloat8Avx Shuffle(VFloat8Avx a, VFloat8Avx b) noexcept { return {_mm256_shuffle_ps(a.v, b.v, _MM_SHUFFLE(D, C, B, A))}; }
+            template <int A, int B, int C, int D> static VFloat8Avx Swizzle(VFloat8Avx a) noexcept { return Shuffle<A, B, C, D>(a, a); }
+            template <int I> static VFloat8Avx                      SplatLane(VFloat8Avx a) noexcept { return Shuffle<I, I, I, I>(a, a); }
+    };
+#endif
+
+#if defined(VANTOR_MATH_SSE)
+    using VFloat4 = VFloat4Sse;
+#elif defined(VANTOR_MATH_NEON)
+    using VFloat4 = VFloat4Neon;
+#else
+    using VFloat4 = VFloat4Scalar;
+#endif
+
+    // Name of the backend VFloat4 compiles to, for logs and benchmarks
+    constexpr const char *GetSimdBackendName() noexcept
+    {
+#if defined(VANTOR_MATH_AVX2)
+        return "AVX2+FMA";
+#elif defined(VANTOR_MATH_SSE41)
+        return "SSE4.1";
+#elif defined(VANTOR_MATH_SSE)
+        return "SSE2";
+#elif defined(VANTOR_MATH_NEON)
+        return "NEON";
+#else
+        return "Scalar";
+#endif
+    }
+
+    // Calls body(W{}, first) for every full group of W::Width elements, W being VFloat8Avx while eight are
+    // left (AVX2 builds, V = VFloat4Sse), V after that. Returns how many elements were handled.
+    template <typename V, typename Body> inline size_t ForEachGroup(size_t count, Body &&body) noexcept
+    {
+        size_t i = 0;
+#if defined(VANTOR_MATH_AVX2)
+        if constexpr (std::is_same_v<V, VFloat4Sse>)
+        {
+            for (; i + VFloat8Avx::Width <= count; i += VFloat8Avx::Width) body(VFloat8Avx{}, i);
+        }
+#endif
+        for (; i + V::Width <= count; i += V::Width) body(V{}, i);
+        return i;
+    }
+
+    // Groups of four lanes for kernels over arrays of 4 float records (matrix rows, packed points): group g
+    // of V is read from or written to p + g * stride
+    template <typename V> inline V LoadGroupsU(const float *p, size_t stride) noexcept
+    {
+        if constexpr (V::Width == 8)
+            return V::LoadU2(p, p + stride);
+        else
+            return V::LoadU(p);
+    }
+
+    // p and p + stride 16 byte aligned
+    template <typename V> inline void StoreGroups(float *p, size_t stride, V a) noexcept
+    {
+        if constexpr (V::Width == 8)
+            V::Store2(p, p + stride, a);
+        else
+            V::Store(p, a);
+    }
+
+    template <typename V> inline void StoreGroupsU(float *p, size_t stride, V a) noexcept
+    {
+        if constexpr (V::Width == 8)
+            V::StoreU2(p, p + stride, a);
+        else
+            V::StoreU(p, a);
+    }
+} // namespace VE::Math::Detail
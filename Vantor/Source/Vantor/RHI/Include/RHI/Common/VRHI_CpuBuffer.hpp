@@ -0,0 +1,61 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <RHI/Interface/VRHI_Buffer.hpp>
+
+#include <Core/Container/VCO_Vector.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+
+#include <cstring>
+
+namespace VE::Internal::RHI
+{
+
+// IRHIBuffer backed by plain system memory.
+// Used where no graphics API is available (headless runs, allocator tests), the contents can be inspected through GetData().
+class VCpuBuffer : public IRHIBuffer
+{
+public:
+    VCpuBuffer(uint32_t size, const void* data = nullptr)
+    {
+        m_data.resize(size);
+        if (data != nullptr)
+            std::memcpy(m_data.data(), data, size);
+    }
+
+    // IRHIBuffer implementation
+    void Bind() override {}
+    void Bind(uint32_t /*slot*/) override {}
+    void Unbind() override {}
+
+    void UpdateData(const void* data, uint32_t size, uint32_t offset = 0) override
+    {
+        if (uint64_t(offset) + size > m_data.size())
+        {
+            VE_LOG(ERR, "RHI", "Buffer update out of bounds: offset={}, size={}, buffer_size={}", offset, size, m_data.size());
+            return;
+        }
+        std::memcpy(m_data.data() + offset, data, size);
+    }
+
+    void* Map() override { return m_data.data(); }
+    void Unmap() override {}
+
+    uint32_t GetSize() const override { return static_cast<uint32_t>(m_data.size()); }
+    uint32_t GetHandle() const override { return 0; }
+
+    const uint8_t* GetData() const { return m_data.data(); }
+
+private:
+    VE::Internal::Core::Container::TVector<uint8_t> m_data;
+};
+
+} // namespace VE::Internal::RHI
@@ -0,0 +1,79 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <RHI/Interface/VRHI_Buffer.hpp>
+
+#include <Core/Memory/VCO_Allocator.hpp>
+
+#include <cstdint>
+#include <memory>
+
+// Suballocates one large IRHIBuffer through a VPageAllocator, so many meshes share a few buffer objects.
+// Freed ranges go through the deferred release queue of the page allocator and are only reused
+// once the GPU can no longer read them (see UpdateDeferredRelease).
+// The heap only talks to the IRHIBuffer interface, so it works the same on top of a VCpuBuffer.
+
+namespace VE::Internal::RHI
+{
+
+struct VGpuHeapStats
+{
+    uint64_t capacity = 0;         // bytes managed by the heap
+    uint64_t freeBytes = 0;        // bytes not allocated (pending deferred releases count as allocated)
+    uint64_t largestFreeBlock = 0; // largest contiguous free range
+};
+
+// A range inside a VGpuHeap. Copies share the range, it is released when the last copy goes away.
+struct VGpuAllocation
+{
+    VE::Internal::Core::Memory::VPageAllocator::Allocation allocation;
+    IRHIBuffer* buffer = nullptr; // the heap buffer, kept alive by the heap owner
+    uint64_t offset = 0;          // aligned byte offset inside buffer
+    uint64_t size = 0;            // requested size in bytes
+
+    bool IsValid() const { return allocation.IsValid(); }
+
+    // First element of the range when the buffer is read as an array of stride sized elements (base vertex / first index).
+    // The offset is a multiple of stride if the allocation was made with alignment == stride.
+    uint32_t GetElementOffset(uint32_t stride) const { return static_cast<uint32_t>(offset / stride); }
+
+    void Reset() { *this = VGpuAllocation(); }
+};
+
+class VGpuHeap
+{
+public:
+    static constexpr uint32_t DEFAULT_PAGE_SIZE = 256;
+
+    // buffer: the backing buffer, its size is the heap capacity (rounded down to pageSize)
+    // deferredRelease: keep freed ranges alive for a few frames, required when the GPU reads the buffer
+    VGpuHeap(std::shared_ptr<IRHIBuffer> buffer, uint32_t pageSize = DEFAULT_PAGE_SIZE, bool deferredRelease = true);
+
+    // Reserves size bytes starting at a multiple of alignment (any value, e.g. a vertex stride) and optionally uploads data.
+    // Returns an invalid allocation if the heap is full.
+    VGpuAllocation Allocate(uint64_t size, uint32_t alignment = 1, const void* data = nullptr);
+
+    // Writes into an existing allocation
+    void Write(const VGpuAllocation& allocation, const void* data, uint64_t size, uint64_t offset = 0);
+
+    // Has to be called once per frame, ranges freed before frameIndex - bufferCount become reusable
+    void UpdateDeferredRelease(uint64_t frameIndex, uint32_t bufferCount);
+
+    const std::shared_ptr<IRHIBuffer>& GetBuffer() const { return m_buffer; }
+    uint32_t GetPageSize() const { return m_allocator.page_size; }
+    VGpuHeapStats GetStats() const;
+
+private:
+    std::shared_ptr<IRHIBuffer> m_buffer;
+    VE::Internal::Core::Memory::VPageAllocator m_allocator;
+};
+
+} // namespace VE::Internal::RHI
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <Core/Container/VCO_Vector.hpp>
+#include <Core/Container/VCO_SmallVector.hpp>
 
 #include <memory>
 #include <string>
@@ -24,9 +25,11 @@ class IRHITexture;
 class IRHIMesh;
 class IRHIBuffer;
 class IRHIRenderTarget;
+class VGpuHeap;
 
 enum class EGraphicsAPI {
-    OPENGL
+    OPENGL,
+    NULL_DEVICE // draws nothing, for headless runs and benchmarks
 };
 
 enum class ERHIFormat
@@ -164,7 +167,8 @@ struct VVertexAttribute
 
 struct VVertexLayout
 {
-    VE::Internal::Core::Container::TVector<VVertexAttribute> attributes;
+    // Layouts rarely have more than a handful of attributes, keep them off the heap
+    VE::Internal::Core::Container::TSmallVector<VVertexAttribute, 8> attributes;
     uint32_t stride;
 };
 
@@ -183,6 +187,8 @@ public:
     virtual void Shutdown() = 0;
     virtual void Present() = 0;
     virtual void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f) = 0;
+    // Called once per frame before any rendering, releases GPU memory that is no longer in flight
+    virtual void BeginFrame(uint64_t frameIndex) = 0;
 
     // Resource creation
     virtual std::shared_ptr<IRHIShader> CreateShader(const std::string& vertexSource, const std::string& fragmentSource) = 0;
@@ -191,6 +197,9 @@ public:
     virtual std::shared_ptr<IRHIBuffer> CreateBuffer(ERHIBufferType type, uint32_t size, const void* data = nullptr) = 0;
     virtual std::shared_ptr<IRHIRenderTarget> CreateRenderTarget(uint32_t width, uint32_t height, uint32_t samples = 1) = 0;
 
+    // Shared suballocated buffer for the given type, nullptr if the device has none
+    virtual VGpuHeap* GetGpuHeap(ERHIBufferType type) = 0;
+
     // Rendering
     virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
     // virtual void BindShader(std::shared_ptr<IRHIShader> shader) = 0;
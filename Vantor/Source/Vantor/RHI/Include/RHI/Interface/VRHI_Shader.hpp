@@ -16,6 +16,8 @@
 #include <Math/Linear/VMA_Vector.hpp>
 #include <Math/Linear/VMA_Matrix.hpp>
 
+#include <Core/Types/VCO_Name.hpp>
+
 namespace VE::Internal::RHI
 {
 
@@ -27,20 +29,21 @@ public:
     virtual void Use() = 0;
 
     // Uniform Setters
-    virtual void SetBool(const std::string& name, bool value) = 0;
-    virtual void SetInt(const std::string& name, int value) = 0;
-    virtual void SetFloat(const std::string& name, float value) = 0;
-
-    virtual void SetVec2(const std::string& name, float x, float y) = 0;
-    virtual void SetVec2(const std::string& name, const VE::Math::VVector2 &value) = 0;
-    virtual void SetVec3(const std::string& name, float x, float y, float z) = 0;
-    virtual void SetVec3(const std::string& name, const VE::Math::VVector3 &value) = 0;
-    virtual void SetVec4(const std::string& name, float x, float y, float z, float w) = 0;
-    virtual void SetVec4(const std::string& name, const VE::Math::VVector4 &value) = 0;
-
-    virtual void SetMat2(const std::string& name, const VE::Math::VMat2 &mat) = 0;
-    virtual void SetMat3(const std::string& name, const VE::Math::VMat3 &mat) = 0;
-    virtual void SetMat4(const std::string& name, const VE::Math::VMat4 &mat) = 0;
+    // Strings convert to VName implicitly but are interned on every call, hot paths should pass VE_NAME("...") or a stored VName
+    virtual void SetBool(VE::Internal::Core::Types::VName name, bool value) = 0;
+    virtual void SetInt(VE::Internal::Core::Types::VName name, int value) = 0;
+    virtual void SetFloat(VE::Internal::Core::Types::VName name, float value) = 0;
+
+    virtual void SetVec2(VE::Internal::Core::Types::VName name, float x, float y) = 0;
+    virtual void SetVec2(VE::Internal::Core::Types::VName name, const VE::Math::VVector2 &value) = 0;
+    virtual void SetVec3(VE::Internal::Core::Types::VName name, float x, float y, float z) = 0;
+    virtual void SetVec3(VE::Internal::Core::Types::VName name, const VE::Math::VVector3 &value) = 0;
+    virtual void SetVec4(VE::Internal::Core::Types::VName name, float x, float y, float z, float w) = 0;
+    virtual void SetVec4(VE::Internal::Core::Types::VName name, const VE::Math::VVector4 &value) = 0;
+
+    virtual void SetMat2(VE::Internal::Core::Types::VName name, const VE::Math::VMat2 &mat) = 0;
+    virtual void SetMat3(VE::Internal::Core::Types::VName name, const VE::Math::VMat3 &mat) = 0;
+    virtual void SetMat4(VE::Internal::Core::Types::VName name, const VE::Math::VMat4 &mat) = 0;
 
     // // OpenGL: GLuint ID
     // // Vulkan: VkShaderModule*
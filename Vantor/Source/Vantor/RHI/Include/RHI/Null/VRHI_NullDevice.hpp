@@ -0,0 +1,79 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <RHI/Interface/VRHI_Device.hpp>
+#include <RHI/Interface/VRHI_Shader.hpp>
+#include <RHI/Interface/VRHI_Texture.hpp>
+#include <RHI/Interface/VRHI_Mesh.hpp>
+#include <RHI/Interface/VRHI_Buffer.hpp>
+#include <RHI/Interface/VRHI_RenderTarget.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Device that accepts every call and draws nothing.
+// Used for headless runs and to measure the engine side of rendering without a driver in the way.
+// Buffers live in system memory (VCpuBuffer), every other resource only remembers its description.
+// A per draw cost can be set to stand in for the CPU time a real driver spends on a draw call.
+
+namespace VE::Internal::RHI
+{
+
+// Counts of the calls that reached the device, safe to read from any thread
+struct VNullDeviceStats
+{
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> drawCalls{0};
+    std::atomic<uint64_t> uniformUpdates{0};
+    std::atomic<uint64_t> textureBinds{0};
+};
+
+class NullDevice : public IRHIDevice
+{
+public:
+    NullDevice() = default;
+    ~NullDevice() override = default;
+
+    // IRHIDevice implementation
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void Present() override {}
+    void Clear(float /*r*/ = 0.0f, float /*g*/ = 0.0f, float /*b*/ = 0.0f, float /*a*/ = 1.0f) override {}
+    void BeginFrame(uint64_t /*frameIndex*/) override { m_stats.frames.fetch_add(1, std::memory_order_relaxed); }
+
+    std::shared_ptr<IRHIShader> CreateShader(const std::string& vertexSource, const std::string& fragmentSource) override;
+    std::shared_ptr<IRHITexture> CreateTexture(uint32_t width, uint32_t height, ERHIFormat format, const void* data = nullptr, ETextureType type = ETextureType::Texture2D, uint32_t depth = 1) override;
+    std::shared_ptr<IRHIMesh> CreateMesh(const void* vertexData, uint32_t vertexSize, const void* indexData, uint32_t indexCount, const VVertexLayout& layout) override;
+    std::shared_ptr<IRHIBuffer> CreateBuffer(ERHIBufferType type, uint32_t size, const void* data = nullptr) override;
+    std::shared_ptr<IRHIRenderTarget> CreateRenderTarget(uint32_t width, uint32_t height, uint32_t samples = 1) override;
+
+    // No shared heaps, meshes get their own buffers
+    VGpuHeap* GetGpuHeap(ERHIBufferType /*type*/) override { return nullptr; }
+
+    void SetViewport(uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+
+    // Busy waits this long in every draw call, 0 by default
+    void SetDrawCost(uint64_t nanoseconds) { m_drawCostNs.store(nanoseconds, std::memory_order_relaxed); }
+
+    const VNullDeviceStats& GetStats() const { return m_stats; }
+
+    // Called by the null resources
+    void RecordDraw();
+    void RecordUniformUpdate() { m_stats.uniformUpdates.fetch_add(1, std::memory_order_relaxed); }
+    void RecordTextureBind() { m_stats.textureBinds.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    VNullDeviceStats m_stats;
+    std::atomic<uint64_t> m_drawCostNs{0};
+};
+
+} // namespace VE::Internal::RHI
@@ -15,9 +15,11 @@
 #include <RHI/Interface/VRHI_Mesh.hpp>
 #include <RHI/Interface/VRHI_Buffer.hpp>
 #include <RHI/Interface/VRHI_RenderTarget.hpp>
+#include <RHI/Common/VRHI_GpuHeap.hpp>
 
 #include <Shared/glad/glad.h>
 
+#include <array>
 #include <memory>
 #include <unordered_map>
 
@@ -35,6 +37,7 @@ public:
     void Shutdown() override;
     void Present() override;
     void Clear(float r = 0.0f, float g = 0.0f, float b = 0.0f, float a = 1.0f) override;
+    void BeginFrame(uint64_t frameIndex) override;
 
     std::shared_ptr<IRHIShader> CreateShader(const std::string& vertexSource, const std::string& fragmentSource) override;
     std::shared_ptr<IRHITexture> CreateTexture(uint32_t width, uint32_t height, ERHIFormat format, const void* data = nullptr, ETextureType type = ETextureType::Texture2D, uint32_t depth = 1) override;
@@ -42,6 +45,8 @@ public:
     std::shared_ptr<IRHIBuffer> CreateBuffer(ERHIBufferType type, uint32_t size, const void* data = nullptr) override;
     std::shared_ptr<IRHIRenderTarget> CreateRenderTarget(uint32_t width, uint32_t height, uint32_t samples = 1) override;
 
+    VGpuHeap* GetGpuHeap(ERHIBufferType type) override;
+
     void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
     // void BindShader(std::shared_ptr<IRHIShader> shader) override;
     // void BindTexture(std::shared_ptr<IRHITexture> texture, uint32_t slot = 0) override;
@@ -52,11 +57,21 @@ public:
     static GLenum RHIFormatToGL(ERHIFormat format);
     static GLenum BufferTypeToGL(ERHIBufferType type);
 
+    // Heap sizes, meshes that don't fit anymore fall back to their own buffers
+    static constexpr uint32_t VERTEX_HEAP_SIZE = 64u * 1024u * 1024u;
+    static constexpr uint32_t INDEX_HEAP_SIZE = 32u * 1024u * 1024u;
+    // Frames a released range stays untouched, matches the frames the driver may queue
+    static constexpr uint32_t FRAMES_IN_FLIGHT = 2;
+
 private:
     bool m_initialized;
     std::shared_ptr<IRHIShader> m_currentShader;
     std::shared_ptr<IRHIRenderTarget> m_currentRenderTarget;
     std::unordered_map<uint32_t, std::shared_ptr<IRHITexture>> m_boundTextures;
+    // Indexed by ERHIBufferType, only Vertex and Index are created, nothing allocates uniform buffers yet
+    std::array<std::unique_ptr<VGpuHeap>, 4> m_gpuHeaps;
+
+    void CreateGpuHeaps();
 
     void SetupDefaultState();
 };
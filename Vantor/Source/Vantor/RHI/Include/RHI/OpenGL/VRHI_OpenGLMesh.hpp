@@ -12,6 +12,7 @@
 #include <RHI/Interface/VRHI_Mesh.hpp>
 #include <RHI/Interface/VRHI_Device.hpp>
 #include <RHI/Interface/VRHI_Buffer.hpp>
+#include <RHI/Common/VRHI_GpuHeap.hpp>
 
 #include <Shared/glad/glad.h>
 
@@ -24,6 +25,10 @@ class OpenGLMesh : public IRHIMesh
 {
 public:
     OpenGLMesh(const void* vertexData, uint32_t vertexSize, const void* indexData, uint32_t indexCount, const VVertexLayout& layout);
+    // Mesh living in shared heap buffers, the data has already been uploaded into the allocations
+    OpenGLMesh(std::shared_ptr<IRHIBuffer> vertexBuffer, VGpuAllocation vertices,
+               std::shared_ptr<IRHIBuffer> indexBuffer, VGpuAllocation indices,
+               uint32_t vertexSize, uint32_t indexCount, const VVertexLayout& layout);
     virtual ~OpenGLMesh();
 
     // IRHIMesh implementation
@@ -54,6 +59,12 @@ private:
     uint32_t m_indexCount;
     bool m_hasIndices;
 
+    // Only valid for heap meshes, released (deferred) together with the mesh
+    VGpuAllocation m_vertexAllocation;
+    VGpuAllocation m_indexAllocation;
+    uint32_t m_baseVertex = 0;
+    uint64_t m_indexByteOffset = 0;
+
     void SetupVertexAttributes(const VVertexLayout& layout);
 };
 
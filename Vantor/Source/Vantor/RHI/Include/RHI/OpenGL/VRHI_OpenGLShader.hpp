@@ -11,6 +11,8 @@
 
 #include <RHI/Interface/VRHI_Shader.hpp>
 
+#include <Core/Container/VCO_FlatHashMap.hpp>
+
 #include <Shared/glad/glad.h>
 #include <string>
 
@@ -27,28 +29,30 @@ public:
     void Use() override;
 
     // Uniform Setters
-    void SetBool(const std::string& name, bool value) override;
-    void SetInt(const std::string& name, int value) override;
-    void SetFloat(const std::string& name, float value) override;
+    void SetBool(VE::Internal::Core::Types::VName name, bool value) override;
+    void SetInt(VE::Internal::Core::Types::VName name, int value) override;
+    void SetFloat(VE::Internal::Core::Types::VName name, float value) override;
 
-    void SetVec2(const std::string& name, float x, float y) override;
-    void SetVec2(const std::string& name, const VE::Math::VVector2 &value) override;
-    void SetVec3(const std::string& name, float x, float y, float z) override;
-    void SetVec3(const std::string& name, const VE::Math::VVector3 &value) override;
-    void SetVec4(const std::string& name, float x, float y, float z, float w) override;
-    void SetVec4(const std::string& name, const VE::Math::VVector4 &value) override;
+    void SetVec2(VE::Internal::Core::Types::VName name, float x, float y) override;
+    void SetVec2(VE::Internal::Core::Types::VName name, const VE::Math::VVector2 &value) override;
+    void SetVec3(VE::Internal::Core::Types::VName name, float x, float y, float z) override;
+    void SetVec3(VE::Internal::Core::Types::VName name, const VE::Math::VVector3 &value) override;
+    void SetVec4(VE::Internal::Core::Types::VName name, float x, float y, float z, float w) override;
+    void SetVec4(VE::Internal::Core::Types::VName name, const VE::Math::VVector4 &value) override;
 
-    void SetMat2(const std::string& name, const VE::Math::VMat2 &mat) override;
-    void SetMat3(const std::string& name, const VE::Math::VMat3 &mat) override;
-    void SetMat4(const std::string& name, const VE::Math::VMat4 &mat) override;
+    void SetMat2(VE::Internal::Core::Types::VName name, const VE::Math::VMat2 &mat) override;
+    void SetMat3(VE::Internal::Core::Types::VName name, const VE::Math::VMat3 &mat) override;
+    void SetMat4(VE::Internal::Core::Types::VName name, const VE::Math::VMat4 &mat) override;
 
 private:
     uint32_t m_program;
+    // Uniform locations are per program, looked up once per name (keyed by the interned id)
+    VE::Internal::Core::Container::TFlatHashMap<VE::Internal::Core::Types::VName, int> m_uniformLocations;
 
     uint32_t CompileShader(const std::string& source, GLenum type);
     bool CheckCompileErrors(uint32_t shader, const std::string& type);
     bool CheckLinkErrors(uint32_t program);
-    int GetUniformLocation(const std::string& name);
+    int GetUniformLocation(VE::Internal::Core::Types::VName name);
 };
 
 } // namespace VE::Internal::RHI
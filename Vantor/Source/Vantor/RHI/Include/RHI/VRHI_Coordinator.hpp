@@ -10,15 +10,16 @@
 #pragma once
 
 #include <RHI/Interface/VRHI_Device.hpp>
+#include <RHI/Null/VRHI_NullDevice.hpp>
 
 #ifdef VANTOR_API_OPENGL
 #include <RHI/OpenGL/VRHI_OpenGLDevice.hpp>
 #endif
 
 #include <Core/Types/VCO_Singleton.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
 #include <memory>
-#include <iostream>
 
 namespace VE::Internal::RHI {
 
@@ -35,12 +36,15 @@ public:
             #ifdef VANTOR_API_OPENGL
                 return std::make_shared<OpenGLDevice>();
             #else
-                std::cout << "OpenGL support not compiled in!" << std::endl;
+                VE_LOG(ERR, "RHI", "OpenGL support not compiled in!");
                 return nullptr;
             #endif
 
+            case EGraphicsAPI::NULL_DEVICE:
+                return std::make_shared<NullDevice>();
+
             default:
-                std::cout << "Unknown RHI API requested!" << std::endl;
+                VE_LOG(ERR, "RHI", "Unknown RHI API requested!");
                 return nullptr;
         }
     }
@@ -0,0 +1,86 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <RHI/Common/VRHI_GpuHeap.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+
+#include <cassert>
+
+namespace VE::Internal::RHI
+{
+
+VGpuHeap::VGpuHeap(std::shared_ptr<IRHIBuffer> buffer, uint32_t pageSize, bool deferredRelease)
+    : m_buffer(std::move(buffer))
+{
+    assert(m_buffer != nullptr && pageSize > 0);
+
+    // Only whole pages, the page allocator would otherwise hand out a tail past the end of the buffer
+    const uint64_t capacity = uint64_t(m_buffer->GetSize()) / pageSize * pageSize;
+    m_allocator.init(capacity, pageSize, deferredRelease);
+}
+
+VGpuAllocation VGpuHeap::Allocate(uint64_t size, uint32_t alignment, const void* data)
+{
+    VGpuAllocation result;
+    if (size == 0 || alignment == 0)
+        return result;
+
+    // Page offsets are already aligned when alignment divides the page size, otherwise reserve room to shift the start
+    const uint64_t padding = (m_allocator.page_size % alignment == 0) ? 0 : alignment - 1;
+
+    result.allocation = m_allocator.allocate(size + padding);
+    if (!result.allocation.IsValid())
+        return result;
+
+    result.buffer = m_buffer.get();
+    result.offset = (result.allocation.byte_offset + alignment - 1) / alignment * alignment;
+    result.size = size;
+
+    if (data != nullptr)
+        m_buffer->UpdateData(data, static_cast<uint32_t>(size), static_cast<uint32_t>(result.offset));
+
+    return result;
+}
+
+void VGpuHeap::Write(const VGpuAllocation& allocation, const void* data, uint64_t size, uint64_t offset)
+{
+    if (!allocation.IsValid() || allocation.buffer != m_buffer.get())
+    {
+        VE_LOG(ERR, "RHI", "VGpuHeap::Write called with an allocation of another heap");
+        return;
+    }
+    if (offset + size > allocation.size)
+    {
+        VE_LOG(ERR, "RHI", "VGpuHeap write out of bounds: offset={}, size={}, allocation_size={}", offset, size, allocation.size);
+        return;
+    }
+    m_buffer->UpdateData(data, static_cast<uint32_t>(size), static_cast<uint32_t>(allocation.offset + offset));
+}
+
+void VGpuHeap::UpdateDeferredRelease(uint64_t frameIndex, uint32_t bufferCount)
+{
+    m_allocator.update_deferred_release(frameIndex, bufferCount);
+}
+
+VGpuHeapStats VGpuHeap::GetStats() const
+{
+    VGpuHeapStats stats;
+    if (m_allocator.allocator == nullptr)
+        return stats;
+
+    std::scoped_lock lock(m_allocator.allocator->locker);
+    const OffsetAllocator::StorageReport report = m_allocator.allocator->allocator.storageReport();
+
+    stats.capacity = m_allocator.total_size_in_bytes();
+    stats.freeBytes = uint64_t(report.totalFreeSpace) * m_allocator.page_size;
+    stats.largestFreeBlock = uint64_t(report.largestFreeRegion) * m_allocator.page_size;
+    return stats;
+}
+
+} // namespace VE::Internal::RHI
@@ -0,0 +1,201 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <RHI/Null/VRHI_NullDevice.hpp>
+#include <RHI/Common/VRHI_CpuBuffer.hpp>
+
+#include <chrono>
+#include <unordered_map>
+
+namespace VE::Internal::RHI
+{
+
+namespace
+{
+
+// The resources keep a pointer to their device, which has to outlive them like any other device
+
+class NullShader : public IRHIShader
+{
+public:
+    explicit NullShader(NullDevice* device) : m_device(device) {}
+
+    void Use() override {}
+
+    void SetBool(VE::Internal::Core::Types::VName /*name*/, bool /*value*/) override { m_device->RecordUniformUpdate(); }
+    void SetInt(VE::Internal::Core::Types::VName /*name*/, int /*value*/) override { m_device->RecordUniformUpdate(); }
+    void SetFloat(VE::Internal::Core::Types::VName /*name*/, float /*value*/) override { m_device->RecordUniformUpdate(); }
+
+    void SetVec2(VE::Internal::Core::Types::VName /*name*/, float /*x*/, float /*y*/) override { m_device->RecordUniformUpdate(); }
+    void SetVec2(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VVector2 &/*value*/) override { m_device->RecordUniformUpdate(); }
+    void SetVec3(VE::Internal::Core::Types::VName /*name*/, float /*x*/, float /*y*/, float /*z*/) override { m_device->RecordUniformUpdate(); }
+    void SetVec3(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VVector3 &/*value*/) override { m_device->RecordUniformUpdate(); }
+    void SetVec4(VE::Internal::Core::Types::VName /*name*/, float /*x*/, float /*y*/, float /*z*/, float /*w*/) override { m_device->RecordUniformUpdate(); }
+    void SetVec4(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VVector4 &/*value*/) override { m_device->RecordUniformUpdate(); }
+
+    void SetMat2(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VMat2 &/*mat*/) override { m_device->RecordUniformUpdate(); }
+    void SetMat3(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VMat3 &/*mat*/) override { m_device->RecordUniformUpdate(); }
+    void SetMat4(VE::Internal::Core::Types::VName /*name*/, const VE::Math::VMat4 &/*mat*/) override { m_device->RecordUniformUpdate(); }
+
+private:
+    NullDevice* m_device;
+};
+
+class NullTexture : public IRHITexture
+{
+public:
+    NullTexture(NullDevice* device, uint32_t width, uint32_t height, uint32_t depth, ERHIFormat format, ETextureType type)
+        : m_device(device), m_width(width), m_height(height), m_depth(depth), m_format(format), m_type(type) {}
+
+    void Bind(uint32_t /*slot*/ = 0) override { m_device->RecordTextureBind(); }
+    void Unbind() override {}
+
+    void UpdateData(const void* /*data*/, uint32_t /*width*/, uint32_t /*height*/ = 1, uint32_t /*depth*/ = 1, uint32_t /*face*/ = 0) override {}
+
+    uint32_t GetWidth() const override { return m_width; }
+    uint32_t GetHeight() const override { return m_height; }
+    uint32_t GetDepth() const override { return m_depth; }
+    uint32_t GetHandle() const override { return 0; }
+    ERHIFormat GetFormat() const override { return m_format; }
+    ETextureType GetType() const override { return m_type; }
+
+    void Resize(uint32_t newWidth, uint32_t newHeight, uint32_t newDepth = 1) override
+    {
+        m_width = newWidth;
+        m_height = newHeight;
+        m_depth = newDepth;
+    }
+
+    void SetFilter(ETextureFilter /*minFilter*/, ETextureFilter /*magFilter*/) override {}
+    void SetWrap(ETextureWrap /*wrapS*/, ETextureWrap /*wrapT*/, ETextureWrap /*wrapR*/ = ETextureWrap::Repeat) override {}
+
+private:
+    NullDevice* m_device;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_depth;
+    ERHIFormat m_format;
+    ETextureType m_type;
+};
+
+class NullMesh : public IRHIMesh
+{
+public:
+    NullMesh(NullDevice* device, std::shared_ptr<IRHIBuffer> vertexBuffer, std::shared_ptr<IRHIBuffer> indexBuffer, uint32_t vertexCount, uint32_t indexCount)
+        : m_device(device), m_vertexBuffer(std::move(vertexBuffer)), m_indexBuffer(std::move(indexBuffer)), m_vertexCount(vertexCount), m_indexCount(indexCount) {}
+
+    void Bind() override {}
+    void Unbind() override {}
+    void Draw() override { m_device->RecordDraw(); }
+    void Draw(EPrimitiveType /*primitiveType*/) override { m_device->RecordDraw(); }
+
+    uint32_t GetVertexCount() const override { return m_vertexCount; }
+    uint32_t GetIndexCount() const override { return m_indexCount; }
+
+    std::shared_ptr<IRHIBuffer> GetVertexBuffer() const override { return m_vertexBuffer; }
+    std::shared_ptr<IRHIBuffer> GetIndexBuffer() const override { return m_indexBuffer; }
+
+private:
+    NullDevice* m_device;
+    std::shared_ptr<IRHIBuffer> m_vertexBuffer;
+    std::shared_ptr<IRHIBuffer> m_indexBuffer;
+    uint32_t m_vertexCount;
+    uint32_t m_indexCount;
+};
+
+class NullRenderTarget : public IRHIRenderTarget
+{
+public:
+    NullRenderTarget(uint32_t width, uint32_t height, uint32_t samples) : m_width(width), m_height(height), m_samples(samples) {}
+
+    void Bind() override {}
+    void Unbind() override {}
+    bool IsComplete() const override { return true; }
+
+    void AttachTexture(EAttachmentType type, std::shared_ptr<IRHITexture> texture, uint32_t /*mipLevel*/ = 0, uint32_t /*layer*/ = 0) override
+    {
+        m_attachments[type] = std::move(texture);
+    }
+
+    void DetachTexture(EAttachmentType type) override { m_attachments.erase(type); }
+
+    std::shared_ptr<IRHITexture> GetAttachment(EAttachmentType type) const override
+    {
+        auto it = m_attachments.find(type);
+        return it != m_attachments.end() ? it->second : nullptr;
+    }
+
+    void Clear(float /*r*/ = 0.0f, float /*g*/ = 0.0f, float /*b*/ = 0.0f, float /*a*/ = 1.0f) override {}
+    void ClearDepth(float /*depth*/ = 1.0f) override {}
+    void ClearStencil(int32_t /*stencil*/ = 0) override {}
+
+    uint32_t GetWidth() const override { return m_width; }
+    uint32_t GetHeight() const override { return m_height; }
+    uint32_t GetHandle() const override { return 0; }
+
+    void SetViewport(uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+
+    uint32_t GetSampleCount() const override { return m_samples; }
+    bool IsMultisampled() const override { return m_samples > 1; }
+
+private:
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_samples;
+    std::unordered_map<EAttachmentType, std::shared_ptr<IRHITexture>> m_attachments;
+};
+
+} // namespace
+
+std::shared_ptr<IRHIShader> NullDevice::CreateShader(const std::string& /*vertexSource*/, const std::string& /*fragmentSource*/)
+{
+    return std::make_shared<NullShader>(this);
+}
+
+std::shared_ptr<IRHITexture> NullDevice::CreateTexture(uint32_t width, uint32_t height, ERHIFormat format, const void* /*data*/, ETextureType type, uint32_t depth)
+{
+    return std::make_shared<NullTexture>(this, width, height, depth, format, type);
+}
+
+std::shared_ptr<IRHIMesh> NullDevice::CreateMesh(const void* vertexData, uint32_t vertexSize, const void* indexData, uint32_t indexCount, const VVertexLayout& layout)
+{
+    std::shared_ptr<IRHIBuffer> vertexBuffer = std::make_shared<VCpuBuffer>(vertexSize, vertexData);
+    std::shared_ptr<IRHIBuffer> indexBuffer;
+    if (indexData != nullptr)
+        indexBuffer = std::make_shared<VCpuBuffer>(static_cast<uint32_t>(indexCount * sizeof(uint32_t)), indexData);
+
+    const uint32_t vertexCount = layout.stride > 0 ? vertexSize / layout.stride : 0;
+    return std::make_shared<NullMesh>(this, std::move(vertexBuffer), std::move(indexBuffer), vertexCount, indexCount);
+}
+
+std::shared_ptr<IRHIBuffer> NullDevice::CreateBuffer(ERHIBufferType /*type*/, uint32_t size, const void* data)
+{
+    return std::make_shared<VCpuBuffer>(size, data);
+}
+
+std::shared_ptr<IRHIRenderTarget> NullDevice::CreateRenderTarget(uint32_t width, uint32_t height, uint32_t samples)
+{
+    return std::make_shared<NullRenderTarget>(width, height, samples);
+}
+
+void NullDevice::RecordDraw()
+{
+    m_stats.drawCalls.fetch_add(1, std::memory_order_relaxed);
+
+    const uint64_t cost = m_drawCostNs.load(std::memory_order_relaxed);
+    if (cost == 0)
+        return;
+
+    const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(cost);
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+}
+
+} // namespace VE::Internal::RHI
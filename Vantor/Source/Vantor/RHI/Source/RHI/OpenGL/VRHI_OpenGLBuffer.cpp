@@ -9,7 +9,7 @@
 
 #include <RHI/OpenGL/VRHI_OpenGLBuffer.hpp>
 
-#include <Core/BackLog/VCO_Backlog.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
 #include <array>
 
@@ -77,8 +77,7 @@ void OpenGLBuffer::UpdateData(const void* data, uint32_t size, uint32_t offset)
 {
     if (offset + size > m_size)
     {
-        std::cerr << "Buffer update out of bounds: offset=" << offset
-                  << ", size=" << size << ", buffer_size=" << m_size << std::endl;
+        VE_LOG(ERR, "RHI", "Buffer update out of bounds: offset={}, size={}, buffer_size={}", offset, size, m_size);
         return;
     }
 
@@ -99,7 +98,7 @@ void* OpenGLBuffer::Map()
 {
     if (m_mapped)
     {
-        std::cerr << "Buffer is already mapped" << std::endl;
+        VE_LOG(ERR, "RHI", "Buffer is already mapped");
         return nullptr;
     }
 
@@ -113,7 +112,7 @@ void* OpenGLBuffer::Map()
 
     if (!ptr)
     {
-        std::cerr << "Failed to map buffer" << std::endl;
+        VE_LOG(ERR, "RHI", "Failed to map buffer");
         return nullptr;
     }
 
@@ -125,14 +124,14 @@ void OpenGLBuffer::Unmap()
 {
     if (!m_mapped)
     {
-        std::cerr << "Buffer is not mapped" << std::endl;
+        VE_LOG(ERR, "RHI", "Buffer is not mapped");
         return;
     }
 
     Bind();
 
     if (glUnmapBuffer(BufferTypeToGL(m_type)) == GL_FALSE)
-        std::cerr << "Buffer data was corrupted during mapping" << std::endl;
+        VE_LOG(ERR, "RHI", "Buffer data was corrupted during mapping");
 
     m_mapped = false;
 }
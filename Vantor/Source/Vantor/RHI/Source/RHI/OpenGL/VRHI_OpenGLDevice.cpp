@@ -13,8 +13,7 @@
 #include <RHI/OpenGL/VRHI_OpenGLMesh.hpp>
 #include <RHI/OpenGL/VRHI_OpenGLBuffer.hpp>
 #include <RHI/OpenGL/VRHI_OpenGLRenderTarget.hpp>
-
-#include <iostream>
+#include <Core/BackLog/VCO_Log.hpp>
 
 namespace VE::Internal::RHI
 {
@@ -40,14 +39,15 @@ bool OpenGLDevice::Initialize()
     // Initialize GLAD
     if (!gladLoadGL())
     {
-        std::cerr << "Failed to initialize GLAD" << std::endl;
+        VE_LOG(ERR, "RHI", "Failed to initialize GLAD");
         return false;
     }
 
-    std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
-    std::cout << "Graphics Card: " << glGetString(GL_RENDERER) << std::endl;
+    VE_LOG(INFO, "RHI", "OpenGL Version: {}", reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+    VE_LOG(INFO, "RHI", "Graphics Card: {}", reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
 
     SetupDefaultState();
+    CreateGpuHeaps();
     m_initialized = true;
     return true;
 }
@@ -60,9 +60,34 @@ void OpenGLDevice::Shutdown()
     m_currentShader.reset();
     m_currentRenderTarget.reset();
     m_boundTextures.clear();
+    // Meshes still alive keep their heap buffer through shared ownership
+    for (auto& heap : m_gpuHeaps)
+        heap.reset();
     m_initialized = false;
 }
 
+void OpenGLDevice::BeginFrame(uint64_t frameIndex)
+{
+    for (auto& heap : m_gpuHeaps)
+    {
+        if (heap)
+            heap->UpdateDeferredRelease(frameIndex, FRAMES_IN_FLIGHT);
+    }
+}
+
+void OpenGLDevice::CreateGpuHeaps()
+{
+    m_gpuHeaps[static_cast<int>(ERHIBufferType::Vertex)] = std::make_unique<VGpuHeap>(
+        std::make_shared<OpenGLBuffer>(ERHIBufferType::Vertex, VERTEX_HEAP_SIZE, EBufferUsage::Static), VGpuHeap::DEFAULT_PAGE_SIZE);
+    m_gpuHeaps[static_cast<int>(ERHIBufferType::Index)] = std::make_unique<VGpuHeap>(
+        std::make_shared<OpenGLBuffer>(ERHIBufferType::Index, INDEX_HEAP_SIZE, EBufferUsage::Static), VGpuHeap::DEFAULT_PAGE_SIZE);
+}
+
+VGpuHeap* OpenGLDevice::GetGpuHeap(ERHIBufferType type)
+{
+    return m_gpuHeaps[static_cast<int>(type)].get();
+}
+
 void OpenGLDevice::Present()
 {
     glFlush();
@@ -86,6 +111,28 @@ std::shared_ptr<IRHITexture> OpenGLDevice::CreateTexture(uint32_t width, uint32_
 
 std::shared_ptr<IRHIMesh> OpenGLDevice::CreateMesh(const void* vertexData, uint32_t vertexSize, const void* indexData, uint32_t indexCount, const VVertexLayout& layout)
 {
+    VGpuHeap* vertexHeap = GetGpuHeap(ERHIBufferType::Vertex);
+    VGpuHeap* indexHeap = GetGpuHeap(ERHIBufferType::Index);
+
+    if (vertexHeap != nullptr && indexHeap != nullptr && layout.stride > 0)
+    {
+        // Vertex ranges start on a whole vertex so the mesh can be drawn with a base vertex
+        VGpuAllocation vertices = vertexHeap->Allocate(vertexSize, layout.stride, vertexData);
+        VGpuAllocation indices;
+        if (indexData != nullptr && vertices.IsValid())
+            indices = indexHeap->Allocate(uint64_t(indexCount) * sizeof(uint32_t), sizeof(uint32_t), indexData);
+
+        if (vertices.IsValid() && (indexData == nullptr || indices.IsValid()))
+        {
+            return std::make_shared<OpenGLMesh>(
+                vertexHeap->GetBuffer(), std::move(vertices),
+                indexData != nullptr ? indexHeap->GetBuffer() : nullptr, std::move(indices),
+                vertexSize, indexCount, layout);
+        }
+
+        VE_LOG(WARNING, "RHI", "GPU heap is full, creating dedicated buffers for mesh");
+    }
+
     return std::make_shared<OpenGLMesh>(vertexData, vertexSize, indexData, indexCount, layout);
 }
 
@@ -9,8 +9,9 @@
 
 #include <RHI/OpenGL/VRHI_OpenGLMesh.hpp>
 #include <RHI/OpenGL/VRHI_OpenGLBuffer.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
+#include <Core/Profiler/VCO_Profiler.hpp>
 
-#include <iostream>
 
 namespace VE::Internal::RHI
 {
@@ -60,6 +61,31 @@ OpenGLMesh::OpenGLMesh(const void* vertexData, uint32_t vertexSize, const void*
     if (m_hasIndices) m_IndexBuffer->Unbind();
 }
 
+OpenGLMesh::OpenGLMesh(std::shared_ptr<IRHIBuffer> vertexBuffer, VGpuAllocation vertices,
+                       std::shared_ptr<IRHIBuffer> indexBuffer, VGpuAllocation indices,
+                       uint32_t vertexSize, uint32_t indexCount, const VVertexLayout& layout)
+    : m_VertexBuffer(std::move(vertexBuffer)), m_IndexBuffer(std::move(indexBuffer)), m_vao(0),
+      m_vertexCount(vertexSize / layout.stride), m_indexCount(indexCount), m_hasIndices(indices.IsValid()),
+      m_vertexAllocation(std::move(vertices)), m_indexAllocation(std::move(indices))
+{
+    m_baseVertex = m_vertexAllocation.GetElementOffset(layout.stride);
+    m_indexByteOffset = m_hasIndices ? m_indexAllocation.offset : 0;
+
+    glGenVertexArrays(1, &m_vao);
+    glBindVertexArray(m_vao);
+
+    // The attribute pointers start at the beginning of the heap, the mesh is selected with the base vertex
+    m_VertexBuffer->Bind();
+    // The element binding is VAO state, bind it directly so the buffer bind cache can't skip it
+    if (m_hasIndices)
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer->GetHandle());
+
+    SetupVertexAttributes(layout);
+
+    glBindVertexArray(0);
+    m_VertexBuffer->Unbind();
+}
+
 OpenGLMesh::~OpenGLMesh()
 {
     if (m_vao != 0)
@@ -84,14 +110,17 @@ void OpenGLMesh::Draw()
 void OpenGLMesh::Draw(EPrimitiveType primitiveType)
 {
     GLenum glPrimitiveType = PrimitiveTypeToGL(primitiveType);
+    VE_PROFILE_COUNT("Draw Calls", 1);
     
     if (m_hasIndices)
     {
-        glDrawElements(glPrimitiveType, m_indexCount, GL_UNSIGNED_INT, 0);
+        // Dedicated buffers have offset and base vertex 0, heap meshes address their range inside the shared buffers
+        glDrawElementsBaseVertex(glPrimitiveType, m_indexCount, GL_UNSIGNED_INT,
+                                 reinterpret_cast<void*>(static_cast<uintptr_t>(m_indexByteOffset)), static_cast<GLint>(m_baseVertex));
     }
     else
     {
-        glDrawArrays(glPrimitiveType, 0, m_vertexCount);
+        glDrawArrays(glPrimitiveType, static_cast<GLint>(m_baseVertex), m_vertexCount);
     }
 }
 
@@ -128,7 +157,7 @@ void OpenGLMesh::SetupVertexAttributes(const VVertexLayout& layout)
                 normalized = true;
                 break;
             default:
-                std::cerr << "Unsupported vertex attribute format" << std::endl;
+                VE_LOG(ERR, "RHI", "Unsupported vertex attribute format");
                 continue;
         }
 
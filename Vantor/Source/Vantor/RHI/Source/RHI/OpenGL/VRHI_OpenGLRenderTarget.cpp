@@ -9,8 +9,8 @@
 
 #include <RHI/OpenGL/VRHI_OpenGLRenderTarget.hpp>
 #include <RHI/OpenGL/VRHI_OpenGLTexture.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
-#include <iostream>
 #include <cassert>
 #include <Shared/glad/glad.h>
 
@@ -101,7 +101,7 @@ void OpenGLRenderTarget::AttachTexture(EAttachmentType type,
     auto openglTexture = std::static_pointer_cast<OpenGLTexture>(texture);
     if (!openglTexture)
     {
-        std::cerr << "Error: Texture is not an OpenGL texture" << std::endl;
+        VE_LOG(ERR, "RHI", "Texture is not an OpenGL texture");
         return;
     }
 
@@ -248,31 +248,31 @@ void OpenGLRenderTarget::CheckFramebufferStatus() const
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
     if (status != GL_FRAMEBUFFER_COMPLETE)
     {
-        std::cerr << "Framebuffer not complete! Status: 0x" << std::hex << status << std::endl;
+        const char *reason = "Unknown framebuffer error";
         switch (status)
         {
             case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT:
-                std::cerr << "GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT" << std::endl;
+                reason = "GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT";
                 break;
             case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT:
-                std::cerr << "GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT" << std::endl;
+                reason = "GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT";
                 break;
             case GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER:
-                std::cerr << "GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER" << std::endl;
+                reason = "GL_FRAMEBUFFER_INCOMPLETE_DRAW_BUFFER";
                 break;
             case GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER:
-                std::cerr << "GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER" << std::endl;
+                reason = "GL_FRAMEBUFFER_INCOMPLETE_READ_BUFFER";
                 break;
             case GL_FRAMEBUFFER_UNSUPPORTED:
-                std::cerr << "GL_FRAMEBUFFER_UNSUPPORTED" << std::endl;
+                reason = "GL_FRAMEBUFFER_UNSUPPORTED";
                 break;
             case GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE:
-                std::cerr << "GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE" << std::endl;
+                reason = "GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE";
                 break;
             default:
-                std::cerr << "Unknown framebuffer error" << std::endl;
                 break;
         }
+        VE_LOG(ERR, "RHI", "Framebuffer not complete! Status: {} ({})", status, reason);
     }
 }
 
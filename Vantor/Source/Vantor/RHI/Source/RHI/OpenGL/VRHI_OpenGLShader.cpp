@@ -8,9 +8,8 @@
  ****************************************************************************/
 
 #include <RHI/OpenGL/VRHI_OpenGLShader.hpp>
+#include <Core/BackLog/VCO_Log.hpp>
 
-#include <iostream>
-#include <unordered_map>
 
 namespace VE::Internal::RHI
 {
@@ -63,62 +62,62 @@ void OpenGLShader::Use()
     }
 }
 
-void OpenGLShader::SetBool(const std::string& name, bool value)
+void OpenGLShader::SetBool(VE::Internal::Core::Types::VName name, bool value)
 {
     glUniform1i(GetUniformLocation(name), static_cast<int>(value));
 }
 
-void OpenGLShader::SetInt(const std::string& name, int value)
+void OpenGLShader::SetInt(VE::Internal::Core::Types::VName name, int value)
 {
     glUniform1i(GetUniformLocation(name), value);
 }
 
-void OpenGLShader::SetFloat(const std::string& name, float value)
+void OpenGLShader::SetFloat(VE::Internal::Core::Types::VName name, float value)
 {
     glUniform1f(GetUniformLocation(name), value);
 }
 
-void OpenGLShader::SetVec2(const std::string& name, float x, float y)
+void OpenGLShader::SetVec2(VE::Internal::Core::Types::VName name, float x, float y)
 {
     glUniform2f(GetUniformLocation(name), x, y);
 }
 
-void OpenGLShader::SetVec2(const std::string& name, const VE::Math::VVector2 &value)
+void OpenGLShader::SetVec2(VE::Internal::Core::Types::VName name, const VE::Math::VVector2 &value)
 {
     glUniform2fv(GetUniformLocation(name), 1,  value.Data());
 }
 
-void OpenGLShader::SetVec3(const std::string& name, float x, float y, float z)
+void OpenGLShader::SetVec3(VE::Internal::Core::Types::VName name, float x, float y, float z)
 {
     glUniform3f(GetUniformLocation(name), x, y, z);
 }
 
-void OpenGLShader::SetVec3(const std::string& name, const VE::Math::VVector3 &value)
+void OpenGLShader::SetVec3(VE::Internal::Core::Types::VName name, const VE::Math::VVector3 &value)
 {
     glUniform3fv(GetUniformLocation(name), 1, value.Data());
 }
 
-void OpenGLShader::SetVec4(const std::string& name, float x, float y, float z, float w)
+void OpenGLShader::SetVec4(VE::Internal::Core::Types::VName name, float x, float y, float z, float w)
 {
     glUniform4f(GetUniformLocation(name), x, y, z, w);
 }
 
-void OpenGLShader::SetVec4(const std::string& name, const VE::Math::VVector4 &value)
+void OpenGLShader::SetVec4(VE::Internal::Core::Types::VName name, const VE::Math::VVector4 &value)
 {
     glUniform4fv(GetUniformLocation(name), 1, value.Data());
 }
 
-void OpenGLShader::SetMat2(const std::string& name, const VE::Math::VMat2 &mat)
+void OpenGLShader::SetMat2(VE::Internal::Core::Types::VName name, const VE::Math::VMat2 &mat)
 {
     glUniformMatrix2fv(GetUniformLocation(name), 1, GL_FALSE, mat.Data());
 }
 
-void OpenGLShader::SetMat3(const std::string& name, const VE::Math::VMat3 &mat)
+void OpenGLShader::SetMat3(VE::Internal::Core::Types::VName name, const VE::Math::VMat3 &mat)
 {
     glUniformMatrix3fv(GetUniformLocation(name), 1, GL_FALSE, mat.Data());
 }
 
-void OpenGLShader::SetMat4(const std::string& name, const VE::Math::VMat4 &mat)
+void OpenGLShader::SetMat4(VE::Internal::Core::Types::VName name, const VE::Math::VMat4 &mat)
 {
     glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, mat.Data());
 }
@@ -149,8 +148,7 @@ bool OpenGLShader::CheckCompileErrors(uint32_t shader, const std::string& type)
     if (!success)
     {
         glGetShaderInfoLog(shader, 1024, nullptr, infoLog);
-        std::cerr << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << "\n" 
-                  << infoLog << "\n -- --------------------------------------------------- --" << std::endl;
+        VE_LOG(ERR, "RHI", "ERROR::SHADER_COMPILATION_ERROR of type: {}\n{}\n -- --------------------------------------------------- --", type, infoLog);
         return false;
     }
     return true;
@@ -165,29 +163,26 @@ bool OpenGLShader::CheckLinkErrors(uint32_t program)
     if (!success)
     {
         glGetProgramInfoLog(program, 1024, nullptr, infoLog);
-        std::cerr << "ERROR::PROGRAM_LINKING_ERROR\n" 
-                  << infoLog << "\n -- --------------------------------------------------- --" << std::endl;
+        VE_LOG(ERR, "RHI", "ERROR::PROGRAM_LINKING_ERROR\n{}\n -- --------------------------------------------------- --", infoLog);
         return false;
     }
     return true;
 }
 
-int OpenGLShader::GetUniformLocation(const std::string& name)
+int OpenGLShader::GetUniformLocation(VE::Internal::Core::Types::VName name)
 {
-    static std::unordered_map<std::string, int> uniformCache;
-    
-    auto it = uniformCache.find(name);
-    if (it != uniformCache.end())
+    auto it = m_uniformLocations.find(name);
+    if (it != m_uniformLocations.end())
     {
         return it->second;
     }
     
     int location = glGetUniformLocation(m_program, name.c_str());
-    uniformCache[name] = location;
+    m_uniformLocations[name] = location;
     
     if (location == -1)
     {
-        std::cerr << "Warning: uniform '" << name << "' not found in shader" << std::endl;
+        VE_LOG(WARNING, "RHI", "uniform '{}' not found in shader", name.GetString());
     }
     
     return location;
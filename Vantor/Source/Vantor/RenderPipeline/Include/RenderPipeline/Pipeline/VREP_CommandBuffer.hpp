@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <Math/Linear/VMA_Matrix.hpp>
@@ -45,8 +46,9 @@ namespace VE::Internal::RenderPipeline {
             // sorts the command buffer; first by shader, then by texture bind.
             void Sort();
 
-            std::vector<VRenderCommand> GetForwardRenderCommands(bool cull = false);
-            std::vector<VRenderCommand> GetDefferedRenderCommands(bool cull = false);
+            // Views into the command lists, valid while the frame packet that owns this buffer is held
+            std::span<const VRenderCommand> GetForwardRenderCommands(bool cull = false) const;
+            std::span<const VRenderCommand> GetDefferedRenderCommands(bool cull = false) const;
 
         private:
             std::vector<VRenderCommand> m_ForwardRenderCommands;
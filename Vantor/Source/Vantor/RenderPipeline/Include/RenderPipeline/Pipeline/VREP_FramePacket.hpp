@@ -0,0 +1,74 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <RenderPipeline/Pipeline/VREP_CommandBuffer.hpp>
+
+#include <Graphics/Light/VGFX_LightData.hpp>
+
+#include <Math/Linear/VMA_Matrix.hpp>
+#include <Math/Linear/VMA_Vector.hpp>
+
+#include <Core/Container/VCO_Vector.hpp>
+
+#include <cstdint>
+
+namespace VE::Graphics {
+    class ACamera;
+}
+
+namespace VE::Internal::RenderPipeline {
+
+    // Copy of the camera state a frame is rendered with, the camera actor itself keeps moving
+    struct VCameraSnapshot
+    {
+            VE::Math::VMat4    View;
+            VE::Math::VMat4    Projection;
+            VE::Math::VVector3 Position = VE::Math::VVector3(0.0f, 0.0f, 0.0f);
+            VE::Math::VVector3 Forward  = VE::Math::VVector3(0.0f, 0.0f, -1.0f);
+            float              Near     = 0.0f;
+            float              Far      = 0.0f;
+
+            static VCameraSnapshot Capture(const VE::Graphics::ACamera& camera);
+    };
+
+    // Everything the render passes read for one frame. The game thread fills a packet, hands it to the
+    // render stage and does not touch it again until the render stage is done with it, so neither side
+    // ever sees the other one write.
+    //
+    // Models, materials and shaders are referenced, not copied. They are treated as render resources:
+    // set up once and not changed while frames are in flight. Per frame values go into the packet.
+    struct VFramePacket
+    {
+            uint64_t        FrameIndex = 0;
+            VCameraSnapshot Camera;
+            bool            HasCamera = false;
+
+            uint32_t ViewportX      = 0;
+            uint32_t ViewportY      = 0;
+            uint32_t ViewportWidth  = 0;
+            uint32_t ViewportHeight = 0;
+
+            // Each packet owns its command buffer, two packets double-buffer the commands
+            VCommandBuffer Commands;
+
+            VE::Internal::Core::Container::TVector<VE::Internal::Graphics::VPointLightData>       PointLights;
+            VE::Internal::Core::Container::TVector<VE::Internal::Graphics::VDirectionalLightData> DirectionalLights;
+
+            // Empties the packet for the next frame, keeps the capacity of its lists
+            void Reset()
+            {
+                HasCamera = false;
+                Commands.Clear();
+                PointLights.clear();
+                DirectionalLights.clear();
+            }
+    };
+}
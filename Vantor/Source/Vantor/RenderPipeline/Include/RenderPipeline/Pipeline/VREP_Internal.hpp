@@ -37,5 +37,9 @@ namespace VE::Internal::RenderPipeline {
             void Cleanup() override;
 
             VE::Render::ERenderPassType GetType() const override { return VE::Render::ERenderPassType::VF_Forward; };
+
+            // Lights of the packet beyond these are dropped, matches the uniform arrays of the forward shaders
+            static constexpr uint32_t MAX_POINT_LIGHTS       = 4;
+            static constexpr uint32_t MAX_DIRECTIONAL_LIGHTS = 4;
     };
 }
\ No newline at end of file
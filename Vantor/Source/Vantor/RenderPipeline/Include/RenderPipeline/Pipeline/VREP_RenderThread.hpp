@@ -0,0 +1,99 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#pragma once
+
+#include <RenderPipeline/Pipeline/VREP_FramePacket.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Two stage pipeline between the game thread and the render stage.
+//
+// The game thread fills the write packet and submits it. With a render thread, Submit() returns as
+// soon as the thread has picked the packet up, so frame N+1 is simulated while frame N renders:
+//
+//     game    | sim N | sim N+1 | sim N+2 |
+//     render          | draw N  | draw N+1 | draw N+2
+//
+// There are two packets, one being written and one being rendered. Submit() waits for the render
+// stage to finish the previous packet before handing over the next one, which bounds the latency to
+// one frame and guarantees the packet the game thread gets back is no longer read.
+//
+// Without a render thread Submit() renders the packet right away on the calling thread. Both modes
+// go through the same packets, so switching between them changes nothing but the timing.
+
+namespace VE::Internal::RenderPipeline {
+
+    struct VRenderThreadDesc
+    {
+            bool        threaded   = false;
+            std::string threadName = "Render Thread";
+
+            // Run on the render thread before the first and after the last packet, e.g. to make a
+            // graphics context current there. Unused without a render thread.
+            std::function<void()> onThreadStart;
+            std::function<void()> onThreadStop;
+    };
+
+    struct VRenderThreadStats
+    {
+            uint64_t submittedFrames = 0;
+            double   gameWaitSeconds = 0.0; // time Submit() blocked on the render stage
+            double   renderSeconds   = 0.0; // time spent in the consumer
+    };
+
+    class VRenderThread
+    {
+        public:
+            using VConsumer = std::function<void(VFramePacket&)>;
+
+            VRenderThread(VConsumer consumer, const VRenderThreadDesc& desc = VRenderThreadDesc());
+            ~VRenderThread();
+
+            VRenderThread(const VRenderThread&)            = delete;
+            VRenderThread& operator=(const VRenderThread&) = delete;
+
+            // Game thread only. The packet stays valid and unshared until the next Submit().
+            VFramePacket& GetWritePacket() { return m_Packets[m_WriteIndex]; }
+
+            // Hands the write packet to the render stage and resets the other packet for writing
+            void Submit();
+            // Waits until every submitted packet is rendered
+            void Flush();
+
+            bool IsThreaded() const { return m_Desc.threaded; }
+            // Game thread only, rendering may still be running for the last submitted packet
+            const VRenderThreadStats& GetStats() const { return m_Stats; }
+
+        private:
+            void ThreadLoop();
+            void Consume(VFramePacket& packet);
+
+            VConsumer         m_Consumer;
+            VRenderThreadDesc m_Desc;
+            VFramePacket      m_Packets[2];
+            uint32_t          m_WriteIndex = 0;
+            uint64_t          m_NextFrame  = 0;
+
+            VRenderThreadStats m_Stats;
+            double             m_RenderSeconds = 0.0; // written by the render stage, copied into m_Stats on the game thread
+
+            std::mutex              m_Mutex;
+            std::condition_variable m_Submitted;
+            std::condition_variable m_Done;
+            VFramePacket*           m_Pending = nullptr; // handed over but not yet rendered
+            bool                    m_Stop    = false;
+            std::thread             m_Thread;
+    };
+}
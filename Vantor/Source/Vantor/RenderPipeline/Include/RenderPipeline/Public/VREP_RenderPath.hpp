@@ -15,6 +15,7 @@
 #include <Math/Linear/VMA_Matrix.hpp>
 
 #include <RenderPipeline/Pipeline/VREP_CommandBuffer.hpp>
+#include <RenderPipeline/Pipeline/VREP_RenderThread.hpp>
 
 #include <memory>
 #include <cstdint>
@@ -33,13 +34,17 @@ namespace VE {
 namespace VE::Render {
 
     // Base render path interface
+    //
+    // Pushes and SetCamera() go into the frame packet being written on the game thread, Render()
+    // captures the camera and submits the packet. Passes only ever read the packet being rendered
+    // (GetRenderPacket()), with a render thread that happens while the game thread fills the next one.
     class VRenderPath
     {
         public:
             virtual ~VRenderPath() = default;
 
             // Core rendering methods
-            virtual void Initialize(VE::Internal::RHI::IRHIDevice* device) = 0;
+            virtual void Initialize(VE::Internal::RHI::IRHIDevice* device, const VE::Internal::RenderPipeline::VRenderThreadDesc& threading = VE::Internal::RenderPipeline::VRenderThreadDesc()) = 0;
             virtual void Render() = 0;
             virtual void Shutdown() = 0;
 
@@ -58,12 +63,16 @@ namespace VE::Render {
             void SetCamera(VE::Graphics::ACamera* camera) { m_Camera = camera; };
             VE::Graphics::ACamera* GetCamera() const { return m_Camera; };
 
-            VE::Internal::RenderPipeline::VCommandBuffer* GetCommandBuffer() const { return m_CommandBuffer.get(); }
+            // Command buffer of the packet the game thread is writing
+            VE::Internal::RenderPipeline::VCommandBuffer* GetCommandBuffer() const { return m_RenderThread ? &m_RenderThread->GetWritePacket().Commands : nullptr; }
+            // Packet being rendered, only valid inside the passes
+            const VE::Internal::RenderPipeline::VFramePacket* GetRenderPacket() const { return m_RenderPacket; }
+            VE::Internal::RenderPipeline::VRenderThread* GetRenderThread() const { return m_RenderThread.get(); }
             VE::Internal::RHI::IRHIDevice* GetDevice() const { return m_Device; }
 
 
         protected:
-            VE::Graphics::ACamera* m_Camera;
+            VE::Graphics::ACamera* m_Camera = nullptr;
 
             uint32_t m_ViewportX      = 0;
             uint32_t m_ViewportY      = 0;
@@ -75,7 +84,8 @@ namespace VE::Render {
 
             VE::Internal::RHI::IRHIDevice* m_Device;
 
-            std::unique_ptr<VE::Internal::RenderPipeline::VCommandBuffer> m_CommandBuffer;
+            std::unique_ptr<VE::Internal::RenderPipeline::VRenderThread> m_RenderThread;
+            const VE::Internal::RenderPipeline::VFramePacket*            m_RenderPacket = nullptr;
     };
 
     class VRenderPath3D : public VRenderPath
@@ -85,7 +95,7 @@ namespace VE::Render {
             virtual ~VRenderPath3D() = default;
 
             // Core rendering methods
-            void Initialize(VE::Internal::RHI::IRHIDevice *device) override;
+            void Initialize(VE::Internal::RHI::IRHIDevice *device, const VE::Internal::RenderPipeline::VRenderThreadDesc& threading = VE::Internal::RenderPipeline::VRenderThreadDesc()) override;
             void Render() override;
             void Shutdown() override;
 
@@ -93,7 +103,8 @@ namespace VE::Render {
             void PushRender(VE::Graphics::VModel* model, VMaterial* material, const VE::Math::VMat4& transform);
             // void PushRender(Vantor::Object::VObject *object) override;
 
-            // void PushPointLight(const Vantor::Renderer::VPointLightData &pointLightData) override;
+            void PushPointLight(const VE::Internal::Graphics::VPointLightData& pointLightData);
+            void PushDirectionalLight(const VE::Internal::Graphics::VDirectionalLightData& directionalLightData);
 
             // Viewport configuration
             void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
@@ -105,6 +116,8 @@ namespace VE::Render {
 
         private:
             void SetupDefaultRenderPasses();
+            // Render stage, on the render thread if there is one
+            void RenderPacket(VE::Internal::RenderPipeline::VFramePacket& packet);
 
             std::unordered_map<ERenderPassType, std::unique_ptr<VRenderPass>> m_RenderPasses;
     };
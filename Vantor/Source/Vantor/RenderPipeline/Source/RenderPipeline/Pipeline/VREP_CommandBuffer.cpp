@@ -73,11 +73,11 @@ namespace VE::Internal::RenderPipeline {
         // }
     }
 
-    std::vector<VRenderCommand> VCommandBuffer::GetForwardRenderCommands(bool cull)
+    std::span<const VRenderCommand> VCommandBuffer::GetForwardRenderCommands(bool cull) const
     {
         // TODO: Work with Camera Frustum
-        return m_ForwardRenderCommands;
+        return std::span(m_ForwardRenderCommands);
     }
 
-    std::vector<VRenderCommand> VCommandBuffer::GetDefferedRenderCommands(bool cull) { return m_DeferredRenderCommands; }
+    std::span<const VRenderCommand> VCommandBuffer::GetDefferedRenderCommands(bool cull) const { return std::span(m_DeferredRenderCommands); }
 }
\ No newline at end of file
@@ -0,0 +1,27 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <RenderPipeline/Pipeline/VREP_FramePacket.hpp>
+
+#include <Graphics/Public/Camera/VGFX_Camera.hpp>
+
+namespace VE::Internal::RenderPipeline {
+
+    VCameraSnapshot VCameraSnapshot::Capture(const VE::Graphics::ACamera& camera)
+    {
+        VCameraSnapshot snapshot;
+        snapshot.View       = camera.View;
+        snapshot.Projection = camera.Projection;
+        snapshot.Position   = camera.Position;
+        snapshot.Forward    = camera.Forward;
+        snapshot.Near       = camera.Near;
+        snapshot.Far        = camera.Far;
+        return snapshot;
+    }
+}
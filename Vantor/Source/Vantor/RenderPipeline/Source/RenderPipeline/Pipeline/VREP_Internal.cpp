@@ -14,11 +14,56 @@
 #include <RHI/Interface/VRHI_Device.hpp>
 #include <RHI/Interface/VRHI_RenderTarget.hpp>
 #include <RHI/Interface/VRHI_Mesh.hpp>
+#include <RHI/Interface/VRHI_Shader.hpp>
 
+#include <Core/Types/VCO_Name.hpp>
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <string>
 
 namespace VE::Internal::RenderPipeline {
 
+    namespace {
+        // Names of the light array elements, interned once instead of building "uLightPositions[i]" per draw
+        template <uint32_t Count>
+        std::array<VE::Internal::Core::Types::VName, Count> MakeArrayNames(const char* base)
+        {
+            std::array<VE::Internal::Core::Types::VName, Count> names;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                names[i] = VE::Internal::Core::Types::VName(std::string(base) + "[" + std::to_string(i) + "]");
+            }
+            return names;
+        }
+
+        void UploadLights(VE::Internal::RHI::IRHIShader* shader, const VFramePacket& packet)
+        {
+            static const auto pointPositions = MakeArrayNames<VForwardRenderPass::MAX_POINT_LIGHTS>("uLightPositions");
+            static const auto pointColors    = MakeArrayNames<VForwardRenderPass::MAX_POINT_LIGHTS>("uLightColors");
+            static const auto dirDirections  = MakeArrayNames<VForwardRenderPass::MAX_DIRECTIONAL_LIGHTS>("uDirLightDirections");
+            static const auto dirColors      = MakeArrayNames<VForwardRenderPass::MAX_DIRECTIONAL_LIGHTS>("uDirLightColors");
+
+            const uint32_t numPoint = std::min<uint32_t>(static_cast<uint32_t>(packet.PointLights.size()), VForwardRenderPass::MAX_POINT_LIGHTS);
+            shader->SetInt(VE_NAME("uNumLights"), static_cast<int>(numPoint));
+            for (uint32_t i = 0; i < numPoint; ++i)
+            {
+                shader->SetVec3(pointPositions[i], packet.PointLights[i].position);
+                shader->SetVec3(pointColors[i], packet.PointLights[i].diffuse);
+            }
+
+            const uint32_t numDir = std::min<uint32_t>(static_cast<uint32_t>(packet.DirectionalLights.size()), VForwardRenderPass::MAX_DIRECTIONAL_LIGHTS);
+            shader->SetInt(VE_NAME("uNumDirLights"), static_cast<int>(numDir));
+            for (uint32_t i = 0; i < numDir; ++i)
+            {
+                shader->SetVec3(dirDirections[i], packet.DirectionalLights[i].direction);
+                shader->SetVec3(dirColors[i], packet.DirectionalLights[i].diffuse);
+            }
+        }
+    }
+
     VGeometryRenderPass::VGeometryRenderPass() = default;
 
     void VGeometryRenderPass::Execute()
@@ -35,17 +80,27 @@ namespace VE::Internal::RenderPipeline {
 
     void VForwardRenderPass::Execute()
     {
-          // Go through all Meshes
-        auto commands = m_RenderPath->GetCommandBuffer()->GetForwardRenderCommands();
+        VE_PROFILE_SCOPE("VForwardRenderPass::Execute");
+
+        // Reads the packet only, the camera and the command buffer of the game thread may already be in the next frame
+        const VFramePacket *packet = m_RenderPath->GetRenderPacket();
+        if (!packet || !packet->HasCamera) return;
+
+        // Go through all Meshes
+        auto commands = packet->Commands.GetForwardRenderCommands();
         
-        for (auto command : commands)
+        for (const auto &command : commands)
         {
             command.Material->GetShader()->Use();
 
             // Should be the same in every Shader
-            command.Material->GetShader()->SetMat4("uModel", command.Transform);
-            command.Material->GetShader()->SetMat4("uView", m_RenderPath->GetCamera()->View);
-            command.Material->GetShader()->SetMat4("uProj",  m_RenderPath->GetCamera()->Projection);
+            command.Material->GetShader()->SetMat4(VE_NAME("uModel"), command.Transform);
+            command.Material->GetShader()->SetMat4(VE_NAME("uView"), packet->Camera.View);
+            command.Material->GetShader()->SetMat4(VE_NAME("uProj"), packet->Camera.Projection);
+            command.Material->GetShader()->SetVec3(VE_NAME("uCameraPos"), packet->Camera.Position);
+
+            // Lights come from the packet, shaders without the light uniforms just ignore them
+            UploadLights(command.Material->GetShader(), *packet);
 
             // Handle Textures of Material
             auto *samplers = command.Material->GetSamplerUniforms();
@@ -0,0 +1,123 @@
+/****************************************************************************
+ * Vantor Engine™ - Source Code (2025)
+ *
+ * Author    : Lukas Rennhofer (@LukasRennhofer), Vantor Studios™
+ * Copyright : © 2025 Lukas Rennhofer, Vantor Studios™
+ * License   : GNU General Public License v3.0
+ *             See LICENSE file for full details.
+ ****************************************************************************/
+
+#include <RenderPipeline/Pipeline/VREP_RenderThread.hpp>
+
+#include <Core/Profiler/VCO_Profiler.hpp>
+
+#include <chrono>
+#include <utility>
+
+namespace VE::Internal::RenderPipeline {
+
+    VRenderThread::VRenderThread(VConsumer consumer, const VRenderThreadDesc& desc) : m_Consumer(std::move(consumer)), m_Desc(desc)
+    {
+        if (m_Desc.threaded)
+        {
+            m_Thread = std::thread([this] { ThreadLoop(); });
+        }
+    }
+
+    VRenderThread::~VRenderThread()
+    {
+        if (!m_Thread.joinable()) return;
+
+        Flush();
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Submitted.notify_one();
+        m_Thread.join();
+    }
+
+    void VRenderThread::Submit()
+    {
+        VE_PROFILE_SCOPE("VRenderThread::Submit");
+
+        VFramePacket& packet = m_Packets[m_WriteIndex];
+        packet.FrameIndex    = m_NextFrame++;
+
+        if (!m_Desc.threaded)
+        {
+            Consume(packet);
+            m_Stats.renderSeconds = m_RenderSeconds;
+        }
+        else
+        {
+            const auto waitStart = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_Done.wait(lock, [&] { return m_Pending == nullptr; });
+                m_Pending             = &packet;
+                m_Stats.renderSeconds = m_RenderSeconds;
+            }
+            m_Submitted.notify_one();
+            m_Stats.gameWaitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count();
+        }
+        m_Stats.submittedFrames++;
+
+        // The render stage is done with the other packet, it was the one submitted before this one
+        m_WriteIndex ^= 1;
+        m_Packets[m_WriteIndex].Reset();
+    }
+
+    void VRenderThread::Flush()
+    {
+        if (!m_Desc.threaded) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Done.wait(lock, [&] { return m_Pending == nullptr; });
+        m_Stats.renderSeconds = m_RenderSeconds;
+    }
+
+    void VRenderThread::ThreadLoop()
+    {
+        VE::Internal::Core::Profiler::VProfiler::SetThreadName(m_Desc.threadName);
+        if (m_Desc.onThreadStart) m_Desc.onThreadStart();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        for (;;)
+        {
+            m_Submitted.wait(lock, [&] { return m_Pending != nullptr || m_Stop; });
+            if (m_Pending == nullptr) break;
+
+            VFramePacket* packet = m_Pending;
+            lock.unlock();
+            Consume(*packet);
+            lock.lock();
+
+            m_Pending = nullptr;
+            m_Done.notify_one();
+        }
+        lock.unlock();
+
+        if (m_Desc.onThreadStop) m_Desc.onThreadStop();
+    }
+
+    void VRenderThread::Consume(VFramePacket& packet)
+    {
+        VE_PROFILE_SCOPE("VRenderThread::Consume");
+
+        const auto start = std::chrono::steady_clock::now();
+        m_Consumer(packet);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // The game thread reads it under the lock
+        if (m_Desc.threaded)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_RenderSeconds += seconds;
+        }
+        else
+        {
+            m_RenderSeconds += seconds;
+        }
+    }
+}
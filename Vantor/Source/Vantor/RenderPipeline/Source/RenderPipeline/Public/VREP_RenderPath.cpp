@@ -14,14 +14,17 @@
 
 #include <RHI/Interface/VRHI_Device.hpp>
 
+#include <Core/Profiler/VCO_Profiler.hpp>
+
 namespace VE::Render {
 
     VRenderPath3D::VRenderPath3D() {}
 
-    void VRenderPath3D::Initialize(VE::Internal::RHI::IRHIDevice *device)
+    void VRenderPath3D::Initialize(VE::Internal::RHI::IRHIDevice *device, const VE::Internal::RenderPipeline::VRenderThreadDesc& threading)
     {
-
-        m_CommandBuffer = std::make_unique<VE::Internal::RenderPipeline::VCommandBuffer>();
+        // The packets own their commands until they are reused, so no frame allocator copies are needed
+        m_RenderThread = std::make_unique<VE::Internal::RenderPipeline::VRenderThread>(
+            [this](VE::Internal::RenderPipeline::VFramePacket& packet) { RenderPacket(packet); }, threading);
 
         m_Device = device;
         SetupDefaultRenderPasses();
@@ -35,7 +38,28 @@ namespace VE::Render {
 
     void VRenderPath3D::Render()
     {
-        m_CommandBuffer->Sort();
+        VE_PROFILE_SCOPE("VRenderPath3D::Render");
+
+        VE::Internal::RenderPipeline::VFramePacket& packet = m_RenderThread->GetWritePacket();
+        packet.HasCamera = m_Camera != nullptr;
+        if (m_Camera)
+        {
+            packet.Camera = VE::Internal::RenderPipeline::VCameraSnapshot::Capture(*m_Camera);
+        }
+        packet.ViewportX      = m_ViewportX;
+        packet.ViewportY      = m_ViewportY;
+        packet.ViewportWidth  = m_ViewportWidth;
+        packet.ViewportHeight = m_ViewportHeight;
+
+        m_RenderThread->Submit();
+    }
+
+    void VRenderPath3D::RenderPacket(VE::Internal::RenderPipeline::VFramePacket& packet)
+    {
+        VE_PROFILE_SCOPE("VRenderPath3D::RenderPacket");
+
+        m_RenderPacket = &packet;
+        packet.Commands.Sort();
 
         // The Geometry Pass
         // auto *geometryPass = GetRenderPass(ERenderPassType::VD_Geometry);
@@ -51,11 +75,14 @@ namespace VE::Render {
             forwardPass->Execute();
         }
 
-        m_CommandBuffer->Clear();
+        m_RenderPacket = nullptr;
     }
 
     void VRenderPath3D::Shutdown()
     {
+        // Stops the render thread before the passes it runs go away
+        m_RenderThread.reset();
+
         for (auto &[type, pass] : m_RenderPasses)
         {
             pass->Cleanup();
@@ -67,7 +94,17 @@ namespace VE::Render {
                                     VMaterial* material, 
                                     const VE::Math::VMat4& transform) 
     {
-        m_CommandBuffer->Push(model, material, transform);
+        m_RenderThread->GetWritePacket().Commands.Push(model, material, transform);
+    }
+
+    void VRenderPath3D::PushPointLight(const VE::Internal::Graphics::VPointLightData& pointLightData)
+    {
+        m_RenderThread->GetWritePacket().PointLights.push_back(pointLightData);
+    }
+
+    void VRenderPath3D::PushDirectionalLight(const VE::Internal::Graphics::VDirectionalLightData& directionalLightData)
+    {
+        m_RenderThread->GetWritePacket().DirectionalLights.push_back(directionalLightData);
     }
 
     void VRenderPath3D::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)